@@ -9,12 +9,17 @@
 #include "mlir/Transforms/DialectConversion.h"
 
 namespace mlir::tt {
+#define GEN_PASS_DECL_CONVERTTTNNTOEMITC
+#include "ttmlir/Conversion/Passes.h.inc"
 
 void populateTTNNToEmitCPatterns(MLIRContext *ctx, RewritePatternSet &patterns,
-                                 TypeConverter &typeConverter);
+                                 TypeConverter &typeConverter, bool optimize);
 
 std::unique_ptr<OperationPass<ModuleOp>> createConvertTTNNToEmitCPass();
 
+std::unique_ptr<OperationPass<ModuleOp>>
+createConvertTTNNToEmitCPass(const ConvertTTNNToEmitCOptions &options);
+
 } // namespace mlir::tt
 
 #endif // TTMLIR_CONVERSION_TTNNTOEMITC_TTNNTOEMITC_H
@@ -23,6 +23,16 @@ inline constexpr char kCreateVectorFunctionName[] = "utilCreateVec";
 //
 bool insertVecCreateFnIfNotExists(PatternRewriter &rewriter, Operation *op);
 
+// Name for the function that moves a variadic number of `ttnn::Tensor`s into a
+// std::vector
+//
+inline constexpr char kMoveVectorFunctionName[] = "utilMoveVec";
+
+// Inserts a function to top of the caller's module that takes in a variadic
+// number of `ttnn::Tensor`s and moves them into a `std::vector`
+//
+bool insertVecMoveFnIfNotExists(PatternRewriter &rewriter, Operation *op);
+
 // Create emitc::OpaqueAttr for ttnn::Shape
 //
 emitc::OpaqueAttr convertShape(Builder &builder, ttnn::ShapeAttr attr);
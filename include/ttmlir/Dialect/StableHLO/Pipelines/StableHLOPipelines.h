@@ -31,6 +31,11 @@ struct AutomaticShardingPipelineOptions
       *this, OptionNames::automaticArgAnalysis,
       llvm::cl::desc("Automatically determine argument shardings.")};
 
+  Option<bool> automaticTensorParallel{
+      *this, OptionNames::automaticTensorParallel,
+      llvm::cl::desc("Search for tensor parallel shardings of matmul weights "
+                     "before falling back to batch parallelism.")};
+
   Option<tt::TTArgumentTypeMap, tt::ArgumentTypeMapParser> argumentTypeMap{
       *this, tt::OptionNames::argumentTypes,
       llvm::cl::desc(
@@ -14,6 +14,8 @@ struct OptionNames {
   static constexpr llvm::StringRef meshShape = "mesh-shape";
   static constexpr llvm::StringRef automaticArgAnalysis =
       "automatic-arg-analysis";
+  static constexpr llvm::StringRef automaticTensorParallel =
+      "automatic-tensor-parallel";
 };
 
 #endif // TTMLIR_ENABLE_STABLEHLO
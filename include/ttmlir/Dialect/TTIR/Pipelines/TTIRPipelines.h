@@ -27,6 +27,11 @@ struct StableHLOToTTIRPipelineOptions
       // This pass will convert stablehlo.composite ops into func.call ops so
       // that the TTIR inliner pass may inline the ops.
       llvm::cl::init(true)};
+  ListOption<int64_t> shapeBucketSizes{
+      *this, "shape-bucket-sizes",
+      llvm::cl::desc("Compile one program per bucket size for every function "
+                     "with dynamic dimensions, e.g. sequence lengths "
+                     "128,256,512,1024.")};
 };
 #endif
 
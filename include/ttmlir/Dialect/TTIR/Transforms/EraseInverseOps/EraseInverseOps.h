@@ -7,6 +7,10 @@
 
 #include "ttmlir/Dialect/TTIR/IR/TTIROps.h"
 #include "ttmlir/Dialect/TTIR/IR/TTIROpsInterfaces.h"
+#include "ttmlir/Dialect/TTIR/Utils/Utils.h"
+#include "ttmlir/Utils.h"
+
+#include "llvm/ADT/Sequence.h"
 
 namespace mlir::tt::ttir {
 
@@ -169,10 +173,68 @@ inline bool checkAllUsersAreIdenticalTms(ArrayRef<Operation *> users) {
   });
 }
 
+// Returns the permutation applied by a transpose or permute op, such that
+// result.shape[i] == input.shape[permutation[i]].
+inline std::optional<SmallVector<int64_t>> getTMPermutation(Operation *op) {
+  if (auto permuteOp = dyn_cast<ttir::PermuteOp>(op)) {
+    return SmallVector<int64_t>(permuteOp.getPermutation());
+  }
+
+  if (auto transposeOp = dyn_cast<ttir::TransposeOp>(op)) {
+    int64_t rank = transposeOp.getInput().getType().getRank();
+    int64_t dim0 = transposeOp.getDim0() < 0 ? transposeOp.getDim0() + rank
+                                             : transposeOp.getDim0();
+    int64_t dim1 = transposeOp.getDim1() < 0 ? transposeOp.getDim1() + rank
+                                             : transposeOp.getDim1();
+    SmallVector<int64_t> permutation(llvm::seq<int64_t>(0, rank));
+    std::swap(permutation[dim0], permutation[dim1]);
+    return permutation;
+  }
+
+  return std::nullopt;
+}
+
+// Creates a TM of the same kind as `tmUser` which applies `permutation` to
+// `operand`. A transpose is only created if `permutation` swaps exactly two
+// dims, otherwise a permute is created.
+inline Value createPermutationTM(PatternRewriter &rewriter, Location loc,
+                                 Operation *tmUser, Value operand,
+                                 ArrayRef<int64_t> permutation) {
+  auto operandType = cast<RankedTensorType>(operand.getType());
+  auto resultType = cast<RankedTensorType>(tmUser->getResult(0).getType());
+  SmallVector<int64_t> newShape =
+      ttmlir::utils::applyPermutation(operandType.getShape(), permutation);
+
+  SmallVector<int64_t> swappedDims;
+  for (int64_t i = 0; i < static_cast<int64_t>(permutation.size()); i++) {
+    if (permutation[i] != i) {
+      swappedDims.push_back(i);
+    }
+  }
+
+  if (isa<ttir::TransposeOp>(tmUser) && swappedDims.size() == 2) {
+    return ttir::utils::createDPSOp<ttir::TransposeOp>(
+        rewriter, loc, newShape, operandType.getElementType(),
+        resultType.getEncoding(), operand, swappedDims[0], swappedDims[1])
+        .getResult();
+  }
+
+  return ttir::utils::createDPSOp<ttir::PermuteOp>(
+             rewriter, loc, newShape, operandType.getElementType(),
+             resultType.getEncoding(), operand, permutation)
+      .getResult();
+}
+
 void populateElementwiseCommutePatterns(MLIRContext *ctx,
                                         RewritePatternSet &patterns);
 void populateBroadcastCommutePatterns(MLIRContext *ctx,
                                       RewritePatternSet &patterns);
+void populateReductionCommutePatterns(MLIRContext *ctx,
+                                      RewritePatternSet &patterns);
+void populateConcatSliceCommutePatterns(MLIRContext *ctx,
+                                        RewritePatternSet &patterns);
+void populateMatmulCommutePatterns(MLIRContext *ctx,
+                                   RewritePatternSet &patterns);
 
 } // namespace mlir::tt::ttir
 
@@ -13,6 +13,7 @@
 #include "llvm/ADT/STLForwardCompat.h"
 #include "llvm/ADT/SmallVector.h"
 
+#include <optional>
 #include <type_traits>
 #include <utility>
 
@@ -239,6 +240,10 @@ mlir::LogicalResult broadcastValue(mlir::PatternRewriter &rewriter,
                                    mlir::Value &output, mlir::Location loc,
                                    bool frontUnsqueeze);
 
+// Returns the value of a splat constant, looking through broadcasts, reshapes
+// and typecasts. Returns nullopt if `value` isn't a splat constant.
+std::optional<float> getConstantValue(mlir::Value value);
+
 template <typename AdaptorT>
 mlir::ValueRange getDpsInputsFromAdaptor(AdaptorT adaptor,
                                          unsigned numDpsInits) {
@@ -27,6 +27,13 @@ struct TTIRToTTMetalBackendPipelineOptions
       llvm::cl::desc(
           "Pass in a system descriptor flatbuffer to compile against."),
       llvm::cl::init("")};
+
+  // Option to fuse producer/consumer generic ops into a single program.
+  //
+  Option<bool> enableGenericOpFusion{
+      *this, "enable-generic-op-fusion",
+      llvm::cl::desc("Fuse compatible consecutive generic ops."),
+      llvm::cl::init(false)};
 };
 
 void createTTIRBufferizationPipeline(OpPassManager &pm);
@@ -259,6 +259,16 @@ public:
   static TTNNOperandsWorkarounds
   createUpdateCacheOpOperandsWorkarounds(RankedTensorType updateIndex);
 
+  // Create workarounds for paged cache op operands.
+  static TTNNOperandsWorkarounds createPagedUpdateCacheOpOperandsWorkarounds();
+  static TTNNOperandsWorkarounds createPagedFillCacheOpOperandsWorkarounds();
+  static TTNNOperandsWorkarounds
+  createPagedScaledDotProductAttentionDecodeOpOperandsWorkarounds();
+
+  // Create workarounds for scaled dot product attention op operands.
+  static TTNNOperandsWorkarounds
+  createScaledDotProductAttentionOpOperandsWorkarounds(bool hasAttentionMask);
+
   // Create workarounds for binary op operands.
   static TTNNOperandsWorkarounds
   createBinaryOpOperandsWorkarounds(mlir::Operation *op);
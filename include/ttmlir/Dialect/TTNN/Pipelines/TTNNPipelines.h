@@ -197,10 +197,51 @@ struct TTIRToTTNNBackendPipelineOptions
       *this, "enable-erase-inverse-ops-pass",
       llvm::cl::desc("Enable erase inverse ops pass."), llvm::cl::init(true)};
 
+  Option<bool> tmPropagationEnabled{
+      *this, "enable-tm-propagation-pass",
+      llvm::cl::desc("Enable whole-function TM propagation pass."),
+      llvm::cl::init(false)};
+
+  Option<std::string> tmPropagationReportPath{
+      *this, "tm-propagation-report-path",
+      llvm::cl::desc("Path of the JSON report written by the TM propagation "
+                     "pass."),
+      llvm::cl::init("")};
+
+  // If this option is greater than zero, matmul and linear weights are stored
+  // in block-float formats as long as the estimated relative error of the
+  // model outputs stays within this budget.
+  Option<double> automaticPrecisionBudget{
+      *this, "automatic-precision-budget",
+      llvm::cl::desc("Accuracy budget of the automatic precision pass. The "
+                     "pass is disabled if zero."),
+      llvm::cl::init(0.0)};
+
+  Option<std::string> automaticPrecisionSensitivityPath{
+      *this, "automatic-precision-sensitivity-path",
+      llvm::cl::desc("Path of a JSON file with measured per-op weight "
+                     "sensitivities for the automatic precision pass."),
+      llvm::cl::init("")};
+
+  Option<std::string> automaticPrecisionReportPath{
+      *this, "automatic-precision-report-path",
+      llvm::cl::desc("Path of the JSON report written by the automatic "
+                     "precision pass."),
+      llvm::cl::init("")};
+
   Option<bool> enableFusing{*this, "enable-fusing-pass",
                             llvm::cl::desc("Enable fusing pass."),
                             llvm::cl::init(false)};
 
+  // If this option is true, reorder ops so that compute independent of CCL
+  // ops is issued while the collectives are in flight.
+  //
+  Option<bool> cclOverlapSchedulingEnabled{
+      *this, "enable-ccl-overlap-scheduling",
+      llvm::cl::desc("Enable compute/communication overlap scheduling of CCL "
+                     "ops."),
+      llvm::cl::init(false)};
+
   Option<tt::TTArgumentTypeMap, tt::ArgumentTypeMapParser> argumentTypeMap{
       *this, tt::OptionNames::argumentTypes,
       llvm::cl::desc(
@@ -229,6 +270,19 @@ struct TTIRToTTNNBackendPipelineOptions
       llvm::cl::desc("Enable const-eval optimization pass."),
       llvm::cl::init(true)};
 
+  // Prepare constant conv2d weights at compile time instead of on the first
+  // run. Requires the optimizer.
+  Option<bool> prepareConv2dWeightsOnHost{
+      *this, "prepare-conv2d-weights-on-host",
+      llvm::cl::desc("Prepare constant conv2d weights at compile time."),
+      llvm::cl::init(false)};
+
+  Option<bool> quantizedDomainFusionEnabled{
+      *this, "enable-quantized-domain-fusion",
+      llvm::cl::desc("Rewrite quantize/dequantize ops around compute ops into "
+                     "integer compute."),
+      llvm::cl::init(false)};
+
   // Option to specify the target bit width for quantized data types.
   Option<uint32_t> quantBitWidth{
       *this, "target-bit-width",
@@ -247,7 +301,14 @@ struct TTIRToEmitCPipelineOptions : public TTIRToTTNNBackendPipelineOptions {};
 // TTIR to EmitC SO pipeline options.
 // Inherit from TTIRToEmitCPipelineOptions to reuse the options.
 //
-struct TTIRToEmitCSOPipelineOptions : public TTIRToEmitCPipelineOptions {};
+struct TTIRToEmitCSOPipelineOptions : public TTIRToEmitCPipelineOptions {
+  Option<bool> optimizeEmitC{
+      *this, "optimize-emitc",
+      llvm::cl::desc("Emit code optimized for repeated calls of the model: "
+                     "const-eval results are cached in a model state and dead "
+                     "tensors are moved instead of copied."),
+      llvm::cl::init(false)};
+};
 
 void createTTNNPipelineTTIRPasses(
     OpPassManager &pm, const TTIRToTTNNBackendPipelineOptions &options);
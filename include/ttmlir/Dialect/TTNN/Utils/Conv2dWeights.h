@@ -0,0 +1,59 @@
+// SPDX-FileCopyrightText: (c) 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef TTMLIR_DIALECT_TTNN_UTILS_CONV2DWEIGHTS_H
+#define TTMLIR_DIALECT_TTNN_UTILS_CONV2DWEIGHTS_H
+
+#include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/SmallVector.h"
+
+#include <cassert>
+#include <cstdint>
+
+namespace mlir::tt::ttnn::utils {
+
+// Host implementation of the weight matrix layout produced by
+// ttnn::prepare_conv_weights for height sharded conv2d with a single group.
+//
+// `weights` are row-major OIHW. The result is the row-major
+// [`rows`, `cols`] matrix holding weights[o][i][kh][kw] at row
+// (kh * KW + kw) * `paddedInChannels` + i and column o. Padding is zero.
+template <typename T>
+llvm::SmallVector<T>
+reorderConv2dWeightsToMatrix(llvm::ArrayRef<T> weights,
+                             llvm::ArrayRef<int64_t> oihwShape,
+                             int64_t paddedInChannels, int64_t rows,
+                             int64_t cols, T zero) {
+  assert(oihwShape.size() == 4 && "Expected OIHW weights");
+  const int64_t outChannels = oihwShape[0];
+  const int64_t inChannels = oihwShape[1];
+  const int64_t kernelHeight = oihwShape[2];
+  const int64_t kernelWidth = oihwShape[3];
+  assert(static_cast<int64_t>(weights.size()) ==
+             outChannels * inChannels * kernelHeight * kernelWidth &&
+         "Weights don't match their shape");
+  assert(paddedInChannels >= inChannels && cols >= outChannels &&
+         rows >= kernelHeight * kernelWidth * paddedInChannels &&
+         "Weight matrix is too small");
+
+  llvm::SmallVector<T> matrix(rows * cols, zero);
+  for (int64_t o = 0; o < outChannels; ++o) {
+    for (int64_t i = 0; i < inChannels; ++i) {
+      for (int64_t kh = 0; kh < kernelHeight; ++kh) {
+        for (int64_t kw = 0; kw < kernelWidth; ++kw) {
+          const int64_t row = (kh * kernelWidth + kw) * paddedInChannels + i;
+          matrix[row * cols + o] =
+              weights[((o * inChannels + i) * kernelHeight + kh) *
+                          kernelWidth +
+                      kw];
+        }
+      }
+    }
+  }
+  return matrix;
+}
+
+} // namespace mlir::tt::ttnn::utils
+
+#endif // TTMLIR_DIALECT_TTNN_UTILS_CONV2DWEIGHTS_H
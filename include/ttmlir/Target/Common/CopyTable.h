@@ -0,0 +1,52 @@
+// SPDX-FileCopyrightText: (c) 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef TTMLIR_TARGET_COMMON_COPYTABLE_H
+#define TTMLIR_TARGET_COMMON_COPYTABLE_H
+
+#include "flatbuffers/reflection.h"
+
+#include <cassert>
+#include <vector>
+
+namespace tt::target {
+
+// Deep copies `table`, a table of type `objectName` in `schema`, into `fbb`.
+// Shared by the compiler and the runtime, which both rebuild binaries around
+// existing programs. Returns a null offset for a null table.
+template <typename T>
+inline ::flatbuffers::Offset<T>
+copyTable(::flatbuffers::FlatBufferBuilder &fbb,
+          const reflection::Schema &schema, const char *objectName,
+          const T *table) {
+  if (!table) {
+    return 0;
+  }
+  const reflection::Object *object = schema.objects()->LookupByKey(objectName);
+  assert(object && "Unknown flatbuffer table");
+  return ::flatbuffers::CopyTable(
+             fbb, schema, *object,
+             *reinterpret_cast<const ::flatbuffers::Table *>(table))
+      .o;
+}
+
+// Copies every table of `tables`, an empty vector for a null one.
+template <typename T>
+inline std::vector<::flatbuffers::Offset<T>>
+copyTables(::flatbuffers::FlatBufferBuilder &fbb,
+           const reflection::Schema &schema, const char *objectName,
+           const ::flatbuffers::Vector<::flatbuffers::Offset<T>> *tables) {
+  std::vector<::flatbuffers::Offset<T>> copies;
+  if (tables) {
+    copies.reserve(tables->size());
+    for (const T *table : *tables) {
+      copies.push_back(copyTable(fbb, schema, objectName, table));
+    }
+  }
+  return copies;
+}
+
+} // namespace tt::target
+
+#endif // TTMLIR_TARGET_COMMON_COPYTABLE_H
@@ -6,14 +6,48 @@
 #define TTMLIR_TARGET_UTILS_FLATBUFFEROBJECTCACHE_H
 
 #include "flatbuffers/flatbuffers.h"
+#include "llvm/ADT/ArrayRef.h"
 #include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/Support/xxhash.h"
+
+#include <memory>
+#include <vector>
 
 namespace mlir::tt {
 
+// Constant payloads deduplicated by content, in order of first insertion. The
+// payloads are owned by the attributes they were taken from.
+struct FlatbufferConstantTable {
+  std::vector<ArrayRef<char>> payloads;
+  DenseMap<uint64_t, SmallVector<uint32_t, 1>> indicesByHash;
+
+  // Returns the index of `data`, adding it if no equal payload was added
+  // before. Lookups of payloads that are already in the table don't modify
+  // it, so they can run concurrently.
+  uint32_t getOrInsert(ArrayRef<char> data) {
+    uint64_t hash = llvm::xxh3_64bits(ArrayRef<uint8_t>(
+        reinterpret_cast<const uint8_t *>(data.data()), data.size()));
+    if (auto it = indicesByHash.find(hash); it != indicesByHash.end()) {
+      for (uint32_t index : it->second) {
+        if (payloads[index] == data) {
+          return index;
+        }
+      }
+    }
+    indicesByHash[hash].push_back(payloads.size());
+    payloads.push_back(data);
+    return payloads.size() - 1;
+  }
+};
+
 struct FlatbufferObjectCache {
   ::flatbuffers::FlatBufferBuilder *fbb;
   DenseMap<const void *, ::flatbuffers::uoffset_t> objectMap;
   uint32_t global_id = 1; // 0 is reserved for null
+  // Shared by the caches of all programs when they are serialized in parallel.
+  std::shared_ptr<FlatbufferConstantTable> constants =
+      std::make_shared<FlatbufferConstantTable>();
 
   FlatbufferObjectCache(::flatbuffers::FlatBufferBuilder *fbb) : fbb(fbb) {}
 
@@ -39,22 +39,21 @@ struct GoldenTensor {
   GoldenTensor() = default;
 };
 
-inline flatbuffers::Offset<::tt::target::MLIR>
-toDebugInfo(::flatbuffers::FlatBufferBuilder &fbb, const std::string &name,
-            ModuleOp module) {
+inline std::string getDebugInfoSource(ModuleOp module) {
   std::string source;
   llvm::raw_string_ostream os(source);
 
   mlir::OpPrintingFlags flags;
   flags.enableDebugInfo(); // Enable the loc dumping
   module->print(os, flags);
-
-  return ::tt::target::CreateMLIRDirect(fbb, name.c_str(), source.c_str());
+  return source;
 }
 
+// `source` is the module printed by getDebugInfoSource, so that the printing
+// can run ahead of serialization.
 inline flatbuffers::Offset<::tt::target::DebugInfo> debugInfoToFlatbuffer(
     flatbuffers::FlatBufferBuilder &fbb, const std::string &name,
-    ModuleOp module,
+    const std::string &source,
     const std::unordered_map<std::string, GoldenTensor> &goldenMap,
     const std::vector<std::pair<std::string, std::string>> &moduleCache,
     const char *cpp = nullptr) {
@@ -84,7 +83,18 @@ inline flatbuffers::Offset<::tt::target::DebugInfo> debugInfoToFlatbuffer(
   }
 
   return ::tt::target::CreateDebugInfoDirect(
-      fbb, toDebugInfo(fbb, name, module), cpp, &moduleCacheList, goldenInfo);
+      fbb, ::tt::target::CreateMLIRDirect(fbb, name.c_str(), source.c_str()),
+      cpp, &moduleCacheList, goldenInfo);
+}
+
+inline flatbuffers::Offset<::tt::target::DebugInfo> debugInfoToFlatbuffer(
+    flatbuffers::FlatBufferBuilder &fbb, const std::string &name,
+    ModuleOp module,
+    const std::unordered_map<std::string, GoldenTensor> &goldenMap,
+    const std::vector<std::pair<std::string, std::string>> &moduleCache,
+    const char *cpp = nullptr) {
+  return debugInfoToFlatbuffer(fbb, name, getDebugInfoSource(module),
+                               goldenMap, moduleCache, cpp);
 }
 
 inline ::tt::target::OOBVal toFlatbuffer(FlatbufferObjectCache &,
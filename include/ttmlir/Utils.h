@@ -28,6 +28,10 @@
 namespace ttmlir::utils {
 
 constexpr inline llvm::StringLiteral g_constEvalAttrName = "const_eval";
+constexpr inline llvm::StringLiteral g_loopRegionAttrName = "loop_region";
+constexpr inline llvm::StringLiteral g_shapeBucketAttrName = "shape_bucket";
+constexpr inline llvm::StringLiteral g_bucketedDimsAttrName =
+    "tt.bucketed_dims";
 
 template <typename T>
 T alignUp(T ptr, T alignment) {
@@ -491,6 +495,31 @@ inline bool isConstEvalFunc(mlir::Operation *op) {
   return false;
 }
 
+// Loop region funcs hold the condition or body of a tt.while op and are only
+// executed by it.
+inline bool isLoopRegionFunc(mlir::Operation *op) {
+  if (auto funcOp = mlir::dyn_cast<mlir::func::FuncOp>(op)) {
+    return funcOp->hasAttr(g_loopRegionAttrName);
+  }
+  return false;
+}
+
+// Const-eval and loop region funcs are only executed by other programs, which
+// own their arguments and pick their layouts.
+inline bool isSubProgramFunc(mlir::Operation *op) {
+  return isConstEvalFunc(op) || isLoopRegionFunc(op);
+}
+
+// Funcs specialized for a shape bucket carry a dictionary with the name of the
+// function they were specialized from and the bucket size. Returns a null
+// attribute for any other op.
+inline mlir::DictionaryAttr getShapeBucket(mlir::Operation *op) {
+  if (auto funcOp = mlir::dyn_cast<mlir::func::FuncOp>(op)) {
+    return funcOp->getAttrOfType<mlir::DictionaryAttr>(g_shapeBucketAttrName);
+  }
+  return nullptr;
+}
+
 template <typename T, typename From>
 T castContainer(const From &value) {
   return T(value.begin(), value.end());
@@ -76,6 +76,7 @@ struct ConvertStableHLOToTTIRPass
     target.addLegalOp<mlir::func::FuncOp>();
     target.addLegalOp<mlir::func::ReturnOp>();
     target.addLegalOp<mlir::func::CallOp>();
+    target.addLegalOp<mlir::tt::WhileOp>();
 
     // For now keep the same type assuming StableHLO ops operate on builtin
     // tensor.
@@ -29,9 +29,11 @@
 #include "mlir/Support/LLVM.h"
 #include "mlir/Support/LogicalResult.h"
 #include "mlir/Transforms/DialectConversion.h"
+#include "mlir/Transforms/RegionUtils.h"
 #include "stablehlo/dialect/StablehloOps.h"
 #include "llvm/ADT/APFloat.h"
 #include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/SetVector.h"
 
 #include <algorithm>
 #include <cmath>
@@ -1980,6 +1982,91 @@ private:
 };
 } // namespace
 
+namespace {
+// Frontends emit paged attention as custom calls to tt kernels, e.g.
+//   stablehlo.custom_call @tt.paged_update_cache(%cache, %input,
+//     %update_index, %page_table)
+// Attributes are passed as strings in `mhlo.frontend_attributes`.
+class StableHLOToTTIRPagedAttentionCustomCallOpConversionPattern
+    : public OpConversionPattern<mlir::stablehlo::CustomCallOp> {
+
+  using OpConversionPattern<mlir::stablehlo::CustomCallOp>::OpConversionPattern;
+
+public:
+  static constexpr llvm::StringLiteral kPagedUpdateCacheTargetName =
+      "tt.paged_update_cache";
+  static constexpr llvm::StringLiteral kPagedFillCacheTargetName =
+      "tt.paged_fill_cache";
+  static constexpr llvm::StringLiteral kPagedSDPADecodeTargetName =
+      "tt.paged_scaled_dot_product_attention_decode";
+
+  LogicalResult
+  matchAndRewrite(mlir::stablehlo::CustomCallOp srcOp,
+                  mlir::stablehlo::CustomCallOp::Adaptor adaptor,
+                  ConversionPatternRewriter &rewriter) const override {
+    StringRef callTargetName = adaptor.getCallTargetName();
+    if (callTargetName != kPagedUpdateCacheTargetName &&
+        callTargetName != kPagedFillCacheTargetName &&
+        callTargetName != kPagedSDPADecodeTargetName) {
+      return failure();
+    }
+
+    if (srcOp->getNumResults() != 1) {
+      return rewriter.notifyMatchFailure(srcOp, "Expected a single result");
+    }
+
+    auto outputType = mlir::cast<RankedTensorType>(
+        getTypeConverter()->convertType(srcOp->getResult(0).getType()));
+    ValueRange inputs = adaptor.getInputs();
+
+    if (callTargetName == kPagedUpdateCacheTargetName) {
+      if (inputs.size() != 4) {
+        return rewriter.notifyMatchFailure(
+            srcOp, "Expected cache, input, update_index and page_table");
+      }
+      // The cache is the DPS init of the TTIR op.
+      rewriter.replaceOpWithNewOp<ttir::PagedUpdateCacheOp>(
+          srcOp, outputType, inputs[0], inputs[1], inputs[2], inputs[3]);
+      return success();
+    }
+
+    if (callTargetName == kPagedFillCacheTargetName) {
+      if (inputs.size() != 4) {
+        return rewriter.notifyMatchFailure(
+            srcOp, "Expected cache, input, page_table and batch_idx");
+      }
+      rewriter.replaceOpWithNewOp<ttir::PagedFillCacheOp>(
+          srcOp, outputType, inputs[0], inputs[1], inputs[2], inputs[3]);
+      return success();
+    }
+
+    if (inputs.size() != 5) {
+      return rewriter.notifyMatchFailure(
+          srcOp, "Expected query, key, value, page_table and cur_pos");
+    }
+
+    FloatAttr scaleAttr;
+    if (auto frontendAttributes = srcOp->getAttrOfType<DictionaryAttr>(
+            "mhlo.frontend_attributes")) {
+      if (auto scale = frontendAttributes.getAs<StringAttr>("scale")) {
+        double scaleValue;
+        if (scale.getValue().getAsDouble(scaleValue)) {
+          return rewriter.notifyMatchFailure(
+              srcOp, "Expected scale to be a floating point number");
+        }
+        scaleAttr = rewriter.getF32FloatAttr(scaleValue);
+      }
+    }
+
+    ttir::utils::replaceOpWithNewDPSOp<
+        ttir::PagedScaledDotProductAttentionDecodeOp>(
+        rewriter, srcOp, outputType, inputs[0], inputs[1], inputs[2],
+        inputs[3], inputs[4], scaleAttr);
+    return success();
+  }
+};
+} // namespace
+
 namespace {
 class StableHLOToTTIRSliceOpConversionPattern
     : public OpConversionPattern<mlir::stablehlo::SliceOp> {
@@ -2252,6 +2339,109 @@ private:
 };
 } // namespace
 
+namespace {
+// Converts stablehlo.while into tt.while. The condition and body regions are
+// outlined into private functions marked with the loop region attribute, so
+// the whole loop can be compiled into programs which the runtime executes
+// without returning to the host between iterations.
+class StableHLOToTTIRWhileOpConversionPattern
+    : public OpConversionPattern<mlir::stablehlo::WhileOp> {
+  using OpConversionPattern<mlir::stablehlo::WhileOp>::OpConversionPattern;
+
+public:
+  LogicalResult
+  matchAndRewrite(mlir::stablehlo::WhileOp srcOp,
+                  mlir::stablehlo::WhileOp::Adaptor adaptor,
+                  ConversionPatternRewriter &rewriter) const override {
+    // Outlined regions can only use the loop-carried values.
+    for (Region *region : srcOp->getRegions()) {
+      llvm::SetVector<Value> capturedValues;
+      getUsedValuesDefinedAbove(*region, capturedValues);
+      if (!capturedValues.empty()) {
+        return rewriter.notifyMatchFailure(
+            srcOp, "Loop regions capturing values defined above the loop are "
+                   "not supported.");
+      }
+    }
+
+    SmallVector<Type> resultTypes;
+    if (failed(getTypeConverter()->convertTypes(srcOp.getResultTypes(),
+                                                resultTypes))) {
+      return rewriter.notifyMatchFailure(srcOp,
+                                         "Failed to convert result types.");
+    }
+
+    auto parentFuncOp = srcOp->getParentOfType<func::FuncOp>();
+    FailureOr<func::FuncOp> condFuncOp =
+        outlineRegion(srcOp.getCond(), parentFuncOp, parentFuncOp, "cond",
+                      resultTypes, rewriter);
+    if (failed(condFuncOp)) {
+      return rewriter.notifyMatchFailure(srcOp,
+                                         "Failed to outline loop condition.");
+    }
+
+    FailureOr<func::FuncOp> bodyFuncOp =
+        outlineRegion(srcOp.getBody(), parentFuncOp, *condFuncOp, "body",
+                      resultTypes, rewriter);
+    if (failed(bodyFuncOp)) {
+      return rewriter.notifyMatchFailure(srcOp, "Failed to outline loop body.");
+    }
+
+    rewriter.replaceOpWithNewOp<mlir::tt::WhileOp>(
+        srcOp, resultTypes, SymbolRefAttr::get(*condFuncOp),
+        SymbolRefAttr::get(*bodyFuncOp), adaptor.getOperands());
+
+    return success();
+  }
+
+private:
+  // Moves `region` into a new private function placed right after
+  // `insertAfter`. The region terminator becomes the function return.
+  FailureOr<func::FuncOp>
+  outlineRegion(Region &region, func::FuncOp parentFuncOp,
+                Operation *insertAfter, StringRef kind, TypeRange inputTypes,
+                ConversionPatternRewriter &rewriter) const {
+    auto moduleOp = parentFuncOp->getParentOfType<ModuleOp>();
+    std::string name;
+    for (unsigned i = 0;; i++) {
+      name = (parentFuncOp.getSymName() + "_while_" + kind + "_" + Twine(i))
+                 .str();
+      if (!moduleOp.lookupSymbol(name)) {
+        break;
+      }
+    }
+
+    Operation *terminator = region.front().getTerminator();
+    SmallVector<Type> resultTypes;
+    if (failed(getTypeConverter()->convertTypes(terminator->getOperandTypes(),
+                                                resultTypes))) {
+      return failure();
+    }
+
+    OpBuilder::InsertionGuard guard(rewriter);
+    rewriter.setInsertionPointAfter(insertAfter);
+    auto funcOp = rewriter.create<func::FuncOp>(
+        region.getLoc(), name,
+        rewriter.getFunctionType(inputTypes, resultTypes));
+    funcOp.setPrivate();
+    funcOp->setAttr(ttmlir::utils::g_loopRegionAttrName,
+                    rewriter.getUnitAttr());
+
+    rewriter.inlineRegionBefore(region, funcOp.getBody(), funcOp.end());
+    if (failed(rewriter.convertRegionTypes(&funcOp.getBody(),
+                                           *getTypeConverter()))) {
+      return failure();
+    }
+
+    rewriter.setInsertionPoint(terminator);
+    rewriter.replaceOpWithNewOp<func::ReturnOp>(terminator,
+                                                terminator->getOperands());
+
+    return funcOp;
+  }
+};
+} // namespace
+
 static void
 addElementwiseUnaryOpsConversionPatterns(MLIRContext *ctx,
                                          RewritePatternSet &patterns,
@@ -2443,6 +2633,13 @@ addLogicalAndBitwiseOpsConversionPatterns(MLIRContext *ctx,
       mlir::tt::ttir::BitwiseNotOp>>(typeConverter, ctx);
 }
 
+static void addPagedAttentionOpsConversionPattern(
+    MLIRContext *ctx, RewritePatternSet &patterns,
+    TypeConverter &typeConverter) {
+  patterns.add<StableHLOToTTIRPagedAttentionCustomCallOpConversionPattern>(
+      typeConverter, ctx);
+}
+
 static void addSliceOpConversionPattern(MLIRContext *ctx,
                                         RewritePatternSet &patterns,
                                         TypeConverter &typeConverter) {
@@ -2489,6 +2686,12 @@ static void addPadOpConversionPattern(MLIRContext *ctx,
   patterns.add<StableHLOToTTIROpPadOpConversionPattern>(typeConverter, ctx);
 }
 
+static void addWhileOpConversionPattern(MLIRContext *ctx,
+                                        RewritePatternSet &patterns,
+                                        TypeConverter &typeConverter) {
+  patterns.add<StableHLOToTTIRWhileOpConversionPattern>(typeConverter, ctx);
+}
+
 namespace mlir::tt {
 
 void populateStableHLOToTTIRPatterns(MLIRContext *ctx,
@@ -2509,6 +2712,7 @@ void populateStableHLOToTTIRPatterns(MLIRContext *ctx,
   addTransposeOpConversionPattern(ctx, patterns, typeConverter);
   addReshapeOpConversionPattern(ctx, patterns, typeConverter);
   addCCLOpsConversionPattern(ctx, patterns, typeConverter);
+  addPagedAttentionOpsConversionPattern(ctx, patterns, typeConverter);
   addLogicalAndBitwiseOpsConversionPatterns(ctx, patterns, typeConverter);
   addSliceOpConversionPattern(ctx, patterns, typeConverter);
   addClampOpConversionPattern(ctx, patterns, typeConverter);
@@ -2517,6 +2721,7 @@ void populateStableHLOToTTIRPatterns(MLIRContext *ctx,
   addScatterOpConversionPatterns(ctx, patterns, typeConverter);
   addReverseOpConversionPattern(ctx, patterns, typeConverter);
   addPadOpConversionPattern(ctx, patterns, typeConverter);
+  addWhileOpConversionPattern(ctx, patterns, typeConverter);
 }
 
 } // namespace mlir::tt
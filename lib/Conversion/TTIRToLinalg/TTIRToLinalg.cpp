@@ -12,6 +12,7 @@
 #include "mlir/Dialect/Linalg/IR/Linalg.h"
 #include "mlir/Dialect/Math/IR/Math.h"
 #include "mlir/Dialect/Tensor/IR/Tensor.h"
+#include "mlir/IR/AffineExpr.h"
 #include "mlir/IR/Attributes.h"
 #include "mlir/IR/BuiltinTypes.h"
 #include "mlir/IR/Types.h"
@@ -21,6 +22,7 @@
 #include "mlir/Transforms/DialectConversion.h"
 #include "llvm/ADT/SmallVector.h"
 
+#include <cmath>
 #include <cstdint>
 
 namespace mlir::tt {
@@ -465,6 +467,439 @@ public:
 };
 } // namespace
 
+namespace {
+// Reference lowering of ttir.scaled_dot_product_attention. Unlike the device
+// kernel it materializes the scores, which is fine for checking fused
+// attention on the CPU. The softmax is spelled out since linalg.softmax isn't
+// lowered yet (#3232).
+class ScaledDotProductAttentionOpConversionPattern
+    : public OpConversionPattern<ttir::ScaledDotProductAttentionOp> {
+public:
+  using OpConversionPattern<
+      ttir::ScaledDotProductAttentionOp>::OpConversionPattern;
+
+  LogicalResult
+  matchAndRewrite(ttir::ScaledDotProductAttentionOp op, OpAdaptor adaptor,
+                  ConversionPatternRewriter &rewriter) const override {
+    Location loc = op.getLoc();
+    MLIRContext *ctx = rewriter.getContext();
+    auto queryType = cast<RankedTensorType>(adaptor.getQuery().getType());
+    auto keyType = cast<RankedTensorType>(adaptor.getKey().getType());
+    auto elementType = dyn_cast<FloatType>(queryType.getElementType());
+    if (!elementType) {
+      return rewriter.notifyMatchFailure(op, "Expected float tensors");
+    }
+
+    const int64_t batch = queryType.getDimSize(0);
+    const int64_t numHeads = queryType.getDimSize(1);
+    const int64_t queryLen = queryType.getDimSize(2);
+    const int64_t headDim = queryType.getDimSize(3);
+    const int64_t keyLen = keyType.getDimSize(2);
+    const int64_t groupSize = numHeads / keyType.getDimSize(1);
+    const float scale = op.getScale()
+                            ? op.getScale()->convertToFloat()
+                            : 1.0f / std::sqrt(static_cast<float>(headDim));
+
+    // Iteration space [batch, head, query, key, head_dim].
+    AffineExpr b, h, i, j, d;
+    bindDims(ctx, b, h, i, j, d);
+    AffineExpr kvHead = h.floorDiv(groupSize);
+    auto map = [&](unsigned numDims, ArrayRef<AffineExpr> exprs) {
+      return AffineMap::get(numDims, 0, exprs, ctx);
+    };
+    const auto parallel = mlir::utils::IteratorType::parallel;
+    const auto reduction = mlir::utils::IteratorType::reduction;
+
+    auto constant = [&](const APFloat &value) -> Value {
+      return rewriter.create<arith::ConstantOp>(
+          loc, rewriter.getFloatAttr(elementType, value));
+    };
+    Value zero = constant(APFloat::getZero(elementType.getFloatSemantics()));
+    Value negInf = constant(
+        APFloat::getInf(elementType.getFloatSemantics(), /*Negative=*/true));
+    APFloat scaleValue(scale);
+    bool losesInfo;
+    scaleValue.convertToFormat(elementType.getFloatSemantics(),
+                               APFloat::rmNearestTiesToEven, &losesInfo);
+    Value scaleConstant = constant(scaleValue);
+
+    auto filled = [&](ArrayRef<int64_t> shape, Value value) -> Value {
+      Value empty = rewriter.create<tensor::EmptyOp>(loc, shape, elementType);
+      return rewriter.create<linalg::FillOp>(loc, value, empty).getResult(0);
+    };
+
+    // scores = query @ key^T * scale + mask, with masked scores set to -inf.
+    SmallVector<int64_t> scoresShape{batch, numHeads, queryLen, keyLen};
+    auto scoresType = RankedTensorType::get(scoresShape, elementType);
+    Value scores =
+        rewriter
+            .create<linalg::GenericOp>(
+                loc, TypeRange{scoresType},
+                ValueRange{adaptor.getQuery(), adaptor.getKey()},
+                ValueRange{filled(scoresShape, zero)},
+                SmallVector<AffineMap>{map(5, {b, h, i, d}),
+                                       map(5, {b, kvHead, j, d}),
+                                       map(5, {b, h, i, j})},
+                SmallVector<mlir::utils::IteratorType>{
+                    parallel, parallel, parallel, parallel, reduction},
+                [&](OpBuilder &builder, Location loc, ValueRange args) {
+                  Value product =
+                      builder.create<arith::MulFOp>(loc, args[0], args[1]);
+                  builder.create<linalg::YieldOp>(
+                      loc, ValueRange{builder.create<arith::AddFOp>(
+                               loc, args[2], product)});
+                })
+            .getResult(0);
+
+    Value mask = adaptor.getAttentionMask();
+    const bool isCausal = op.getIsCausal();
+    if (mask || isCausal || scale != 1.0f) {
+      SmallVector<Value> inputs{scores};
+      SmallVector<AffineMap> maps{map(4, {b, h, i, j})};
+      if (mask) {
+        // The mask is broadcast over heads, and over batch if it has one.
+        auto maskType = cast<RankedTensorType>(mask.getType());
+        AffineExpr maskBatch =
+            maskType.getDimSize(0) == 1 ? getAffineConstantExpr(0, ctx) : b;
+        inputs.push_back(mask);
+        maps.push_back(
+            map(4, {maskBatch, getAffineConstantExpr(0, ctx), i, j}));
+      }
+      maps.push_back(map(4, {b, h, i, j}));
+      scores =
+          rewriter
+              .create<linalg::GenericOp>(
+                  loc, TypeRange{scoresType}, inputs,
+                  ValueRange{rewriter.create<tensor::EmptyOp>(loc, scoresShape,
+                                                              elementType)},
+                  maps, SmallVector<mlir::utils::IteratorType>(4, parallel),
+                  [&](OpBuilder &builder, Location loc, ValueRange args) {
+                    Value score = builder.create<arith::MulFOp>(loc, args[0],
+                                                                scaleConstant);
+                    if (mask) {
+                      score =
+                          builder.create<arith::AddFOp>(loc, score, args[1]);
+                    }
+                    if (isCausal) {
+                      Value isMasked = builder.create<arith::CmpIOp>(
+                          loc, arith::CmpIPredicate::ugt,
+                          builder.create<linalg::IndexOp>(loc, 3),
+                          builder.create<linalg::IndexOp>(loc, 2));
+                      score = builder.create<arith::SelectOp>(loc, isMasked,
+                                                              negInf, score);
+                    }
+                    builder.create<linalg::YieldOp>(loc, score);
+                  })
+              .getResult(0);
+    }
+
+    // Softmax over keys, normalized while multiplying with value.
+    SmallVector<int64_t> rowShape{batch, numHeads, queryLen};
+    SmallVector<AffineMap> rowMaps{map(4, {b, h, i, j}), map(4, {b, h, i})};
+    SmallVector<mlir::utils::IteratorType> rowIterators{parallel, parallel,
+                                                        parallel, reduction};
+    Value rowMax =
+        rewriter
+            .create<linalg::GenericOp>(
+                loc, TypeRange{RankedTensorType::get(rowShape, elementType)},
+                ValueRange{scores}, ValueRange{filled(rowShape, negInf)},
+                rowMaps, rowIterators,
+                [&](OpBuilder &builder, Location loc, ValueRange args) {
+                  builder.create<linalg::YieldOp>(
+                      loc, ValueRange{builder.create<arith::MaximumFOp>(
+                               loc, args[0], args[1])});
+                })
+            .getResult(0);
+    Value exps =
+        rewriter
+            .create<linalg::GenericOp>(
+                loc, TypeRange{scoresType}, ValueRange{scores, rowMax},
+                ValueRange{rewriter.create<tensor::EmptyOp>(loc, scoresShape,
+                                                            elementType)},
+                SmallVector<AffineMap>{map(4, {b, h, i, j}), map(4, {b, h, i}),
+                                       map(4, {b, h, i, j})},
+                SmallVector<mlir::utils::IteratorType>(4, parallel),
+                [&](OpBuilder &builder, Location loc, ValueRange args) {
+                  Value shifted =
+                      builder.create<arith::SubFOp>(loc, args[0], args[1]);
+                  builder.create<linalg::YieldOp>(
+                      loc,
+                      ValueRange{builder.create<math::ExpOp>(loc, shifted)});
+                })
+            .getResult(0);
+    Value rowSum =
+        rewriter
+            .create<linalg::GenericOp>(
+                loc, TypeRange{RankedTensorType::get(rowShape, elementType)},
+                ValueRange{exps}, ValueRange{filled(rowShape, zero)}, rowMaps,
+                rowIterators,
+                [&](OpBuilder &builder, Location loc, ValueRange args) {
+                  builder.create<linalg::YieldOp>(
+                      loc, ValueRange{builder.create<arith::AddFOp>(
+                               loc, args[0], args[1])});
+                })
+            .getResult(0);
+
+    // result = (exps / rowSum) @ value, with the iteration space reusing the
+    // key dim j as the reduction dim.
+    auto resultType = cast<RankedTensorType>(
+        this->getTypeConverter()->convertType(op.getResult().getType()));
+    Value resultInit =
+        rewriter.create<linalg::FillOp>(loc, zero, adaptor.getOutput())
+            .getResult(0);
+    Value result =
+        rewriter
+            .create<linalg::GenericOp>(
+                loc, TypeRange{resultType},
+                ValueRange{exps, rowSum, adaptor.getValue()},
+                ValueRange{resultInit},
+                SmallVector<AffineMap>{
+                    map(5, {b, h, i, j}), map(5, {b, h, i}),
+                    map(5, {b, kvHead, j, d}), map(5, {b, h, i, d})},
+                SmallVector<mlir::utils::IteratorType>{
+                    parallel, parallel, parallel, reduction, parallel},
+                [&](OpBuilder &builder, Location loc, ValueRange args) {
+                  Value probability =
+                      builder.create<arith::DivFOp>(loc, args[0], args[1]);
+                  Value product =
+                      builder.create<arith::MulFOp>(loc, probability, args[2]);
+                  builder.create<linalg::YieldOp>(
+                      loc, ValueRange{builder.create<arith::AddFOp>(
+                               loc, args[3], product)});
+                })
+            .getResult(0);
+
+    rewriter.replaceOp(op, result);
+    return success();
+  }
+};
+} // namespace
+
+namespace {
+// Conversion pattern for elementwise ops without a linalg named op, lowered to
+// a linalg.generic computing `computeScalar` on each element.
+template <typename TTIROpTy, typename OpAdaptor = typename TTIROpTy::Adaptor>
+class ElementwiseGenericOpConversionPattern
+    : public OpConversionPattern<TTIROpTy> {
+public:
+  using OpConversionPattern<TTIROpTy>::OpConversionPattern;
+
+  LogicalResult
+  matchAndRewrite(TTIROpTy op, OpAdaptor adaptor,
+                  ConversionPatternRewriter &rewriter) const override {
+    auto resultType = cast<RankedTensorType>(
+        this->getTypeConverter()->convertType(op.getResult().getType()));
+    if (!isa<FloatType>(resultType.getElementType())) {
+      return rewriter.notifyMatchFailure(op, "Expected float tensors");
+    }
+
+    AffineMap identityMap =
+        rewriter.getMultiDimIdentityMap(resultType.getRank());
+    rewriter.replaceOpWithNewOp<linalg::GenericOp>(
+        op, TypeRange{resultType}, ValueRange{adaptor.getInput()},
+        ValueRange{adaptor.getOutput()},
+        SmallVector<AffineMap>{identityMap, identityMap},
+        SmallVector<mlir::utils::IteratorType>(
+            resultType.getRank(), mlir::utils::IteratorType::parallel),
+        [&](OpBuilder &builder, Location loc, ValueRange args) {
+          builder.create<linalg::YieldOp>(
+              loc, computeScalar(op, builder, loc, args[0]));
+        });
+    return success();
+  }
+
+private:
+  static Value computeScalar(TTIROpTy op, OpBuilder &builder, Location loc,
+                             Value x);
+
+  static Value constant(OpBuilder &builder, Location loc, Type type,
+                        double value) {
+    return builder.create<arith::ConstantOp>(
+        loc, builder.getFloatAttr(type, value));
+  }
+};
+
+// gelu(x) = 0.5 * x * (1 + erf(x / sqrt(2))), or with `approximate`
+// gelu(x) = 0.5 * x * (1 + tanh(sqrt(2 / pi) * (x + 0.044715 * x^3)))
+template <>
+Value ElementwiseGenericOpConversionPattern<ttir::GeluOp>::computeScalar(
+    ttir::GeluOp op, OpBuilder &builder, Location loc, Value x) {
+  Type type = x.getType();
+  Value cdf;
+  if (op.getApproximate()) {
+    Value cube = builder.create<arith::MulFOp>(
+        loc, x, builder.create<arith::MulFOp>(loc, x, x));
+    Value cubic = builder.create<arith::MulFOp>(
+        loc, cube, constant(builder, loc, type, 0.044715));
+    Value inner = builder.create<arith::AddFOp>(loc, x, cubic);
+    cdf = builder.create<math::TanhOp>(
+        loc, builder.create<arith::MulFOp>(
+                 loc, inner, constant(builder, loc, type, 0.7978845608028654)));
+  } else {
+    cdf = builder.create<math::ErfOp>(
+        loc, builder.create<arith::MulFOp>(
+                 loc, x, constant(builder, loc, type, std::sqrt(0.5))));
+  }
+  Value halfX = builder.create<arith::MulFOp>(
+      loc, x, constant(builder, loc, type, 0.5));
+  return builder.create<arith::MulFOp>(
+      loc, halfX,
+      builder.create<arith::AddFOp>(loc, cdf,
+                                    constant(builder, loc, type, 1.0)));
+}
+
+// silu(x) = x / (1 + exp(-x))
+template <>
+Value ElementwiseGenericOpConversionPattern<ttir::SiluOp>::computeScalar(
+    ttir::SiluOp, OpBuilder &builder, Location loc, Value x) {
+  Value exp = builder.create<math::ExpOp>(
+      loc, builder.create<arith::NegFOp>(loc, x));
+  Value denominator = builder.create<arith::AddFOp>(
+      loc, exp, constant(builder, loc, x.getType(), 1.0));
+  return builder.create<arith::DivFOp>(loc, x, denominator);
+}
+
+template <>
+Value ElementwiseGenericOpConversionPattern<ttir::ErfOp>::computeScalar(
+    ttir::ErfOp, OpBuilder &builder, Location loc, Value x) {
+  return builder.create<math::ErfOp>(loc, x);
+}
+} // namespace
+
+namespace {
+// Reference lowering of ttir.rms_norm and ttir.layer_norm. Row statistics are
+// reduced with one linalg.generic each and applied by a final elementwise one.
+template <typename TTIROpTy, typename OpAdaptor = typename TTIROpTy::Adaptor>
+class NormOpConversionPattern : public OpConversionPattern<TTIROpTy> {
+public:
+  using OpConversionPattern<TTIROpTy>::OpConversionPattern;
+
+  LogicalResult
+  matchAndRewrite(TTIROpTy op, OpAdaptor adaptor,
+                  ConversionPatternRewriter &rewriter) const override {
+    constexpr bool isLayerNorm = std::is_same_v<TTIROpTy, ttir::LayerNormOp>;
+    Location loc = op.getLoc();
+    Value input = adaptor.getInput();
+    auto inputType = cast<RankedTensorType>(input.getType());
+    auto elementType = dyn_cast<FloatType>(inputType.getElementType());
+    if (!elementType) {
+      return rewriter.notifyMatchFailure(op, "Expected float tensors");
+    }
+
+    const int64_t rank = inputType.getRank();
+    AffineMap identityMap = rewriter.getMultiDimIdentityMap(rank);
+    AffineMap rowMap = identityMap.dropResult(rank - 1);
+    AffineMap lastDimMap =
+        AffineMap::get(rank, 0, rewriter.getAffineDimExpr(rank - 1));
+    SmallVector<mlir::utils::IteratorType> iterators(
+        rank, mlir::utils::IteratorType::parallel);
+    SmallVector<mlir::utils::IteratorType> rowIterators(iterators);
+    rowIterators.back() = mlir::utils::IteratorType::reduction;
+
+    auto constant = [&](double value) -> Value {
+      return rewriter.create<arith::ConstantOp>(
+          loc, rewriter.getFloatAttr(elementType, value));
+    };
+    Value zero = constant(0.0);
+    Value rowSize = constant(static_cast<double>(inputType.getShape().back()));
+    Value epsilon = constant(op.getEpsilon().convertToDouble());
+
+    // Sums `term(x, rowInputs...)` over the last dim.
+    auto rowType =
+        RankedTensorType::get(inputType.getShape().drop_back(), elementType);
+    auto rowSum =
+        [&](ValueRange rowInputs,
+            function_ref<Value(OpBuilder &, Location, ValueRange)> term) {
+          SmallVector<Value> inputs{input};
+          llvm::append_range(inputs, rowInputs);
+          SmallVector<AffineMap> maps{identityMap};
+          maps.append(rowInputs.size() + 1, rowMap);
+          Value init =
+              rewriter
+                  .create<linalg::FillOp>(
+                      loc, zero,
+                      rewriter.create<tensor::EmptyOp>(
+                          loc, rowType.getShape(), elementType))
+                  .getResult(0);
+          return rewriter
+              .create<linalg::GenericOp>(
+                  loc, TypeRange{rowType}, inputs, ValueRange{init}, maps,
+                  rowIterators,
+                  [&](OpBuilder &builder, Location loc, ValueRange args) {
+                    Value value = term(builder, loc, args.drop_back());
+                    builder.create<linalg::YieldOp>(
+                        loc, ValueRange{builder.create<arith::AddFOp>(
+                                 loc, args.back(), value)});
+                  })
+              .getResult(0);
+        };
+
+    SmallVector<Value> inputs{input};
+    SmallVector<AffineMap> maps{identityMap};
+    if constexpr (isLayerNorm) {
+      Value sum = rowSum({}, [](OpBuilder &, Location, ValueRange args) {
+        return args[0];
+      });
+      Value squaredDeviationSum = rowSum(
+          sum, [&](OpBuilder &builder, Location loc, ValueRange args) {
+            Value mean = builder.create<arith::DivFOp>(loc, args[1], rowSize);
+            Value deviation = builder.create<arith::SubFOp>(loc, args[0], mean);
+            return builder.create<arith::MulFOp>(loc, deviation, deviation)
+                .getResult();
+          });
+      inputs.append({sum, squaredDeviationSum});
+      maps.append(2, rowMap);
+    } else {
+      inputs.push_back(
+          rowSum({}, [](OpBuilder &builder, Location loc, ValueRange args) {
+            return builder.create<arith::MulFOp>(loc, args[0], args[0])
+                .getResult();
+          }));
+      maps.push_back(rowMap);
+    }
+    Value weight = adaptor.getWeight();
+    Value bias = adaptor.getBias();
+    for (Value affine : {weight, bias}) {
+      if (affine) {
+        inputs.push_back(affine);
+        maps.push_back(lastDimMap);
+      }
+    }
+    maps.push_back(identityMap);
+
+    auto resultType = cast<RankedTensorType>(
+        this->getTypeConverter()->convertType(op.getResult().getType()));
+    rewriter.replaceOpWithNewOp<linalg::GenericOp>(
+        op, TypeRange{resultType}, inputs, ValueRange{adaptor.getOutput()},
+        maps, iterators,
+        [&](OpBuilder &builder, Location loc, ValueRange args) {
+          unsigned index = 0;
+          Value normalized = args[index++];
+          if constexpr (isLayerNorm) {
+            Value mean =
+                builder.create<arith::DivFOp>(loc, args[index++], rowSize);
+            normalized = builder.create<arith::SubFOp>(loc, normalized, mean);
+          }
+          Value variance =
+              builder.create<arith::DivFOp>(loc, args[index++], rowSize);
+          Value scale = builder.create<math::RsqrtOp>(
+              loc, builder.create<arith::AddFOp>(loc, variance, epsilon));
+          normalized = builder.create<arith::MulFOp>(loc, normalized, scale);
+          if (weight) {
+            normalized =
+                builder.create<arith::MulFOp>(loc, normalized, args[index++]);
+          }
+          if (bias) {
+            normalized =
+                builder.create<arith::AddFOp>(loc, normalized, args[index++]);
+          }
+          builder.create<linalg::YieldOp>(loc, normalized);
+        });
+    return success();
+  }
+};
+} // namespace
+
 void populateTTIRToLinalgPatterns(MLIRContext *ctx, RewritePatternSet &patterns,
                                   TypeConverter &typeConverter) {
   patterns.add<
@@ -483,11 +918,16 @@ void populateTTIRToLinalgPatterns(MLIRContext *ctx, RewritePatternSet &patterns,
       ElementwiseOpConversionPattern<ttir::TanhOp, linalg::TanhOp>,
       ElementwiseOpConversionPattern<ttir::ReciprocalOp, linalg::ReciprocalOp>,
       ElementwiseOpConversionPattern<ttir::NegOp, linalg::NegFOp>,
+      ElementwiseGenericOpConversionPattern<ttir::GeluOp>,
+      ElementwiseGenericOpConversionPattern<ttir::SiluOp>,
+      ElementwiseGenericOpConversionPattern<ttir::ErfOp>,
+      NormOpConversionPattern<ttir::RMSNormOp>,
+      NormOpConversionPattern<ttir::LayerNormOp>,
       TransposeOpConversionPattern, SoftmaxOpConversionPattern,
       EmptyOpConversionPattern, ReshapeOpConversionPattern,
       PermuteOpConversionPattern, SliceOpConversionPattern,
-      ConcatOpConversionPattern, ConstantOpConversionPattern>(typeConverter,
-                                                              ctx);
+      ConcatOpConversionPattern, ConstantOpConversionPattern,
+      ScaledDotProductAttentionOpConversionPattern>(typeConverter, ctx);
 }
 
 } // namespace mlir::tt
@@ -82,6 +82,29 @@ static Value getLoadIndex(Value tile) {
   return loadOp.getIndices().front();
 }
 
+// Tile ops of a fused compute region form a chain through DST: each op takes
+// the result of the previous one (already in DST index 0) as its first operand
+// and loads any remaining operands from CBs. Walk the chain forward to the
+// store packing its result out of DST.
+static memref::StoreOp getChainTailStore(Operation *op) {
+  do {
+    assert(op->hasOneUse() && "Expected tile op with a single use, failing.");
+    op = *op->user_begin();
+  } while (!mlir::isa<memref::StoreOp>(op));
+  return mlir::cast<memref::StoreOp>(op);
+}
+
+// Walk a DST chain backward to the load feeding the first operand of its head.
+static memref::LoadOp getChainHeadLoad(Operation *op) {
+  Value operand = op->getOperand(0);
+  while (!operand.getDefiningOp<memref::LoadOp>()) {
+    op = operand.getDefiningOp();
+    assert(op && "Expected DST chain to start with a load, failing.");
+    operand = op->getOperand(0);
+  }
+  return operand.getDefiningOp<memref::LoadOp>();
+}
+
 // This function finds the loop variables that are not used in the computation
 // of the copy tile index. These represent the loop variables that loop over the
 // inner dimension of the tensor. They may not be the innermost loops in the IR.
@@ -136,7 +159,7 @@ findInnerTensorDimLoopVars(PatternRewriter &rewriter, memref::LoadOp loadOp) {
   return innerLoopVars;
 }
 
-static void lowerLoadToCopyTile(memref::LoadOp op, bool cbIdxAsDstIdx,
+static void lowerLoadToCopyTile(memref::LoadOp op, int64_t dstIdx,
                                 bool guardFirstCopy,
                                 ConversionPatternRewriter &rewriter) {
   auto index = [&](int64_t value) {
@@ -147,7 +170,6 @@ static void lowerLoadToCopyTile(memref::LoadOp op, bool cbIdxAsDstIdx,
   };
 
   auto cb = rewriter.getRemappedValue(op.getMemref());
-  auto cbType = mlir::cast<ttkernel::CBType>(cb.getType());
   llvm::SmallVector<Value> innerLoopVars =
       findInnerTensorDimLoopVars(rewriter, op);
   // This early return is for the case where guardFirstCopy == true (indicating
@@ -158,9 +180,7 @@ static void lowerLoadToCopyTile(memref::LoadOp op, bool cbIdxAsDstIdx,
   }
   auto copyInit = rewriter.create<ttkernel::CopyTileInitOp>(op.getLoc(), cb);
   auto copyTile = rewriter.create<ttkernel::CopyTileOp>(
-      op.getLoc(), cb, op.getIndices().front(),
-      cbIdxAsDstIdx ? index(static_cast<uint32_t>(cbType.getPort()))
-                    : index(0));
+      op.getLoc(), cb, op.getIndices().front(), index(dstIdx));
   if (guardFirstCopy) {
     Value innerLoopVar = innerLoopVars.pop_back_val();
     Value condition =
@@ -236,10 +256,9 @@ public:
   LogicalResult
   matchAndRewrite(ConcreteOp op, typename ConcreteOp::Adaptor adaptor,
                   ConversionPatternRewriter &rewriter) const final {
-    auto store = mlir::cast<memref::StoreOp>(*op->user_begin());
+    auto store = getChainTailStore(op);
     auto outCB = rewriter.getRemappedValue(store.getMemref());
 
-    assert(op->hasOneUse());
     if constexpr (arity == 1) {
       assert(op->getNumOperands() == 1u);
     } else if constexpr (arity == 2) {
@@ -274,7 +293,7 @@ public:
           /* transpose */ i32(rewriter, op->getLoc(), 0));
       rewriter.setInsertionPoint(mmInitShortOp);
       lowerLoadToCopyTile(
-          adaptor.getC().template getDefiningOp<memref::LoadOp>(), false, true,
+          adaptor.getC().template getDefiningOp<memref::LoadOp>(), 0, true,
           rewriter);
     } else if constexpr (arity == 2) {
       rewriter.create<InitOp>(op->getLoc(), getCB(rewriter, adaptor.getLhs()),
@@ -314,14 +333,27 @@ public:
     Operation *newOp = nullptr;
     Operation *initOp = nullptr;
 
-    auto load =
-        mlir::cast<memref::LoadOp>((*op->operand_begin()).getDefiningOp());
-    auto inCB = rewriter.getRemappedValue(load.getMemref());
-    auto store = mlir::cast<memref::StoreOp>(*op->user_begin());
-    auto outCB = rewriter.getRemappedValue(store.getMemref());
-    assert(inCB.getDefiningOp()->isBeforeInBlock(outCB.getDefiningOp()));
-    rewriter.setInsertionPointAfter(outCB.getDefiningOp());
-    rewriter.create<ttkernel::InitSFPUOp>(op->getLoc(), inCB, outCB);
+    // The head of a DST chain configures the SFPU, later ops of the chain find
+    // their first operand already in DST index 0. A chain headed by an FPU op
+    // configured the unpacker for that op instead, so the first SFPU op after
+    // it configures the SFPU in place.
+    bool isChainHead = static_cast<bool>(
+        op->getOperand(0).template getDefiningOp<memref::LoadOp>());
+    bool followsFPUOp =
+        mlir::isa_and_nonnull<ttir::TileAddOp, ttir::TileMulOp,
+                              ttir::TileMatmulOp>(
+            op->getOperand(0).getDefiningOp());
+    if (isChainHead || followsFPUOp) {
+      auto inCB = rewriter.getRemappedValue(getChainHeadLoad(op).getMemref());
+      auto store = getChainTailStore(op);
+      auto outCB = rewriter.getRemappedValue(store.getMemref());
+      OpBuilder::InsertionGuard guard(rewriter);
+      if (isChainHead) {
+        assert(inCB.getDefiningOp()->isBeforeInBlock(outCB.getDefiningOp()));
+        rewriter.setInsertionPointAfter(outCB.getDefiningOp());
+      }
+      rewriter.create<ttkernel::InitSFPUOp>(op->getLoc(), inCB, outCB);
+    }
 
     if constexpr (arity == 1) {
       initOp = rewriter.create<InitOp>(op->getLoc());
@@ -335,10 +367,10 @@ public:
     }
 
     rewriter.setInsertionPoint(initOp == nullptr ? newOp : initOp);
-    for (int i = 0; i < arity; i++) {
+    for (int i = isChainHead ? 0 : 1; i < arity; i++) {
       lowerLoadToCopyTile(
-          adaptor.getOperands()[i].template getDefiningOp<memref::LoadOp>(),
-          true, false, rewriter);
+          op->getOperand(i).template getDefiningOp<memref::LoadOp>(), i, false,
+          rewriter);
     }
 
     rewriter.eraseOp(op);
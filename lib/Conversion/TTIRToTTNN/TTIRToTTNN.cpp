@@ -450,6 +450,25 @@ public:
 };
 } // namespace
 
+namespace {
+template <typename TTIROpTy, typename TTNNOpTy,
+          typename OpAdaptor = typename TTIROpTy::Adaptor>
+class NormOpConversionPattern : public OpConversionPattern<TTIROpTy> {
+public:
+  using OpConversionPattern<TTIROpTy>::OpConversionPattern;
+
+  LogicalResult
+  matchAndRewrite(TTIROpTy op, OpAdaptor adaptor,
+                  ConversionPatternRewriter &rewriter) const override {
+    rewriter.replaceOpWithNewOp<TTNNOpTy>(
+        op, this->getTypeConverter()->convertType(op.getType()),
+        adaptor.getInput(), adaptor.getWeight(), adaptor.getBias(),
+        adaptor.getEpsilonAttr());
+    return success();
+  }
+};
+} // namespace
+
 namespace {
 class TransposeOpConversionPattern
     : public OpConversionPattern<ttir::TransposeOp> {
@@ -561,6 +580,119 @@ public:
 };
 } // namespace
 
+namespace {
+class PagedUpdateCacheOpConversionPattern
+    : public OpConversionPattern<ttir::PagedUpdateCacheOp> {
+public:
+  using OpConversionPattern<ttir::PagedUpdateCacheOp>::OpConversionPattern;
+
+  LogicalResult
+  matchAndRewrite(ttir::PagedUpdateCacheOp op, OpAdaptor adaptor,
+                  ConversionPatternRewriter &rewriter) const override {
+    // Same as UpdateCacheOp, the TTNN op writes into the cache in-place, so
+    // it has to be the last use of the cache tensor.
+    std::vector<mlir::Operation *> users(op.getCache().getUsers().begin(),
+                                         op.getCache().getUsers().end());
+    if (users.size() != 1) {
+      return rewriter.notifyMatchFailure(
+          op, "PagedUpdateCacheOp must have exactly one user");
+    }
+
+    rewriter.create<ttnn::PagedUpdateCacheOp>(
+        op.getLoc(), adaptor.getCache(), adaptor.getInput(),
+        adaptor.getUpdateIndex(), adaptor.getPageTable());
+
+    rewriter.replaceOp(op, adaptor.getCache());
+    return success();
+  }
+};
+} // namespace
+
+namespace {
+class PagedFillCacheOpConversionPattern
+    : public OpConversionPattern<ttir::PagedFillCacheOp> {
+public:
+  using OpConversionPattern<ttir::PagedFillCacheOp>::OpConversionPattern;
+
+  LogicalResult
+  matchAndRewrite(ttir::PagedFillCacheOp op, OpAdaptor adaptor,
+                  ConversionPatternRewriter &rewriter) const override {
+    // Same as FillCacheOp, the TTNN op writes into the cache in-place, so it
+    // has to be the last use of the cache tensor.
+    std::vector<mlir::Operation *> users(op.getCache().getUsers().begin(),
+                                         op.getCache().getUsers().end());
+    if (users.size() != 1) {
+      return rewriter.notifyMatchFailure(
+          op, "PagedFillCacheOp must have exactly one user");
+    }
+
+    rewriter.create<ttnn::PagedFillCacheOp>(
+        op.getLoc(), adaptor.getCache(), adaptor.getInput(),
+        adaptor.getPageTable(), adaptor.getBatchIdx());
+
+    rewriter.replaceOp(op, adaptor.getCache());
+    return success();
+  }
+};
+} // namespace
+
+namespace {
+class PagedScaledDotProductAttentionDecodeOpConversionPattern
+    : public OpConversionPattern<ttir::PagedScaledDotProductAttentionDecodeOp> {
+public:
+  using OpConversionPattern<
+      ttir::PagedScaledDotProductAttentionDecodeOp>::OpConversionPattern;
+
+  LogicalResult
+  matchAndRewrite(ttir::PagedScaledDotProductAttentionDecodeOp op,
+                  OpAdaptor adaptor,
+                  ConversionPatternRewriter &rewriter) const override {
+    rewriter.replaceOpWithNewOp<ttnn::PagedScaledDotProductAttentionDecodeOp>(
+        op, this->getTypeConverter()->convertType(op.getType()),
+        adaptor.getQuery(), adaptor.getKey(), adaptor.getValue(),
+        adaptor.getPageTable(), adaptor.getCurPos(), adaptor.getScaleAttr());
+    return success();
+  }
+};
+} // namespace
+
+namespace {
+class ScaledDotProductAttentionOpConversionPattern
+    : public OpConversionPattern<ttir::ScaledDotProductAttentionOp> {
+public:
+  using OpConversionPattern<
+      ttir::ScaledDotProductAttentionOp>::OpConversionPattern;
+
+  LogicalResult
+  matchAndRewrite(ttir::ScaledDotProductAttentionOp op, OpAdaptor adaptor,
+                  ConversionPatternRewriter &rewriter) const override {
+    rewriter.replaceOpWithNewOp<ttnn::ScaledDotProductAttentionOp>(
+        op, this->getTypeConverter()->convertType(op.getType()),
+        adaptor.getQuery(), adaptor.getKey(), adaptor.getValue(),
+        adaptor.getAttentionMask(), adaptor.getIsCausalAttr(),
+        adaptor.getScaleAttr());
+    return success();
+  }
+};
+} // namespace
+
+namespace {
+class GeluOpConversionPattern : public OpConversionPattern<ttir::GeluOp> {
+public:
+  using OpConversionPattern<ttir::GeluOp>::OpConversionPattern;
+
+  LogicalResult
+  matchAndRewrite(ttir::GeluOp op, OpAdaptor adaptor,
+                  ConversionPatternRewriter &rewriter) const override {
+    rewriter.replaceOpWithNewOp<ttnn::GeluOp>(
+        op, this->getTypeConverter()->convertType(op.getType()),
+        adaptor.getInput(), /*memory_config=*/nullptr,
+        adaptor.getApproximate());
+    return success();
+  }
+};
+} // namespace
+
 namespace {
 template <typename TTIROpTy, typename TTNNOpTy,
           typename OpAdaptor = typename TTIROpTy::Adaptor>
@@ -870,7 +1002,7 @@ public:
     rewriter.replaceOpWithNewOp<ttnn::LinearOp>(
         op, this->getTypeConverter()->convertType(op.getType()), adaptor.getA(),
         adaptor.getB(), adaptor.getBias(), adaptor.getTransposeA(),
-        adaptor.getTransposeB());
+        adaptor.getTransposeB(), /*activation=*/nullptr);
     return success();
   }
 };
@@ -888,7 +1020,7 @@ public:
     rewriter.replaceOpWithNewOp<ttnn::MatmulOp>(
         op, this->getTypeConverter()->convertType(op.getType()), adaptor.getA(),
         adaptor.getB(), adaptor.getTransposeA(), adaptor.getTransposeB(),
-        nullptr);
+        /*matmul_program_config=*/nullptr, /*activation=*/nullptr);
     return success();
   }
 };
@@ -1637,7 +1769,9 @@ void populateTTIRToTTNNPatterns(MLIRContext *ctx, RewritePatternSet &patterns,
            ElementwiseOpConversionPattern<ttir::MinimumOp, ttnn::MinimumOp>,
            ElementwiseOpConversionPattern<ttir::NegOp, ttnn::NegOp>,
            ElementwiseOpConversionPattern<ttir::ReluOp, ttnn::ReluOp>,
-           ElementwiseOpConversionPattern<ttir::GeluOp, ttnn::GeluOp>,
+           GeluOpConversionPattern,
+           ElementwiseOpConversionPattern<ttir::SiluOp, ttnn::SiluOp>,
+           ElementwiseOpConversionPattern<ttir::ErfOp, ttnn::ErfOp>,
            ElementwiseOpConversionPattern<ttir::SqrtOp, ttnn::SqrtOp>,
            ElementwiseOpConversionPattern<ttir::RsqrtOp, ttnn::RsqrtOp>,
            ElementwiseOpConversionPattern<ttir::SignOp, ttnn::SignOp>,
@@ -1675,6 +1809,8 @@ void populateTTIRToTTNNPatterns(MLIRContext *ctx, RewritePatternSet &patterns,
            CumSumOpConversionPattern,
            RepeatInterleaveOpConversionPattern,
            SoftmaxOpConversionPattern,
+           NormOpConversionPattern<ttir::RMSNormOp, ttnn::RMSNormOp>,
+           NormOpConversionPattern<ttir::LayerNormOp, ttnn::LayerNormOp>,
            TransposeOpConversionPattern,
            TypecastOpConversionPattern,
            ClampOpConversionPattern<ttir::ClampScalarOp, ttnn::ClampScalarOp>,
@@ -1698,6 +1834,10 @@ void populateTTIRToTTNNPatterns(MLIRContext *ctx, RewritePatternSet &patterns,
            ArangeOpConversionPattern,
            UpdateCacheOpConversionPattern,
            FillCacheOpConversionPattern,
+           PagedUpdateCacheOpConversionPattern,
+           PagedFillCacheOpConversionPattern,
+           PagedScaledDotProductAttentionDecodeOpConversionPattern,
+           ScaledDotProductAttentionOpConversionPattern,
            ScatterOpConversionPattern,
            PermuteOpConversionPattern,
            UpsampleOpConversionPattern
@@ -10,6 +10,7 @@
 #include "ttmlir/Dialect/TTNN/IR/TTNN.h"
 #include "ttmlir/Dialect/TTNN/IR/TTNNOps.h"
 #include "ttmlir/Dialect/TTNN/IR/TTNNOpsAttrs.h"
+#include "ttmlir/Utils.h"
 
 #include "mlir/Dialect/Arith/IR/Arith.h"
 #include "mlir/Dialect/EmitC/IR/EmitC.h"
@@ -22,6 +23,7 @@
 #include "mlir/IR/BuiltinTypes.h"
 #include "mlir/IR/MLIRContext.h"
 #include "mlir/IR/PatternMatch.h"
+#include "mlir/IR/SymbolTable.h"
 #include "mlir/IR/Value.h"
 #include "mlir/IR/ValueRange.h"
 #include "mlir/Pass/Pass.h"
@@ -151,7 +153,8 @@ public:
 // EltwiseUnaryWithFastAndApproximateModeOp conversion pattern
 //
 // Currently, it has to insert nullopts for some parameters that are not
-// modelled in the dialect (parameter, memcfg).
+// modelled in the dialect (memcfg). The fast and approximate mode is only
+// modelled for gelu.
 //
 namespace {
 template <typename SourceOp>
@@ -169,9 +172,14 @@ public:
 
     ttnn_to_emitc::EmitCTTNNEmitter<SourceOp> emitter(srcOp, adaptor, rewriter);
 
+    bool fastAndApproximateMode = false;
+    if constexpr (std::is_same_v<SourceOp, tt::ttnn::GeluOp>) {
+      fastAndApproximateMode = srcOp.getApproximate();
+    }
+
     llvm::SmallVector<mlir::Attribute> args{
         emitter.emit(srcOp.getInput()),
-        /*parameter=*/emitter.emit(false),
+        /*parameter=*/emitter.emit(fastAndApproximateMode),
         emitter.emit(std::nullopt) | emitter.getMemoryConfig(srcOp.getResult()),
     };
 
@@ -493,6 +501,9 @@ public:
         emitter.emit(srcOp.getTransposeA()),
         emitter.emit(srcOp.getTransposeB()),
         emitter.emit(std::nullopt) | emitter.getMemoryConfig(srcOp.getResult()),
+        /*dtype=*/emitter.emit(std::nullopt),
+        /*program_config=*/emitter.emit(std::nullopt),
+        emitter.emit(srcOp.getActivation()),
     };
 
     emitter.replaceOp(*this, args);
@@ -527,6 +538,9 @@ public:
         emitter.emit(srcOp.getTransposeA()),
         emitter.emit(srcOp.getTransposeB()),
         emitter.emit(std::nullopt) | emitter.getMemoryConfig(srcOp.getResult()),
+        /*dtype=*/emitter.emit(std::nullopt),
+        /*program_config=*/emitter.emit(std::nullopt),
+        emitter.emit(srcOp.getActivation()),
     };
     // ANCHOR_END: adding_an_op_matmul_ttnn_to_emitc_array_attrs
 
@@ -701,6 +715,39 @@ public:
 };
 } // namespace
 
+// RMSNorm and LayerNorm op conversion pattern
+//
+namespace {
+template <typename NormOp>
+class NormOpConversionPattern
+    : public TTNNToEmitCBaseOpConversionPattern<NormOp> {
+
+public:
+  using TTNNToEmitCBaseOpConversionPattern<
+      NormOp>::TTNNToEmitCBaseOpConversionPattern;
+
+  LogicalResult
+  matchAndRewrite(NormOp srcOp, typename NormOp::Adaptor adaptor,
+                  ConversionPatternRewriter &rewriter) const override {
+
+    ttnn_to_emitc::EmitCTTNNEmitter<NormOp> emitter(srcOp, adaptor, rewriter);
+
+    llvm::SmallVector<mlir::Attribute> args{
+        emitter.emit(srcOp.getInput()),
+        emitter.emit(srcOp.getEpsilon()),
+        emitter.emit(srcOp.getWeight()),
+        emitter.emit(srcOp.getBias()),
+        /*residual_input_tensor=*/emitter.emit(std::nullopt),
+        emitter.emit(std::nullopt) | emitter.getMemoryConfig(srcOp.getResult()),
+    };
+
+    emitter.replaceOp(*this, args);
+
+    return success();
+  }
+};
+} // namespace
+
 // Embedding op conversion pattern
 //
 namespace {
@@ -1563,7 +1610,10 @@ namespace {
 class TupleOpConversionPattern : public OpConversionPattern<tt::TupleOp> {
 
 public:
-  using OpConversionPattern::OpConversionPattern;
+  TupleOpConversionPattern(const TypeConverter &typeConverter,
+                           MLIRContext *context, bool moveDeadOperands)
+      : OpConversionPattern<tt::TupleOp>(typeConverter, context),
+        moveDeadOperands(moveDeadOperands) {}
 
   LogicalResult
   matchAndRewrite(tt::TupleOp tupleOp, tt::TupleOp::Adaptor adaptor,
@@ -1572,6 +1622,21 @@ public:
     // we need to create a utility function that does this. This is achieved
     // by using EmitC's VerbatimOp.
 
+    // If the tuple is the only user of all of its operands, they are dead
+    // after it and can be moved into the vector instead of copied.
+    //
+    if (moveDeadOperands &&
+        llvm::all_of(tupleOp.getOperands(),
+                     [](Value operand) { return operand.hasOneUse(); })) {
+      tt::ttnn_to_emitc::utils::insertVecMoveFnIfNotExists(rewriter, tupleOp);
+
+      rewriter.replaceOpWithNewOp<emitc::CallOpaqueOp>(
+          tupleOp, this->getTypeConverter()->convertType(tupleOp.getType()),
+          tt::ttnn_to_emitc::utils::kMoveVectorFunctionName, nullptr, nullptr,
+          adaptor.getOperands());
+      return success();
+    }
+
     // Try to find if utility vec creation function is already defined in the
     // module. If not, insert it.
     //
@@ -1583,6 +1648,9 @@ public:
         adaptor.getOperands());
     return success();
   }
+
+private:
+  bool moveDeadOperands;
 };
 } // namespace
 
@@ -1711,6 +1779,141 @@ public:
 };
 } // namespace
 
+// LoadCached Op conversion pattern used in optimized mode
+//
+// All const-eval results of the module are kept in a single static
+// ttnn::ModelState, in a cache per const-eval function. The cache recomputes
+// the results when the inputs or the device change, and each result is read
+// directly from the cache.
+//
+namespace {
+class OptimizedLoadCachedOpConversionPattern
+    : public OpConversionPattern<tt::LoadCachedOp> {
+
+public:
+  using OpConversionPattern<tt::LoadCachedOp>::OpConversionPattern;
+
+  LogicalResult
+  matchAndRewrite(tt::LoadCachedOp srcOp, tt::LoadCachedOp::Adaptor adaptor,
+                  ConversionPatternRewriter &rewriter) const override {
+    static constexpr char kModelStateName[] = "g_model_state";
+
+    llvm::StringRef callee = srcOp.getCallee();
+    auto funcOp = srcOp->getParentOfType<func::FuncOp>();
+    auto moduleOp = funcOp->getParentOfType<ModuleOp>();
+
+    // Caches are indexed by the position of the callee among the const-eval
+    // functions of the module.
+    //
+    size_t slot = 0;
+    bool calleeFound = false;
+    for (auto constEvalFuncOp : moduleOp.getOps<func::FuncOp>()) {
+      if (constEvalFuncOp.getSymName() == callee) {
+        calleeFound = true;
+        break;
+      }
+      if (ttmlir::utils::isConstEvalFunc(constEvalFuncOp)) {
+        ++slot;
+      }
+    }
+    if (!calleeFound) {
+      return rewriter.notifyMatchFailure(srcOp, "callee not found in module");
+    }
+
+    tt::ttnn_to_emitc::utils::insertVecCreateFnIfNotExists(rewriter, srcOp);
+
+    auto modelStateType =
+        emitc::OpaqueType::get(rewriter.getContext(), "::ttnn::ModelState");
+    auto tupleType = emitc::OpaqueType::get(rewriter.getContext(),
+                                            "::std::vector<::ttnn::Tensor>");
+    auto tensorType =
+        emitc::OpaqueType::get(rewriter.getContext(), "::ttnn::Tensor");
+
+    // Insert the model state before the first function that uses it, after
+    // the header include.
+    //
+    if (!SymbolTable::lookupSymbolIn(moduleOp, kModelStateName)) {
+      OpBuilder::InsertionGuard guard(rewriter);
+      rewriter.setInsertionPoint(funcOp);
+      rewriter.create<emitc::GlobalOp>(
+          srcOp.getLoc(), rewriter.getStringAttr(kModelStateName),
+          TypeAttr::get(modelStateType),
+          /*initialValue=*/nullptr,
+          /*extern_specifier=*/UnitAttr(),
+          /*static_specifier=*/rewriter.getUnitAttr(),
+          /*const_specifier=*/UnitAttr());
+    }
+
+    auto funcPtrType = emitc::OpaqueType::get(
+        rewriter.getContext(), "::std::function<::std::vector<::ttnn::Tensor>(:"
+                               ":std::vector<::ttnn::Tensor>)>");
+    auto funcPtrValue = rewriter.create<emitc::ConstantOp>(
+        srcOp.getLoc(), funcPtrType,
+        emitc::OpaqueAttr::get(rewriter.getContext(), "&" + callee.str()));
+
+    Value inputs =
+        rewriter
+            .create<emitc::CallOpaqueOp>(
+                srcOp.getLoc(), tupleType,
+                tt::ttnn_to_emitc::utils::kCreateVectorFunctionName, nullptr,
+                nullptr, adaptor.getInputs())
+            .getResult(0);
+
+    auto modelState = rewriter.create<emitc::GetGlobalOp>(
+        srcOp.getLoc(), emitc::LValueType::get(modelStateType),
+        SymbolRefAttr::get(rewriter.getContext(), kModelStateName));
+    Value modelStatePtr = rewriter.create<emitc::ApplyOp>(
+        srcOp.getLoc(),
+        emitc::PointerType::get(rewriter.getContext(), modelStateType), "&",
+        modelState);
+
+    Value slotValue = rewriter.create<emitc::LiteralOp>(
+        srcOp.getLoc(), rewriter.getIndexType(), std::to_string(slot));
+
+    rewriter.create<emitc::CallOpaqueOp>(
+        srcOp.getLoc(), TypeRange{}, "::ttnn::constEvalFuncWrapper",
+        ValueRange{funcPtrValue, inputs, modelStatePtr, slotValue,
+                   getDevice(funcOp, srcOp.getLoc(), rewriter)},
+        ArrayAttr{});
+
+    SmallVector<Value> results;
+    for (unsigned i = 0; i < srcOp.getNumResults(); ++i) {
+      Value indexValue = rewriter.create<emitc::LiteralOp>(
+          srcOp.getLoc(), rewriter.getIndexType(), std::to_string(i));
+      results.push_back(
+          rewriter
+              .create<emitc::CallOpaqueOp>(
+                  srcOp.getLoc(), tensorType, "::ttnn::getConstEvalResult",
+                  ValueRange{modelStatePtr, slotValue, indexValue}, ArrayAttr{})
+              .getResult(0));
+    }
+
+    rewriter.replaceOp(srcOp, results);
+
+    return success();
+  }
+
+private:
+  // Returns the device argument of the function, added by the dylib signature
+  // modification, or nullptr if the function doesn't take a device.
+  //
+  static Value getDevice(func::FuncOp funcOp, Location loc,
+                         ConversionPatternRewriter &rewriter) {
+    for (BlockArgument arg : funcOp.getArguments()) {
+      if (mlir::isa<tt::ttnn::DeviceType, emitc::PointerType>(arg.getType())) {
+        return rewriter.getRemappedValue(arg);
+      }
+    }
+
+    return rewriter.create<emitc::ConstantOp>(
+        loc,
+        emitc::PointerType::get(emitc::OpaqueType::get(
+            rewriter.getContext(), "ttnn::distributed::MeshDevice")),
+        emitc::OpaqueAttr::get(rewriter.getContext(), "nullptr"));
+  }
+};
+} // namespace
+
 // Module Op conversion pattern
 //
 // This conversion pattern removes attributes from the ModuleOp. Previously,
@@ -1934,7 +2137,7 @@ namespace mlir::tt {
 // ANCHOR: op_rewriter_pattern_set_emitc
 void populateTTNNToEmitCPatterns(mlir::MLIRContext *ctx,
                                  mlir::RewritePatternSet &patterns,
-                                 TypeConverter &typeConverter) {
+                                 TypeConverter &typeConverter, bool optimize) {
   // Device ops
   //
   patterns.add<TTDeviceOpConversionPattern>(typeConverter, ctx);
@@ -1980,6 +2183,9 @@ void populateTTNNToEmitCPatterns(mlir::MLIRContext *ctx,
                tt::ttnn::LeakyReluOp>,
            EltwiseUnaryWithFastAndApproximateModeOpConversionPattern<
                tt::ttnn::GeluOp>,
+           EltwiseUnaryOpConversionPattern<tt::ttnn::SiluOp>,
+           EltwiseUnaryWithFastAndApproximateModeOpConversionPattern<
+               tt::ttnn::ErfOp>,
            EltwiseUnaryOpConversionPattern<tt::ttnn::SqrtOp>,
            EltwiseUnaryWithFastAndApproximateModeOpConversionPattern<
                tt::ttnn::RsqrtOp>,
@@ -2078,6 +2284,9 @@ void populateTTNNToEmitCPatterns(mlir::MLIRContext *ctx,
   patterns.add<SoftmaxOpConversionPattern, EmbeddingOpConversionPattern,
                DefaultOpConversionPattern<tt::ttnn::EmbeddingBackwardOp>,
                MorehCumSumOpConversionPattern>(typeConverter, ctx);
+  patterns.add<NormOpConversionPattern<tt::ttnn::RMSNormOp>,
+               NormOpConversionPattern<tt::ttnn::LayerNormOp>>(typeConverter,
+                                                                ctx);
 
   // CCL ops
   //
@@ -2100,11 +2309,15 @@ void populateTTNNToEmitCPatterns(mlir::MLIRContext *ctx,
   // Tuple ops
   //
   patterns.add<GetTupleElementOpConversionPattern>(typeConverter, ctx);
-  patterns.add<TupleOpConversionPattern>(typeConverter, ctx);
+  patterns.add<TupleOpConversionPattern>(typeConverter, ctx, optimize);
 
   // LoadCached op
   //
-  patterns.add<LoadCachedOpConversionPattern>(typeConverter, ctx);
+  if (optimize) {
+    patterns.add<OptimizedLoadCachedOpConversionPattern>(typeConverter, ctx);
+  } else {
+    patterns.add<LoadCachedOpConversionPattern>(typeConverter, ctx);
+  }
 
   // Module op
   //
@@ -54,6 +54,9 @@ public:
 
 struct ConvertTTNNToEmitCPass
     : public tt::ttnn::impl::ConvertTTNNToEmitCBase<ConvertTTNNToEmitCPass> {
+  using tt::ttnn::impl::ConvertTTNNToEmitCBase<
+      ConvertTTNNToEmitCPass>::ConvertTTNNToEmitCBase;
+
   void runOnOperation() override {
     mlir::ModuleOp module = getOperation();
     // Only run conversion on top-level moduleOp.
@@ -128,7 +131,8 @@ struct ConvertTTNNToEmitCPass
 
       // TTNN -> EmitC patterns
       //
-      populateTTNNToEmitCPatterns(&getContext(), patterns, typeConverter);
+      populateTTNNToEmitCPatterns(&getContext(), patterns, typeConverter,
+                                  optimize);
 
       // Apply conversion
       //
@@ -148,4 +152,9 @@ std::unique_ptr<OperationPass<ModuleOp>> createConvertTTNNToEmitCPass() {
   return std::make_unique<ConvertTTNNToEmitCPass>();
 }
 
+std::unique_ptr<OperationPass<ModuleOp>>
+createConvertTTNNToEmitCPass(const ConvertTTNNToEmitCOptions &options) {
+  return std::make_unique<ConvertTTNNToEmitCPass>(options);
+}
+
 } // namespace mlir::tt
@@ -26,42 +26,64 @@ mlir::ModuleOp getParentModule(mlir::Operation *op) {
   return nullptr;
 }
 
-// The func::FuncOp is inserted by creating an emitc::VerbatimOp with the
-// function definition and inserting it at the start of the module.
+// The verbatim is inserted at the start of the module, unless the module
+// already contains it.
 //
-bool insertVecCreateFnIfNotExists(PatternRewriter &rewriter, Operation *op) {
+static bool insertVerbatimIfNotExists(PatternRewriter &rewriter, Operation *op,
+                                      llvm::StringRef verbatim) {
   ModuleOp moduleOp = getParentModule(op);
   assert(op && "Could not find top-level module");
 
-  static constexpr const char *vecCreateFnAsStr = R"(
-template <typename... T>
-std::vector<ttnn::Tensor> utilCreateVec(T &&...t) {
-  return std::vector<ttnn::Tensor>{std::forward<T>(t)...};
-}
-)";
-
   for (auto &currOp : moduleOp.getOps()) {
     if (auto verbatimOp = dyn_cast<emitc::VerbatimOp>(currOp)) {
-      // Check if value of the VerbatimOp is the vecCreateFnAsStr - if so, it
-      // means that the util vec function has already been added to the module
-      //
-      if (verbatimOp.getValue() == vecCreateFnAsStr) {
+      if (verbatimOp.getValue() == verbatim) {
         return false;
       }
     }
   }
 
-  // Set insertion to start of module, add the func there, and restore the
+  // Set insertion to start of module, add the verbatim there, and restore the
   // insertion point
   //
   auto currentInsertionPoint = rewriter.saveInsertionPoint();
   rewriter.setInsertionPointToStart(moduleOp.getBody(0));
-  rewriter.create<emitc::VerbatimOp>(op->getLoc(), vecCreateFnAsStr);
+  rewriter.create<emitc::VerbatimOp>(op->getLoc(), verbatim);
   rewriter.restoreInsertionPoint(currentInsertionPoint);
 
   return true;
 }
 
+// The func::FuncOp is inserted by creating an emitc::VerbatimOp with the
+// function definition and inserting it at the start of the module.
+//
+bool insertVecCreateFnIfNotExists(PatternRewriter &rewriter, Operation *op) {
+  static constexpr const char *vecCreateFnAsStr = R"(
+template <typename... T>
+std::vector<ttnn::Tensor> utilCreateVec(T &&...t) {
+  return std::vector<ttnn::Tensor>{std::forward<T>(t)...};
+}
+)";
+
+  return insertVerbatimIfNotExists(rewriter, op, vecCreateFnAsStr);
+}
+
+// Elements of an initializer list can't be moved from, so the tensors are
+// pushed into the vector one by one.
+//
+bool insertVecMoveFnIfNotExists(PatternRewriter &rewriter, Operation *op) {
+  static constexpr const char *vecMoveFnAsStr = R"(
+template <typename... T>
+std::vector<ttnn::Tensor> utilMoveVec(T &&...t) {
+  std::vector<ttnn::Tensor> vec;
+  vec.reserve(sizeof...(t));
+  (vec.push_back(std::move(t)), ...);
+  return vec;
+}
+)";
+
+  return insertVerbatimIfNotExists(rewriter, op, vecMoveFnAsStr);
+}
+
 emitc::OpaqueAttr convertShape(Builder &builder, ttnn::ShapeAttr attr) {
   llvm::ArrayRef shape = attr.getShape();
   std::string buf;
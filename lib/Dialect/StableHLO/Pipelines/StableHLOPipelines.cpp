@@ -38,6 +38,8 @@ void createAutomaticShardingPipeline(
   shardyAnnotateArgumentsOptions.meshShape = llvm::to_vector(options.meshShape);
   shardyAnnotateArgumentsOptions.automaticArgAnalysis =
       options.automaticArgAnalysis;
+  shardyAnnotateArgumentsOptions.automaticTensorParallel =
+      options.automaticTensorParallel;
   pm.addPass(createShardyAnnotateArgumentsPass(shardyAnnotateArgumentsOptions));
 
   // Propagate tensor shardings through the entire graph.
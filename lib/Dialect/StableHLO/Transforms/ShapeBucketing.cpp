@@ -0,0 +1,175 @@
+// SPDX-FileCopyrightText: (c) 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "ttmlir/Dialect/StableHLO/Transforms/Passes.h"
+#include "ttmlir/Utils.h"
+
+#include "mlir/Dialect/Func/IR/FuncOps.h"
+#include "mlir/IR/Builders.h"
+#include "mlir/IR/BuiltinOps.h"
+#include "mlir/IR/BuiltinTypes.h"
+#include "mlir/IR/PatternMatch.h"
+#include "mlir/Transforms/GreedyPatternRewriteDriver.h"
+#include "stablehlo/transforms/StablehloRefineShapes.h"
+#include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/SmallVector.h"
+
+namespace mlir::tt::stablehlo {
+#define GEN_PASS_DEF_SHAPEBUCKETINGPASS
+#include "ttmlir/Dialect/StableHLO/Transforms/Passes.h.inc"
+
+// Returns the indices of the dynamic dims of `type`.
+static llvm::SmallVector<int64_t> getDynamicDims(Type type) {
+  llvm::SmallVector<int64_t> dims;
+  auto tensorType = mlir::dyn_cast<RankedTensorType>(type);
+  if (!tensorType) {
+    return dims;
+  }
+  for (auto [dim, size] : llvm::enumerate(tensorType.getShape())) {
+    if (ShapedType::isDynamic(size)) {
+      dims.push_back(dim);
+    }
+  }
+  return dims;
+}
+
+static bool hasDynamicDims(TypeRange types) {
+  return llvm::any_of(types,
+                      [](Type type) { return !getDynamicDims(type).empty(); });
+}
+
+namespace {
+class ShapeBucketingPass
+    : public impl::ShapeBucketingPassBase<ShapeBucketingPass> {
+public:
+  using impl::ShapeBucketingPassBase<
+      ShapeBucketingPass>::ShapeBucketingPassBase;
+
+  void runOnOperation() final {
+    mlir::ModuleOp rootModule = getOperation();
+
+    llvm::SmallVector<int64_t> sizes(bucketSizes.begin(), bucketSizes.end());
+    llvm::sort(sizes);
+    sizes.erase(llvm::unique(sizes), sizes.end());
+    if (sizes.empty()) {
+      return;
+    }
+    if (sizes.front() <= 0) {
+      rootModule.emitError("Shape bucket sizes must be positive.\n");
+      signalPassFailure();
+      return;
+    }
+
+    llvm::SmallVector<func::FuncOp> dynamicFuncs;
+    for (auto funcOp : rootModule.getOps<func::FuncOp>()) {
+      if (funcOp.isPublic() && !funcOp.isDeclaration() &&
+          hasDynamicDims(funcOp.getArgumentTypes())) {
+        dynamicFuncs.push_back(funcOp);
+      }
+    }
+
+    RewritePatternSet patterns(&getContext());
+    ::mlir::stablehlo::populateStablehloRefineShapesPatterns(&patterns,
+                                                             &getContext());
+    FrozenRewritePatternSet refinePatterns(std::move(patterns));
+
+    for (func::FuncOp funcOp : dynamicFuncs) {
+      Operation *insertAfter = funcOp;
+      for (int64_t size : sizes) {
+        func::FuncOp bucketFuncOp =
+            createBucketFunction(funcOp, size, refinePatterns);
+        if (!bucketFuncOp) {
+          signalPassFailure();
+          return;
+        }
+        bucketFuncOp->moveAfter(insertAfter);
+        insertAfter = bucketFuncOp;
+      }
+      funcOp.erase();
+    }
+  }
+
+private:
+  // Clones `funcOp` with all dynamic dims set to `size` and refines the shapes
+  // of its body. Returns a null func on failure.
+  func::FuncOp createBucketFunction(func::FuncOp funcOp, int64_t size,
+                                    const FrozenRewritePatternSet &patterns) {
+    MLIRContext *context = &getContext();
+    mlir::OpBuilder builder(context);
+
+    builder.setInsertionPointAfter(funcOp);
+    auto bucketFuncOp = mlir::cast<func::FuncOp>(builder.clone(*funcOp));
+    bucketFuncOp.setSymName(
+        (funcOp.getSymName() + "_bucket_" + llvm::Twine(size)).str());
+
+    llvm::SmallVector<Type> refinedTypes;
+    for (Type type : funcOp.getArgumentTypes()) {
+      auto tensorType = mlir::dyn_cast<RankedTensorType>(type);
+      if (!tensorType) {
+        refinedTypes.push_back(type);
+        continue;
+      }
+      llvm::SmallVector<int64_t> shape(tensorType.getShape());
+      for (int64_t dim : getDynamicDims(tensorType)) {
+        shape[dim] = size;
+      }
+      refinedTypes.push_back(tensorType.clone(shape));
+    }
+
+    if (failed(::mlir::stablehlo::refineArguments(bucketFuncOp,
+                                                  refinedTypes)) ||
+        failed(applyPatternsGreedily(bucketFuncOp, patterns))) {
+      funcOp.emitError("Failed to refine shapes of function ")
+          << funcOp.getSymName() << " for bucket size " << size << ".\n";
+      bucketFuncOp.erase();
+      return nullptr;
+    }
+
+    bool isStatic = true;
+    bucketFuncOp.walk([&](Operation *op) {
+      for (Type type : op->getResultTypes()) {
+        if (auto shapedType = mlir::dyn_cast<ShapedType>(type);
+            shapedType && !shapedType.hasStaticShape()) {
+          isStatic = false;
+        }
+      }
+    });
+    if (!isStatic || hasDynamicDims(bucketFuncOp.getResultTypes())) {
+      funcOp.emitError("Function ")
+          << funcOp.getSymName()
+          << " still has dynamic shapes after refining it for bucket size "
+          << size << ".\n";
+      bucketFuncOp.erase();
+      return nullptr;
+    }
+
+    // Record which dims of the arguments and results are bucketed, so the
+    // runtime knows which dims to pad and slice.
+    for (auto [idx, type] : llvm::enumerate(funcOp.getArgumentTypes())) {
+      llvm::SmallVector<int64_t> dims = getDynamicDims(type);
+      if (!dims.empty()) {
+        bucketFuncOp.setArgAttr(idx, ttmlir::utils::g_bucketedDimsAttrName,
+                                builder.getDenseI64ArrayAttr(dims));
+      }
+    }
+    for (auto [idx, type] : llvm::enumerate(funcOp.getResultTypes())) {
+      llvm::SmallVector<int64_t> dims = getDynamicDims(type);
+      if (!dims.empty()) {
+        bucketFuncOp.setResultAttr(idx, ttmlir::utils::g_bucketedDimsAttrName,
+                                   builder.getDenseI64ArrayAttr(dims));
+      }
+    }
+
+    bucketFuncOp->setAttr(
+        ttmlir::utils::g_shapeBucketAttrName,
+        builder.getDictionaryAttr(
+            {builder.getNamedAttr("name", funcOp.getSymNameAttr()),
+             builder.getNamedAttr("size", builder.getI64IntegerAttr(size))}));
+
+    return bucketFuncOp;
+  }
+};
+} // namespace
+
+} // namespace mlir::tt::stablehlo
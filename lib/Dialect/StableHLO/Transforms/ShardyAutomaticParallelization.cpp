@@ -19,6 +19,9 @@
 #include "mlir/Transforms/DialectConversion.h"
 #include "mlir/Transforms/GreedyPatternRewriteDriver.h"
 #include "mlir/Transforms/Passes.h"
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/Sequence.h"
+#include "llvm/ADT/SmallPtrSet.h"
 #include "llvm/ADT/SmallSet.h"
 #include "llvm/ADT/SmallString.h"
 #include "llvm/ADT/SmallVector.h"
@@ -47,7 +50,9 @@ support that yet (need to add a conversion from gspmd into sdy).
 determine the inputs and insert custom meshOp and sharding annotations for batch
 parallelization.
   d. If it's not annotated, we insert custom meshOp and sharding
-annotations for batch parallelization.
+annotations for batch parallelization. If automatic tensor parallelism is
+enabled, we first search for Megatron-style tensor parallel shardings of matmul
+weights and use them instead when they score better than replicating weights.
 2. Run sdy sharding propogation pass.
 3. Wrap all operations under a sdy.manual_computationOp.
 4. Run topological sort on the graph and update all shapes with a new shape
@@ -58,6 +63,12 @@ pass.
 7. Close tensor shardings and drop replicated axes.
 */
 
+// Discardable attribute set on a dot_general whose contracting dimension is
+// sharded by the tensor parallel analysis. The value is the mesh axis name
+// along which the partial results have to be all-reduced.
+static constexpr llvm::StringLiteral tensorParallelAllReduceAttrName =
+    "tt.tensor_parallel_all_reduce";
+
 // Check if tt argument annotations exist in the module.
 static inline bool ttAnnotationsExist(mlir::ModuleOp &rootModule) {
   mlir::WalkResult result = rootModule.walk([&](func::FuncOp funcOp) {
@@ -341,6 +352,91 @@ static inline mlir::LogicalResult updateShapes(MLIRContext *context,
   return mlir::success();
 }
 
+// Insert all-reduce ops after dot_general ops whose contracting dimension was
+// sharded by the tensor parallel analysis, since each device only computes a
+// partial sum of their result.
+static inline mlir::LogicalResult
+insertTensorParallelAllReduces(MLIRContext *context, mlir::OpBuilder &builder,
+                               mlir::sdy::MeshOp &globalMeshOp,
+                               func::FuncOp &funcOp,
+                               int64_t &nextChannelHandle) {
+  sdy_utils::MeshMap meshMap =
+      sdy_utils::createMeshMapFromMeshAttr(globalMeshOp.getMesh());
+
+  llvm::SmallVector<mlir::stablehlo::DotGeneralOp> dotOps;
+  funcOp.getBody().walk([&](mlir::stablehlo::DotGeneralOp dotOp) {
+    if (dotOp->hasAttr(tensorParallelAllReduceAttrName)) {
+      dotOps.push_back(dotOp);
+    }
+  });
+
+  for (mlir::stablehlo::DotGeneralOp dotOp : dotOps) {
+    llvm::StringRef axisName =
+        dotOp->getAttrOfType<mlir::StringAttr>(tensorParallelAllReduceAttrName)
+            .getValue();
+    dotOp->removeAttr(tensorParallelAllReduceAttrName);
+
+    if (meshMap.find(axisName) == meshMap.end()) {
+      dotOp.emitError("Tensor parallel axis ")
+          << axisName << " does not exist in the mesh.\n";
+      return mlir::failure();
+    }
+
+    // Mesh dim0 is always 1, so a single replica group spans all devices of
+    // the tensor parallel axis.
+    int64_t numDevices = meshMap[axisName];
+    llvm::SmallVector<int64_t> replicaGroup =
+        llvm::to_vector(llvm::seq<int64_t>(0, numDevices));
+    mlir::DenseIntElementsAttr replicaGroupsAttr =
+        mlir::DenseIntElementsAttr::get(
+            mlir::RankedTensorType::get({1, numDevices}, builder.getI64Type()),
+            replicaGroup);
+    mlir::stablehlo::ChannelHandleAttr channelHandleAttr =
+        mlir::stablehlo::ChannelHandleAttr::get(
+            context, /*handle=*/nextChannelHandle++, /*type=*/1);
+
+    mlir::Location loc = dotOp.getLoc();
+    mlir::RankedTensorType resultType =
+        mlir::cast<mlir::RankedTensorType>(dotOp.getType());
+    builder.setInsertionPointAfter(dotOp);
+    mlir::stablehlo::AllReduceOp allReduceOp =
+        builder.create<mlir::stablehlo::AllReduceOp>(
+            loc, mlir::TypeRange{resultType},
+            mlir::ValueRange{dotOp.getResult()}, replicaGroupsAttr,
+            channelHandleAttr, builder.getUnitAttr());
+
+    // Reduction body: sum of two scalar tensors.
+    mlir::RankedTensorType scalarType =
+        mlir::RankedTensorType::get({}, resultType.getElementType());
+    mlir::Block *body =
+        builder.createBlock(&allReduceOp.getComputation(), {},
+                            {scalarType, scalarType}, {loc, loc});
+    mlir::Value sum = builder.create<mlir::stablehlo::AddOp>(
+        loc, body->getArgument(0), body->getArgument(1));
+    builder.create<mlir::stablehlo::ReturnOp>(loc, sum);
+
+    dotOp.getResult().replaceAllUsesExcept(allReduceOp.getResult(0),
+                                           allReduceOp);
+  }
+
+  return mlir::success();
+}
+
+// Returns the smallest channel handle that is larger than every channel handle
+// already used in the module.
+static inline int64_t getNextChannelHandle(mlir::ModuleOp &rootModule) {
+  int64_t maxHandle = 0;
+  rootModule.walk([&](mlir::Operation *op) {
+    std::optional<mlir::Attribute> attr = op->getInherentAttr("channel_handle");
+    if (auto channelHandle =
+            mlir::dyn_cast_if_present<mlir::stablehlo::ChannelHandleAttr>(
+                attr.value_or(nullptr))) {
+      maxHandle = std::max(maxHandle, channelHandle.getHandle());
+    }
+  });
+  return maxHandle + 1;
+}
+
 // Remove all sdy tensor shardings from the module.
 static inline mlir::LogicalResult
 removeSdyTensorShardings(MLIRContext *context, mlir::OpBuilder &builder,
@@ -396,7 +492,8 @@ public:
   // todo: (tapspatel) Need to generalize largest rank such that batch dim
   // doesn't always have to be with tensors of rank 4.
   // https://github.com/tenstorrent/tt-mlir/issues/3292
-  AutomaticArgumentAnalysis() : ArgumentAnalysis(4) {}
+  AutomaticArgumentAnalysis(llvm::StringRef axisName = "batch")
+      : ArgumentAnalysis(4), axisName(axisName) {}
 
   // Add an argument to the automaticArgumentAnalysis and update largestRank.
   mlir::LogicalResult processArgument(BlockArgument *arg,
@@ -433,7 +530,7 @@ public:
     // https://github.com/tenstorrent/tt-mlir/issues/3289
     if (argType.getRank() == this->largestRank && argType.getShape()[0] != 1) {
       mlir::sdy::AxisRefAttr axisAttr =
-          mlir::sdy::AxisRefAttr::get(context, "batch");
+          mlir::sdy::AxisRefAttr::get(context, axisName);
       mlir::sdy::DimensionShardingAttr dimShardingAttr =
           mlir::sdy::DimensionShardingAttr::get(context, {axisAttr}, true);
       dimShardings.push_back(dimShardingAttr);
@@ -455,6 +552,10 @@ public:
         sharding);
     return mlir::DictionaryAttr::get(context, newArgAttrs);
   }
+
+private:
+  // Name of the mesh axis the batch dimension is sharded along.
+  std::string axisName;
 };
 
 class TTArgumentAnalysis : public ArgumentAnalysis {
@@ -544,6 +645,200 @@ public:
   }
 };
 
+// This class is used to search for tensor parallel shardings of matmul weights
+// if no shard hints are provided. It looks for Megatron-style pairs of matmuls
+// (a column parallel matmul feeding a row parallel matmul through elementwise
+// ops) and scores sharding the pair's weights against replicating them. A
+// candidate's cost is its per-device weight bytes plus the weighted bytes of
+// the all-reduce it requires on the row parallel matmul output. Arguments
+// which are not part of a selected pair are replicated.
+class TensorParallelArgumentAnalysis : public ArgumentAnalysis {
+public:
+  TensorParallelArgumentAnalysis(func::FuncOp &funcOp, llvm::StringRef axisName,
+                                 int64_t numDevices)
+      : ArgumentAnalysis(0), axisName(axisName), numDevices(numDevices) {
+    searchShardings(funcOp);
+  }
+
+  // Check whether the search found at least one pair worth sharding.
+  bool hasTensorParallelShardings() const { return !shardedArgs.empty(); }
+
+  mlir::LogicalResult processArgument(BlockArgument *arg,
+                                      func::FuncOp &funcOp) override {
+    return mlir::success();
+  }
+
+  mlir::DictionaryAttr
+  getUpdatedArgumentDictionaryAttr(mlir::MLIRContext *context,
+                                   func::FuncOp &funcOp,
+                                   BlockArgument *arg) override {
+    llvm::SmallVector<mlir::NamedAttribute> newArgAttrs;
+
+    // Copy the current dictionary if it exists for the op.
+    if (auto currentArgAttrDict = funcOp.getArgAttrDict(arg->getArgNumber())) {
+      newArgAttrs =
+          SmallVector<mlir::NamedAttribute>(currentArgAttrDict.getValue());
+    }
+
+    mlir::RankedTensorType argType =
+        mlir::cast<mlir::RankedTensorType>(arg->getType());
+    mlir::sdy::DimensionShardingAttr full =
+        mlir::sdy::DimensionShardingAttr::get(context, {}, true);
+    llvm::SmallVector<mlir::sdy::DimensionShardingAttr> dimShardings(
+        argType.getRank(), full);
+
+    auto shardedArgIt = shardedArgs.find(arg->getArgNumber());
+    if (shardedArgIt != shardedArgs.end()) {
+      mlir::sdy::AxisRefAttr axisAttr =
+          mlir::sdy::AxisRefAttr::get(context, axisName);
+      dimShardings[shardedArgIt->second] =
+          mlir::sdy::DimensionShardingAttr::get(context, {axisAttr}, true);
+    }
+
+    // Add the shardy sharding attribute to the argument
+    mlir::sdy::TensorShardingAttr sharding =
+        mlir::sdy::TensorShardingAttr::get(context, "mesh", dimShardings, {});
+    newArgAttrs.emplace_back(
+        mlir::StringAttr::get(context, mlir::sdy::TensorShardingAttr::name),
+        sharding);
+    return mlir::DictionaryAttr::get(context, newArgAttrs);
+  }
+
+private:
+  // Collective bytes are weighted higher than weight bytes since inter-chip
+  // links are much slower than DRAM.
+  static constexpr double collectiveBytesWeight = 4.0;
+
+  static int64_t getSizeInBytes(mlir::RankedTensorType type) {
+    return type.getNumElements() * type.getElementTypeBitWidth() / 8;
+  }
+
+  // Return the weight argument of a dot_general computing `x @ w` where `w` is
+  // a rank 2 function argument, otherwise return nullptr.
+  static mlir::BlockArgument getLinearWeight(mlir::stablehlo::DotGeneralOp op,
+                                             func::FuncOp &funcOp) {
+    mlir::stablehlo::DotDimensionNumbersAttr dims =
+        op.getDotDimensionNumbers();
+    int64_t lhsRank =
+        mlir::cast<mlir::RankedTensorType>(op.getLhs().getType()).getRank();
+    if (!dims.getLhsBatchingDimensions().empty() ||
+        !dims.getRhsBatchingDimensions().empty() ||
+        dims.getLhsContractingDimensions() !=
+            llvm::ArrayRef<int64_t>{lhsRank - 1} ||
+        dims.getRhsContractingDimensions() != llvm::ArrayRef<int64_t>{0}) {
+      return nullptr;
+    }
+
+    mlir::BlockArgument weight =
+        mlir::dyn_cast<mlir::BlockArgument>(op.getRhs());
+    if (!weight || weight.getOwner() != &funcOp.getBody().front() ||
+        mlir::cast<mlir::RankedTensorType>(weight.getType()).getRank() != 2) {
+      return nullptr;
+    }
+
+    // Never shard arguments explicitly annotated as inputs.
+    if (auto argAttrDict = funcOp.getArgAttrDict(weight.getArgNumber())) {
+      if (auto argumentTypeAttr =
+              mlir::dyn_cast_if_present<mlir::tt::ArgumentTypeAttr>(
+                  argAttrDict.get(mlir::tt::ArgumentTypeAttr::name));
+          argumentTypeAttr &&
+          argumentTypeAttr.getValue() == mlir::tt::ArgumentType::Input) {
+        return nullptr;
+      }
+    }
+
+    return weight;
+  }
+
+  // Follow the single-use chain of unary elementwise ops starting at the
+  // column parallel matmul and return the matmul consuming it as lhs.
+  static mlir::stablehlo::DotGeneralOp
+  getRowParallelConsumer(mlir::stablehlo::DotGeneralOp columnOp,
+                         func::FuncOp &funcOp) {
+    mlir::Value current = columnOp.getResult();
+    while (current.hasOneUse()) {
+      mlir::Operation *user = *current.getUsers().begin();
+      if (auto rowOp = mlir::dyn_cast<mlir::stablehlo::DotGeneralOp>(user)) {
+        if (rowOp.getLhs() == current && getLinearWeight(rowOp, funcOp)) {
+          return rowOp;
+        }
+        return nullptr;
+      }
+
+      if (!user->hasTrait<mlir::OpTrait::Elementwise>() ||
+          user->getNumOperands() != 1 || user->getNumResults() != 1) {
+        return nullptr;
+      }
+      current = user->getResult(0);
+    }
+
+    return nullptr;
+  }
+
+  void searchShardings(func::FuncOp &funcOp) {
+    llvm::SmallVector<mlir::stablehlo::DotGeneralOp> dotOps;
+    funcOp.getBody().walk(
+        [&](mlir::stablehlo::DotGeneralOp dotOp) { dotOps.push_back(dotOp); });
+
+    llvm::SmallPtrSet<mlir::Operation *, 8> visited;
+    for (mlir::stablehlo::DotGeneralOp columnOp : dotOps) {
+      mlir::BlockArgument columnWeight = getLinearWeight(columnOp, funcOp);
+      if (!columnWeight || visited.contains(columnOp)) {
+        continue;
+      }
+
+      mlir::stablehlo::DotGeneralOp rowOp =
+          getRowParallelConsumer(columnOp, funcOp);
+      if (!rowOp || visited.contains(rowOp)) {
+        continue;
+      }
+      mlir::BlockArgument rowWeight = getLinearWeight(rowOp, funcOp);
+
+      // Weights shared with other ops can't be sharded without resharding.
+      if (columnWeight == rowWeight || !columnWeight.hasOneUse() ||
+          !rowWeight.hasOneUse()) {
+        continue;
+      }
+
+      // Both split dimensions have to divide evenly across devices.
+      mlir::RankedTensorType columnWeightType =
+          mlir::cast<mlir::RankedTensorType>(columnWeight.getType());
+      mlir::RankedTensorType rowWeightType =
+          mlir::cast<mlir::RankedTensorType>(rowWeight.getType());
+      if (columnWeightType.getDimSize(1) % numDevices != 0 ||
+          rowWeightType.getDimSize(0) % numDevices != 0) {
+        continue;
+      }
+
+      // Ring all-reduce moves 2 * (N - 1) / N of the buffer per device.
+      double weightBytes = static_cast<double>(
+          getSizeInBytes(columnWeightType) + getSizeInBytes(rowWeightType));
+      double allReduceBytes =
+          2.0 * (numDevices - 1) / numDevices *
+          getSizeInBytes(mlir::cast<mlir::RankedTensorType>(rowOp.getType()));
+      double replicatedCost = weightBytes;
+      double shardedCost =
+          weightBytes / numDevices + collectiveBytesWeight * allReduceBytes;
+      if (shardedCost >= replicatedCost) {
+        continue;
+      }
+
+      visited.insert(columnOp);
+      visited.insert(rowOp);
+      shardedArgs[columnWeight.getArgNumber()] = 1;
+      shardedArgs[rowWeight.getArgNumber()] = 0;
+      rowOp->setAttr(tensorParallelAllReduceAttrName,
+                     mlir::StringAttr::get(funcOp.getContext(), axisName));
+    }
+  }
+
+  std::string axisName;
+  int64_t numDevices;
+  // Argument number -> tensor dimension sharded along the tensor parallel
+  // axis.
+  llvm::DenseMap<unsigned, int64_t> shardedArgs;
+};
+
 class ShardyAnnotateArgumentsPass
     : public impl::ShardyAnnotateArgumentsPassBase<
           ShardyAnnotateArgumentsPass> {
@@ -641,10 +936,36 @@ public:
         return;
       }
 
+      // Search for tensor parallel shardings first since the result decides
+      // which axis the mesh is parallelized along. User provided tt argument
+      // annotations take precedence, so the search is skipped if they exist.
+      llvm::DenseMap<mlir::Operation *,
+                     std::unique_ptr<TensorParallelArgumentAnalysis>>
+          tensorParallelAnalyses;
+      bool tensorParallelFound = false;
+      if (automaticTensorParallel && !ttArgAnnotationsExist) {
+        for (auto &op : rootModule.getBody()->getOperations()) {
+          auto funcOp = llvm::dyn_cast<func::FuncOp>(op);
+          if (!funcOp || funcOp.isDeclaration()) {
+            continue;
+          }
+
+          auto tensorParallelAnalysis =
+              std::make_unique<TensorParallelArgumentAnalysis>(
+                  funcOp, "model", meshShapeRef[1]);
+          if (!tensorParallelAnalysis->hasTensorParallelShardings()) {
+            continue;
+          }
+          tensorParallelFound = true;
+          tensorParallelAnalyses[funcOp] = std::move(tensorParallelAnalysis);
+        }
+      }
+
       std::string meshName = "mesh";
+      std::string parallelAxisName = tensorParallelFound ? "model" : "batch";
       sdy_utils::MeshMap meshMap;
       meshMap["default"] = meshShapeRef[0];
-      meshMap["batch"] = meshShapeRef[1];
+      meshMap[parallelAxisName] = meshShapeRef[1];
       mlir::sdy::MeshAttr sdyMeshAttr =
           sdy_utils::createMeshAttrFromMeshMap(context, meshMap);
       builder.setInsertionPoint(&(rootModule.getBody()->front()));
@@ -658,12 +979,17 @@ public:
           continue;
         }
 
-        // Get appropriate analysis manager.
+        // Get appropriate analysis manager. Functions without a tensor
+        // parallel pair fall back to batch parallelism along the same mesh
+        // axis.
         std::unique_ptr<ArgumentAnalysis> analysis;
         if (ttArgAnnotationsExist) {
           analysis = std::make_unique<TTArgumentAnalysis>();
+        } else if (tensorParallelAnalyses.count(funcOp)) {
+          analysis = std::move(tensorParallelAnalyses[funcOp]);
         } else if (automaticArgAnalysis) {
-          analysis = std::make_unique<AutomaticArgumentAnalysis>();
+          analysis = std::make_unique<AutomaticArgumentAnalysis>(
+              parallelAxisName);
         }
 
         Block &entryBlock = funcOp.getBody().front();
@@ -797,6 +1123,20 @@ public:
       }
     });
 
+    // Partial results of row parallel matmuls have to be summed across
+    // devices.
+    // Every generated collective gets its own channel.
+    int64_t nextChannelHandle = getNextChannelHandle(rootModule);
+    rootModule.walk([&](func::FuncOp funcOp) {
+      if (failed(insertTensorParallelAllReduces(context, builder, globalMeshOp,
+                                                funcOp, nextChannelHandle))) {
+        rootModule.emitError("Could not insert tensor parallel all-reduce "
+                             "ops.\n");
+        signalPassFailure();
+        return;
+      }
+    });
+
     // Remove all sdy tensor sharding annotations since all the analysis is
     // complete
     rootModule.walk([&](func::FuncOp funcOp) {
@@ -116,8 +116,8 @@ LogicalResult DeviceModuleOp::verify() { return verifyModuleWrapper(*this); }
 LogicalResult CPUModuleOp::verify() { return verifyModuleWrapper(*this); }
 
 // Helper method to verify a list of tensors (inputs or outputs) for
-// LoadCachedOp.
-static LogicalResult verifyTensorList(LoadCachedOp *op, ValueRange opValues,
+// LoadCachedOp and WhileOp.
+static LogicalResult verifyTensorList(Operation *op, ValueRange opValues,
                                       TypeRange fnTypes, bool isInput) {
   // Verify count
   if (opValues.size() != fnTypes.size()) {
@@ -163,7 +163,7 @@ LogicalResult LoadCachedOp::verify() {
   }
 
   if (LogicalResult result = verifyTensorList(
-          this, this->getOperands(),
+          getOperation(), this->getOperands(),
           hasTupleInput
               ? mlir::cast<mlir::TupleType>(fnType.getInput(0)).getTypes()
               : fnType.getInputs(),
@@ -173,7 +173,7 @@ LogicalResult LoadCachedOp::verify() {
   }
 
   if (LogicalResult result = verifyTensorList(
-          this, this->getResults(),
+          getOperation(), this->getResults(),
           hasTupleResult
               ? mlir::cast<mlir::TupleType>(fnType.getResult(0)).getTypes()
               : fnType.getResults(),
@@ -185,4 +185,57 @@ LogicalResult LoadCachedOp::verify() {
   return success();
 }
 
+LogicalResult WhileOp::verify() {
+  auto lookupFunc = [&](FlatSymbolRefAttr symbol) -> func::FuncOp {
+    return SymbolTable::lookupNearestSymbolFrom<func::FuncOp>(*this, symbol);
+  };
+
+  func::FuncOp condFuncOp = lookupFunc(getCondAttr());
+  if (!condFuncOp) {
+    return emitOpError() << "'" << getCond()
+                         << "' does not reference a function";
+  }
+
+  func::FuncOp bodyFuncOp = lookupFunc(getBodyAttr());
+  if (!bodyFuncOp) {
+    return emitOpError() << "'" << getBody()
+                         << "' does not reference a function";
+  }
+
+  // Loop-carried tensors keep their types across iterations.
+  if (!llvm::equal(getInputs().getTypes(), getResults().getTypes())) {
+    return emitOpError("Loop-carried inputs and results must have the same "
+                       "types");
+  }
+
+  FunctionType condType = condFuncOp.getFunctionType();
+  if (LogicalResult result = verifyTensorList(
+          getOperation(), getInputs(), condType.getInputs(), /*isInput=*/true);
+      failed(result)) {
+    return result;
+  }
+
+  if (condType.getNumResults() != 1) {
+    return emitOpError() << "Condition '" << getCond()
+                         << "' must return a single tensor";
+  }
+
+  auto condResultType =
+      mlir::dyn_cast<RankedTensorType>(condType.getResult(0));
+  if (!condResultType || condResultType.getNumElements() != 1) {
+    return emitOpError() << "Condition '" << getCond()
+                         << "' must return a single element tensor";
+  }
+
+  FunctionType bodyType = bodyFuncOp.getFunctionType();
+  if (LogicalResult result = verifyTensorList(
+          getOperation(), getInputs(), bodyType.getInputs(), /*isInput=*/true);
+      failed(result)) {
+    return result;
+  }
+
+  return verifyTensorList(getOperation(), getResults(), bodyType.getResults(),
+                          /*isInput=*/false);
+}
+
 } // namespace mlir::tt
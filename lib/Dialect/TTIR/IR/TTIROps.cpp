@@ -144,41 +144,6 @@ void mlir::tt::ttir::BitwiseXorOp::getCanonicalizationPatterns(
   return success();
 }
 
-// Helper function to extract constant value.
-static std::optional<float> getConstantValue(mlir::Value value) {
-  mlir::Operation *op = value.getDefiningOp();
-  while (mlir::isa_and_present<mlir::tt::ttir::BroadcastOp,
-                               mlir::tt::ttir::ReshapeOp,
-                               mlir::tt::ttir::TypecastOp>(op)) {
-    op = op->getOperand(0).getDefiningOp();
-  }
-
-  auto constantOp = mlir::dyn_cast_if_present<mlir::tt::ttir::ConstantOp>(op);
-  if (!constantOp) {
-    return std::nullopt;
-  }
-
-  mlir::ElementsAttr attr = constantOp.getValueAttr();
-  if (!attr.isSplat()) {
-    return std::nullopt;
-  }
-
-  mlir::Type elementType = attr.getElementType();
-  mlir::APFloat fillValue(mlir::APFloat::IEEEsingle());
-  if (mlir::isa<mlir::IntegerType>(elementType)) {
-    fillValue.convertFromAPInt(attr.getSplatValue<llvm::APInt>(),
-                               attr.getElementType().isSignedInteger(),
-                               llvm::RoundingMode::TowardZero);
-    return fillValue.convertToFloat();
-  }
-  if (mlir::isa<mlir::FloatType>(elementType)) {
-    return static_cast<float>(
-        attr.getSplatValue<mlir::APFloat>().convertToDouble());
-  }
-
-  return std::nullopt;
-}
-
 // ClampTensorOp canonicalization
 void mlir::tt::ttir::ClampTensorOp::getCanonicalizationPatterns(
     mlir::RewritePatternSet &patterns, mlir::MLIRContext *context) {
@@ -186,8 +151,10 @@ void mlir::tt::ttir::ClampTensorOp::getCanonicalizationPatterns(
       +[](mlir::tt::ttir::ClampTensorOp op, mlir::PatternRewriter &rewriter) {
         RankedTensorType outputType = op.getResult().getType();
 
-        std::optional<float> minValue = getConstantValue(op.getMin());
-        std::optional<float> maxValue = getConstantValue(op.getMax());
+        std::optional<float> minValue =
+            ttir::utils::getConstantValue(op.getMin());
+        std::optional<float> maxValue =
+            ttir::utils::getConstantValue(op.getMax());
         if (minValue && maxValue) {
           ttir::utils::replaceOpWithNewDPSOp<ttir::ClampScalarOp>(
               rewriter, op, outputType, op.getInput(), mlir::APFloat(*minValue),
@@ -2944,6 +2911,50 @@ void mlir::tt::ttir::MatmulOp::getCanonicalizationPatterns(
   return success();
 }
 
+//===----------------------------------------------------------------------===//
+// RMSNormOp and LayerNormOp
+//===----------------------------------------------------------------------===//
+
+// Common verifier for ops normalizing over the last dimension.
+template <typename NormOp>
+static ::mlir::LogicalResult verifyNormOp(NormOp op) {
+  ::mlir::RankedTensorType inputType = op.getInput().getType();
+  ::mlir::RankedTensorType outputType = op.getOutput().getType();
+
+  if (inputType.getRank() == 0) {
+    return op.emitOpError("Input must have at least one dimension");
+  }
+
+  if (inputType.getShape() != outputType.getShape()) {
+    return op.emitOpError("Input and output shapes must be the same");
+  }
+
+  const int64_t normalizedDim = inputType.getShape().back();
+  for (::mlir::Value affine : {op.getWeight(), op.getBias()}) {
+    if (!affine) {
+      continue;
+    }
+    ::llvm::ArrayRef<int64_t> shape =
+        ::mlir::cast<::mlir::RankedTensorType>(affine.getType()).getShape();
+    if (shape.size() != 1 || shape[0] != normalizedDim) {
+      return op.emitOpError("Weight and bias must have shape [")
+             << normalizedDim << "]";
+    }
+  }
+
+  return success();
+}
+
+// RMSNormOp verification
+::mlir::LogicalResult mlir::tt::ttir::RMSNormOp::verify() {
+  return verifyNormOp(*this);
+}
+
+// LayerNormOp verification
+::mlir::LogicalResult mlir::tt::ttir::LayerNormOp::verify() {
+  return verifyNormOp(*this);
+}
+
 //===----------------------------------------------------------------------===//
 // AllGatherOp
 //===----------------------------------------------------------------------===//
@@ -3214,6 +3225,215 @@ void mlir::tt::ttir::MatmulOp::getCanonicalizationPatterns(
   return success();
 }
 
+//===----------------------------------------------------------------------===//
+// PagedUpdateCacheOp
+//===----------------------------------------------------------------------===//
+
+::mlir::LogicalResult mlir::tt::ttir::PagedUpdateCacheOp::verify() {
+  const ::mlir::RankedTensorType cacheType = getCache().getType();
+  const ::mlir::RankedTensorType inputType = getInput().getType();
+  const ::mlir::RankedTensorType updateIndexType = getUpdateIndex().getType();
+  const ::mlir::RankedTensorType pageTableType = getPageTable().getType();
+
+  if (cacheType.getElementType() != inputType.getElementType()) {
+    return emitOpError("Cache and input tensors must have the same dtype");
+  }
+
+  if (cacheType.getRank() != 4 || inputType.getRank() != 4) {
+    return emitOpError("Cache and input tensors must be 4D tensors");
+  }
+
+  if (inputType.getDimSize(0) != 1) {
+    return emitOpError("Input tensor requires that dim 0 have size 1, got "
+                       "input dim 0 size = ")
+           << inputType.getDimSize(0);
+  }
+
+  if (inputType.getDimSize(2) != cacheType.getDimSize(1) ||
+      inputType.getDimSize(3) != cacheType.getDimSize(3)) {
+    return emitOpError("Input tensor must have shape [1, num_sequences, "
+                       "num_heads, head_dim] matching cache shape [num_blocks, "
+                       "num_heads, block_size, head_dim]");
+  }
+
+  const int64_t numSequences = inputType.getDimSize(1);
+  if (!updateIndexType.getElementType().isInteger() ||
+      updateIndexType.getRank() != 1 ||
+      updateIndexType.getDimSize(0) != numSequences) {
+    return emitOpError("Update index must be a 1D integer tensor with one "
+                       "position per sequence");
+  }
+
+  if (!pageTableType.getElementType().isInteger() ||
+      pageTableType.getRank() != 2 ||
+      pageTableType.getDimSize(0) != numSequences) {
+    return emitOpError("Page table must be a 2D integer tensor with one row "
+                       "per sequence");
+  }
+
+  return success();
+}
+
+//===----------------------------------------------------------------------===//
+// PagedFillCacheOp
+//===----------------------------------------------------------------------===//
+
+::mlir::LogicalResult mlir::tt::ttir::PagedFillCacheOp::verify() {
+  const ::mlir::RankedTensorType cacheType = getCache().getType();
+  const ::mlir::RankedTensorType inputType = getInput().getType();
+  const ::mlir::RankedTensorType pageTableType = getPageTable().getType();
+  const ::mlir::RankedTensorType batchIdxType = getBatchIdx().getType();
+
+  if (cacheType.getElementType() != inputType.getElementType()) {
+    return emitOpError("Cache and input tensors must have the same dtype");
+  }
+
+  if (cacheType.getRank() != 4 || inputType.getRank() != 4) {
+    return emitOpError("Cache and input tensors must be 4D tensors");
+  }
+
+  if (inputType.getDimSize(0) != 1 ||
+      inputType.getDimSize(1) != cacheType.getDimSize(1) ||
+      inputType.getDimSize(3) != cacheType.getDimSize(3)) {
+    return emitOpError("Input tensor must have shape [1, num_heads, seq_len, "
+                       "head_dim] matching cache shape [num_blocks, "
+                       "num_heads, block_size, head_dim]");
+  }
+
+  if (!pageTableType.getElementType().isInteger() ||
+      pageTableType.getRank() != 2) {
+    return emitOpError("Page table must be a 2D integer tensor");
+  }
+
+  if (inputType.getDimSize(2) >
+      pageTableType.getDimSize(1) * cacheType.getDimSize(2)) {
+    return emitOpError("Input sequence length ")
+           << inputType.getDimSize(2)
+           << " exceeds the capacity of a sequence in the page table ("
+           << pageTableType.getDimSize(1) * cacheType.getDimSize(2) << ")";
+  }
+
+  if (!batchIdxType.getElementType().isInteger() ||
+      batchIdxType.getNumElements() != 1) {
+    return emitOpError("Batch index must be an integer tensor with a single "
+                       "element");
+  }
+
+  return success();
+}
+
+//===----------------------------------------------------------------------===//
+// PagedScaledDotProductAttentionDecodeOp
+//===----------------------------------------------------------------------===//
+
+::mlir::LogicalResult
+mlir::tt::ttir::PagedScaledDotProductAttentionDecodeOp::verify() {
+  const ::mlir::RankedTensorType queryType = getQuery().getType();
+  const ::mlir::RankedTensorType keyType = getKey().getType();
+  const ::mlir::RankedTensorType valueType = getValue().getType();
+  const ::mlir::RankedTensorType pageTableType = getPageTable().getType();
+  const ::mlir::RankedTensorType curPosType = getCurPos().getType();
+  const ::mlir::RankedTensorType outputType = getOutput().getType();
+
+  if (queryType.getRank() != 4 || keyType.getRank() != 4) {
+    return emitOpError("Query and key tensors must be 4D tensors");
+  }
+
+  if (keyType.getShape() != valueType.getShape()) {
+    return emitOpError("Key and value caches must have the same shape");
+  }
+
+  if (queryType.getDimSize(0) != 1) {
+    return emitOpError("Query tensor requires that dim 0 have size 1, got "
+                       "query dim 0 size = ")
+           << queryType.getDimSize(0);
+  }
+
+  if (queryType.getDimSize(3) != keyType.getDimSize(3)) {
+    return emitOpError("Query and key head dims must match");
+  }
+
+  if (queryType.getDimSize(2) % keyType.getDimSize(1) != 0) {
+    return emitOpError("Number of query heads must be a multiple of the "
+                       "number of key/value heads");
+  }
+
+  const int64_t numSequences = queryType.getDimSize(1);
+  if (!pageTableType.getElementType().isInteger() ||
+      pageTableType.getRank() != 2 ||
+      pageTableType.getDimSize(0) != numSequences) {
+    return emitOpError("Page table must be a 2D integer tensor with one row "
+                       "per sequence");
+  }
+
+  if (!curPosType.getElementType().isInteger() || curPosType.getRank() != 1 ||
+      curPosType.getDimSize(0) != numSequences) {
+    return emitOpError("Current positions must be a 1D integer tensor with "
+                       "one position per sequence");
+  }
+
+  if (outputType.getShape() != queryType.getShape()) {
+    return emitOpError("Output shape must match query shape");
+  }
+
+  return success();
+}
+
+//===----------------------------------------------------------------------===//
+// ScaledDotProductAttentionOp
+//===----------------------------------------------------------------------===//
+
+::mlir::LogicalResult
+mlir::tt::ttir::ScaledDotProductAttentionOp::verify() {
+  const ::mlir::RankedTensorType queryType = getQuery().getType();
+  const ::mlir::RankedTensorType keyType = getKey().getType();
+  const ::mlir::RankedTensorType valueType = getValue().getType();
+  const ::mlir::RankedTensorType resultType = getOutput().getType();
+
+  if (queryType.getRank() != 4 || keyType.getRank() != 4) {
+    return emitOpError("Query and key tensors must be 4D tensors");
+  }
+
+  if (keyType.getShape() != valueType.getShape()) {
+    return emitOpError("Key and value tensors must have the same shape");
+  }
+
+  if (queryType.getDimSize(0) != keyType.getDimSize(0)) {
+    return emitOpError("Query and key batch sizes must match");
+  }
+
+  if (queryType.getDimSize(3) != keyType.getDimSize(3)) {
+    return emitOpError("Query and key head dims must match");
+  }
+
+  if (queryType.getDimSize(1) % keyType.getDimSize(1) != 0) {
+    return emitOpError("Number of query heads must be a multiple of the "
+                       "number of key/value heads");
+  }
+
+  if (::mlir::TypedValue<::mlir::RankedTensorType> mask =
+          getAttentionMask()) {
+    if (getIsCausal()) {
+      return emitOpError("Causal attention doesn't take an attention mask");
+    }
+
+    ::llvm::ArrayRef<int64_t> maskShape = mask.getType().getShape();
+    if (maskShape.size() != 4 ||
+        (maskShape[0] != 1 && maskShape[0] != queryType.getDimSize(0)) ||
+        maskShape[1] != 1 || maskShape[2] != queryType.getDimSize(2) ||
+        maskShape[3] != keyType.getDimSize(2)) {
+      return emitOpError("Attention mask must have shape [batch, 1, "
+                         "query_len, key_len]");
+    }
+  }
+
+  if (resultType.getShape() != queryType.getShape()) {
+    return emitOpError("Output shape must match query shape");
+  }
+
+  return success();
+}
+
 //===----------------------------------------------------------------------===//
 // ReverseOp
 //===----------------------------------------------------------------------===//
@@ -25,6 +25,8 @@
 #include "ttmlir/Transforms/Passes.h"
 
 #ifdef TTMLIR_ENABLE_STABLEHLO
+#include "ttmlir/Dialect/StableHLO/Transforms/Passes.h"
+
 #include "stablehlo/transforms/Passes.h"
 #endif
 
@@ -40,9 +42,15 @@ void createStableHLOToTTIRPipeline(
     pm.addPass(createConvertArithToStableHLOPass());
   }
   if (options.legalizeCompositeToCallEnabled) {
-    pm.addPass(stablehlo::createStablehloLegalizeCompositeToCallPass());
+    pm.addPass(mlir::stablehlo::createStablehloLegalizeCompositeToCallPass());
   }
   pm.addPass(mlir::createInlinerPass());
+  if (!options.shapeBucketSizes.empty()) {
+    tt::stablehlo::ShapeBucketingPassOptions shapeBucketingOptions;
+    shapeBucketingOptions.bucketSizes =
+        llvm::to_vector(options.shapeBucketSizes);
+    pm.addPass(tt::stablehlo::createShapeBucketingPass(shapeBucketingOptions));
+  }
   pm.addPass(createConvertStableHLOToTTIRPass());
   pm.addPass(createTTIRTensorAnnotationCleanupPass());
 }
@@ -0,0 +1,127 @@
+// SPDX-FileCopyrightText: (c) 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "ttmlir/Dialect/TTIR/IR/TTIROps.h"
+#include "ttmlir/Dialect/TTIR/Transforms/EraseInverseOps/EraseInverseOps.h"
+#include "ttmlir/Dialect/TTIR/Utils/Utils.h"
+
+namespace mlir::tt::ttir {
+
+namespace {
+// Commutes a transpose or permute above a concat by permuting every input and
+// concatenating along the dim the original concat dim is moved to.
+template <typename TMOpType>
+class TTIRCommuteTmsAboveConcatRewriter
+    : public TTIRCommuteOpRewritePattern<TMOpType, ttir::ConcatOp> {
+public:
+  using TTIRCommuteOpRewritePattern<
+      TMOpType, ttir::ConcatOp>::TTIRCommuteOpRewritePattern;
+
+  void performCommuteRewrite(ttir::ConcatOp op, TMOpType tmUser,
+                             PatternRewriter &rewriter) const override {
+    SmallVector<int64_t> permutation = *getTMPermutation(tmUser);
+    int64_t rank = op.getType().getRank();
+    int64_t dim = op.getDim() < 0 ? op.getDim() + rank : op.getDim();
+    int32_t newDim = ttmlir::utils::inversePermutation(permutation)[dim];
+
+    SmallVector<Value> newInputs;
+    for (Value input : op.getInputs()) {
+      newInputs.push_back(createPermutationTM(rewriter, op->getLoc(), tmUser,
+                                              input, permutation));
+    }
+
+    auto newConcat = ttir::utils::createDPSOp<ttir::ConcatOp>(
+        rewriter, op->getLoc(), tmUser.getResult().getType(), newInputs,
+        newDim);
+
+    SmallVector<Operation *> users(op->getUsers());
+    for (auto *user : users) {
+      assert(checkIdenticalTms(tmUser, user) &&
+             "shouldCommute should have ensured this is true");
+    }
+
+    for (auto *user : users) {
+      rewriter.replaceOp(user, newConcat);
+    }
+  }
+
+private:
+  bool isCommuteViable(ttir::ConcatOp op, TMOpType) const override {
+    // We can always commute a permutation above a concat.
+    return true;
+  }
+
+  bool isCommuteFavorable(ttir::ConcatOp op, TMOpType) const override {
+    // Like elementwise binary ops, commuting adds a TM on every input. This is
+    // favorable when all users are identical TMs, since the input TMs may
+    // cancel against inverses above the concat or be const-evaluated.
+    SmallVector<Operation *> users(op->getUsers());
+    return !users.empty() && checkAllUsersAreIdenticalTms(users);
+  }
+};
+} // namespace
+
+namespace {
+// Commutes a transpose or permute above a slice by permuting the input and the
+// begins, ends and steps of the slice.
+template <typename TMOpType>
+class TTIRCommuteTmsAboveSliceRewriter
+    : public TTIRCommuteOpRewritePattern<TMOpType, ttir::SliceOp> {
+public:
+  using TTIRCommuteOpRewritePattern<
+      TMOpType, ttir::SliceOp>::TTIRCommuteOpRewritePattern;
+
+  void performCommuteRewrite(ttir::SliceOp op, TMOpType tmUser,
+                             PatternRewriter &rewriter) const override {
+    SmallVector<int64_t> permutation = *getTMPermutation(tmUser);
+
+    auto permuteAttr = [&](ArrayAttr attr) {
+      auto values = llvm::map_to_vector(attr, [](Attribute value) {
+        return static_cast<int32_t>(mlir::cast<IntegerAttr>(value).getInt());
+      });
+      return rewriter.getI32ArrayAttr(
+          ttmlir::utils::applyPermutation(ArrayRef<int32_t>(values),
+                                          permutation));
+    };
+
+    Value newTM = createPermutationTM(rewriter, op->getLoc(), tmUser,
+                                      op.getInput(), permutation);
+    auto newSlice = ttir::utils::createDPSOp<ttir::SliceOp>(
+        rewriter, op->getLoc(), tmUser.getResult().getType(), newTM,
+        permuteAttr(op.getBegins()), permuteAttr(op.getEnds()),
+        permuteAttr(op.getStep()));
+
+    SmallVector<Operation *> users(op->getUsers());
+    for (auto *user : users) {
+      assert(checkIdenticalTms(tmUser, user) &&
+             "shouldCommute should have ensured this is true");
+    }
+
+    for (auto *user : users) {
+      rewriter.replaceOp(user, newSlice);
+    }
+  }
+
+private:
+  bool isCommuteViable(ttir::SliceOp op, TMOpType) const override {
+    // We can always commute a permutation above a slice.
+    return true;
+  }
+
+  bool isCommuteFavorable(ttir::SliceOp op, TMOpType) const override {
+    SmallVector<Operation *> users(op->getUsers());
+    return !users.empty() && checkAllUsersAreIdenticalTms(users);
+  }
+};
+} // namespace
+
+void populateConcatSliceCommutePatterns(MLIRContext *ctx,
+                                        RewritePatternSet &patterns) {
+  patterns.add<TTIRCommuteTmsAboveConcatRewriter<TransposeOp>,
+               TTIRCommuteTmsAboveConcatRewriter<PermuteOp>,
+               TTIRCommuteTmsAboveSliceRewriter<TransposeOp>,
+               TTIRCommuteTmsAboveSliceRewriter<PermuteOp>>(ctx);
+}
+
+} // namespace mlir::tt::ttir
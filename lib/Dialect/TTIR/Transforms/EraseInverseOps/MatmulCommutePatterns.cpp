@@ -0,0 +1,81 @@
+// SPDX-FileCopyrightText: (c) 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "ttmlir/Dialect/TTIR/IR/TTIROps.h"
+#include "ttmlir/Dialect/TTIR/Transforms/EraseInverseOps/EraseInverseOps.h"
+#include "ttmlir/Dialect/TTIR/Utils/Utils.h"
+
+namespace mlir::tt::ttir {
+
+// Returns true if `permutation` only swaps the two innermost dims.
+static bool isInnerDimsSwap(ArrayRef<int64_t> permutation) {
+  int64_t rank = permutation.size();
+  if (rank < 2) {
+    return false;
+  }
+
+  for (int64_t i = 0; i < rank - 2; i++) {
+    if (permutation[i] != i) {
+      return false;
+    }
+  }
+  return permutation[rank - 2] == rank - 1 && permutation[rank - 1] == rank - 2;
+}
+
+namespace {
+// Commutes a transpose of the two innermost dims above a matmul using
+// (A @ B)^T = B^T @ A^T. No new TMs are created: the operands are swapped and
+// their transpose flags are flipped. Operand TMs which become redundant are
+// folded into the transpose flags by the matmul canonicalization.
+template <typename TMOpType>
+class TTIRCommuteTmsAboveMatmulRewriter
+    : public TTIRCommuteOpRewritePattern<TMOpType, ttir::MatmulOp> {
+public:
+  using TTIRCommuteOpRewritePattern<
+      TMOpType, ttir::MatmulOp>::TTIRCommuteOpRewritePattern;
+
+  void performCommuteRewrite(ttir::MatmulOp op, TMOpType tmUser,
+                             PatternRewriter &rewriter) const override {
+    auto newMatmul = ttir::utils::createDPSOp<ttir::MatmulOp>(
+        rewriter, op->getLoc(), tmUser.getResult().getType(), op.getB(),
+        op.getA(), rewriter.getBoolAttr(!op.getTransposeB()),
+        rewriter.getBoolAttr(!op.getTransposeA()));
+
+    SmallVector<Operation *> users(op->getUsers());
+    for (auto *user : users) {
+      assert(checkIdenticalTms(tmUser, user) &&
+             "shouldCommute should have ensured this is true");
+    }
+
+    for (auto *user : users) {
+      rewriter.replaceOp(user, newMatmul);
+    }
+  }
+
+private:
+  bool isCommuteViable(ttir::MatmulOp op, TMOpType tmUser) const override {
+    // Only a swap of the two innermost dims maps onto the transpose flags.
+    // Batch dims are broadcast symmetrically, so swapping the operands is
+    // always valid as long as neither of them is a vector.
+    return op.getA().getType().getRank() >= 2 &&
+           op.getB().getType().getRank() >= 2 &&
+           isInnerDimsSwap(*getTMPermutation(tmUser));
+  }
+
+  bool isCommuteFavorable(ttir::MatmulOp op, TMOpType) const override {
+    // The commute removes the TM without adding any, so it is always
+    // favorable when all users are identical TMs.
+    SmallVector<Operation *> users(op->getUsers());
+    return !users.empty() && checkAllUsersAreIdenticalTms(users);
+  }
+};
+} // namespace
+
+void populateMatmulCommutePatterns(MLIRContext *ctx,
+                                   RewritePatternSet &patterns) {
+  patterns.add<TTIRCommuteTmsAboveMatmulRewriter<TransposeOp>,
+               TTIRCommuteTmsAboveMatmulRewriter<PermuteOp>>(ctx);
+}
+
+} // namespace mlir::tt::ttir
@@ -0,0 +1,137 @@
+// SPDX-FileCopyrightText: (c) 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "ttmlir/Dialect/TTIR/IR/TTIROps.h"
+#include "ttmlir/Dialect/TTIR/Transforms/EraseInverseOps/EraseInverseOps.h"
+#include "ttmlir/Dialect/TTIR/Utils/Utils.h"
+
+#include "llvm/ADT/BitVector.h"
+
+namespace mlir::tt::ttir {
+
+// Returns a mask of the input dims reduced by `op`. A missing `dim_arg` means
+// that all dims are reduced.
+template <typename ReductionOp>
+static llvm::BitVector getReduceDimsMask(ReductionOp op) {
+  int64_t rank = op.getInput().getType().getRank();
+  llvm::BitVector reduceDimsMask(rank, false);
+  if (!op.getDimArg()) {
+    reduceDimsMask.set();
+    return reduceDimsMask;
+  }
+
+  for (Attribute reduceDim : *op.getDimArg()) {
+    int64_t reduceDimInt = mlir::cast<IntegerAttr>(reduceDim).getInt();
+    reduceDimsMask.set((reduceDimInt + rank) % rank);
+  }
+  return reduceDimsMask;
+}
+
+namespace {
+// Commutes a transpose or permute above a reduction:
+//
+//   reduce(x, dims) -> permute(P)  ==>  permute(P') -> reduce(x', dims')
+//
+// With keep_dim = true the result has the same rank as the input, so the
+// input is permuted with P and every reduced dim is moved to its new position.
+//
+// With keep_dim = false the reduced dims are dropped from the result, so P
+// only reorders the kept dims. The input permutation P' reorders the kept
+// input dims in the same way while the reduced dims stay where they are, so
+// `dim_arg` is left unchanged.
+template <typename TMOpType, typename ReductionOp>
+class TTIRCommuteTmsAboveReductionRewriter
+    : public TTIRCommuteOpRewritePattern<TMOpType, ReductionOp> {
+public:
+  using TTIRCommuteOpRewritePattern<TMOpType,
+                                    ReductionOp>::TTIRCommuteOpRewritePattern;
+
+  void performCommuteRewrite(ReductionOp op, TMOpType tmUser,
+                             PatternRewriter &rewriter) const override {
+    SmallVector<int64_t> permutation = *getTMPermutation(tmUser);
+    int64_t inputRank = op.getInput().getType().getRank();
+    llvm::BitVector reduceDimsMask = getReduceDimsMask(op);
+
+    SmallVector<int64_t> inputPermutation;
+    ArrayAttr newDimArg = op.getDimArgAttr();
+    if (op.getKeepDim()) {
+      inputPermutation = permutation;
+      if (newDimArg) {
+        SmallVector<int64_t> inversePermutation =
+            ttmlir::utils::inversePermutation(permutation);
+        SmallVector<int32_t> newReduceDims;
+        for (int64_t dim : reduceDimsMask.set_bits()) {
+          newReduceDims.push_back(inversePermutation[dim]);
+        }
+        llvm::sort(newReduceDims);
+        newDimArg = rewriter.getI32ArrayAttr(newReduceDims);
+      }
+    } else {
+      SmallVector<int64_t> keptDims;
+      for (int64_t dim = 0; dim < inputRank; dim++) {
+        if (!reduceDimsMask.test(dim)) {
+          keptDims.push_back(dim);
+        }
+      }
+      inputPermutation = llvm::to_vector(llvm::seq<int64_t>(0, inputRank));
+      for (size_t i = 0; i < keptDims.size(); i++) {
+        inputPermutation[keptDims[i]] = keptDims[permutation[i]];
+      }
+    }
+
+    Value newTM = createPermutationTM(rewriter, op->getLoc(), tmUser,
+                                      op.getInput(), inputPermutation);
+    auto newReduction = ttir::utils::createDPSOp<ReductionOp>(
+        rewriter, op->getLoc(), tmUser.getResult().getType(), newTM,
+        op.getKeepDimAttr(), newDimArg);
+
+    SmallVector<Operation *> users(op->getUsers());
+    for (auto *user : users) {
+      assert(checkIdenticalTms(tmUser, user) &&
+             "shouldCommute should have ensured this is true");
+    }
+
+    for (auto *user : users) {
+      rewriter.replaceOp(user, newReduction);
+    }
+  }
+
+private:
+  bool isCommuteViable(ReductionOp op, TMOpType tmUser) const override {
+    // Any permutation of the reduction result can be expressed as a
+    // permutation of its input.
+    return true;
+  }
+
+  bool isCommuteFavorable(ReductionOp op, TMOpType) const override {
+    // The commuted TM operates on the reduction input, which is larger than
+    // its result. This is still favorable when all users are identical TMs as
+    // it moves the TM towards its inverse or a constant operand. Whether the
+    // overall placement is cheaper is decided by the TM propagation pass.
+    SmallVector<Operation *> users(op->getUsers());
+    return !users.empty() && checkAllUsersAreIdenticalTms(users);
+  }
+};
+} // namespace
+
+template <typename TMOpType>
+static void addReductionCommutePatterns(MLIRContext *ctx,
+                                        RewritePatternSet &patterns) {
+  patterns.add<TTIRCommuteTmsAboveReductionRewriter<TMOpType, SumOp>,
+               TTIRCommuteTmsAboveReductionRewriter<TMOpType, MeanOp>,
+               TTIRCommuteTmsAboveReductionRewriter<TMOpType, MaxOp>,
+               TTIRCommuteTmsAboveReductionRewriter<TMOpType, MinOp>,
+               TTIRCommuteTmsAboveReductionRewriter<TMOpType, ProdOp>,
+               TTIRCommuteTmsAboveReductionRewriter<TMOpType, ReduceAndOp>,
+               TTIRCommuteTmsAboveReductionRewriter<TMOpType, ReduceOrOp>,
+               TTIRCommuteTmsAboveReductionRewriter<TMOpType, ArgMaxOp>>(ctx);
+}
+
+void populateReductionCommutePatterns(MLIRContext *ctx,
+                                      RewritePatternSet &patterns) {
+  addReductionCommutePatterns<TransposeOp>(ctx, patterns);
+  addReductionCommutePatterns<PermuteOp>(ctx, patterns);
+}
+
+} // namespace mlir::tt::ttir
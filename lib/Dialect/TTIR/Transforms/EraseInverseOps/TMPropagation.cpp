@@ -0,0 +1,227 @@
+// SPDX-FileCopyrightText: (c) 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "ttmlir/Dialect/TT/IR/TT.h"
+#include "ttmlir/Dialect/TT/IR/TTOpsTypes.h"
+#include "ttmlir/Dialect/TT/IR/TTTraits.h"
+#include "ttmlir/Dialect/TTIR/Transforms/EraseInverseOps/EraseInverseOps.h"
+#include "ttmlir/Dialect/TTIR/Transforms/Passes.h"
+#include "ttmlir/Utils.h"
+
+#include "mlir/Dialect/Func/IR/FuncOps.h"
+#include "mlir/Dialect/Quant/IR/QuantTypes.h"
+#include "mlir/IR/PatternMatch.h"
+#include "mlir/Support/LLVM.h"
+#include "mlir/Transforms/GreedyPatternRewriteDriver.h"
+#include "llvm/Support/Debug.h"
+#include "llvm/Support/JSON.h"
+#include "llvm/Support/raw_ostream.h"
+
+#define DEBUG_TYPE "ttir-propagate-tms"
+
+namespace mlir::tt::ttir {
+#define GEN_PASS_DEF_TTIRTMPROPAGATION
+#include "ttmlir/Dialect/TTIR/Transforms/Passes.h.inc"
+
+namespace {
+// Number of TMs in a function and the bytes they move. TMs on const-evaluable
+// values are not counted since they are hoisted into const-eval functions.
+struct TMCost {
+  int64_t numTMs = 0;
+  int64_t numBytes = 0;
+
+  bool operator<(const TMCost &other) const {
+    return std::tie(numBytes, numTMs) < std::tie(other.numBytes, other.numTMs);
+  }
+};
+
+struct FunctionReport {
+  std::string name;
+  TMCost before;
+  TMCost after;
+};
+} // namespace
+
+static int64_t getElementSizeBytes(Type elementType) {
+  if (auto quantType = mlir::dyn_cast<quant::QuantizedType>(elementType)) {
+    return llvm::divideCeil(quantType.getStorageTypeIntegralWidth(), 8);
+  }
+  if (elementType.isIntOrFloat()) {
+    return llvm::divideCeil(elementType.getIntOrFloatBitWidth(), 8);
+  }
+  return mlir::tt::getElementSizeBytes(elementType);
+}
+
+// Returns the number of TMs in `funcOp` and the bytes they move. A value is
+// const-evaluable if it is a parameter or constant argument, or it is computed
+// only from creation ops and other const-evaluable values.
+static TMCost getTMCost(func::FuncOp funcOp) {
+  llvm::SmallPtrSet<BlockArgument, 4> constParams =
+      ttmlir::utils::populateConstParams(funcOp);
+  llvm::DenseSet<Value> constEvaluable(constParams.begin(), constParams.end());
+
+  TMCost cost;
+  funcOp.walk([&](Operation *op) {
+    auto dpsOp = mlir::dyn_cast<DestinationStyleOpInterface>(op);
+    bool isConstEvaluable =
+        op->hasTrait<mlir::tt::Trait::TTCreationOpTrait>() ||
+        llvm::all_of(op->getOpOperands(), [&](OpOperand &operand) {
+          return (dpsOp && dpsOp.isDpsInit(&operand)) ||
+                 constEvaluable.contains(operand.get());
+        });
+    if (isConstEvaluable) {
+      constEvaluable.insert(op->result_begin(), op->result_end());
+      return;
+    }
+
+    if (!isa<ttir::TransposeOp, ttir::PermuteOp, ttir::ReshapeOp>(op)) {
+      return;
+    }
+    auto resultType = mlir::cast<RankedTensorType>(op->getResult(0).getType());
+    cost.numTMs++;
+    cost.numBytes += resultType.getNumElements() *
+                     getElementSizeBytes(resultType.getElementType());
+  });
+  return cost;
+}
+
+using PatternPopulator = void (*)(MLIRContext *, RewritePatternSet &);
+
+namespace {
+class TTIRTMPropagation
+    : public impl::TTIRTMPropagationBase<TTIRTMPropagation> {
+public:
+  using impl::TTIRTMPropagationBase<TTIRTMPropagation>::TTIRTMPropagationBase;
+
+  void runOnOperation() final {
+    // Each strategy is a set of commute patterns. The local strategy matches
+    // the erase inverse ops pass, the global one additionally moves TMs through
+    // reductions, concats, slices and matmuls.
+    SmallVector<SmallVector<PatternPopulator>> strategies = {
+        {populateElementwiseCommutePatterns, populateBroadcastCommutePatterns},
+        {populateElementwiseCommutePatterns, populateBroadcastCommutePatterns,
+         populateReductionCommutePatterns, populateConcatSliceCommutePatterns,
+         populateMatmulCommutePatterns}};
+
+    SmallVector<FrozenRewritePatternSet> patternSets;
+    for (const auto &populators : strategies) {
+      RewritePatternSet patterns(&getContext());
+      for (PatternPopulator populate : populators) {
+        populate(&getContext(), patterns);
+      }
+      // Absorbs operand transposes into the matmul transpose flags.
+      ttir::MatmulOp::getCanonicalizationPatterns(patterns, &getContext());
+      patternSets.emplace_back(std::move(patterns));
+    }
+
+    SmallVector<FunctionReport> reports;
+    for (auto funcOp : getOperation().getOps<func::FuncOp>()) {
+      if (funcOp.isDeclaration() || ttmlir::utils::isSubProgramFunc(funcOp)) {
+        continue;
+      }
+
+      FailureOr<FunctionReport> report = propagate(funcOp, patternSets);
+      if (failed(report)) {
+        signalPassFailure();
+        return;
+      }
+      reports.push_back(*report);
+    }
+
+    if (!reportPath.empty()) {
+      writeReport(reports);
+    }
+  }
+
+private:
+  // Runs every strategy on a clone of `funcOp` and keeps the cheapest result.
+  FailureOr<FunctionReport>
+  propagate(func::FuncOp funcOp,
+            ArrayRef<FrozenRewritePatternSet> patternSets) {
+    TMCost bestCost = getTMCost(funcOp);
+    FunctionReport report{funcOp.getSymName().str(), bestCost, bestCost};
+
+    func::FuncOp best = nullptr;
+    for (const FrozenRewritePatternSet &patterns : patternSets) {
+      func::FuncOp candidate = funcOp.clone();
+      if (failed(applyPatternsGreedily(candidate, patterns))) {
+        candidate->erase();
+        if (best) {
+          best->erase();
+        }
+        return failure();
+      }
+
+      TMCost cost = getTMCost(candidate);
+      LLVM_DEBUG(llvm::dbgs() << funcOp.getSymName() << ": " << cost.numTMs
+                              << " TMs moving " << cost.numBytes << " bytes\n");
+      if (!(cost < bestCost)) {
+        candidate->erase();
+        continue;
+      }
+
+      if (best) {
+        best->erase();
+      }
+      best = candidate;
+      bestCost = cost;
+    }
+
+    if (best) {
+      funcOp.getBody().takeBody(best.getBody());
+      best->erase();
+    }
+    report.after = bestCost;
+    return report;
+  }
+
+  void writeReport(ArrayRef<FunctionReport> reports) {
+    std::error_code ec;
+    llvm::raw_fd_ostream file(reportPath, ec);
+    if (ec) {
+      getOperation().emitWarning()
+          << "Failed to open TM propagation report file " << reportPath << ": "
+          << ec.message();
+      return;
+    }
+
+    auto writeCost = [](llvm::json::OStream &json, llvm::StringRef key,
+                        const TMCost &cost) {
+      json.attributeObject(key, [&] {
+        json.attribute("num_tms", cost.numTMs);
+        json.attribute("num_bytes", cost.numBytes);
+      });
+    };
+
+    TMCost totalBefore;
+    TMCost totalAfter;
+    llvm::json::OStream json(file, /*IndentSize=*/2);
+    json.object([&] {
+      json.attribute("module",
+                     getOperation().getSymName().value_or("").str());
+      json.attributeArray("functions", [&] {
+        for (const FunctionReport &report : reports) {
+          json.object([&] {
+            json.attribute("name", report.name);
+            writeCost(json, "before", report.before);
+            writeCost(json, "after", report.after);
+            json.attribute("tms_eliminated",
+                           report.before.numTMs - report.after.numTMs);
+          });
+          totalBefore.numTMs += report.before.numTMs;
+          totalBefore.numBytes += report.before.numBytes;
+          totalAfter.numTMs += report.after.numTMs;
+          totalAfter.numBytes += report.after.numBytes;
+        }
+      });
+      writeCost(json, "before", totalBefore);
+      writeCost(json, "after", totalAfter);
+      json.attribute("tms_eliminated", totalBefore.numTMs - totalAfter.numTMs);
+    });
+    file << "\n";
+  }
+};
+} // namespace
+
+} // namespace mlir::tt::ttir
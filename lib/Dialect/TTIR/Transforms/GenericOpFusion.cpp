@@ -0,0 +1,332 @@
+// SPDX-FileCopyrightText: (c) 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "ttmlir/Dialect/TT/IR/TT.h"
+#include "ttmlir/Dialect/TTIR/Transforms/Passes.h"
+
+#include "mlir/Dialect/Linalg/IR/Linalg.h"
+#include "mlir/IR/IRMapping.h"
+#include "mlir/Transforms/GreedyPatternRewriteDriver.h"
+
+namespace mlir::tt::ttir {
+#define GEN_PASS_DEF_TTIRGENERICOPFUSION
+#include "ttmlir/Dialect/TTIR/Transforms/Passes.h.inc"
+
+namespace {
+class TTIRGenericOpFusionRewriter : public OpRewritePattern<GenericOp> {
+public:
+  using OpRewritePattern<GenericOp>::OpRewritePattern;
+
+  // Returns the single compute block of 'generic' if it is still in its
+  // compute only, affine map form on tensors.
+  static Block *getComputeBlock(GenericOp generic) {
+    if (!generic.isComputeOnlyForm() || !generic.isAffineMapForm() ||
+        generic->getNumResults() != 1 || generic.getNumRegions() != 1) {
+      return nullptr;
+    }
+    Block &block = generic.getRegion(0).front();
+    if (block.getNumArguments() != generic->getNumOperands()) {
+      return nullptr;
+    }
+    return &block;
+  }
+
+  // Returns the linalg op making up the body of an elementwise generic, i.e.
+  // one with identity indexing maps and parallel iterators whose body only
+  // reads its inputs.
+  static linalg::GenericOp getElementwiseBody(GenericOp generic) {
+    Block *block = getComputeBlock(generic);
+    if (!block || !llvm::hasSingleElement(*block)) {
+      return nullptr;
+    }
+
+    if (!llvm::all_of(generic.getIteratorTypesValue(), [](IteratorType type) {
+          return type == IteratorType::Parallel;
+        }) ||
+        !llvm::all_of(generic.getIndexingMapsValue(),
+                      [](AffineMap map) { return map.isIdentity(); })) {
+      return nullptr;
+    }
+
+    auto linalgGeneric = mlir::dyn_cast<linalg::GenericOp>(block->front());
+    if (!linalgGeneric || linalgGeneric.getNumDpsInits() != 1 ||
+        !llvm::equal(linalgGeneric->getOperands(), block->getArguments()) ||
+        linalgGeneric.getNumParallelLoops() != linalgGeneric.getNumLoops() ||
+        !llvm::all_of(linalgGeneric.getIndexingMapsArray(),
+                      [](AffineMap map) { return map.isIdentity(); })) {
+      return nullptr;
+    }
+
+    Block &body = linalgGeneric.getRegion().front();
+    if (!body.getArguments().back().use_empty()) {
+      return nullptr;
+    }
+
+    return linalgGeneric;
+  }
+
+  // Returns true if the compute block of 'generic' is a tile_matmul_block
+  // (optionally followed by already fused epilogues) whose reduction is done
+  // in a single iteration, so that its output block is final by the time the
+  // region ends.
+  static bool isFusibleMatmulBlock(GenericOp generic) {
+    Block *block = getComputeBlock(generic);
+    if (!block || block->empty()) {
+      return false;
+    }
+
+    auto matmul = mlir::dyn_cast<TileMatmulBlockOp>(block->front());
+    if (!matmul || !llvm::equal(matmul->getOperands(), block->getArguments())) {
+      return false;
+    }
+
+    if (!llvm::all_of(llvm::drop_begin(*block), [&](Operation &op) {
+          auto epilogue = mlir::dyn_cast<linalg::GenericOp>(op);
+          return epilogue &&
+                 epilogue.getDpsInits().front() == block->getArguments().back();
+        })) {
+      return false;
+    }
+
+    SmallVector<IteratorType> iteratorTypes = generic.getIteratorTypesValue();
+    SmallVector<int64_t> loopBounds = generic.getLoopBounds();
+    for (size_t i = 0; i < iteratorTypes.size(); ++i) {
+      if (iteratorTypes[i] == IteratorType::Reduction && loopBounds[i] != 1) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // Fused tile ops are lowered as a chain through DST, so an intermediate may
+  // only feed the first operand of a tile op that reads its operands from DST
+  // rather than from CBs (i.e. not an FPU op).
+  static bool isDstChainable(OpOperand &use) {
+    return use.getOperandNumber() == 0 &&
+           !mlir::isa<TileAddOp, TileSubOp, TileMulOp, TileMatmulOp>(
+               use.getOwner());
+  }
+
+  // Clones all but the terminator of 'body' and returns the yielded value.
+  static Value clonePayload(OpBuilder &builder, Block &body,
+                            IRMapping &mapping) {
+    for (Operation &op : body.without_terminator()) {
+      builder.clone(op, mapping);
+    }
+    return mapping.lookupOrDefault(body.getTerminator()->getOperand(0));
+  }
+
+  static SmallVector<AffineMap> getIdentityMaps(OpBuilder &builder,
+                                                std::size_t arity,
+                                                Value memref) {
+    unsigned rank = mlir::cast<MemRefType>(memref.getType()).getRank();
+    return SmallVector<AffineMap>(arity, builder.getMultiDimIdentityMap(rank));
+  }
+
+  static SmallVector<utils::IteratorType> getParallelIterators(Value memref) {
+    unsigned rank = mlir::cast<MemRefType>(memref.getType()).getRank();
+    return SmallVector<utils::IteratorType>(rank,
+                                            utils::IteratorType::parallel);
+  }
+
+  // Elementwise into elementwise: merge both linalg bodies so that the
+  // intermediate tile stays in DST.
+  static GenericOp fuseElementwise(PatternRewriter &rewriter,
+                                   GenericOp producer, GenericOp consumer,
+                                   unsigned operandIndex) {
+    linalg::GenericOp producerBody = getElementwiseBody(producer);
+    linalg::GenericOp consumerBody = getElementwiseBody(consumer);
+    const unsigned numProducerInputs = producer.getInputs().size();
+    const unsigned numConsumerInputs = consumer.getInputs().size();
+
+    SmallVector<Value> inputs(consumer.getInputs().take_front(operandIndex));
+    llvm::append_range(inputs, producer.getInputs());
+    llvm::append_range(inputs,
+                       consumer.getInputs().drop_front(operandIndex + 1));
+
+    SmallVector<AffineMap> indexingMaps(
+        inputs.size() + 1,
+        rewriter.getMultiDimIdentityMap(consumer.getNumDims()));
+
+    return rewriter.create<GenericOp>(
+        consumer.getLoc(), inputs, consumer.getOutputs(),
+        rewriter.getAffineMapArrayAttr(indexingMaps),
+        consumer.getIteratorTypes(),
+        [&](OpBuilder &builder, Location loc, ValueRange blockArgs) {
+          Value output = blockArgs.back();
+          builder.create<linalg::GenericOp>(
+              loc, blockArgs.drop_back(), output,
+              getIdentityMaps(builder, blockArgs.size(), output),
+              getParallelIterators(output),
+              [&](OpBuilder &bbBuilder, Location bbLoc, ValueRange bbArgs) {
+                IRMapping mapping;
+
+                Block &producerPayload = producerBody.getRegion().front();
+                for (unsigned i = 0; i < numProducerInputs; ++i) {
+                  mapping.map(producerPayload.getArgument(i),
+                              bbArgs[operandIndex + i]);
+                }
+                mapping.map(producerPayload.getArguments().back(),
+                            bbArgs.back());
+                Value intermediate =
+                    clonePayload(bbBuilder, producerPayload, mapping);
+
+                Block &consumerPayload = consumerBody.getRegion().front();
+                for (unsigned i = 0; i < numConsumerInputs; ++i) {
+                  Value arg =
+                      i < operandIndex
+                          ? bbArgs[i]
+                          : (i == operandIndex
+                                 ? intermediate
+                                 : bbArgs[i + numProducerInputs - 1]);
+                  mapping.map(consumerPayload.getArgument(i), arg);
+                }
+                mapping.map(consumerPayload.getArguments().back(),
+                            bbArgs.back());
+                Value result =
+                    clonePayload(bbBuilder, consumerPayload, mapping);
+
+                bbBuilder.create<linalg::YieldOp>(bbLoc, result);
+              });
+        },
+        consumer.getGrid());
+  }
+
+  // Elementwise epilogue into tile_matmul_block: the matmul accumulates into
+  // the consumer's output block and the epilogue is applied to it in place.
+  static GenericOp fuseMatmulEpilogue(PatternRewriter &rewriter,
+                                      GenericOp producer, GenericOp consumer,
+                                      unsigned operandIndex) {
+    linalg::GenericOp consumerBody = getElementwiseBody(consumer);
+    Block *producerBlock = getComputeBlock(producer);
+    const unsigned numProducerInputs = producer.getInputs().size();
+    const unsigned numConsumerInputs = consumer.getInputs().size();
+
+    SmallVector<Value> inputs(producer.getInputs());
+    for (unsigned i = 0; i < numConsumerInputs; ++i) {
+      if (i != operandIndex) {
+        inputs.push_back(consumer.getInputs()[i]);
+      }
+    }
+
+    // Epilogue operands are indexed like the matmul output.
+    SmallVector<AffineMap> producerMaps = producer.getIndexingMapsValue();
+    AffineMap outputMap = producerMaps.back();
+    SmallVector<AffineMap> indexingMaps(
+        producerMaps.begin(), producerMaps.begin() + numProducerInputs);
+    indexingMaps.append(numConsumerInputs, outputMap);
+
+    return rewriter.create<GenericOp>(
+        consumer.getLoc(), inputs, consumer.getOutputs(),
+        rewriter.getAffineMapArrayAttr(indexingMaps),
+        producer.getIteratorTypes(),
+        [&](OpBuilder &builder, Location loc, ValueRange blockArgs) {
+          Value output = blockArgs.back();
+
+          IRMapping mapping;
+          for (unsigned i = 0; i < numProducerInputs; ++i) {
+            mapping.map(producerBlock->getArgument(i), blockArgs[i]);
+          }
+          mapping.map(producerBlock->getArguments().back(), output);
+          for (Operation &op : *producerBlock) {
+            builder.clone(op, mapping);
+          }
+
+          SmallVector<Value> epilogueInputs;
+          for (unsigned i = 0, j = numProducerInputs; i < numConsumerInputs;
+               ++i) {
+            epilogueInputs.push_back(i == operandIndex ? output
+                                                       : blockArgs[j++]);
+          }
+
+          builder.create<linalg::GenericOp>(
+              loc, epilogueInputs, output,
+              getIdentityMaps(builder, numConsumerInputs + 1, output),
+              getParallelIterators(output),
+              [&](OpBuilder &bbBuilder, Location bbLoc, ValueRange bbArgs) {
+                IRMapping payloadMapping;
+                Block &payload = consumerBody.getRegion().front();
+                payloadMapping.map(payload.getArguments(), bbArgs);
+                Value result = clonePayload(bbBuilder, payload, payloadMapping);
+                bbBuilder.create<linalg::YieldOp>(bbLoc, result);
+              });
+        },
+        producer.getGrid());
+  }
+
+  LogicalResult matchAndRewrite(GenericOp consumer,
+                                PatternRewriter &rewriter) const final {
+    linalg::GenericOp consumerBody = getElementwiseBody(consumer);
+    if (!consumerBody) {
+      return failure();
+    }
+
+    Block &consumerPayload = consumerBody.getRegion().front();
+    for (OpOperand &input : consumer.getInputsMutable()) {
+      auto producer = input.get().getDefiningOp<GenericOp>();
+      if (!producer || !producer->hasOneUse() ||
+          producer.getGrid() != consumer.getGrid()) {
+        continue;
+      }
+
+      const unsigned operandIndex = input.getOperandNumber();
+      BlockArgument payloadArg = consumerPayload.getArgument(operandIndex);
+
+      GenericOp fused;
+      if (linalg::GenericOp producerBody = getElementwiseBody(producer)) {
+        Block &producerPayload = producerBody.getRegion().front();
+        Value yielded = producerPayload.getTerminator()->getOperand(0);
+        if (!yielded.getDefiningOp() || !payloadArg.hasOneUse() ||
+            !isDstChainable(*payloadArg.use_begin())) {
+          continue;
+        }
+        fused = fuseElementwise(rewriter, producer, consumer, operandIndex);
+      } else if (isFusibleMatmulBlock(producer)) {
+        // The epilogue runs in place on the matmul output block. This is only
+        // safe if each tile is copied into DST before the result is packed
+        // back over it, i.e. the block heads a DST chain and is read nowhere
+        // else in the epilogue.
+        if (producer.getOutputs().front().getType() !=
+                consumer.getOutputs().front().getType() ||
+            !payloadArg.hasOneUse() ||
+            !isDstChainable(*payloadArg.use_begin())) {
+          continue;
+        }
+        fused = fuseMatmulEpilogue(rewriter, producer, consumer, operandIndex);
+      } else {
+        continue;
+      }
+
+      rewriter.replaceOp(consumer, fused->getResults());
+      rewriter.eraseOp(producer);
+      return success();
+    }
+
+    return failure();
+  }
+};
+} // namespace
+
+namespace {
+class TTIRGenericOpFusion
+    : public impl::TTIRGenericOpFusionBase<TTIRGenericOpFusion> {
+public:
+  using impl::TTIRGenericOpFusionBase<
+      TTIRGenericOpFusion>::TTIRGenericOpFusionBase;
+
+  void runOnOperation() final {
+    RewritePatternSet patterns(&getContext());
+    patterns.add<TTIRGenericOpFusionRewriter>(&getContext());
+    if (failed(applyPatternsGreedily(getOperation(), std::move(patterns)))) {
+      signalPassFailure();
+    }
+  }
+
+  void getDependentDialects(mlir::DialectRegistry &registry) const override {
+    registry.insert<mlir::linalg::LinalgDialect>();
+  }
+};
+} // namespace
+
+} // namespace mlir::tt::ttir
@@ -5,15 +5,22 @@
 #include "ttmlir/Dialect/TT/IR/TT.h"
 #include "ttmlir/Dialect/TT/IR/TTOps.h"
 #include "ttmlir/Dialect/TTIR/Transforms/Passes.h"
+#include "ttmlir/Utils.h"
 
 #include "mlir/Dialect/Func/IR/FuncOps.h"
 #include "mlir/Dialect/Tensor/IR/Tensor.h"
 #include "mlir/IR/PatternMatch.h"
 #include "mlir/Transforms/DialectConversion.h"
 #include "mlir/Transforms/GreedyPatternRewriteDriver.h"
-#include "llvm/ADT/SmallSet.h"
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/SetVector.h"
+#include "llvm/ADT/SmallPtrSet.h"
 #include "llvm/ADT/SmallString.h"
 #include "llvm/ADT/SmallVector.h"
+#include "llvm/ADT/StringExtras.h"
+#include "llvm/Support/JSON.h"
+#include "llvm/Support/raw_ostream.h"
+#include "llvm/Support/xxhash.h"
 
 namespace mlir::tt::ttir {
 #define GEN_PASS_DEF_TTIRHOISTTRANSFORM
@@ -23,17 +30,16 @@ namespace mlir::tt::ttir {
 // Hoist CPU ops to standalone funcs pass
 //===----------------------------------------------------------------------===//
 
-// Helper function to get ranks of an op's operands
+// Helper function to get ranks of tensor values
 // we use this to populate attrs which we need to tensor unpacking operations
 // later.
 static llvm::SmallVector<int64_t, 4>
-getOperandTensorRanks(mlir::Operation *op) {
+getTensorRanks(mlir::ValueRange values) {
   llvm::SmallVector<int64_t, 4> ranks;
 
-  // Iterate over operands (inputs)
-  for (auto operand : op->getOperands()) {
-    // Check if the operand is a tensor
-    if (auto tensorType = dyn_cast<mlir::RankedTensorType>(operand.getType())) {
+  for (auto value : values) {
+    // Check if the value is a tensor
+    if (auto tensorType = dyn_cast<mlir::RankedTensorType>(value.getType())) {
       // Add the rank of the tensor (number of dimensions)
       ranks.push_back(tensorType.getRank());
     }
@@ -60,6 +66,55 @@ static llvm::SmallString<16> generateHoistedFuncName(mlir::Operation *op) {
   return uniqueName;
 }
 
+// Generate unique name for a cluster of ops based on the types of the ops and
+// the argument tensors dims. Different clusters may contain the same ops
+// connected differently, so a hash of the cluster structure is appended too.
+static llvm::SmallString<16>
+generateHoistedClusterFuncName(llvm::ArrayRef<mlir::Operation *> ops,
+                               llvm::ArrayRef<mlir::Value> inputs) {
+  llvm::SmallString<16> uniqueName("hoisted");
+  for (mlir::Operation *op : ops) {
+    uniqueName += "_";
+    uniqueName.append(op->getName().getStringRef());
+  }
+
+  for (auto input : inputs) {
+    if (auto tensorType = dyn_cast<mlir::RankedTensorType>(input.getType())) {
+      uniqueName += "_";
+      llvm::raw_svector_ostream os(uniqueName);
+      llvm::interleave(tensorType.getShape(), os, "x");
+    }
+  }
+
+  // Describe where every operand of every op comes from: a function argument,
+  // a previous op of the cluster, or an internal empty tensor.
+  std::string structure;
+  llvm::raw_string_ostream os(structure);
+  for (mlir::Operation *op : ops) {
+    os << op->getName() << "(";
+    for (auto operand : op->getOperands()) {
+      auto *inputIt = llvm::find(inputs, operand);
+      auto *producerIt = llvm::find(ops, operand.getDefiningOp());
+      if (inputIt != inputs.end()) {
+        os << "arg" << std::distance(inputs.begin(), inputIt);
+      } else if (producerIt != ops.end()) {
+        os << "op" << std::distance(ops.begin(), producerIt);
+      } else {
+        os << "empty" << operand.getType();
+      }
+      os << ",";
+    }
+    os << ")";
+  }
+  uniqueName += "_";
+  uniqueName += llvm::utohexstr(llvm::xxh3_64bits(structure),
+                                /*LowerCase=*/true);
+
+  uniqueName += "_func";
+  std::replace(uniqueName.begin(), uniqueName.end(), '.', '_');
+  return uniqueName;
+}
+
 // Tag bufferization access options based on operand semantics.
 static void tagBufferizationAccess(mlir::func::FuncOp funcOp, unsigned argIdx,
                                    mlir::Operation *origOp,
@@ -78,35 +133,113 @@ static void tagBufferizationAccess(mlir::func::FuncOp funcOp, unsigned argIdx,
   }
 }
 
-// Helper function to hoist an arbitrary op into a new function in targetModule,
-// generate a matching extern prototype in the sourceModule, and replace the
-// original op with a callOp to the extern function.
-static void hoistOperationToFunction(mlir::Operation *opToHoist,
-                                     mlir::ModuleOp sourceModule,
-                                     mlir::ModuleOp targetModule) {
+// Tag bufferization access options of a cluster function. The last argument is
+// the output of the cluster, other arguments are only read unless some op of
+// the cluster writes into them.
+static void tagClusterBufferizationAccess(
+    mlir::func::FuncOp funcOp, unsigned argIdx,
+    llvm::ArrayRef<mlir::Operation *> ops, mlir::Value input,
+    mlir::OpBuilder &builder) {
+  if (argIdx == funcOp.getNumArguments() - 1) {
+    funcOp.setArgAttr(argIdx, "bufferization.access",
+                      builder.getStringAttr("write"));
+    return;
+  }
+
+  bool isWritten = llvm::any_of(ops, [&](mlir::Operation *op) {
+    auto dpsOp = dyn_cast<mlir::DestinationStyleOpInterface>(op);
+    return !dpsOp || llvm::is_contained(dpsOp.getDpsInits(), input);
+  });
+  funcOp.setArgAttr(argIdx, "bufferization.access",
+                    builder.getStringAttr(isWritten ? "read_write" : "read"));
+}
+
+// Returns the operands the hoisted function of `opsToHoist` takes. A single op
+// takes all its operands. A cluster takes the values it uses from outside of
+// the cluster, with the output tensor of its last op as the last argument,
+// since the runtime writes the result of a CPU op into its last input. Empty
+// output tensors of the other ops of a cluster are created inside the hoisted
+// function, so they aren't copied to the host.
+static llvm::SmallVector<mlir::Value> getHoistedFuncInputs(
+    llvm::ArrayRef<mlir::Operation *> opsToHoist,
+    llvm::SmallVector<mlir::tt::ttir::EmptyOp> &internalEmpties) {
+  if (opsToHoist.size() == 1) {
+    return llvm::to_vector(opsToHoist.front()->getOperands());
+  }
 
-  const llvm::SmallVector<int64_t, 4> ranks = getOperandTensorRanks(opToHoist);
+  mlir::Operation *lastOp = opsToHoist.back();
+  mlir::Value output =
+      cast<mlir::DestinationStyleOpInterface>(lastOp).getDpsInits().front();
+
+  llvm::SetVector<mlir::Value> inputs;
+  for (mlir::Operation *op : opsToHoist) {
+    auto dpsOp = cast<mlir::DestinationStyleOpInterface>(op);
+    for (mlir::OpOperand &operand : op->getOpOperands()) {
+      mlir::Value value = operand.get();
+      if (value == output ||
+          llvm::is_contained(opsToHoist, value.getDefiningOp())) {
+        continue;
+      }
+      auto emptyOp = value.getDefiningOp<mlir::tt::ttir::EmptyOp>();
+      if (op != lastOp && emptyOp && value.hasOneUse() &&
+          dpsOp.isDpsInit(&operand)) {
+        internalEmpties.push_back(emptyOp);
+        continue;
+      }
+      inputs.insert(value);
+    }
+  }
+  inputs.insert(output);
+
+  return llvm::to_vector(inputs);
+}
+
+// Returns `type` with f32 elements if it is a tensor type.
+static mlir::Type getF32Type(mlir::Type type) {
+  if (auto tensorType = dyn_cast<mlir::RankedTensorType>(type)) {
+    if (!tensorType.getElementType().isF32()) {
+      return RankedTensorType::get(tensorType.getShape(),
+                                   mlir::Float32Type::get(type.getContext()),
+                                   tensorType.getEncoding());
+    }
+  }
+  return type;
+}
+
+// Helper function to hoist an arbitrary op, or a cluster of ops where only the
+// result of the last one is used outside of the cluster, into a new function
+// in targetModule, generate a matching extern prototype in the sourceModule,
+// and replace the ops with a callOp to the extern function.
+static void hoistOperationsToFunction(
+    llvm::ArrayRef<mlir::Operation *> opsToHoist, mlir::ModuleOp sourceModule,
+    mlir::ModuleOp targetModule) {
+  mlir::Operation *lastOp = opsToHoist.back();
+  const bool isCluster = opsToHoist.size() > 1;
+
+  llvm::SmallVector<mlir::tt::ttir::EmptyOp> internalEmpties;
+  const llvm::SmallVector<mlir::Value> inputs =
+      getHoistedFuncInputs(opsToHoist, internalEmpties);
+
+  const llvm::SmallVector<int64_t, 4> ranks = getTensorRanks(inputs);
   mlir::MLIRContext *context = sourceModule.getContext();
-  mlir::OpBuilder typeBuilder(opToHoist);
+  mlir::OpBuilder typeBuilder(lastOp);
   auto f32Type = mlir::Float32Type::get(context);
 
   // Convert operands and gather types for function signature
   llvm::SmallVector<mlir::Type> operandTypes;
   llvm::SmallVector<mlir::Value> convertedOperands;
 
-  for (auto operand : opToHoist->getOperands()) {
+  for (auto operand : inputs) {
     if (auto tensorType = dyn_cast<mlir::RankedTensorType>(operand.getType())) {
       if (!tensorType.getElementType().isF32()) {
         // Create f32 version of tensor type
-        auto f32TensorType = RankedTensorType::get(
-            tensorType.getShape(), f32Type, tensorType.getEncoding());
-        operandTypes.push_back(f32TensorType);
+        operandTypes.push_back(getF32Type(tensorType));
 
         // Create converted tensor value
         auto emptyTensor = typeBuilder.create<mlir::tt::ttir::EmptyOp>(
-            opToHoist->getLoc(), tensorType.getShape(), f32Type);
+            lastOp->getLoc(), tensorType.getShape(), f32Type);
         auto converted = typeBuilder.create<mlir::tt::ttir::ToLayoutOp>(
-            opToHoist->getLoc(), operand, emptyTensor);
+            lastOp->getLoc(), operand, emptyTensor);
         convertedOperands.push_back(converted->getResult(0));
       } else {
         operandTypes.push_back(tensorType);
@@ -120,17 +253,8 @@ static void hoistOperationToFunction(mlir::Operation *opToHoist,
 
   // Gather result types for function signature
   llvm::SmallVector<mlir::Type> resultTypes;
-  for (auto result : opToHoist->getResultTypes()) {
-    if (auto tensorType = dyn_cast<mlir::RankedTensorType>(result)) {
-      if (!tensorType.getElementType().isF32()) {
-        resultTypes.push_back(RankedTensorType::get(
-            tensorType.getShape(), f32Type, tensorType.getEncoding()));
-      } else {
-        resultTypes.push_back(tensorType);
-      }
-    } else {
-      resultTypes.push_back(result);
-    }
+  for (auto result : lastOp->getResultTypes()) {
+    resultTypes.push_back(getF32Type(result));
   }
 
   // Create function types
@@ -139,7 +263,9 @@ static void hoistOperationToFunction(mlir::Operation *opToHoist,
   mlir::FunctionType funcType =
       mlir::FunctionType::get(context, operandTypes, {});
 
-  const llvm::SmallString<16> functionName = generateHoistedFuncName(opToHoist);
+  const llvm::SmallString<16> functionName =
+      isCluster ? generateHoistedClusterFuncName(opsToHoist, inputs)
+                : generateHoistedFuncName(lastOp);
   llvm::SmallString<16> localFunctionName = functionName;
   localFunctionName.append("_decl");
 
@@ -150,65 +276,64 @@ static void hoistOperationToFunction(mlir::Operation *opToHoist,
   if (localFunc == nullptr) {
     // Insert the function and the terminator
     auto hoistedFunc =
-        func::FuncOp::create(opToHoist->getLoc(), functionName, funcType);
+        func::FuncOp::create(lastOp->getLoc(), functionName, funcType);
     targetModule.push_back(hoistedFunc);
 
     // Add a basic block to the function.
     mlir::Block *block = hoistedFunc.addEntryBlock();
     mlir::OpBuilder builder(block, block->end());
 
-    // Map operands to block arguments and clone the operation.
-    llvm::SmallVector<mlir::Value> newOperands;
-    for (auto operand : llvm::enumerate(opToHoist->getOperands())) {
-      newOperands.push_back(block->getArgument(operand.index()));
-    }
-
     // Add bufferization access attributes to function arguments
-    for (auto arg : llvm::enumerate(hoistedFunc.getArguments())) {
-      if (auto tensorType =
-              dyn_cast<mlir::RankedTensorType>(arg.value().getType())) {
-        tagBufferizationAccess(hoistedFunc, arg.index(), opToHoist, builder);
+    auto tagArgs = [&](func::FuncOp funcOp) {
+      for (auto arg : llvm::enumerate(funcOp.getArguments())) {
+        if (!isa<mlir::RankedTensorType>(arg.value().getType())) {
+          continue;
+        }
+        if (isCluster) {
+          tagClusterBufferizationAccess(funcOp, arg.index(), opsToHoist,
+                                        inputs[arg.index()], builder);
+        } else {
+          tagBufferizationAccess(funcOp, arg.index(), lastOp, builder);
+        }
       }
-    }
+    };
+    tagArgs(hoistedFunc);
 
+    // Map inputs to block arguments and create the internal output tensors.
     mlir::IRMapping mapping;
-    for (auto operand : llvm::zip(opToHoist->getOperands(), newOperands)) {
-      mapping.map(std::get<0>(operand), std::get<1>(operand));
+    for (auto input : llvm::enumerate(inputs)) {
+      mapping.map(input.value(), block->getArgument(input.index()));
+    }
+    for (mlir::tt::ttir::EmptyOp emptyOp : internalEmpties) {
+      auto internalEmpty = builder.create<mlir::tt::ttir::EmptyOp>(
+          emptyOp.getLoc(), emptyOp.getType().getShape(), f32Type);
+      mapping.map(emptyOp.getResult(), internalEmpty.getResult());
     }
 
-    // Clone the operation but modify its type if needed
-    auto *clonedOp = builder.clone(*opToHoist, mapping);
-
-    // Update operand types to f32 for tensor types
-    for (auto i : llvm::seq<unsigned>(0, clonedOp->getNumOperands())) {
-      if (auto tensorType = dyn_cast<mlir::RankedTensorType>(
-              clonedOp->getOperand(i).getType())) {
-        if (!tensorType.getElementType().isF32()) {
-          auto newType = RankedTensorType::get(tensorType.getShape(), f32Type,
-                                               tensorType.getEncoding());
-          clonedOp->getOperand(i).setType(newType);
-        }
+    // Clone the operations but modify their types if needed
+    for (mlir::Operation *opToHoist : opsToHoist) {
+      auto *clonedOp = builder.clone(*opToHoist, mapping);
+
+      // Update operand types to f32 for tensor types
+      for (auto i : llvm::seq<unsigned>(0, clonedOp->getNumOperands())) {
+        clonedOp->getOperand(i).setType(
+            getF32Type(clonedOp->getOperand(i).getType()));
       }
-    }
 
-    // Update result types to f32 for tensor types
-    for (auto i : llvm::seq<unsigned>(0, clonedOp->getNumResults())) {
-      if (auto tensorType = dyn_cast<mlir::RankedTensorType>(
-              clonedOp->getResult(i).getType())) {
-        if (!tensorType.getElementType().isF32()) {
-          auto newType = RankedTensorType::get(tensorType.getShape(), f32Type,
-                                               tensorType.getEncoding());
-          clonedOp->getResult(i).setType(newType);
-        }
+      // Update result types to f32 for tensor types
+      for (auto i : llvm::seq<unsigned>(0, clonedOp->getNumResults())) {
+        clonedOp->getResult(i).setType(
+            getF32Type(clonedOp->getResult(i).getType()));
       }
+
     }
 
     // Add a return operation to the function.
-    builder.create<mlir::func::ReturnOp>(opToHoist->getLoc(), ValueRange());
+    builder.create<mlir::func::ReturnOp>(lastOp->getLoc(), ValueRange());
 
     // Declare the function prototype in the source module.
-    localFunc = func::FuncOp::create(opToHoist->getLoc(),
-                                     localFunctionName.str(), localFuncType);
+    localFunc = func::FuncOp::create(lastOp->getLoc(), localFunctionName.str(),
+                                     localFuncType);
     localFunc.setPrivate();
 
     // Add the function to the module first
@@ -216,36 +341,30 @@ static void hoistOperationToFunction(mlir::Operation *opToHoist,
 
     // Now that the function is in the module, add bufferization access
     // attributes
-    for (auto arg : llvm::enumerate(localFunc.getArguments())) {
-      if (auto tensorType =
-              dyn_cast<mlir::RankedTensorType>(arg.value().getType())) {
-        tagBufferizationAccess(localFunc, arg.index(), opToHoist, builder);
-      }
-    }
+    tagArgs(localFunc);
 
     hoistedFunc->setAttr("arg_ranks", builder.getI64ArrayAttr(ranks));
   }
 
   // Create the call using already converted inputs
-  mlir::OpBuilder opBuilder(opToHoist);
+  mlir::OpBuilder opBuilder(lastOp);
   auto callOp = opBuilder.create<mlir::func::CallOp>(
-      opToHoist->getLoc(), localFunc, convertedOperands);
+      lastOp->getLoc(), localFunc, convertedOperands);
 
   // Add the hoisted_call attribute
-  callOp->setAttr(HoistedCallAttr::name,
-                  UnitAttr::get(opToHoist->getContext()));
+  callOp->setAttr(HoistedCallAttr::name, UnitAttr::get(lastOp->getContext()));
 
   // Convert results back to original types if needed
   llvm::SmallVector<mlir::Value> finalResults;
   for (auto [result, callResult] :
-       llvm::zip(opToHoist->getResults(), callOp.getResults())) {
+       llvm::zip(lastOp->getResults(), callOp.getResults())) {
     if (auto tensorType = dyn_cast<mlir::RankedTensorType>(result.getType())) {
       if (!tensorType.getElementType().isF32()) {
         auto converted = opBuilder.create<mlir::tt::ttir::EmptyOp>(
-            opToHoist->getLoc(), tensorType.getShape(),
+            lastOp->getLoc(), tensorType.getShape(),
             tensorType.getElementType());
         auto toOriginal = opBuilder.create<mlir::tt::ttir::ToLayoutOp>(
-            opToHoist->getLoc(), callResult, converted);
+            lastOp->getLoc(), callResult, converted);
         finalResults.push_back(toOriginal->getResult(0));
       } else {
         finalResults.push_back(callResult);
@@ -255,25 +374,288 @@ static void hoistOperationToFunction(mlir::Operation *opToHoist,
     }
   }
 
-  // Replace original op with the converted results
-  opToHoist->replaceAllUsesWith(finalResults);
+  // Replace the result of the last op with the converted results
+  lastOp->replaceAllUsesWith(finalResults);
+
+  // Erase the original operations, users first
+  for (mlir::Operation *opToHoist : llvm::reverse(opsToHoist)) {
+    opToHoist->erase();
+  }
+  for (mlir::tt::ttir::EmptyOp emptyOp : internalEmpties) {
+    emptyOp->erase();
+  }
+}
+
+// Rough costs used to decide whether an op should run on the host instead of
+// the device: host <-> device copies, kernel dispatch, and elementwise
+// throughput of the Linalg lowering on the host and of the device kernels,
+// which always process whole tiles.
+static constexpr double kTransferLatencyNs = 5000.0;
+static constexpr double kTransferBytesPerNs = 10.0;
+static constexpr double kHostElementsPerNs = 1.0;
+static constexpr double kDeviceElementsPerNs = 100.0;
+static constexpr double kKernelLaunchNs = 10000.0;
+
+static double getTransferNs(mlir::Value value) {
+  auto tensorType = cast<mlir::RankedTensorType>(value.getType());
+  const double bytes =
+      tensorType.getNumElements() *
+      std::max<int64_t>(tensorType.getElementTypeBitWidth() / 8, 1);
+  return kTransferLatencyNs + bytes / kTransferBytesPerNs;
+}
+
+static double getHostComputeNs(mlir::Operation *op) {
+  auto tensorType = cast<mlir::RankedTensorType>(op->getResult(0).getType());
+  return tensorType.getNumElements() / kHostElementsPerNs;
+}
+
+static double getDeviceComputeNs(mlir::Operation *op) {
+  auto tensorType = cast<mlir::RankedTensorType>(op->getResult(0).getType());
+  llvm::SmallVector<int64_t> paddedShape(tensorType.getShape());
+  const auto tileShape = TileType::getDefaultShape();
+  if (!paddedShape.empty()) {
+    paddedShape.back() =
+        ttmlir::utils::alignUp<int64_t>(paddedShape.back(), tileShape[1]);
+  }
+  if (paddedShape.size() > 1) {
+    int64_t &height = paddedShape[paddedShape.size() - 2];
+    height = ttmlir::utils::alignUp<int64_t>(height, tileShape[0]);
+  }
+  return kKernelLaunchNs +
+         ttmlir::utils::volume<int64_t>(paddedShape) / kDeviceElementsPerNs;
+}
+
+// Ops that have a TTIR to Linalg lowering, so they can run on the host. The
+// host path computes in f32, which can't represent every integer above 2^24,
+// so ops on integer tensors are only hoisted when they are tagged.
+static bool isHostLowerable(mlir::Operation *op) {
+  if (!isa<AbsOp, AddOp, CeilOp, DivOp, ExpOp, FloorOp, LogOp, MultiplyOp,
+           NegOp, PowOp, ReciprocalOp, RsqrtOp, SqrtOp, SubtractOp, TanhOp>(
+          op)) {
+    return false;
+  }
+  auto isFloatTensor = [](mlir::Type type) {
+    auto tensorType = dyn_cast<mlir::RankedTensorType>(type);
+    return tensorType && isa<mlir::FloatType>(tensorType.getElementType());
+  };
+  return llvm::all_of(op->getOperandTypes(), isFloatTensor) &&
+         llvm::all_of(op->getResultTypes(), isFloatTensor);
+}
+
+// Hoisted clusters are functions that write their single result into their
+// last argument, so only ops with a single output tensor are merged.
+static bool isClusterable(mlir::Operation *op) {
+  auto dpsOp = dyn_cast<mlir::DestinationStyleOpInterface>(op);
+  return dpsOp && op->getNumResults() == 1 && dpsOp.getNumDpsInits() == 1;
+}
+
+// Returns the cluster that all users of `op` belong to, if any. Ops are
+// clustered in reverse program order, and an op only joins the cluster of its
+// users, so every cluster has a single result.
+static std::optional<unsigned>
+getUsersCluster(mlir::Operation *op,
+                const llvm::DenseMap<mlir::Operation *, unsigned> &clusterOf) {
+  if (!isClusterable(op) || op->use_empty()) {
+    return std::nullopt;
+  }
+
+  std::optional<unsigned> cluster;
+  for (mlir::Operation *user : op->getUsers()) {
+    auto it = clusterOf.find(user);
+    if (it == clusterOf.end() || (cluster && *cluster != it->second)) {
+      return std::nullopt;
+    }
+    cluster = it->second;
+  }
+  return cluster;
+}
 
-  // Erase the original operation
-  opToHoist->erase();
+static std::string getOpLocName(mlir::Operation *op) {
+  if (auto loc = dyn_cast<mlir::NameLoc>(op->getLoc())) {
+    return loc.getName().str();
+  }
+  return "";
 }
 
+// An analysis class which decides which ops run on the host.
+//
+// Host lowerable ops are grouped into subgraphs the way TTIRHoistAnalyze
+// clusters hoisted ops, so that every subgraph placed on the host becomes one
+// hoisted function with a single result; without clustering every op is a
+// subgraph of its own. A subgraph is placed on the host if its estimated host
+// latency, including the copies of the values it exchanges with the device, is
+// lower than its estimated device latency, which is dominated by kernel
+// dispatch for small tensors. Ops can also be forced to either side by their
+// location names; ops already tagged with `should_hoist` stay on the host.
+class TTIRPlacementAnalysis {
+public:
+  struct Decision {
+    mlir::Operation *op;
+    bool onHost;
+    bool overridden;
+    unsigned subgraph;
+    double hostNs;
+    double deviceNs;
+  };
+
+  TTIRPlacementAnalysis(mlir::ModuleOp moduleOp, bool autoPlacement,
+                        bool clusterOps, llvm::ArrayRef<std::string> hostLocs,
+                        llvm::ArrayRef<std::string> deviceLocs)
+      : autoPlacement(autoPlacement), clusterOps(clusterOps),
+        hostLocs(hostLocs.begin(), hostLocs.end()),
+        deviceLocs(deviceLocs.begin(), deviceLocs.end()) {
+    moduleOp.walk([&](mlir::Block *block) { analyzeBlock(block); });
+  }
+
+  llvm::ArrayRef<Decision> getResults() const { return decisions; }
+
+private:
+  // Returns the forced placement of `op`, if any.
+  std::optional<bool> getOverride(mlir::Operation *op) const {
+    const std::string locName = getOpLocName(op);
+    if (!locName.empty() && llvm::is_contained(deviceLocs, locName)) {
+      return false;
+    }
+    if (op->hasAttr("should_hoist") ||
+        (!locName.empty() && llvm::is_contained(hostLocs, locName))) {
+      return true;
+    }
+    return std::nullopt;
+  }
+
+  bool isOnHost(mlir::Operation *op) const {
+    auto it = placement.find(op);
+    return it != placement.end() && it->second;
+  }
+
+  void analyzeBlock(mlir::Block *block) {
+    // Overrides are applied first, so that subgraphs know where the values
+    // they exchange live.
+    llvm::SmallVector<mlir::Operation *> candidates;
+    for (mlir::Operation &op : block->getOperations()) {
+      if (std::optional<bool> onHost = getOverride(&op)) {
+        placement[&op] = *onHost;
+        decisions.push_back({&op, *onHost, /*overridden=*/true,
+                             /*subgraph=*/0, /*hostNs=*/0.0,
+                             /*deviceNs=*/0.0});
+      } else if (autoPlacement && isHostLowerable(&op) &&
+                 isClusterable(&op)) {
+        candidates.push_back(&op);
+      }
+    }
+
+    llvm::DenseMap<mlir::Operation *, unsigned> subgraphOf;
+    llvm::SmallVector<llvm::SmallVector<mlir::Operation *>> subgraphs;
+    for (mlir::Operation *op : llvm::reverse(candidates)) {
+      std::optional<unsigned> subgraph;
+      if (clusterOps) {
+        subgraph = getUsersCluster(op, subgraphOf);
+      }
+      if (subgraph) {
+        subgraphOf[op] = *subgraph;
+        subgraphs[*subgraph].push_back(op);
+      } else {
+        subgraphOf[op] = subgraphs.size();
+        subgraphs.push_back({op});
+      }
+    }
+
+    // Subgraphs are created in reverse program order of their last op, which
+    // comes after the last op of every subgraph it takes inputs from, so
+    // producers are decided before their users.
+    for (llvm::SmallVector<mlir::Operation *> &members :
+         llvm::reverse(subgraphs)) {
+      std::reverse(members.begin(), members.end());
+      decideSubgraph(members);
+    }
+  }
+
+  void decideSubgraph(llvm::ArrayRef<mlir::Operation *> members) {
+    llvm::SmallPtrSet<mlir::Operation *, 8> memberSet(members.begin(),
+                                                      members.end());
+    llvm::SmallPtrSet<mlir::Value, 8> externalInputs;
+    double hostNs = 0.0;
+    double deviceNs = 0.0;
+    for (mlir::Operation *op : members) {
+      hostNs += getHostComputeNs(op);
+      deviceNs += getDeviceComputeNs(op);
+
+      // Inputs computed outside of the subgraph are copied to the side that
+      // doesn't have them yet, once no matter how many members use them.
+      for (mlir::Value input :
+           cast<mlir::DestinationStyleOpInterface>(op).getDpsInputs()) {
+        mlir::Operation *producer = input.getDefiningOp();
+        if ((producer && memberSet.contains(producer)) ||
+            !externalInputs.insert(input).second) {
+          continue;
+        }
+        if (producer && isOnHost(producer)) {
+          deviceNs += getTransferNs(input);
+        } else {
+          hostNs += getTransferNs(input);
+        }
+      }
+
+      // Results used outside of the subgraph are copied to the side of their
+      // users.
+      bool usedOnHost = false;
+      bool usedOnDevice = false;
+      for (mlir::Operation *user : op->getUsers()) {
+        if (memberSet.contains(user)) {
+          continue;
+        }
+        (isOnHost(user) ? usedOnHost : usedOnDevice) = true;
+      }
+      if (usedOnHost) {
+        deviceNs += getTransferNs(op->getResult(0));
+      }
+      if (usedOnDevice) {
+        hostNs += getTransferNs(op->getResult(0));
+      }
+    }
+
+    const bool onHost = hostNs < deviceNs;
+    const unsigned subgraph = numSubgraphs++;
+    for (mlir::Operation *op : members) {
+      placement[op] = onHost;
+      decisions.push_back({op, onHost, /*overridden=*/false, subgraph, hostNs,
+                           deviceNs});
+    }
+  }
+
+  bool autoPlacement;
+  bool clusterOps;
+  llvm::SmallVector<std::string> hostLocs;
+  llvm::SmallVector<std::string> deviceLocs;
+  llvm::DenseMap<mlir::Operation *, bool> placement;
+  llvm::SmallVector<Decision> decisions;
+  unsigned numSubgraphs = 0;
+};
+
 // An analysis class which currently relies on manually tagging ops with a
 // `should_hoist` attribute, but in the future will also tag fall-back ops, etc.
+//
+// With clustering enabled, connected hoisted ops are merged into a single
+// hoisted function, so that a chain of CPU ops copies its inputs to the host
+// and its result to the device once, instead of once per op. An op is merged
+// into the cluster of its users if all of them are in the same cluster, which
+// keeps a single result per cluster. Untagged ops between hoisted ops join the
+// cluster too if running them on the host is cheaper than the copies they
+// cause.
 class TTIRHoistAnalyze {
 public:
-  using HoistOpSet = llvm::SmallVector<llvm::SmallSet<mlir::Operation *, 4>>;
-
-  TTIRHoistAnalyze(mlir::ModuleOp moduleOp) {
-    moduleOp.walk([&](mlir::Operation *nestedOp) {
-      if (nestedOp->hasAttr("should_hoist")) {
-        llvm::SmallSet<mlir::Operation *, 4> opSet;
-        opSet.insert(nestedOp);
-        hoistedOps.push_back(opSet);
+  using HoistOpSet = llvm::SmallVector<llvm::SmallVector<mlir::Operation *, 4>>;
+
+  TTIRHoistAnalyze(mlir::ModuleOp moduleOp, bool clusterOps) {
+    moduleOp.walk([&](mlir::Block *block) {
+      if (clusterOps) {
+        clusterBlock(block);
+        return;
+      }
+      for (mlir::Operation &nestedOp : block->getOperations()) {
+        if (isTagged(&nestedOp)) {
+          hoistedOps.push_back({&nestedOp});
+        }
       }
     });
   }
@@ -281,6 +663,65 @@ public:
   HoistOpSet getResults() { return hoistedOps; }
 
 private:
+  static bool isTagged(mlir::Operation *op) {
+    return op->hasAttr("should_hoist");
+  }
+
+  // Running an untagged op on the host saves copying its inputs, computed by
+  // hoisted ops, to the device, and its result back to the host.
+  static bool isWorthRunningOnHost(mlir::Operation *op) {
+    auto dpsOp = cast<mlir::DestinationStyleOpInterface>(op);
+    double savedTransferNs = getTransferNs(op->getResult(0));
+    for (mlir::Value input : dpsOp.getDpsInputs()) {
+      mlir::Operation *producer = input.getDefiningOp();
+      if (!producer || producer->getBlock() != op->getBlock() ||
+          !isTagged(producer) || !isClusterable(producer) ||
+          !input.hasOneUse()) {
+        return false;
+      }
+      savedTransferNs += getTransferNs(input);
+    }
+
+    const double numElements =
+        cast<mlir::RankedTensorType>(op->getResult(0).getType())
+            .getNumElements();
+    const double extraComputeNs = numElements / kHostElementsPerNs -
+                                  numElements / kDeviceElementsPerNs;
+    return savedTransferNs > extraComputeNs;
+  }
+
+  void clusterBlock(mlir::Block *block) {
+    llvm::DenseMap<mlir::Operation *, unsigned> clusterOf;
+    HoistOpSet clusters;
+
+    // Users come before producers in reverse order, so an op is visited after
+    // all ops of the cluster it may join.
+    for (mlir::Operation &op : llvm::reverse(block->getOperations())) {
+      const bool tagged = isTagged(&op);
+      if (!tagged && !isHostLowerable(&op)) {
+        continue;
+      }
+
+      // The first op of a cluster in reverse order is its last op, the one
+      // whose result is used outside of the cluster.
+      std::optional<unsigned> cluster = getUsersCluster(&op, clusterOf);
+      if (cluster && isClusterable(clusters[*cluster].front()) &&
+          (tagged || isWorthRunningOnHost(&op))) {
+        clusterOf[&op] = *cluster;
+        clusters[*cluster].push_back(&op);
+      } else if (tagged) {
+        clusterOf[&op] = clusters.size();
+        clusters.push_back({&op});
+      }
+    }
+
+    // Keep clusters and the ops within them in program order.
+    for (auto &cluster : llvm::reverse(clusters)) {
+      std::reverse(cluster.begin(), cluster.end());
+      hoistedOps.push_back(std::move(cluster));
+    }
+  }
+
   HoistOpSet hoistedOps;
 };
 
@@ -320,7 +761,23 @@ public:
 
     auto loc = rootModule->getLoc();
 
-    TTIRHoistAnalyze analysisPass(deviceInnerModule);
+    if (autoPlacement || !hostLocs.empty() || !deviceLocs.empty()) {
+      TTIRPlacementAnalysis placementAnalysis(
+          deviceInnerModule, autoPlacement, clusterOps,
+          llvm::to_vector(hostLocs), llvm::to_vector(deviceLocs));
+      for (const auto &decision : placementAnalysis.getResults()) {
+        if (decision.onHost) {
+          decision.op->setAttr("should_hoist", rewriter.getUnitAttr());
+        } else {
+          decision.op->removeAttr("should_hoist");
+        }
+      }
+      if (!placementReportPath.empty()) {
+        writePlacementReport(placementAnalysis.getResults());
+      }
+    }
+
+    TTIRHoistAnalyze analysisPass(deviceInnerModule, clusterOps);
     const TTIRHoistAnalyze::HoistOpSet &hoistOpSets = analysisPass.getResults();
 
     // We don't want to create a CPUModuleOp etc. if we aren't hoisting any ops.
@@ -350,12 +807,43 @@ public:
     }
 
     for (const auto &opSet : hoistOpSets) {
-      assert(opSet.size() == 1 &&
-             "currently don't support hoisting multiple instructions at once!");
-      hoistOperationToFunction(*opSet.begin(), deviceInnerModule,
-                               cpuInnerModule);
+      hoistOperationsToFunction(opSet, deviceInnerModule, cpuInnerModule);
     }
   }
+
+private:
+  void writePlacementReport(
+      llvm::ArrayRef<TTIRPlacementAnalysis::Decision> decisions) {
+    std::error_code ec;
+    llvm::raw_fd_ostream file(placementReportPath, ec);
+    if (ec) {
+      getOperation().emitWarning()
+          << "Failed to open placement report file " << placementReportPath
+          << ": " << ec.message();
+      return;
+    }
+
+    llvm::json::OStream json(file, /*IndentSize=*/2);
+    json.object([&] {
+      json.attributeArray("ops", [&] {
+        for (const auto &decision : decisions) {
+          json.object([&] {
+            json.attribute("op", decision.op->getName().getStringRef());
+            json.attribute("loc", getOpLocName(decision.op));
+            json.attribute("placement", decision.onHost ? "host" : "device");
+            if (decision.overridden) {
+              json.attribute("reason", "override");
+              return;
+            }
+            json.attribute("reason", "cost");
+            json.attribute("subgraph", decision.subgraph);
+            json.attribute("host_ns", decision.hostNs);
+            json.attribute("device_ns", decision.deviceNs);
+          });
+        }
+      });
+    });
+  }
 };
 
 } // namespace mlir::tt::ttir
@@ -3,8 +3,10 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "ttmlir/Dialect/TT/IR/TT.h"
+#include "ttmlir/Dialect/TTIR/IR/TTIROps.h"
 #include "ttmlir/Dialect/TTIR/Transforms/Passes.h"
 #include "ttmlir/Dialect/TTIR/Utils/UniformTypeRewriter.h"
+#include "ttmlir/Dialect/TTIR/Utils/Utils.h"
 
 #include "mlir/Dialect/Quant/IR/Quant.h"
 #include "mlir/Dialect/Quant/IR/QuantTypes.h"
@@ -13,10 +15,11 @@
 #include "mlir/Transforms/GreedyPatternRewriteDriver.h"
 #include "llvm/ADT/APInt.h"
 
-#include <limits>
+#include <algorithm>
 
 namespace mlir::tt::ttir {
 #define GEN_PASS_DEF_TTIRQUANTDATATYPECONVERSIONPASS
+#define GEN_PASS_DEF_TTIRQUANTIZEDDOMAINFUSION
 #include "ttmlir/Dialect/TTIR/Transforms/Passes.h.inc"
 
 namespace {
@@ -157,6 +160,239 @@ struct TTIRQuantDataTypeConversionPass
   }
 };
 
+//===----------------------------------------------------------------------===//
+// Quantized domain fusion
+//===----------------------------------------------------------------------===//
+
+// Returns the per-tensor quantized element type of `value`, or null if it is
+// not per-tensor quantized.
+static quant::UniformQuantizedType getPerTensorQuantType(Value value) {
+  return mlir::dyn_cast<quant::UniformQuantizedType>(
+      mlir::cast<RankedTensorType>(value.getType()).getElementType());
+}
+
+// Returns the quantized type used to accumulate results of `inputTypes` with
+// `scale`. The accumulator is int32, or as wide as the widest input if the
+// storage types were already widened past that.
+static quant::UniformQuantizedType
+getAccumulatorType(ArrayRef<quant::UniformQuantizedType> inputTypes,
+                   double scale) {
+  unsigned bitWidth = 32;
+  for (quant::UniformQuantizedType inputType : inputTypes) {
+    bitWidth = std::max(bitWidth, inputType.getStorageTypeIntegralWidth());
+  }
+  Type expressedType = inputTypes.front().getExpressedType();
+  IntegerType storageType = IntegerType::get(expressedType.getContext(),
+                                             bitWidth, IntegerType::Signed);
+  return quant::UniformQuantizedType::get(
+      quant::QuantizationFlags::Signed, storageType, expressedType, scale,
+      /*zeroPoint=*/0,
+      llvm::APInt::getSignedMinValue(bitWidth).getSExtValue(),
+      llvm::APInt::getSignedMaxValue(bitWidth).getSExtValue());
+}
+
+static RankedTensorType getTensorTypeWithElementType(Value value,
+                                                     Type elementType) {
+  auto type = mlir::cast<RankedTensorType>(value.getType());
+  return RankedTensorType::get(type.getShape(), elementType,
+                               type.getEncoding());
+}
+
+// Converts a floating point `value` into `quantType`. A dequantized value is
+// requantized from its quantized input rather than quantized again.
+static Value convertToQuantType(PatternRewriter &rewriter, Location loc,
+                                Value value,
+                                quant::UniformQuantizedType quantType) {
+  RankedTensorType targetType = getTensorTypeWithElementType(value, quantType);
+  if (auto dequantizeOp = value.getDefiningOp<DequantizeOp>()) {
+    Value input = dequantizeOp.getInput();
+    if (input.getType() == targetType) {
+      return input;
+    }
+    return utils::createDPSOp<RequantizeOp>(rewriter, loc, targetType, input)
+        .getResult();
+  }
+  return utils::createDPSOp<QuantizeOp>(rewriter, loc, targetType, value)
+      .getResult();
+}
+
+// Folds quantize(dequantize(x)) into requantize(x), or x if the quantized
+// types match.
+class QuantizeDequantizeFoldPattern : public OpRewritePattern<QuantizeOp> {
+public:
+  using OpRewritePattern<QuantizeOp>::OpRewritePattern;
+
+  LogicalResult matchAndRewrite(QuantizeOp op,
+                                PatternRewriter &rewriter) const final {
+    auto dequantizeOp = op.getInput().getDefiningOp<DequantizeOp>();
+    if (!dequantizeOp) {
+      return failure();
+    }
+
+    Value input = dequantizeOp.getInput();
+    if (input.getType() == op.getResult().getType()) {
+      rewriter.replaceOp(op, input);
+      return success();
+    }
+    utils::replaceOpWithNewDPSOp<RequantizeOp>(
+        rewriter, op, op.getResult().getType(), input);
+    return success();
+  }
+};
+
+// Removes requantize ops which do not change the quantized type. Chains of
+// requantize ops are kept, since every step rounds and clamps and collapsing
+// them would change the result.
+class RequantizeFoldPattern : public OpRewritePattern<RequantizeOp> {
+public:
+  using OpRewritePattern<RequantizeOp>::OpRewritePattern;
+
+  LogicalResult matchAndRewrite(RequantizeOp op,
+                                PatternRewriter &rewriter) const final {
+    if (op.getInput().getType() != op.getResult().getType()) {
+      return failure();
+    }
+    rewriter.replaceOp(op, op.getInput());
+    return success();
+  }
+};
+
+// Rewrites quantize(op(dequantize(a), dequantize(b), bias)) for matmul, linear
+// and conv2d into an integer op on a and b which accumulates into int32 with
+// scale scale_a * scale_b, followed by a requantize epilogue into the output
+// type. Bias, if any, is converted into the accumulator type. Only symmetric
+// per-tensor quantized inputs are supported, so that the integer product needs
+// no zero point correction.
+class QuantizedContractionFusionPattern
+    : public OpRewritePattern<QuantizeOp> {
+public:
+  using OpRewritePattern<QuantizeOp>::OpRewritePattern;
+
+  LogicalResult matchAndRewrite(QuantizeOp op,
+                                PatternRewriter &rewriter) const final {
+    Operation *computeOp = op.getInput().getDefiningOp();
+    if (!mlir::isa_and_nonnull<MatmulOp, LinearOp, Conv2dOp>(computeOp) ||
+        !computeOp->hasOneUse()) {
+      return failure();
+    }
+
+    auto lhsOp = computeOp->getOperand(0).getDefiningOp<DequantizeOp>();
+    auto rhsOp = computeOp->getOperand(1).getDefiningOp<DequantizeOp>();
+    if (!lhsOp || !rhsOp) {
+      return failure();
+    }
+
+    quant::UniformQuantizedType lhsType =
+        getPerTensorQuantType(lhsOp.getInput());
+    quant::UniformQuantizedType rhsType =
+        getPerTensorQuantType(rhsOp.getInput());
+    if (!lhsType || !rhsType || lhsType.getZeroPoint() != 0 ||
+        rhsType.getZeroPoint() != 0) {
+      return rewriter.notifyMatchFailure(
+          op, "Only symmetric per tensor quantized inputs are supported.");
+    }
+
+    quant::UniformQuantizedType accumulatorType = getAccumulatorType(
+        {lhsType, rhsType}, lhsType.getScale() * rhsType.getScale());
+    RankedTensorType resultType = getTensorTypeWithElementType(
+        computeOp->getResult(0), accumulatorType);
+
+    auto dpsOp = mlir::cast<DestinationStyleOpInterface>(computeOp);
+    SmallVector<Value> operands;
+    for (OpOperand &operand : computeOp->getOpOperands()) {
+      if (dpsOp.isDpsInit(&operand)) {
+        operands.push_back(rewriter.create<EmptyOp>(
+            computeOp->getLoc(), resultType.getShape(),
+            resultType.getElementType(), resultType.getEncoding()));
+      } else if (operand.getOperandNumber() == 0) {
+        operands.push_back(lhsOp.getInput());
+      } else if (operand.getOperandNumber() == 1) {
+        operands.push_back(rhsOp.getInput());
+      } else {
+        operands.push_back(convertToQuantType(rewriter, computeOp->getLoc(),
+                                              operand.get(), accumulatorType));
+      }
+    }
+
+    Operation *integerOp = rewriter.clone(*computeOp);
+    integerOp->setOperands(operands);
+    integerOp->getResult(0).setType(resultType);
+
+    utils::replaceOpWithNewDPSOp<RequantizeOp>(
+        rewriter, op, op.getResult().getType(), integerOp->getResult(0));
+    rewriter.eraseOp(computeOp);
+    return success();
+  }
+};
+
+// Rewrites quantize(add(dequantize(a), dequantize(b))) into an integer add of
+// a and b followed by a requantize epilogue into the output type. a and b must
+// have the same scale, so that moving them to the accumulator type only
+// subtracts their zero points and the epilogue is the only step that rounds,
+// like the quantize op it replaces. Inputs with different scales would each
+// have to be rounded to a common scale first, so such adds are kept.
+class QuantizedAddFusionPattern : public OpRewritePattern<QuantizeOp> {
+public:
+  using OpRewritePattern<QuantizeOp>::OpRewritePattern;
+
+  LogicalResult matchAndRewrite(QuantizeOp op,
+                                PatternRewriter &rewriter) const final {
+    auto addOp = op.getInput().getDefiningOp<AddOp>();
+    if (!addOp || !addOp->hasOneUse()) {
+      return failure();
+    }
+
+    auto lhsOp = addOp.getLhs().getDefiningOp<DequantizeOp>();
+    auto rhsOp = addOp.getRhs().getDefiningOp<DequantizeOp>();
+    if (!lhsOp || !rhsOp || !getPerTensorQuantType(op.getResult())) {
+      return failure();
+    }
+
+    quant::UniformQuantizedType lhsType =
+        getPerTensorQuantType(lhsOp.getInput());
+    quant::UniformQuantizedType rhsType =
+        getPerTensorQuantType(rhsOp.getInput());
+    if (!lhsType || !rhsType || lhsType.getScale() != rhsType.getScale()) {
+      return rewriter.notifyMatchFailure(
+          op, "Only per tensor quantized inputs with equal scales are "
+              "supported.");
+    }
+
+    quant::UniformQuantizedType accumulatorType =
+        getAccumulatorType({lhsType, rhsType}, lhsType.getScale());
+    Value lhs = convertToQuantType(rewriter, addOp.getLoc(), addOp.getLhs(),
+                                   accumulatorType);
+    Value rhs = convertToQuantType(rewriter, addOp.getLoc(), addOp.getRhs(),
+                                   accumulatorType);
+    auto integerAddOp = utils::createDPSOp<AddOp>(
+        rewriter, addOp.getLoc(),
+        getTensorTypeWithElementType(addOp.getResult(), accumulatorType), lhs,
+        rhs);
+
+    utils::replaceOpWithNewDPSOp<RequantizeOp>(
+        rewriter, op, op.getResult().getType(), integerAddOp.getResult());
+    rewriter.eraseOp(addOp);
+    return success();
+  }
+};
+
+struct TTIRQuantizedDomainFusion
+    : public impl::TTIRQuantizedDomainFusionBase<TTIRQuantizedDomainFusion> {
+  using impl::TTIRQuantizedDomainFusionBase<
+      TTIRQuantizedDomainFusion>::TTIRQuantizedDomainFusionBase;
+
+  void runOnOperation() final {
+    RewritePatternSet patterns(&getContext());
+    patterns.add<QuantizeDequantizeFoldPattern, RequantizeFoldPattern,
+                 QuantizedContractionFusionPattern, QuantizedAddFusionPattern>(
+        &getContext());
+    if (failed(applyPatternsGreedily(getOperation(), std::move(patterns)))) {
+      signalPassFailure();
+      return;
+    }
+  }
+};
+
 } // namespace
 
 } // namespace mlir::tt::ttir
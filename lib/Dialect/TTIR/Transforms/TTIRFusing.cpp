@@ -8,6 +8,8 @@
 
 #include "mlir/Transforms/GreedyPatternRewriteDriver.h"
 
+#include <cmath>
+
 namespace mlir::tt::ttir {
 #define GEN_PASS_DEF_TTIRFUSING
 #include "ttmlir/Dialect/TTIR/Transforms/Passes.h.inc"
@@ -218,6 +220,749 @@ public:
   }
 };
 
+// Returns `value` with any broadcasts in front of it stripped.
+static mlir::Value stripBroadcasts(mlir::Value value) {
+  while (auto broadcastOp = value.getDefiningOp<BroadcastOp>()) {
+    value = broadcastOp.getInput();
+  }
+  return value;
+}
+
+// Returns x if `value` is a single use, possibly broadcast,
+// mean(x, dim=-1, keep_dim=true), or null.
+static mlir::Value getLastDimMeanInput(mlir::Value value) {
+  auto meanOp = stripBroadcasts(value).getDefiningOp<MeanOp>();
+  if (!meanOp || !meanOp.getResult().hasOneUse() || !meanOp.getKeepDim() ||
+      !meanOp.getDimArg() || meanOp.getDimArg()->size() != 1) {
+    return nullptr;
+  }
+  const int64_t rank = meanOp.getInput().getType().getRank();
+  int64_t dim =
+      mlir::cast<mlir::IntegerAttr>((*meanOp.getDimArg())[0]).getInt();
+  if (dim != -1 && dim != rank - 1) {
+    return nullptr;
+  }
+  return meanOp.getInput();
+}
+
+// Returns x if `value` is x - mean(x, dim=-1), or null.
+static mlir::Value getCenteredInput(mlir::Value value) {
+  auto subtractOp = value.getDefiningOp<SubtractOp>();
+  if (!subtractOp || subtractOp.getType() != subtractOp.getLhs().getType() ||
+      getLastDimMeanInput(subtractOp.getRhs()) != subtractOp.getLhs()) {
+    return nullptr;
+  }
+  return subtractOp.getLhs();
+}
+
+// Returns x if `value` is rsqrt(mean(x * x, dim=-1) + epsilon), possibly
+// broadcast, and sets `epsilon`. Returns null otherwise. The square may also be
+// pow(x, 2).
+static mlir::Value getRsqrtMeanSquareInput(mlir::Value value, float &epsilon) {
+  auto rsqrtOp = stripBroadcasts(value).getDefiningOp<RsqrtOp>();
+  if (!rsqrtOp || !rsqrtOp.getResult().hasOneUse()) {
+    return nullptr;
+  }
+  auto addOp = rsqrtOp.getInput().getDefiningOp<AddOp>();
+  if (!addOp || !addOp.getResult().hasOneUse()) {
+    return nullptr;
+  }
+
+  for (auto [meanSquare, eps] :
+       {std::make_pair(addOp.getLhs(), addOp.getRhs()),
+        std::make_pair(addOp.getRhs(), addOp.getLhs())}) {
+    std::optional<float> epsValue = utils::getConstantValue(eps);
+    mlir::Value square = getLastDimMeanInput(meanSquare);
+    if (!epsValue || !square || !square.hasOneUse() ||
+        meanSquare.getType() != addOp.getType()) {
+      continue;
+    }
+    mlir::Value x;
+    if (auto multiplyOp = square.getDefiningOp<MultiplyOp>();
+        multiplyOp && multiplyOp.getLhs() == multiplyOp.getRhs()) {
+      x = multiplyOp.getLhs();
+    } else if (auto powOp = square.getDefiningOp<PowOp>()) {
+      if (std::optional<float> exponent =
+              utils::getConstantValue(powOp.getRhs());
+          exponent && *exponent == 2.0f) {
+        x = powOp.getLhs();
+      }
+    }
+    if (x && x.getType() == square.getType()) {
+      epsilon = *epsValue;
+      return x;
+    }
+  }
+  return nullptr;
+}
+
+// This pattern fuses RMS normalization over the last dim:
+//   x * rsqrt(mean(x * x, dim=-1, keep_dim=true) + epsilon)
+// The weight and bias are fused separately by NormAffineFusionPattern.
+class RMSNormFusionPattern : public mlir::OpRewritePattern<MultiplyOp> {
+  using mlir::OpRewritePattern<MultiplyOp>::OpRewritePattern;
+
+public:
+  mlir::LogicalResult
+  matchAndRewrite(MultiplyOp multiplyOp,
+                  mlir::PatternRewriter &rewriter) const final {
+    for (auto [x, invStd] :
+         {std::make_pair(multiplyOp.getLhs(), multiplyOp.getRhs()),
+          std::make_pair(multiplyOp.getRhs(), multiplyOp.getLhs())}) {
+      float epsilon = 0.0f;
+      // Normalizing a centered input is layer norm.
+      if (x.getType() != multiplyOp.getType() ||
+          getRsqrtMeanSquareInput(invStd, epsilon) != x ||
+          getCenteredInput(x)) {
+        continue;
+      }
+
+      utils::replaceOpWithNewDPSOp<RMSNormOp>(
+          rewriter, multiplyOp, multiplyOp.getResult().getType(), x,
+          /*weight=*/mlir::Value(), /*bias=*/mlir::Value(),
+          rewriter.getF32FloatAttr(epsilon));
+      return mlir::success();
+    }
+    return mlir::failure();
+  }
+};
+
+// This pattern fuses layer normalization over the last dim:
+//   c = x - mean(x, dim=-1, keep_dim=true)
+//   c * rsqrt(mean(c * c, dim=-1, keep_dim=true) + epsilon)
+// The weight and bias are fused separately by NormAffineFusionPattern.
+class LayerNormFusionPattern : public mlir::OpRewritePattern<MultiplyOp> {
+  using mlir::OpRewritePattern<MultiplyOp>::OpRewritePattern;
+
+public:
+  mlir::LogicalResult
+  matchAndRewrite(MultiplyOp multiplyOp,
+                  mlir::PatternRewriter &rewriter) const final {
+    for (auto [centered, invStd] :
+         {std::make_pair(multiplyOp.getLhs(), multiplyOp.getRhs()),
+          std::make_pair(multiplyOp.getRhs(), multiplyOp.getLhs())}) {
+      float epsilon = 0.0f;
+      mlir::Value x = getCenteredInput(centered);
+      if (!x || x.getType() != multiplyOp.getType() ||
+          getRsqrtMeanSquareInput(invStd, epsilon) != centered) {
+        continue;
+      }
+
+      utils::replaceOpWithNewDPSOp<LayerNormOp>(
+          rewriter, multiplyOp, multiplyOp.getResult().getType(), x,
+          /*weight=*/mlir::Value(), /*bias=*/mlir::Value(),
+          rewriter.getF32FloatAttr(epsilon));
+      return mlir::success();
+    }
+    return mlir::failure();
+  }
+};
+
+// This pattern fuses the affine transform following a normalization into the
+// norm op: multiply by a weight if `AffineOpTy` is MultiplyOp, add of a bias if
+// it's AddOp. The weight and bias must hold one value per element of the
+// normalized dim, i.e. have shape [1, ..., 1, normalized_dim] before being
+// broadcast.
+template <typename NormOpTy, typename AffineOpTy>
+class NormAffineFusionPattern : public mlir::OpRewritePattern<AffineOpTy> {
+  using mlir::OpRewritePattern<AffineOpTy>::OpRewritePattern;
+
+  static constexpr bool isWeight = std::is_same_v<AffineOpTy, MultiplyOp>;
+
+public:
+  mlir::LogicalResult
+  matchAndRewrite(AffineOpTy affineOp,
+                  mlir::PatternRewriter &rewriter) const final {
+    for (auto [normValue, paramValue] :
+         {std::make_pair(affineOp.getLhs(), affineOp.getRhs()),
+          std::make_pair(affineOp.getRhs(), affineOp.getLhs())}) {
+      auto normOp = normValue.getDefiningOp<NormOpTy>();
+      if (!normOp || !normOp.getResult().hasOneUse() || normOp.getBias() ||
+          (isWeight && normOp.getWeight()) ||
+          normOp.getType() != affineOp.getType()) {
+        continue;
+      }
+      mlir::Value param = stripBroadcasts(paramValue);
+      if (!isFusable(normOp, param)) {
+        continue;
+      }
+
+      auto paramType = mlir::cast<RankedTensorType>(param.getType());
+      if (paramType.getRank() != 1) {
+        rewriter.setInsertionPoint(normOp);
+        const int64_t size = paramType.getNumElements();
+        auto reshapeOp = utils::createDPSOp<ReshapeOp>(
+            rewriter,
+            ttmlir::utils::appendLocationSuffix(param.getLoc(), "_1d"),
+            ArrayRef<int64_t>{size}, paramType.getElementType(),
+            paramType.getEncoding(), param,
+            rewriter.getI32ArrayAttr({static_cast<int32_t>(size)}));
+        param = reshapeOp.getResult();
+      }
+      rewriter.modifyOpInPlace(normOp, [&]() {
+        if constexpr (isWeight) {
+          normOp.getWeightMutable().assign(param);
+        } else {
+          normOp.getBiasMutable().assign(param);
+        }
+      });
+      rewriter.replaceAllOpUsesWith(affineOp, normOp);
+      return mlir::success();
+    }
+    return mlir::failure();
+  }
+
+private:
+  static bool isFusable(NormOpTy normOp, mlir::Value param) {
+    auto paramType = mlir::cast<RankedTensorType>(param.getType());
+    RankedTensorType normType = normOp.getType();
+    ArrayRef<int64_t> shape = paramType.getShape();
+    if (shape.empty() || paramType.getRank() > normType.getRank() ||
+        shape.back() != normType.getShape().back() ||
+        !llvm::all_of(shape.drop_back(),
+                      [](int64_t dim) { return dim == 1; }) ||
+        paramType.getElementType() != normType.getElementType()) {
+      return false;
+    }
+    mlir::Operation *paramOp = param.getDefiningOp();
+    return !paramOp || (paramOp->getBlock() == normOp->getBlock() &&
+                        paramOp->isBeforeInBlock(normOp));
+  }
+};
+
+// Flattens the tree of multiplies rooted at `value` into its non-constant
+// factors. Interior multiplies must have a single use. If `scale` is given,
+// constant factors and divisors are folded into it and small integer powers
+// are expanded into repeated factors.
+static void collectFactors(mlir::Value value, bool isRoot,
+                           llvm::SmallVectorImpl<mlir::Value> &factors,
+                           double *scale) {
+  if (isRoot || value.hasOneUse()) {
+    if (auto multiplyOp = value.getDefiningOp<MultiplyOp>()) {
+      collectFactors(multiplyOp.getLhs(), /*isRoot=*/false, factors, scale);
+      collectFactors(multiplyOp.getRhs(), /*isRoot=*/false, factors, scale);
+      return;
+    }
+    if (auto divOp = value.getDefiningOp<DivOp>(); divOp && scale) {
+      if (std::optional<float> divisor =
+              utils::getConstantValue(divOp.getRhs());
+          divisor && *divisor != 0.0f) {
+        *scale /= *divisor;
+        collectFactors(divOp.getLhs(), /*isRoot=*/false, factors, scale);
+        return;
+      }
+    }
+    if (auto powOp = value.getDefiningOp<PowOp>(); powOp && scale) {
+      if (std::optional<float> exponent =
+              utils::getConstantValue(powOp.getRhs());
+          exponent && (*exponent == 2.0f || *exponent == 3.0f)) {
+        for (int i = 0; i < static_cast<int>(*exponent); ++i) {
+          collectFactors(powOp.getLhs(), /*isRoot=*/false, factors, scale);
+        }
+        return;
+      }
+    }
+  }
+  if (scale) {
+    if (std::optional<float> constant = utils::getConstantValue(value)) {
+      *scale *= *constant;
+      return;
+    }
+  }
+  factors.push_back(value);
+}
+
+// Checks if `value` is within the precision of a bf16 constant of `expected`.
+static bool isCloseTo(double value, double expected) {
+  return std::abs(value - expected) <= 1e-2 * std::abs(expected);
+}
+
+// This pattern fuses GELU in its erf and tanh forms into ttir.gelu:
+//   0.5 * x * (1 + erf(x / sqrt(2)))
+//   0.5 * x * (1 + tanh(sqrt(2 / pi) * (x + 0.044715 * x^3)))
+// The products may be associated in any order, and the factor 0.5 may also be
+// a division by 2. The tanh form sets ttir.gelu's approximate flag.
+template <typename RootOpTy>
+class GeluFusionPattern : public mlir::OpRewritePattern<RootOpTy> {
+  using mlir::OpRewritePattern<RootOpTy>::OpRewritePattern;
+
+public:
+  mlir::LogicalResult
+  matchAndRewrite(RootOpTy rootOp,
+                  mlir::PatternRewriter &rewriter) const final {
+    llvm::SmallVector<mlir::Value, 2> factors;
+    double scale = 1.0;
+    collectFactors(rootOp.getResult(), /*isRoot=*/true, factors, &scale);
+    if (factors.size() != 2 || !isCloseTo(scale, 0.5)) {
+      return mlir::failure();
+    }
+
+    for (auto [x, cdf] : {std::make_pair(factors[0], factors[1]),
+                          std::make_pair(factors[1], factors[0])}) {
+      if (x.getType() != rootOp.getType()) {
+        continue;
+      }
+      std::optional<bool> approximate = matchGeluCdf(cdf, x);
+      if (!approximate) {
+        continue;
+      }
+      utils::replaceOpWithNewDPSOp<GeluOp>(
+          rewriter, rootOp, rootOp.getResult().getType(), x, *approximate);
+      return mlir::success();
+    }
+    return mlir::failure();
+  }
+
+private:
+  // Checks if `cdf` is 1 + erf(...) or 1 + tanh(...) of `x` as above, and
+  // returns whether it is the tanh approximation.
+  static std::optional<bool> matchGeluCdf(mlir::Value cdf, mlir::Value x) {
+    auto addOp = cdf.getDefiningOp<AddOp>();
+    if (!addOp || !cdf.hasOneUse()) {
+      return std::nullopt;
+    }
+    for (auto [one, activation] :
+         {std::make_pair(addOp.getLhs(), addOp.getRhs()),
+          std::make_pair(addOp.getRhs(), addOp.getLhs())}) {
+      std::optional<float> oneValue = utils::getConstantValue(one);
+      if (!oneValue || *oneValue != 1.0f || !activation.hasOneUse()) {
+        continue;
+      }
+      if (auto erfOp = activation.getDefiningOp<ErfOp>();
+          erfOp && isScaled(erfOp.getInput(), x, 1.0 / std::sqrt(2.0))) {
+        return false;
+      }
+      if (auto tanhOp = activation.getDefiningOp<TanhOp>();
+          tanhOp && isTanhArgument(tanhOp.getInput(), x)) {
+        return true;
+      }
+    }
+    return std::nullopt;
+  }
+
+  // Checks if `value` is sqrt(2 / pi) * (x + 0.044715 * x^3).
+  static bool isTanhArgument(mlir::Value value, mlir::Value x) {
+    constexpr double kSqrt2OverPi = 0.7978845608028654;
+    constexpr double kCubicCoefficient = 0.044715;
+
+    llvm::SmallVector<mlir::Value, 1> factors;
+    double scale = 1.0;
+    collectFactors(value, /*isRoot=*/false, factors, &scale);
+    if (factors.size() != 1 || !isCloseTo(scale, kSqrt2OverPi) ||
+        !factors[0].hasOneUse()) {
+      return false;
+    }
+    auto addOp = factors[0].getDefiningOp<AddOp>();
+    if (!addOp) {
+      return false;
+    }
+    llvm::SmallVector<mlir::Value, 3> cube{x, x, x};
+    for (auto [linear, cubic] :
+         {std::make_pair(addOp.getLhs(), addOp.getRhs()),
+          std::make_pair(addOp.getRhs(), addOp.getLhs())}) {
+      llvm::SmallVector<mlir::Value, 3> cubicFactors;
+      double cubicScale = 1.0;
+      collectFactors(cubic, /*isRoot=*/false, cubicFactors, &cubicScale);
+      if (linear == x && cubicFactors == cube &&
+          isCloseTo(cubicScale, kCubicCoefficient)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // Checks if `value` is `x` scaled by `expectedScale`.
+  static bool isScaled(mlir::Value value, mlir::Value x,
+                       double expectedScale) {
+    llvm::SmallVector<mlir::Value, 1> factors;
+    double scale = 1.0;
+    collectFactors(value, /*isRoot=*/false, factors, &scale);
+    return factors.size() == 1 && factors[0] == x &&
+           isCloseTo(scale, expectedScale);
+  }
+};
+
+// This pattern fuses x * sigmoid(x) into ttir.silu. The product may have other
+// factors, as in the gated MLP product up * gate * sigmoid(gate), which becomes
+// silu(gate) * up.
+class SiluFusionPattern : public mlir::OpRewritePattern<MultiplyOp> {
+  using mlir::OpRewritePattern<MultiplyOp>::OpRewritePattern;
+
+public:
+  mlir::LogicalResult
+  matchAndRewrite(MultiplyOp multiplyOp,
+                  mlir::PatternRewriter &rewriter) const final {
+    llvm::SmallVector<mlir::Value> factors;
+    collectFactors(multiplyOp.getResult(), /*isRoot=*/true, factors,
+                   /*scale=*/nullptr);
+    // Reassociating the product is only safe without implicit broadcasts.
+    RankedTensorType type = multiplyOp.getType();
+    if (!llvm::all_of(factors, [&](mlir::Value factor) {
+          return factor.getType() == type;
+        })) {
+      return mlir::failure();
+    }
+
+    auto *sigmoidIt = llvm::find_if(factors, [&](mlir::Value factor) {
+      auto sigmoidOp = factor.getDefiningOp<SigmoidOp>();
+      return sigmoidOp && factor.hasOneUse() &&
+             llvm::is_contained(factors, sigmoidOp.getInput());
+    });
+    if (sigmoidIt == factors.end()) {
+      return mlir::failure();
+    }
+    mlir::Value gate = sigmoidIt->getDefiningOp<SigmoidOp>().getInput();
+    factors.erase(sigmoidIt);
+    factors.erase(llvm::find(factors, gate));
+
+    if (factors.empty()) {
+      utils::replaceOpWithNewDPSOp<SiluOp>(rewriter, multiplyOp, type, gate);
+      return mlir::success();
+    }
+    mlir::Value product = utils::createDPSOp<SiluOp>(
+        rewriter,
+        ttmlir::utils::appendLocationSuffix(multiplyOp.getLoc(), "_silu"),
+        type, gate);
+    for (mlir::Value factor : ArrayRef<mlir::Value>(factors).drop_back()) {
+      product = utils::createDPSOp<MultiplyOp>(rewriter, multiplyOp.getLoc(),
+                                               type, product, factor);
+    }
+    utils::replaceOpWithNewDPSOp<MultiplyOp>(rewriter, multiplyOp, type,
+                                             product, factors.back());
+    return mlir::success();
+  }
+};
+
+// This pattern fuses attention into a single scaled dot product attention op,
+// so the [query_len, key_len] scores never leave the kernel:
+//   matmul(softmax(matmul(Q, K^T) * scale + mask, dim=-1), V)
+// Recognized variants:
+// - K^T as a matmul with transpose_b, a transpose or permute of K, or any other
+//   [batch, heads, head_dim, key_len] tensor;
+// - scale as a multiply or divide by a constant, applied to the scores or to Q;
+// - an optional additive mask, which becomes is_causal if it is a constant
+//   lower triangular mask;
+// - key and value heads repeated for GQA, either with repeat_interleave or
+//   with a reshape, broadcast and reshape.
+// Only bf16 attention with tile aligned sequence lengths and head dim is
+// fused, see isSupportedByKernel.
+class ScaledDotProductAttentionFusionPattern
+    : public mlir::OpRewritePattern<MatmulOp> {
+  using mlir::OpRewritePattern<MatmulOp>::OpRewritePattern;
+
+public:
+  mlir::LogicalResult
+  matchAndRewrite(MatmulOp matmulOp,
+                  mlir::PatternRewriter &rewriter) const final {
+    if (matmulOp.getTransposeA() || matmulOp.getTransposeB()) {
+      return mlir::failure();
+    }
+
+    auto softmaxOp = matmulOp.getA().getDefiningOp<SoftmaxOp>();
+    if (!softmaxOp || !softmaxOp.getResult().hasOneUse() ||
+        softmaxOp.getType().getRank() != 4 ||
+        (softmaxOp.getDimension() != -1 && softmaxOp.getDimension() != 3)) {
+      return mlir::failure();
+    }
+
+    // Split the softmax input into the scores matmul, scale and mask.
+    float scale = 1.0f;
+    mlir::Value mask;
+    MatmulOp scoresOp = getScores(softmaxOp.getInput(), scale);
+    if (!scoresOp) {
+      auto addOp = softmaxOp.getInput().getDefiningOp<AddOp>();
+      if (!addOp || !addOp.getResult().hasOneUse()) {
+        return mlir::failure();
+      }
+      if ((scoresOp = getScores(addOp.getLhs(), scale))) {
+        mask = addOp.getRhs();
+      } else if ((scoresOp = getScores(addOp.getRhs(), scale))) {
+        mask = addOp.getLhs();
+      } else {
+        return mlir::failure();
+      }
+    }
+    if (scoresOp.getTransposeA()) {
+      return mlir::failure();
+    }
+
+    mlir::Value query = scoresOp.getA();
+    if (std::optional<float> queryScale = stripScale(query)) {
+      scale *= *queryScale;
+    }
+
+    // K^T which isn't a transpose of K is transposed back once the pattern
+    // is known to match.
+    mlir::Value key = getKey(scoresOp);
+    mlir::Value value = matmulOp.getB();
+    if (key) {
+      stripRepeatedHeads(key, value);
+    }
+
+    auto queryType = mlir::cast<RankedTensorType>(query.getType());
+    auto keyType = key ? mlir::cast<RankedTensorType>(key.getType())
+                       : getTransposedType(scoresOp.getB());
+    if (queryType.getRank() != 4 || keyType.getRank() != 4 ||
+        keyType != value.getType() ||
+        queryType.getDimSize(0) != keyType.getDimSize(0) ||
+        queryType.getDimSize(3) != keyType.getDimSize(3) ||
+        queryType.getDimSize(1) % keyType.getDimSize(1) != 0 ||
+        !isSupportedByKernel(queryType, keyType)) {
+      return mlir::failure();
+    }
+
+    const int64_t queryLen = queryType.getDimSize(2);
+    const int64_t keyLen = keyType.getDimSize(2);
+    bool isCausal = false;
+    if (mask) {
+      isCausal = isCausalMask(mask, queryLen, keyLen);
+      if (isCausal) {
+        mask = mlir::Value();
+      } else {
+        // SDPA broadcasts the mask over heads itself.
+        while (auto broadcastOp = mask.getDefiningOp<BroadcastOp>()) {
+          if (!isMaskCompatible(broadcastOp.getInput(), queryType, keyLen)) {
+            break;
+          }
+          mask = broadcastOp.getInput();
+        }
+        if (!isMaskCompatible(mask, queryType, keyLen) ||
+            !mlir::cast<RankedTensorType>(mask.getType())
+                 .getElementType()
+                 .isBF16()) {
+          return mlir::failure();
+        }
+      }
+    }
+
+    if (!key) {
+      key = utils::createDPSOp<TransposeOp>(
+          rewriter,
+          ttmlir::utils::appendLocationSuffix(scoresOp.getLoc(), "_key"),
+          keyType, scoresOp.getB(), /*dim0=*/-2, /*dim1=*/-1);
+    }
+    if (mask && mlir::cast<RankedTensorType>(mask.getType()).getRank() != 4) {
+      mask = reshapeMaskTo4D(rewriter, mask);
+    }
+
+    utils::replaceOpWithNewDPSOp<ScaledDotProductAttentionOp>(
+        rewriter, matmulOp, matmulOp.getResult().getType(), query, key, value,
+        mask, rewriter.getBoolAttr(isCausal), rewriter.getF32FloatAttr(scale));
+
+    return mlir::success();
+  }
+
+private:
+  // If `value` is a single use multiply or divide by a constant, replaces it
+  // with the other operand and returns the factor it was scaled by.
+  static std::optional<float> stripScale(mlir::Value &value) {
+    if (!value.hasOneUse()) {
+      return std::nullopt;
+    }
+    // The scaled operand must not be broadcast by the scaling.
+    mlir::Type type = value.getType();
+    if (auto multiplyOp = value.getDefiningOp<MultiplyOp>()) {
+      if (auto factor = utils::getConstantValue(multiplyOp.getRhs());
+          factor && multiplyOp.getLhs().getType() == type) {
+        value = multiplyOp.getLhs();
+        return factor;
+      }
+      if (auto factor = utils::getConstantValue(multiplyOp.getLhs());
+          factor && multiplyOp.getRhs().getType() == type) {
+        value = multiplyOp.getRhs();
+        return factor;
+      }
+    }
+    if (auto divOp = value.getDefiningOp<DivOp>()) {
+      if (auto divisor = utils::getConstantValue(divOp.getRhs());
+          divisor && *divisor != 0.0f && divOp.getLhs().getType() == type) {
+        value = divOp.getLhs();
+        return 1.0f / *divisor;
+      }
+    }
+    return std::nullopt;
+  }
+
+  // The flash attention kernel only takes bf16 and processes the query and
+  // key sequences in chunks of whole tiles. Matching anything else would
+  // leave it to the workarounds to change the precision of the attention,
+  // so such attention is left unfused. The head dim is limited to tile
+  // aligned sizes the kernel is known to handle.
+  static bool isSupportedByKernel(RankedTensorType queryType,
+                                  RankedTensorType keyType) {
+    constexpr int64_t kMaxHeadDim = 256;
+    const auto tileShape = TileType::getDefaultShape();
+    const int64_t headDim = queryType.getDimSize(3);
+    return queryType.getElementType().isBF16() &&
+           keyType.getElementType().isBF16() &&
+           queryType.getDimSize(2) % tileShape[0] == 0 &&
+           keyType.getDimSize(2) % tileShape[0] == 0 &&
+           headDim % tileShape[1] == 0 && headDim <= kMaxHeadDim;
+  }
+
+  // Returns the single use Q @ K^T matmul that `value` scales, if any.
+  static MatmulOp getScores(mlir::Value value, float &scale) {
+    std::optional<float> factor = stripScale(value);
+    auto scoresOp = value.getDefiningOp<MatmulOp>();
+    if (!scoresOp || !scoresOp.getResult().hasOneUse()) {
+      return nullptr;
+    }
+    scale = factor.value_or(1.0f);
+    return scoresOp;
+  }
+
+  // Returns K in [batch, kv_heads, key_len, head_dim] layout if the scores
+  // matmul takes it transposed, or null.
+  static mlir::Value getKey(MatmulOp scoresOp) {
+    mlir::Value keyT = scoresOp.getB();
+    if (scoresOp.getTransposeB()) {
+      return keyT;
+    }
+
+    const int64_t rank =
+        mlir::cast<RankedTensorType>(keyT.getType()).getRank();
+    if (auto transposeOp = keyT.getDefiningOp<TransposeOp>()) {
+      int64_t dim0 = (transposeOp.getDim0() + rank) % rank;
+      int64_t dim1 = (transposeOp.getDim1() + rank) % rank;
+      if (std::min(dim0, dim1) == rank - 2 &&
+          std::max(dim0, dim1) == rank - 1) {
+        return transposeOp.getInput();
+      }
+    }
+    if (auto permuteOp = keyT.getDefiningOp<PermuteOp>();
+        permuteOp && rank == 4 &&
+        permuteOp.getPermutation() == ArrayRef<int64_t>{0, 1, 3, 2}) {
+      return permuteOp.getInput();
+    }
+    return nullptr;
+  }
+
+  // Returns the type of `value` with its last two dims swapped.
+  static RankedTensorType getTransposedType(mlir::Value value) {
+    auto type = mlir::cast<RankedTensorType>(value.getType());
+    llvm::SmallVector<int64_t> shape(type.getShape());
+    if (shape.size() >= 2) {
+      std::swap(shape[shape.size() - 2], shape[shape.size() - 1]);
+    }
+    return RankedTensorType::get(shape, type.getElementType(),
+                                 type.getEncoding());
+  }
+
+  // Returns the key/value heads that `value` repeats for GQA, or `value`
+  // itself.
+  static mlir::Value getRepeatedHeads(mlir::Value value) {
+    auto type = mlir::cast<RankedTensorType>(value.getType());
+    if (type.getRank() != 4) {
+      return value;
+    }
+
+    if (auto repeatOp = value.getDefiningOp<RepeatInterleaveOp>();
+        repeatOp && (repeatOp.getDim() == 1 || repeatOp.getDim() == -3)) {
+      return repeatOp.getInput();
+    }
+
+    // [B, KV, S, D] -> [B, KV, 1, S, D] -> [B, KV, N, S, D] ->
+    // [B, KV * N, S, D]
+    auto reshapeOp = value.getDefiningOp<ReshapeOp>();
+    auto broadcastOp =
+        reshapeOp ? reshapeOp.getInput().getDefiningOp<BroadcastOp>() : nullptr;
+    auto unsqueezeOp =
+        broadcastOp ? broadcastOp.getInput().getDefiningOp<ReshapeOp>()
+                    : nullptr;
+    if (!unsqueezeOp) {
+      return value;
+    }
+    ArrayRef<int64_t> expandedShape = broadcastOp.getType().getShape();
+    ArrayRef<int64_t> headsShape = unsqueezeOp.getInput().getType().getShape();
+    if (expandedShape.size() != 5 || headsShape.size() != 4 ||
+        unsqueezeOp.getType().getDimSize(2) != 1 ||
+        expandedShape[0] != type.getDimSize(0) ||
+        expandedShape[1] != headsShape[1] ||
+        expandedShape[1] * expandedShape[2] != type.getDimSize(1) ||
+        expandedShape.take_back(2) != type.getShape().take_back(2) ||
+        headsShape.take_back(2) != type.getShape().take_back(2)) {
+      return value;
+    }
+    return unsqueezeOp.getInput();
+  }
+
+  // SDPA repeats key/value heads itself. Only strips the repeat if key and
+  // value end up with the same shape.
+  static void stripRepeatedHeads(mlir::Value &key, mlir::Value &value) {
+    mlir::Value keyHeads = getRepeatedHeads(key);
+    mlir::Value valueHeads = getRepeatedHeads(value);
+    if (keyHeads.getType() == valueHeads.getType()) {
+      key = keyHeads;
+      value = valueHeads;
+    }
+  }
+
+  // Checks if `mask` is a constant with 0 at and below the diagonal and a
+  // large negative value above it, broadcast over all leading dims.
+  static bool isCausalMask(mlir::Value mask, int64_t queryLen,
+                           int64_t keyLen) {
+    while (mlir::isa_and_present<BroadcastOp, ReshapeOp, TypecastOp>(
+        mask.getDefiningOp())) {
+      mask = mask.getDefiningOp()->getOperand(0);
+    }
+    auto constantOp = mask.getDefiningOp<ConstantOp>();
+    if (!constantOp || queryLen != keyLen) {
+      return false;
+    }
+    auto values =
+        mlir::dyn_cast<mlir::DenseElementsAttr>(constantOp.getValue());
+    if (!values || !mlir::isa<mlir::FloatType>(values.getElementType()) ||
+        values.isSplat() ||
+        values.getNumElements() % (queryLen * keyLen) != 0) {
+      return false;
+    }
+
+    // exp(x - max) underflows to 0 well before this.
+    constexpr double kMaskedValue = -1e4;
+    int64_t index = 0;
+    for (const APFloat &value : values.getValues<APFloat>()) {
+      const int64_t i = (index / keyLen) % queryLen;
+      const int64_t j = index % keyLen;
+      ++index;
+      bool masked =
+          value.isNegative() &&
+          (value.isInfinity() || value.convertToDouble() <= kMaskedValue);
+      if (j > i ? !masked : !value.isZero()) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // SDPA takes a [batch or 1, 1, query_len, key_len] mask, one mask per head
+  // isn't supported.
+  static bool isMaskCompatible(mlir::Value mask, RankedTensorType queryType,
+                               int64_t keyLen) {
+    auto maskType = mlir::cast<RankedTensorType>(mask.getType());
+    if (maskType.getRank() > 4) {
+      return false;
+    }
+    llvm::SmallVector<int64_t> maskShape(4 - maskType.getRank(), 1);
+    llvm::append_range(maskShape, maskType.getShape());
+    return (maskShape[0] == 1 || maskShape[0] == queryType.getDimSize(0)) &&
+           maskShape[1] == 1 && maskShape[2] == queryType.getDimSize(2) &&
+           maskShape[3] == keyLen;
+  }
+
+  static mlir::Value reshapeMaskTo4D(mlir::PatternRewriter &rewriter,
+                                     mlir::Value mask) {
+    auto maskType = mlir::cast<RankedTensorType>(mask.getType());
+    llvm::SmallVector<int64_t> maskShape(4 - maskType.getRank(), 1);
+    llvm::append_range(maskShape, maskType.getShape());
+    llvm::SmallVector<int32_t> maskShapeI32(maskShape.begin(),
+                                            maskShape.end());
+    return utils::createDPSOp<ReshapeOp>(
+        rewriter, ttmlir::utils::appendLocationSuffix(mask.getLoc(), "_4d"),
+        maskShape, maskType.getElementType(), maskType.getEncoding(), mask,
+        rewriter.getI32ArrayAttr(maskShapeI32));
+  }
+};
+
 class Conv2dWithMultiply : public mlir::OpRewritePattern<MultiplyOp> {
   using mlir::OpRewritePattern<MultiplyOp>::OpRewritePattern;
 
@@ -371,6 +1116,17 @@ public:
     patterns.add<ReductionWithReshapePattern<ArgMaxOp>>(&getContext());
 
     patterns.add<SoftmaxFusionPattern>(&getContext());
+    patterns.add<RMSNormFusionPattern>(&getContext());
+    patterns.add<LayerNormFusionPattern>(&getContext());
+    patterns.add<NormAffineFusionPattern<RMSNormOp, MultiplyOp>>(&getContext());
+    patterns.add<NormAffineFusionPattern<RMSNormOp, AddOp>>(&getContext());
+    patterns.add<NormAffineFusionPattern<LayerNormOp, MultiplyOp>>(
+        &getContext());
+    patterns.add<NormAffineFusionPattern<LayerNormOp, AddOp>>(&getContext());
+    patterns.add<GeluFusionPattern<MultiplyOp>>(&getContext());
+    patterns.add<GeluFusionPattern<DivOp>>(&getContext());
+    patterns.add<SiluFusionPattern>(&getContext());
+    patterns.add<ScaledDotProductAttentionFusionPattern>(&getContext());
     patterns.add<Conv2dWithMultiply>(&getContext());
 
     GreedyRewriteConfig config;
@@ -59,4 +59,39 @@ mlir::LogicalResult broadcastValue(mlir::PatternRewriter &rewriter,
                                           broadcastDims);
   return mlir::success();
 }
+
+std::optional<float> getConstantValue(mlir::Value value) {
+  mlir::Operation *op = value.getDefiningOp();
+  while (mlir::isa_and_present<mlir::tt::ttir::BroadcastOp,
+                               mlir::tt::ttir::ReshapeOp,
+                               mlir::tt::ttir::TypecastOp>(op)) {
+    op = op->getOperand(0).getDefiningOp();
+  }
+
+  auto constantOp = mlir::dyn_cast_if_present<mlir::tt::ttir::ConstantOp>(op);
+  if (!constantOp) {
+    return std::nullopt;
+  }
+
+  mlir::ElementsAttr attr = constantOp.getValueAttr();
+  if (!attr.isSplat()) {
+    return std::nullopt;
+  }
+
+  mlir::Type elementType = attr.getElementType();
+  mlir::APFloat fillValue(mlir::APFloat::IEEEsingle());
+  if (mlir::isa<mlir::IntegerType>(elementType)) {
+    fillValue.convertFromAPInt(attr.getSplatValue<llvm::APInt>(),
+                               attr.getElementType().isSignedInteger(),
+                               llvm::RoundingMode::TowardZero);
+    return fillValue.convertToFloat();
+  }
+  if (mlir::isa<mlir::FloatType>(elementType)) {
+    return static_cast<float>(
+        attr.getSplatValue<mlir::APFloat>().convertToDouble());
+  }
+
+  return std::nullopt;
+}
+
 } // namespace mlir::tt::ttir::utils
@@ -66,6 +66,10 @@ void createTTIRToTTMetalFrontendPipeline(
   }
   pm.addPass(ttir::createTTIROptimizeTensorLayout(optimizeTensorLayoutOptions));
   pm.addPass(mlir::createCanonicalizerPass());
+  if (options.enableGenericOpFusion) {
+    pm.addPass(ttir::createTTIRGenericOpFusion());
+    pm.addPass(mlir::createCanonicalizerPass());
+  }
   pm.addPass(ttir::createTTIRLowerToLayout());
 }
 
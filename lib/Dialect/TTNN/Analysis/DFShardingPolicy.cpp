@@ -20,7 +20,7 @@ namespace mlir::tt::ttnn {
 
 void DFShardingPolicy::run() {
   rootOp->walk([&](func::FuncOp func) {
-    if (ttmlir::utils::isConstEvalFunc(func)) {
+    if (ttmlir::utils::isSubProgramFunc(func)) {
       return;
     }
 
@@ -392,6 +392,78 @@ TTNNOperandsWorkaroundsFactory::createUpdateCacheOpOperandsWorkarounds(
       .addInputOperandWorkaround(typeWorkarounds);
 }
 
+// Paged cache kernels read page tables and positions as int32 row-major
+// tensors.
+static TTNNOperandWorkarounds createPagedCacheIndexWorkaround() {
+  TTNNOperandWorkarounds rowMajorInt32Workaround;
+  rowMajorInt32Workaround.tensorLayoutWorkaround = Layout::RowMajor;
+  rowMajorInt32Workaround.tensorDataTypeWorkaround = DataType::Int32;
+  return rowMajorInt32Workaround;
+}
+
+// Factory method to create a set of workarounds for PagedUpdateCache operation
+// operands. Update index and page table must be int32 row-major tensors.
+TTNNOperandsWorkarounds
+TTNNOperandsWorkaroundsFactory::createPagedUpdateCacheOpOperandsWorkarounds() {
+  TTNNOperandWorkarounds nullWorkarounds;
+  return TTNNOperandsWorkarounds::createEmptyTTNNOperandsWorkarounds()
+      .addInputOperandWorkaround(nullWorkarounds)
+      .addInputOperandWorkaround(nullWorkarounds)
+      .addInputOperandWorkaround(createPagedCacheIndexWorkaround())
+      .addInputOperandWorkaround(createPagedCacheIndexWorkaround());
+}
+
+// Factory method to create a set of workarounds for PagedFillCache operation
+// operands. Page table and batch index must be int32 row-major tensors.
+TTNNOperandsWorkarounds
+TTNNOperandsWorkaroundsFactory::createPagedFillCacheOpOperandsWorkarounds() {
+  TTNNOperandWorkarounds nullWorkarounds;
+  return TTNNOperandsWorkarounds::createEmptyTTNNOperandsWorkarounds()
+      .addInputOperandWorkaround(nullWorkarounds)
+      .addInputOperandWorkaround(nullWorkarounds)
+      .addInputOperandWorkaround(createPagedCacheIndexWorkaround())
+      .addInputOperandWorkaround(createPagedCacheIndexWorkaround());
+}
+
+// Factory method to create a set of workarounds for paged scaled dot product
+// attention decode operation operands. Page table and current positions must be
+// int32 row-major tensors.
+TTNNOperandsWorkarounds TTNNOperandsWorkaroundsFactory::
+    createPagedScaledDotProductAttentionDecodeOpOperandsWorkarounds() {
+  TTNNOperandWorkarounds nullWorkarounds;
+  return TTNNOperandsWorkarounds::createEmptyTTNNOperandsWorkarounds()
+      .addInputOperandWorkaround(nullWorkarounds)
+      .addInputOperandWorkaround(nullWorkarounds)
+      .addInputOperandWorkaround(nullWorkarounds)
+      .addInputOperandWorkaround(createPagedCacheIndexWorkaround())
+      .addInputOperandWorkaround(createPagedCacheIndexWorkaround())
+      .addOutputOperandWorkaround(nullWorkarounds);
+}
+
+// Factory method to create a set of workarounds for scaled dot product
+// attention operation operands. The flash attention kernel only supports bf16
+// tensors in tile layout, so the workaround is applied to the query, key,
+// value, attention mask and output operands.
+TTNNOperandsWorkarounds TTNNOperandsWorkaroundsFactory::
+    createScaledDotProductAttentionOpOperandsWorkarounds(
+        bool hasAttentionMask) {
+  TTNNOperandWorkarounds tileLayoutBF16Workaround;
+  tileLayoutBF16Workaround.tensorLayoutWorkaround = Layout::Tile;
+  tileLayoutBF16Workaround.tensorDataTypeWorkaround = DataType::BFloat16;
+
+  auto workaround =
+      TTNNOperandsWorkarounds::createEmptyTTNNOperandsWorkarounds()
+          .addInputOperandWorkaround(tileLayoutBF16Workaround)
+          .addInputOperandWorkaround(tileLayoutBF16Workaround)
+          .addInputOperandWorkaround(tileLayoutBF16Workaround)
+          .addOutputOperandWorkaround(tileLayoutBF16Workaround);
+
+  if (hasAttentionMask) {
+    workaround = workaround.addInputOperandWorkaround(tileLayoutBF16Workaround);
+  }
+  return workaround;
+}
+
 // Helper function to determine if data type workaround is required for a binary
 // op. Set the workaround data type based on the binary op.
 static std::optional<DataType> binaryOpDTypeWorkaround(mlir::Operation *op,
@@ -53,6 +53,14 @@ void createTTNNPipelineTTIRPasses(
   if (options.eraseInverseOpsEnabled) {
     pm.addPass(mlir::tt::ttir::createTTIREraseInverseOps());
   }
+
+  // Moves the remaining TMs through reductions, concats, slices and matmuls
+  // where that reduces the bytes they move.
+  if (options.tmPropagationEnabled) {
+    ttir::TTIRTMPropagationOptions tmPropagationOptions;
+    tmPropagationOptions.reportPath = options.tmPropagationReportPath;
+    pm.addPass(mlir::tt::ttir::createTTIRTMPropagation(tmPropagationOptions));
+  }
 }
 
 void createTTNNPipelineAnalysisPasses(
@@ -70,7 +78,11 @@ void createTTNNPipelineAnalysisPasses(
     optimizerOptions.maxLegalLayouts = options.maxLegalLayouts;
     optimizerOptions.rowMajorEnabled = options.rowMajorEnabled;
     pm.addPass(mlir::tt::ttnn::createTTNNOptimizer(optimizerOptions));
-    pm.addPass(mlir::tt::ttnn::createTTNNPrepareConv2dWeights());
+    ttnn::TTNNPrepareConv2dWeightsOptions prepareConv2dWeightsOptions;
+    prepareConv2dWeightsOptions.prepareConstantsOnHost =
+        options.prepareConv2dWeightsOnHost;
+    pm.addPass(mlir::tt::ttnn::createTTNNPrepareConv2dWeights(
+        prepareConv2dWeightsOptions));
   }
 }
 
@@ -137,22 +149,43 @@ void createTTIRToTTNNBackendPipeline(
   ttir::TTIRQuantDataTypeConversionPassOptions quantOptions;
   quantOptions.targetBitWidth = options.quantBitWidth;
   devicePm.addPass(ttir::createTTIRQuantDataTypeConversionPass(quantOptions));
+  // Fusion runs on the widened storage types, so the integer ops it creates
+  // already have the storage type the device supports.
+  if (options.quantizedDomainFusionEnabled) {
+    devicePm.addPass(ttir::createTTIRQuantizedDomainFusion());
+  }
 
   createTTNNPipelineLoweringPasses(devicePm, options);
   if (options.enableFusing) {
     devicePm.addPass(tt::ttnn::createTTNNFusing());
   }
   createTTNNPipelineWorkaroundPass(devicePm, options);
+  if (options.automaticPrecisionBudget > 0.0) {
+    TTNNAutomaticPrecisionOptions precisionOptions;
+    precisionOptions.accuracyBudget = options.automaticPrecisionBudget;
+    precisionOptions.sensitivityPath =
+        options.automaticPrecisionSensitivityPath;
+    precisionOptions.reportPath = options.automaticPrecisionReportPath;
+    devicePm.addPass(createTTNNAutomaticPrecision(precisionOptions));
+  }
   if (options.enableConstEval) {
     devicePm.addPass(transforms::createConstEvalHoistTransform());
   }
   createTTNNPipelineAnalysisPasses(devicePm, options);
+  // Matmul epilogues are fused after the analysis so that the fusion sees the
+  // layouts picked for L1 sharding chains.
+  if (options.enableFusing) {
+    devicePm.addPass(tt::ttnn::createTTNNMatmulEpilogueFusing());
+  }
   // We need to re-run const-eval to pick up const prepare conv2d weight ops
   // split during the analysis passes.
   if (options.enableConstEval) {
     devicePm.addPass(transforms::createConstEvalHoistTransform());
   }
   createTTNNPipelineLayoutDecompositionPass(devicePm, options);
+  if (options.cclOverlapSchedulingEnabled) {
+    devicePm.addPass(createTTNNCCLOverlapScheduling());
+  }
   createTTNNPipelineDeallocPass(devicePm, options);
 
   // Run lowering to LLVM pass on hoisted funcs in CPUModule.
@@ -173,7 +206,10 @@ void createTTIRToEmitCSOPipeline(OpPassManager &pm,
   createTTIRToTTNNBackendPipeline(pm, options);
   pm.addPass(tt::createTTUnwrapDeviceModulePass());
   pm.addPass(createTTNNModifySignaturesForDylib());
-  pm.addPass(createConvertTTNNToEmitCPass());
+
+  ConvertTTNNToEmitCOptions emitCOptions;
+  emitCOptions.optimize = options.optimizeEmitC;
+  pm.addPass(createConvertTTNNToEmitCPass(emitCOptions));
 }
 
 //===----------------------------------------------------------------------===//
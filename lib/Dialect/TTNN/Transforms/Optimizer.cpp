@@ -218,8 +218,8 @@ public:
     tracePossibleLayouts(tensorTypePossibleLayouts);
 
     moduleOp->walk([&](func::FuncOp func) {
-      // Filter out all const-eval functions.
-      if (ttmlir::utils::isConstEvalFunc(func)) {
+      // Filter out all const-eval and loop region functions.
+      if (ttmlir::utils::isSubProgramFunc(func)) {
         return;
       }
 
@@ -301,7 +301,7 @@ public:
     // No further analysis.
     //
     moduleOp->walk([&](func::FuncOp func) {
-      if (ttmlir::utils::isConstEvalFunc(func)) {
+      if (ttmlir::utils::isSubProgramFunc(func)) {
         return;
       }
 
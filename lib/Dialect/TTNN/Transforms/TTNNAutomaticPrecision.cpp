@@ -0,0 +1,355 @@
+// SPDX-FileCopyrightText: (c) 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "ttmlir/Dialect/TT/IR/TTOpsTypes.h"
+#include "ttmlir/Dialect/TTNN/IR/TTNNOps.h"
+#include "ttmlir/Dialect/TTNN/IR/TTNNOpsAttrs.h"
+#include "ttmlir/Dialect/TTNN/Transforms/Passes.h"
+#include "ttmlir/Dialect/TTNN/Types/Types.h"
+#include "ttmlir/Dialect/TTNN/Utils/TransformUtils.h"
+#include "ttmlir/Dialect/TTNN/Utils/Utils.h"
+#include "ttmlir/Utils.h"
+
+#include "mlir/Dialect/Func/IR/FuncOps.h"
+#include "mlir/IR/PatternMatch.h"
+#include "llvm/ADT/MapVector.h"
+#include "llvm/Support/Debug.h"
+#include "llvm/Support/JSON.h"
+#include "llvm/Support/MemoryBuffer.h"
+#include "llvm/Support/raw_ostream.h"
+
+#include <cmath>
+
+#define DEBUG_TYPE "ttnn-automatic-precision"
+
+namespace mlir::tt::ttnn {
+#define GEN_PASS_DEF_TTNNAUTOMATICPRECISION
+#include "ttmlir/Dialect/TTNN/Transforms/Passes.h.inc"
+
+// Block-float formats a weight can be lowered to, from the most to the least
+// precise.
+static constexpr std::array<DataType, 2> g_blockFloatFormats = {
+    DataType::BFP_BFloat8, DataType::BFP_BFloat4};
+
+// Relative rounding error of a value stored in `dataType`, i.e. half an ulp
+// of the mantissa that follows the shared exponent of a block.
+static double getDefaultError(DataType dataType) {
+  switch (dataType) {
+  case DataType::BFP_BFloat8:
+    return std::ldexp(1.0, -8);
+  case DataType::BFP_BFloat4:
+    return std::ldexp(1.0, -4);
+  default:
+    return 0.0;
+  }
+}
+
+static uint64_t getTileSizeBytes(MLIRContext *context, DataType dataType) {
+  return mlir::cast<TileType>(
+             utils::getElementType(context, Layout::Tile, dataType))
+      .getSizeBytes();
+}
+
+// Returns the values of `funcOp` which are computed only from parameter and
+// constant arguments. These are hoisted into const-eval functions.
+static llvm::DenseSet<Value> getConstEvaluableValues(func::FuncOp funcOp) {
+  llvm::SmallPtrSet<BlockArgument, 4> constParams =
+      ttmlir::utils::populateConstParams(funcOp);
+  llvm::DenseSet<Value> constEvaluable(constParams.begin(), constParams.end());
+
+  funcOp.walk([&](Operation *op) {
+    if (llvm::all_of(op->getOperands(), [&](Value operand) {
+          return constEvaluable.contains(operand);
+        })) {
+      constEvaluable.insert(op->result_begin(), op->result_end());
+    }
+  });
+  return constEvaluable;
+}
+
+namespace {
+// A weight read by one or more matmul/linear ops.
+struct WeightCandidate {
+  Value weight;
+  SmallVector<Operation *> users;
+  uint64_t numTiles = 0;
+  // Formats the weight can be stored in. The first one is its current format.
+  SmallVector<DataType> formats;
+  // Estimated relative output error of storing the weight in each format.
+  SmallVector<double> errors;
+  // Index of the selected format.
+  size_t selected = 0;
+
+  uint64_t getSizeBytes(MLIRContext *context, size_t format) const {
+    return numTiles * getTileSizeBytes(context, formats[format]);
+  }
+};
+} // namespace
+
+namespace {
+class TTNNAutomaticPrecision
+    : public impl::TTNNAutomaticPrecisionBase<TTNNAutomaticPrecision> {
+public:
+  using impl::TTNNAutomaticPrecisionBase<
+      TTNNAutomaticPrecision>::TTNNAutomaticPrecisionBase;
+
+  void runOnOperation() final {
+    ModuleOp moduleOp = getOperation();
+    if (accuracyBudget < 0.0) {
+      moduleOp.emitError("Accuracy budget must not be negative.");
+      signalPassFailure();
+      return;
+    }
+    if (failed(loadSensitivities())) {
+      signalPassFailure();
+      return;
+    }
+
+    SmallVector<WeightCandidate> candidates;
+    moduleOp.walk([&](func::FuncOp funcOp) {
+      if (funcOp.isDeclaration() || ttmlir::utils::isSubProgramFunc(funcOp)) {
+        return;
+      }
+      collectCandidates(funcOp, candidates);
+    });
+
+    double usedErrorSq = selectFormats(candidates);
+
+    PatternRewriter rewriter(&getContext());
+    for (WeightCandidate &candidate : candidates) {
+      if (candidate.selected != 0) {
+        convertWeight(rewriter, candidate);
+      }
+    }
+
+    if (!reportPath.empty()) {
+      writeReport(candidates, std::sqrt(usedErrorSq));
+    }
+  }
+
+private:
+  llvm::json::Value sensitivities = nullptr;
+
+  LogicalResult loadSensitivities() {
+    if (sensitivityPath.empty()) {
+      return success();
+    }
+
+    llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer>> buffer =
+        llvm::MemoryBuffer::getFile(sensitivityPath);
+    if (!buffer) {
+      return getOperation().emitError()
+             << "Failed to open sensitivity file " << sensitivityPath << ": "
+             << buffer.getError().message();
+    }
+
+    llvm::Expected<llvm::json::Value> json =
+        llvm::json::parse((*buffer)->getBuffer());
+    if (!json) {
+      return getOperation().emitError()
+             << "Failed to parse sensitivity file " << sensitivityPath << ": "
+             << llvm::toString(json.takeError());
+    }
+    if (!json->getAsObject()) {
+      return getOperation().emitError()
+             << "Sensitivity file " << sensitivityPath
+             << " must contain a JSON object.";
+    }
+    sensitivities = std::move(*json);
+    return success();
+  }
+
+  // Returns the relative output error of `op` when its weight is stored in
+  // `dataType`, taken from the sensitivity file if it has an entry for `op`.
+  double getError(Operation *op, DataType dataType) const {
+    if (const llvm::json::Object *ops = sensitivities.getAsObject()) {
+      if (const llvm::json::Object *opSensitivities =
+              ops->getObject(utils::getOpLocName(op))) {
+        if (std::optional<double> error = opSensitivities->getNumber(
+                DataTypeEnumToString(dataType))) {
+          return *error;
+        }
+      }
+    }
+    return getDefaultError(dataType);
+  }
+
+  void collectCandidates(func::FuncOp funcOp,
+                         SmallVector<WeightCandidate> &candidates) {
+    llvm::DenseSet<Value> constEvaluable = getConstEvaluableValues(funcOp);
+
+    llvm::MapVector<Value, SmallVector<Operation *>> weightUsers;
+    funcOp.walk([&](Operation *op) {
+      Value weight;
+      if (auto matmulOp = mlir::dyn_cast<MatmulOp>(op)) {
+        weight = matmulOp.getB();
+      } else if (auto linearOp = mlir::dyn_cast<LinearOp>(op)) {
+        weight = linearOp.getB();
+      } else {
+        return;
+      }
+      if (constEvaluable.contains(weight) &&
+          !constEvaluable.contains(op->getOperand(0))) {
+        weightUsers[weight].push_back(op);
+      }
+    });
+
+    for (auto &[weight, users] : weightUsers) {
+      auto weightType = mlir::cast<RankedTensorType>(weight.getType());
+      auto layout =
+          mlir::dyn_cast_if_present<TTNNLayoutAttr>(weightType.getEncoding());
+      if (!layout || !layout.isTiled() ||
+          (layout.getDataType() != DataType::BFloat16 &&
+           layout.getDataType() != DataType::Float32)) {
+        continue;
+      }
+
+      WeightCandidate candidate;
+      candidate.weight = weight;
+      candidate.users = users;
+      candidate.numTiles =
+          ttmlir::utils::volume<int64_t>(
+              utils::getTilePaddedShape(weightType.getShape())) /
+          (TILE_HEIGHT * TILE_WIDTH);
+      candidate.formats.push_back(layout.getDataType());
+      candidate.errors.push_back(0.0);
+      for (DataType dataType : g_blockFloatFormats) {
+        // Errors of ops sharing the weight are independent, so they add in
+        // quadrature like the errors of different weights.
+        double errorSq = 0.0;
+        for (Operation *user : users) {
+          errorSq += std::pow(getError(user, dataType), 2);
+        }
+        candidate.formats.push_back(dataType);
+        candidate.errors.push_back(std::sqrt(errorSq));
+      }
+      candidates.push_back(std::move(candidate));
+    }
+  }
+
+  // Greedily lowers the format of the weight which saves the most bytes per
+  // unit of added squared error until no step fits in the budget. Returns the
+  // total squared error of the selected formats.
+  double selectFormats(SmallVector<WeightCandidate> &candidates) {
+    MLIRContext *context = &getContext();
+    double budgetSq = accuracyBudget * accuracyBudget;
+    double usedErrorSq = 0.0;
+
+    while (true) {
+      WeightCandidate *best = nullptr;
+      double bestAddedErrorSq = 0.0;
+      double bestRatio = 0.0;
+      for (WeightCandidate &candidate : candidates) {
+        size_t current = candidate.selected;
+        size_t next = current + 1;
+        if (next == candidate.formats.size()) {
+          continue;
+        }
+
+        double addedErrorSq = std::pow(candidate.errors[next], 2) -
+                              std::pow(candidate.errors[current], 2);
+        if (usedErrorSq + addedErrorSq > budgetSq) {
+          continue;
+        }
+
+        int64_t savedBytes = candidate.getSizeBytes(context, current) -
+                             candidate.getSizeBytes(context, next);
+        double ratio = addedErrorSq > 0.0
+                           ? savedBytes / addedErrorSq
+                           : std::numeric_limits<double>::infinity();
+        if (!best || ratio > bestRatio) {
+          best = &candidate;
+          bestAddedErrorSq = addedErrorSq;
+          bestRatio = ratio;
+        }
+      }
+
+      if (!best) {
+        return usedErrorSq;
+      }
+      best->selected++;
+      usedErrorSq += bestAddedErrorSq;
+    }
+  }
+
+  // Converts the weight to its selected format right after it is defined, so
+  // the conversion is hoisted into const-eval along with the weight.
+  void convertWeight(PatternRewriter &rewriter, WeightCandidate &candidate) {
+    DataType dataType = candidate.formats[candidate.selected];
+    auto weight =
+        mlir::cast<mlir::TypedValue<RankedTensorType>>(candidate.weight);
+    TTNNLayoutAttr layout = utils::getLayoutAttrFromTensor(weight.getType());
+
+    std::optional<TensorMemoryLayout> memLayout;
+    if (layout.getMemLayout()) {
+      memLayout = layout.getMemLayout().getValue();
+    }
+
+    rewriter.setInsertionPointAfterValue(weight);
+    ToLayoutOp toLayoutOp = utils::createToLayoutOp(
+        candidate.users.front(), weight, rewriter, Layout::Tile,
+        layout.getBufferType(), memLayout, dataType,
+        ("_weight_" + DataTypeEnumToString(dataType)).str());
+
+    for (Operation *user : candidate.users) {
+      rewriter.modifyOpInPlace(user, [&]() { user->setOperand(1, toLayoutOp); });
+    }
+
+    LLVM_DEBUG(llvm::dbgs()
+               << "Storing weight of " << utils::getOpLocName(
+                                              candidate.users.front())
+               << " as " << DataTypeEnumToString(dataType) << " ("
+               << candidate.getSizeBytes(&getContext(), 0) << " -> "
+               << candidate.getSizeBytes(&getContext(), candidate.selected)
+               << " bytes)\n");
+  }
+
+  void writeReport(ArrayRef<WeightCandidate> candidates,
+                   double estimatedError) {
+    std::error_code ec;
+    llvm::raw_fd_ostream file(reportPath, ec);
+    if (ec) {
+      getOperation().emitWarning()
+          << "Failed to open automatic precision report file " << reportPath
+          << ": " << ec.message();
+      return;
+    }
+
+    MLIRContext *context = &getContext();
+    uint64_t totalBytesBefore = 0;
+    uint64_t totalBytesAfter = 0;
+    llvm::json::OStream json(file, /*IndentSize=*/2);
+    json.object([&] {
+      json.attributeArray("weights", [&] {
+        for (const WeightCandidate &candidate : candidates) {
+          uint64_t bytesBefore = candidate.getSizeBytes(context, 0);
+          uint64_t bytesAfter =
+              candidate.getSizeBytes(context, candidate.selected);
+          json.object([&] {
+            json.attributeArray("ops", [&] {
+              for (Operation *user : candidate.users) {
+                json.value(utils::getOpLocName(user));
+              }
+            });
+            json.attribute("data_type",
+                           DataTypeEnumToString(
+                               candidate.formats[candidate.selected]));
+            json.attribute("error", candidate.errors[candidate.selected]);
+            json.attribute("bytes_before", bytesBefore);
+            json.attribute("bytes_after", bytesAfter);
+          });
+          totalBytesBefore += bytesBefore;
+          totalBytesAfter += bytesAfter;
+        }
+      });
+      json.attribute("estimated_error", estimatedError);
+      json.attribute("bytes_before", totalBytesBefore);
+      json.attribute("bytes_after", totalBytesAfter);
+    });
+    file << "\n";
+  }
+};
+} // namespace
+
+} // namespace mlir::tt::ttnn
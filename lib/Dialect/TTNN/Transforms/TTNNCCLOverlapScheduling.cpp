@@ -0,0 +1,129 @@
+// SPDX-FileCopyrightText: (c) 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "ttmlir/Dialect/TTNN/IR/TTNNOps.h"
+#include "ttmlir/Dialect/TTNN/Transforms/Passes.h"
+
+#include "mlir/Dialect/Func/IR/FuncOps.h"
+#include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/SetVector.h"
+#include "llvm/ADT/SmallVector.h"
+
+namespace mlir::tt::ttnn {
+#define GEN_PASS_DEF_TTNNCCLOVERLAPSCHEDULING
+#include "ttmlir/Dialect/TTNN/Transforms/Passes.h.inc"
+
+namespace {
+
+bool isCCLOp(Operation *op) {
+  return isa<AllGatherOp, ReduceScatterOp, AllReduceOp, CollectivePermuteOp>(
+      op);
+}
+
+// Ops without results are only executed for their side effects (deallocate,
+// update_cache, ...), so nothing may be moved across them.
+bool isSchedulingBarrier(Operation *op) {
+  return op->getNumResults() == 0 || op->hasTrait<OpTrait::IsTerminator>();
+}
+
+// Ops with regions may use the producer from inside their bodies, so the
+// operands of all nested ops are checked too.
+bool usesResultOf(Operation *user, Operation *producer) {
+  WalkResult result = user->walk([&](Operation *nested) {
+    if (llvm::any_of(nested->getOperands(), [&](Value operand) {
+          return operand.getDefiningOp() == producer;
+        })) {
+      return WalkResult::interrupt();
+    }
+    return WalkResult::advance();
+  });
+  return result.wasInterrupted();
+}
+
+class TTNNCCLOverlapScheduling
+    : public impl::TTNNCCLOverlapSchedulingBase<TTNNCCLOverlapScheduling> {
+public:
+  using impl::TTNNCCLOverlapSchedulingBase<
+      TTNNCCLOverlapScheduling>::TTNNCCLOverlapSchedulingBase;
+
+  void runOnOperation() final {
+    getOperation()->walk([&](func::FuncOp funcOp) {
+      if (funcOp.isDeclaration()) {
+        return;
+      }
+
+      for (Block &block : funcOp.getBody()) {
+        hoistCollectives(block);
+        sinkCollectiveConsumers(block);
+      }
+    });
+  }
+
+private:
+  // Move every collective right after the closest preceding op it must not
+  // be reordered with: a producer of one of its operands, another collective
+  // or a scheduling barrier.
+  void hoistCollectives(Block &block) {
+    SmallVector<Operation *> collectives;
+    for (Operation &op : block) {
+      if (isCCLOp(&op)) {
+        collectives.push_back(&op);
+      }
+    }
+
+    for (Operation *collective : collectives) {
+      Operation *anchor = collective->getPrevNode();
+      while (anchor && !isCCLOp(anchor) && !isSchedulingBarrier(anchor) &&
+             !usesResultOf(collective, anchor)) {
+        anchor = anchor->getPrevNode();
+      }
+
+      if (anchor) {
+        collective->moveAfter(anchor);
+      } else {
+        collective->moveBefore(&block.front());
+      }
+    }
+  }
+
+  // Move every direct consumer of a collective right before the closest
+  // following op it must not be reordered with: a user of one of its results,
+  // a collective or a scheduling barrier. This widens the window in which
+  // independent compute is issued while the collective is in flight.
+  void sinkCollectiveConsumers(Block &block) {
+    llvm::SetVector<Operation *> consumers;
+    for (Operation &op : block) {
+      if (!isCCLOp(&op)) {
+        continue;
+      }
+      for (Operation *user : op.getUsers()) {
+        if (user->getBlock() == &block && !isCCLOp(user) &&
+            !isSchedulingBarrier(user)) {
+          consumers.insert(user);
+        }
+      }
+    }
+
+    // Sink the latest consumers first so that chains of consumers keep their
+    // relative order.
+    SmallVector<Operation *> sorted = consumers.takeVector();
+    llvm::sort(sorted, [](Operation *lhs, Operation *rhs) {
+      return rhs->isBeforeInBlock(lhs);
+    });
+
+    for (Operation *consumer : sorted) {
+      Operation *anchor = consumer->getNextNode();
+      while (anchor && !isCCLOp(anchor) && !isSchedulingBarrier(anchor) &&
+             !usesResultOf(anchor, consumer)) {
+        anchor = anchor->getNextNode();
+      }
+
+      assert(anchor && "block must end with a terminator");
+      consumer->moveBefore(anchor);
+    }
+  }
+};
+} // namespace
+
+} // namespace mlir::tt::ttnn
@@ -7,8 +7,11 @@
 
 #include "mlir/Transforms/GreedyPatternRewriteDriver.h"
 
+#include <optional>
+
 namespace mlir::tt::ttnn {
 #define GEN_PASS_DEF_TTNNFUSING
+#define GEN_PASS_DEF_TTNNMATMULEPILOGUEFUSING
 #include "ttmlir/Dialect/TTNN/Transforms/Passes.h.inc"
 
 namespace {
@@ -98,6 +101,148 @@ private:
   }
 };
 
+// The fused op takes over the result of the epilogue op it absorbs, so it has
+// to write the epilogue's output type. The layouts come from the layout
+// analysis, which validated each op only with its own output layout, so the
+// two are only fused when the producer already writes exactly the epilogue's
+// type, including its encoding.
+static bool hasCompatibleOutputLayout(Operation *producer,
+                                      Operation *epilogue) {
+  return producer->getResult(0).getType() == epilogue->getResult(0).getType();
+}
+
+// Folds an add following a matmul, or a linear without bias, into the bias of
+// a linear op. ttnn::linear only broadcasts a single bias row, so the addend
+// has to be of shape [N] or [1, ..., 1, N]. Residual adds stay separate.
+class TTNNMatmulWithBias : public mlir::OpRewritePattern<AddOp> {
+  using TTNNMatmulWithBias::OpRewritePattern<AddOp>::OpRewritePattern;
+
+public:
+  mlir::LogicalResult
+  matchAndRewrite(AddOp srcOp, mlir::PatternRewriter &rewriter) const final {
+    for (auto [input, bias] :
+         {std::make_pair(srcOp.getLhs(), srcOp.getRhs()),
+          std::make_pair(srcOp.getRhs(), srcOp.getLhs())}) {
+      Operation *producer = input.getDefiningOp();
+      if (!producer || !isFusable(producer, srcOp, bias)) {
+        continue;
+      }
+
+      auto fuse = [&](auto producerOp) {
+        rewriter.replaceOpWithNewOp<LinearOp>(
+            srcOp, srcOp.getResult().getType(), producerOp.getA(),
+            producerOp.getB(), bias, producerOp.getTransposeA(),
+            producerOp.getTransposeB(), /*activation=*/nullptr);
+      };
+      if (auto linearOp = mlir::dyn_cast<LinearOp>(producer)) {
+        fuse(linearOp);
+      } else {
+        fuse(mlir::cast<MatmulOp>(producer));
+      }
+      return mlir::success();
+    }
+    return mlir::failure();
+  }
+
+private:
+  bool isFusable(Operation *producer, AddOp srcOp, Value bias) const {
+    // The bias is added before the activation, so an add following an
+    // activation can't be folded.
+    if (auto linearOp = mlir::dyn_cast<LinearOp>(producer)) {
+      if (linearOp.getBias() || linearOp.getActivation()) {
+        return false;
+      }
+    } else if (auto matmulOp = mlir::dyn_cast<MatmulOp>(producer)) {
+      // Linear doesn't take a program config, and dropping it would change
+      // the output shard spec picked for the matmul.
+      if (matmulOp.getActivation() || matmulOp.getMatmulProgramConfig()) {
+        return false;
+      }
+    } else {
+      return false;
+    }
+
+    if (!producer->hasOneUse() || !hasCompatibleOutputLayout(producer, srcOp)) {
+      return false;
+    }
+
+    auto biasType = mlir::cast<RankedTensorType>(bias.getType());
+    RankedTensorType resultType = srcOp.getResult().getType();
+    ArrayRef<int64_t> biasShape = biasType.getShape();
+    return biasType.getElementType() == resultType.getElementType() &&
+           !biasShape.empty() &&
+           static_cast<int64_t>(biasShape.size()) <= resultType.getRank() &&
+           biasShape.back() == resultType.getShape().back() &&
+           llvm::all_of(biasShape.drop_back(),
+                        [](int64_t dim) { return dim == 1; });
+  }
+};
+
+// Returns the name of the matmul activation computing `op`, if there is one.
+static std::optional<llvm::StringRef> getMatmulActivation(ReluOp) {
+  return "relu";
+}
+
+static std::optional<llvm::StringRef> getMatmulActivation(SiluOp) {
+  return "silu";
+}
+
+// The "gelu" matmul activation runs gelu in its fast approximate mode, so the
+// exact gelu isn't fused.
+static std::optional<llvm::StringRef> getMatmulActivation(GeluOp op) {
+  if (!op.getApproximate()) {
+    return std::nullopt;
+  }
+  return "gelu";
+}
+
+// Folds a unary activation following a matmul or linear into the op's
+// activation, see getMatmulActivation.
+template <typename ActivationOp>
+class TTNNMatmulWithActivation : public mlir::OpRewritePattern<ActivationOp> {
+  using mlir::OpRewritePattern<ActivationOp>::OpRewritePattern;
+
+public:
+  mlir::LogicalResult
+  matchAndRewrite(ActivationOp srcOp,
+                  mlir::PatternRewriter &rewriter) const final {
+    std::optional<llvm::StringRef> activationName = getMatmulActivation(srcOp);
+    Operation *producer = srcOp.getInput().getDefiningOp();
+    if (!activationName || !producer || !isFusable(producer, srcOp)) {
+      return mlir::failure();
+    }
+
+    mlir::StringAttr activation = rewriter.getStringAttr(*activationName);
+    rewriter.modifyOpInPlace(producer, [&]() {
+      if (auto linearOp = mlir::dyn_cast<LinearOp>(producer)) {
+        linearOp.setActivationAttr(activation);
+      } else {
+        mlir::cast<MatmulOp>(producer).setActivationAttr(activation);
+      }
+    });
+    rewriter.replaceOp(srcOp, producer->getResult(0));
+    return mlir::success();
+  }
+
+private:
+  bool isFusable(Operation *producer, ActivationOp srcOp) const {
+    if (auto linearOp = mlir::dyn_cast<LinearOp>(producer)) {
+      if (linearOp.getActivation()) {
+        return false;
+      }
+    } else if (auto matmulOp = mlir::dyn_cast<MatmulOp>(producer)) {
+      // With a program config the activation has to be its fused activation.
+      if (matmulOp.getActivation() || matmulOp.getMatmulProgramConfig()) {
+        return false;
+      }
+    } else {
+      return false;
+    }
+
+    return producer->hasOneUse() && hasCompatibleOutputLayout(producer, srcOp);
+  }
+};
+
 class TTNNFusingPass : public impl::TTNNFusingBase<TTNNFusingPass> {
 public:
   using impl::TTNNFusingBase<TTNNFusingPass>::TTNNFusingBase;
@@ -110,6 +255,23 @@ public:
     (void)applyPatternsGreedily(getOperation(), std::move(patterns));
   }
 };
+
+class TTNNMatmulEpilogueFusingPass
+    : public impl::TTNNMatmulEpilogueFusingBase<TTNNMatmulEpilogueFusingPass> {
+public:
+  using impl::TTNNMatmulEpilogueFusingBase<
+      TTNNMatmulEpilogueFusingPass>::TTNNMatmulEpilogueFusingBase;
+
+  void runOnOperation() final {
+    RewritePatternSet patterns(&getContext());
+    patterns.add<TTNNMatmulWithBias, TTNNMatmulWithActivation<ReluOp>,
+                 TTNNMatmulWithActivation<GeluOp>,
+                 TTNNMatmulWithActivation<SiluOp>>(&getContext());
+    GreedyRewriteConfig config;
+    config.useTopDownTraversal = true;
+    (void)applyPatternsGreedily(getOperation(), std::move(patterns));
+  }
+};
 } // namespace
 
 } // namespace mlir::tt::ttnn
@@ -5,6 +5,8 @@
 #include "ttmlir/Dialect/TTNN/IR/TTNNOps.h"
 #include "ttmlir/Dialect/TTNN/IR/TTNNOpsAttrs.h"
 #include "ttmlir/Dialect/TTNN/Transforms/Passes.h"
+#include "ttmlir/Dialect/TTNN/Utils/Conv2dWeights.h"
+#include "ttmlir/Dialect/TTNN/Utils/Utils.h"
 #include "ttmlir/OpModel/TTNN/SingletonDeviceContext.h"
 #include "ttmlir/OpModel/TTNN/TTNNOpModel.h"
 #include "ttmlir/Utils.h"
@@ -43,6 +45,12 @@ public:
               utils::createShardSpecIfNeeded(inputLayoutAttr, deviceGrid));
 
       rewriter.setInsertionPoint(conv2dOp);
+      if (prepareConstantsOnHost &&
+          prepareWeightsOnHost(rewriter, conv2dOp, inputLayoutAttr,
+                               deviceGrid)) {
+        return;
+      }
+
       ttnn::PrepareConv2dWeightsOp prepareConv2dWeightsOp =
           rewriter.create<ttnn::PrepareConv2dWeightsOp>(
               ttmlir::utils::appendLocationSuffix(conv2dOp.getLoc(),
@@ -76,6 +84,102 @@ public:
   }
 
 private:
+  // Replaces a constant weight with the prepared weight matrix computed on the
+  // host, so the runtime only tilizes it and moves it to the device. Returns
+  // false if the weight isn't a dense constant or the conv2d needs a weight
+  // layout the host implementation doesn't produce.
+  bool prepareWeightsOnHost(IRRewriter &rewriter, ttnn::Conv2dOp conv2dOp,
+                            ttnn::TTNNLayoutAttr inputLayoutAttr,
+                            GridAttr deviceGrid) {
+    auto constantOp = conv2dOp.getWeight().getDefiningOp<ttnn::ConstantOp>();
+    if (!constantOp) {
+      return false;
+    }
+    auto weights = mlir::dyn_cast<DenseElementsAttr>(constantOp.getValue());
+    if (!weights || !mlir::isa<FloatType>(weights.getElementType())) {
+      return false;
+    }
+
+    // The host layout is the one ttnn produces for height sharded
+    // convolutions. Without an explicit shard layout ttnn picks one from the
+    // input and may pick block or width sharding, which interleave the weight
+    // matrix, as do grouped convolutions. Row major inputs use a different
+    // input channel alignment.
+    ttnn::Conv2dConfigAttr conv2dConfig = conv2dOp.getConv2dConfigAttr();
+    if (conv2dOp.getGroups() != 1 ||
+        inputLayoutAttr.getLayout() != ttnn::Layout::Tile || !conv2dConfig ||
+        conv2dConfig.getShardLayout() !=
+            ttnn::TensorMemoryLayout::HeightSharded) {
+      return false;
+    }
+
+    // Only use the host layout when it matches the shape the device would
+    // produce.
+    mlir::RankedTensorType preparedType = getPreparedWeightsType(conv2dOp);
+    llvm::ArrayRef<int64_t> preparedShape = preparedType.getShape();
+    llvm::ArrayRef<int64_t> weightShape = weights.getType().getShape();
+    const auto tileShape = TileType::getDefaultShape();
+    const int64_t paddedInChannels =
+        ttmlir::utils::alignUp<int64_t>(weightShape[1], tileShape[1]);
+    if (preparedShape.size() != 4 || preparedShape[0] != 1 ||
+        preparedShape[1] != 1 ||
+        preparedShape[2] !=
+            ttmlir::utils::alignUp<int64_t>(
+                weightShape[2] * weightShape[3] * paddedInChannels,
+                tileShape[0]) ||
+        preparedShape[3] < weightShape[0]) {
+      return false;
+    }
+
+    mlir::Type elementType = weights.getElementType();
+    llvm::SmallVector<APFloat> values =
+        llvm::to_vector(weights.getValues<APFloat>());
+    llvm::SmallVector<APFloat> matrix =
+        utils::reorderConv2dWeightsToMatrix<APFloat>(
+            values, weightShape, paddedInChannels, preparedShape[2],
+            preparedShape[3],
+            APFloat::getZero(
+                mlir::cast<FloatType>(elementType).getFloatSemantics()));
+
+    // The prepared constant stays on the host in row major, like every other
+    // constant.
+    mlir::RankedTensorType constantType = constantOp.getType();
+    mlir::RankedTensorType hostType = mlir::RankedTensorType::get(
+        preparedShape, constantType.getElementType(),
+        utils::getLayoutAttrFromTensor(constantType)
+            .withTensorShape(preparedShape));
+    ttnn::ConstantOp preparedConstantOp = rewriter.create<ttnn::ConstantOp>(
+        ttmlir::utils::appendLocationSuffix(conv2dOp.getLoc(),
+                                            "_prepared_weights"),
+        hostType,
+        DenseElementsAttr::get(
+            mlir::RankedTensorType::get(preparedShape, elementType), matrix));
+
+    ttnn::TTNNLayoutAttr preparedLayoutAttr =
+        mlir::cast<ttnn::TTNNLayoutAttr>(preparedType.getEncoding());
+    ttnn::MemoryConfigAttr preparedMemConfigAttr =
+        rewriter.getAttr<ttnn::MemoryConfigAttr>(
+            preparedLayoutAttr.getMemLayout(),
+            rewriter.getAttr<ttnn::BufferTypeAttr>(
+                preparedLayoutAttr.getBufferType()),
+            utils::createShardSpecIfNeeded(preparedLayoutAttr, deviceGrid));
+    ttnn::ToLayoutOp toLayoutOp = rewriter.create<ttnn::ToLayoutOp>(
+        ttmlir::utils::appendLocationSuffix(conv2dOp.getLoc(),
+                                            "_prepared_weights_to_layout"),
+        preparedType, preparedConstantOp.getResult(),
+        rewriter.getAttr<ttnn::LayoutAttr>(preparedLayoutAttr.getLayout()),
+        rewriter.getAttr<DataTypeAttr>(preparedLayoutAttr.getDataType()),
+        preparedMemConfigAttr, conv2dOp.getDevice());
+
+    rewriter.modifyOpInPlace(conv2dOp, [&]() {
+      conv2dOp.getWeightMutable().assign(toLayoutOp);
+    });
+    if (constantOp->use_empty()) {
+      rewriter.eraseOp(constantOp);
+    }
+    return true;
+  }
+
   ::mlir::RankedTensorType getPreparedWeightsType(ttnn::Conv2dOp conv2dOp) {
     // We use graph capture to retrieve the output type of the PrepareConv2dOp
     // for now until metal exposes an API.
@@ -25,12 +25,15 @@
 #include "mlir/Support/LogicalResult.h"
 #include "llvm/ADT/STLForwardCompat.h"
 #include "llvm/ADT/SmallVector.h"
+#include "llvm/ADT/StringMap.h"
 #include "llvm/Support/LogicalResult.h"
 #include "llvm/Support/raw_ostream.h"
+#include "llvm/Support/xxhash.h"
 
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <mlir/IR/BuiltinTypeInterfaces.h>
 #include <mlir/IR/BuiltinTypes.h>
@@ -380,19 +383,38 @@ ethernetConfigToFlatbuffer(FlatbufferObjectCache &cache,
       toFlatbuffer(ethernetConfigAttr.getNocIndex()));
 }
 
+// Kernels are translated to C++ once per symbol and each unique source is
+// stored once per binary, no matter how many programs reference it.
+class KernelSourceCache {
+public:
+  KernelSourceCache(const SymbolTable &symbolTable)
+      : symbolTable(symbolTable) {}
+
+  StringRef getSource(StringRef kernelSymbol) {
+    auto [it, inserted] = sources.try_emplace(kernelSymbol);
+    if (inserted) {
+      auto kernelEntry = symbolTable.lookup<func::FuncOp>(kernelSymbol);
+      assert(kernelEntry);
+      llvm::raw_string_ostream stream(it->second);
+      LogicalResult result =
+          ttkernel::translateKernelFuncToCpp(kernelEntry, stream);
+      assert(result.succeeded());
+      assert(it->second.size() > 0 && "empty kernel source");
+    }
+    return it->second;
+  }
+
+private:
+  const SymbolTable &symbolTable;
+  llvm::StringMap<std::string> sources;
+};
+
 static flatbuffers::Offset<target::metal::KernelConfig>
 kernelConfigToFlatbuffer(FlatbufferObjectCache &cache,
                          KernelConfigInterface kernelConfig,
-                         const SymbolTable &symbolTable) {
+                         KernelSourceCache &kernelSources) {
   StringRef kernelSymbol = kernelConfig.getKernelSymbol().getRootReference();
-  auto kernelEntry = symbolTable.lookup<func::FuncOp>(kernelSymbol);
-  assert(kernelEntry);
-  std::string source;
-  llvm::raw_string_ostream stream(source);
-  LogicalResult result =
-      ttkernel::translateKernelFuncToCpp(kernelEntry, stream);
-  assert(result.succeeded());
-  assert(source.size() > 0 && "empty kernel source");
+  StringRef source = kernelSources.getSource(kernelSymbol);
 
   std::vector<target::Dim2dRange> coreRangeSet = {
       toFlatbuffer(mlir::cast<CoreRangeAttr>(kernelConfig.getCoreRange()))};
@@ -432,11 +454,31 @@ kernelConfigToFlatbuffer(FlatbufferObjectCache &cache,
 
   return target::metal::CreateKernelConfigDirect(
       *cache.fbb, target::metal::Kernel::KernelSource,
-      target::metal::CreateKernelSourceDirect(*cache.fbb, source.c_str())
+      target::metal::CreateKernelSource(*cache.fbb,
+                                        cache.fbb->CreateSharedString(source))
           .Union(),
       &coreRangeSet, args, configType, configUnion, kernelSymbol.data());
 }
 
+// Content hash of a program: the kernel sources, their configs and the
+// circular buffer ports they are bound to. Identical programs get the same
+// hash across functions and binaries, the runtime uses it to look up compiled
+// programs.
+static std::string getProgramKey(EnqueueProgramOp enqueueProgramOp,
+                                 KernelSourceCache &kernelSources) {
+  std::string key;
+  llvm::raw_string_ostream stream(key);
+  for (Attribute kernelConfig : enqueueProgramOp.getKernelConfigs()) {
+    StringRef kernelSymbol = mlir::cast<KernelConfigInterface>(kernelConfig)
+                                 .getKernelSymbol()
+                                 .getRootReference();
+    stream << kernelSources.getSource(kernelSymbol) << '\0' << kernelConfig
+           << '\0';
+  }
+  llvm::interleaveComma(enqueueProgramOp.getCbPorts(), stream);
+  return key;
+}
+
 static flatbuffers::Offset<::flatbuffers::Vector<uint8_t>>
 memrefGlobalOpToFlatbufferByteVector(FlatbufferObjectCache &cache,
                                      memref::GlobalOp globalOp) {
@@ -476,6 +518,9 @@ static std::shared_ptr<void> translateModuleToFlatbuffer(
         deviceModule.getBodyRegion().front().front());
   }
   SymbolTable symbolTable(module);
+  KernelSourceCache kernelSources(symbolTable);
+  // Unique programs by content, identical programs share a single ProgramDesc.
+  llvm::StringMap<flatbuffers::Offset<target::metal::ProgramDesc>> programDescs;
 
   auto systemDesc =
       mlir::cast<tt::SystemDescAttr>(module->getAttr(tt::SystemDescAttr::name));
@@ -551,18 +596,24 @@ static std::shared_ptr<void> translateModuleToFlatbuffer(
           cbs.push_back(target::metal::CreateCBRef(*cache.fbb, port, buffer));
         }
 
-        std::vector<flatbuffers::Offset<target::metal::KernelConfig>>
-            kernelConfigs;
-        kernelConfigs.reserve(enqueueProgramOp.getKernelConfigs().size());
-        for (Attribute kernelConfig : enqueueProgramOp.getKernelConfigs()) {
-          kernelConfigs.push_back(kernelConfigToFlatbuffer(
-              cache, mlir::cast<KernelConfigInterface>(kernelConfig),
-              symbolTable));
+        std::string programKey =
+            getProgramKey(enqueueProgramOp, kernelSources);
+        auto [programDescIt, inserted] = programDescs.try_emplace(programKey);
+        if (inserted) {
+          std::vector<flatbuffers::Offset<target::metal::KernelConfig>>
+              kernelConfigs;
+          kernelConfigs.reserve(enqueueProgramOp.getKernelConfigs().size());
+          for (Attribute kernelConfig : enqueueProgramOp.getKernelConfigs()) {
+            kernelConfigs.push_back(cache.getOrCreate(
+                mlir::cast<KernelConfigInterface>(kernelConfig),
+                kernelConfigToFlatbuffer, std::ref(kernelSources)));
+          }
+          programDescIt->second = target::metal::CreateProgramDescDirect(
+              fbb, &kernelConfigs, llvm::xxh3_64bits(programKey));
         }
         cqBuilder.appendCommand(
             target::metal::CreateEnqueueProgramCommandDirect(
-                fbb, &buffers, &cbs,
-                target::metal::CreateProgramDescDirect(fbb, &kernelConfigs)),
+                fbb, &buffers, &cbs, programDescIt->second),
             op);
       } else if (auto createBufferOp =
                      dyn_cast_if_present<tt::ttmetal::CreateBufferOp>(op);
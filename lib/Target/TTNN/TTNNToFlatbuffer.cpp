@@ -18,10 +18,12 @@
 #include "ttmlir/Dialect/TTNN/Transforms/TTNNToCpp.h"
 #include "ttmlir/Dialect/TTNN/Types/Types.h"
 #include "ttmlir/Dialect/TTNN/Utils/Utils.h"
+#include "ttmlir/Target/Common/CopyTable.h"
 #include "ttmlir/Target/Common/Target.h"
 #include "ttmlir/Target/Common/types_generated.h"
 #include "ttmlir/Target/LLVM/LLVMToDynamicLib.h"
 #include "ttmlir/Target/TTNN/Target.h"
+#include "ttmlir/Target/TTNN/binary_bfbs_generated.h"
 #include "ttmlir/Target/TTNN/binary_generated.h"
 #include "ttmlir/Target/TTNN/operations/pool_generated.h"
 #include "ttmlir/Target/TTNN/program_generated.h"
@@ -36,16 +38,53 @@
 #include "mlir/Dialect/Func/IR/FuncOps.h"
 #include "mlir/Dialect/Quant/IR/Quant.h"
 #include "mlir/Dialect/Quant/IR/QuantTypes.h"
+#include "mlir/IR/Threading.h"
 #include "mlir/Support/LogicalResult.h"
+
+#include "flatbuffers/reflection.h"
 #include "llvm/ADT/SmallVector.h"
 #include "llvm/Support/Casting.h"
+#include "llvm/Support/CommandLine.h"
+#include "llvm/Support/Compression.h"
 #include "llvm/Support/ErrorHandling.h"
+#include "llvm/Support/MathExtras.h"
+#include "llvm/Support/Parallel.h"
 #include "llvm/Support/raw_ostream.h"
+#include "llvm/Support/xxhash.h"
 
 namespace mlir::tt::ttnn {
 
 constexpr uint64_t kHostAllocatedSize = 0;
 
+static llvm::cl::opt<bool>
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    compressConstants("ttnn-compress-constants",
+                      llvm::cl::desc("Store zstd compressed constant payloads "
+                                     "in TTNN binaries"),
+                      llvm::cl::init(false));
+
+static llvm::cl::opt<bool>
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    parallelSerialization(
+        "ttnn-parallel-serialization",
+        llvm::cl::desc("Serialize the programs of TTNN binaries concurrently"),
+        llvm::cl::init(false));
+
+static llvm::cl::opt<bool>
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    embedDebugInfo("ttnn-debug-info",
+                   llvm::cl::desc("Embed the module IR, pass snapshots, "
+                                  "goldens and generated C++ in TTNN binaries"),
+                   llvm::cl::init(true));
+
+static llvm::cl::opt<std::string>
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    splitDebugInfoPath(
+        "ttnn-split-debug-info",
+        llvm::cl::desc("Write the debug info of TTNN binaries to this file "
+                       "instead of embedding it"),
+        llvm::cl::init(""));
+
 #define GEN_PASS_DEF_TTNNSERIALIZETOBINARY
 #include "ttmlir/Dialect/TTNN/Transforms/Passes.h.inc"
 
@@ -456,7 +495,8 @@ createOp(FlatbufferObjectCache &cache, LinearOp op) {
   auto output = cache.getOrCreate(op.getResult(), tensorValueToFlatbuffer,
                                   kHostAllocatedSize);
   return ::tt::target::ttnn::CreateLinearOp(
-      *cache.fbb, a, b, bias, output, op.getTransposeA(), op.getTransposeB());
+      *cache.fbb, a, b, bias, output, op.getTransposeA(), op.getTransposeB(),
+      toFlatbuffer(cache, op.getActivationAttr()));
 }
 
 // ANCHOR: adding_an_op_matmul_serialize_to_binary
@@ -503,7 +543,8 @@ createOp(FlatbufferObjectCache &cache, MatmulOp op) {
 
   return ::tt::target::ttnn::CreateMatmulOp(
       *cache.fbb, a, b, output, op.getTransposeA(), op.getTransposeB(),
-      matmulProgramConfigType, matmulProgramConfigDesc);
+      matmulProgramConfigType, matmulProgramConfigDesc,
+      toFlatbuffer(cache, op.getActivationAttr()));
 }
 // ANCHOR_END: adding_an_op_matmul_serialize_to_binary
 
@@ -794,25 +835,106 @@ createOp(FlatbufferObjectCache &cache, FillCacheOp op) {
                                                op.getBatchOffset());
 }
 
-::flatbuffers::Offset<::tt::target::ttnn::ConstantOp>
-createOp(FlatbufferObjectCache &cache, ttnn::ConstantOp op) {
+::flatbuffers::Offset<::tt::target::ttnn::PagedUpdateCacheOp>
+createOp(FlatbufferObjectCache &cache, PagedUpdateCacheOp op) {
+  auto cacheOperand = cache.at<::tt::target::ttnn::TensorRef>(
+      getOperandThroughDPSOps(op.getCache()));
+  auto input = cache.at<::tt::target::ttnn::TensorRef>(
+      getOperandThroughDPSOps(op.getInput()));
+  auto updateIndex = cache.at<::tt::target::ttnn::TensorRef>(
+      getOperandThroughDPSOps(op.getUpdateIndex()));
+  auto pageTable = cache.at<::tt::target::ttnn::TensorRef>(
+      getOperandThroughDPSOps(op.getPageTable()));
+
+  return ::tt::target::ttnn::CreatePagedUpdateCacheOp(
+      *cache.fbb, cacheOperand, input, updateIndex, pageTable);
+}
+
+::flatbuffers::Offset<::tt::target::ttnn::PagedFillCacheOp>
+createOp(FlatbufferObjectCache &cache, PagedFillCacheOp op) {
+  auto cacheOperand = cache.at<::tt::target::ttnn::TensorRef>(
+      getOperandThroughDPSOps(op.getCache()));
+  auto input = cache.at<::tt::target::ttnn::TensorRef>(
+      getOperandThroughDPSOps(op.getInput()));
+  auto pageTable = cache.at<::tt::target::ttnn::TensorRef>(
+      getOperandThroughDPSOps(op.getPageTable()));
+  auto batchIdx = cache.at<::tt::target::ttnn::TensorRef>(
+      getOperandThroughDPSOps(op.getBatchIdx()));
+
+  return ::tt::target::ttnn::CreatePagedFillCacheOp(
+      *cache.fbb, cacheOperand, input, pageTable, batchIdx);
+}
+
+::flatbuffers::Offset<::tt::target::ttnn::PagedScaledDotProductAttentionDecodeOp>
+createOp(FlatbufferObjectCache &cache,
+         PagedScaledDotProductAttentionDecodeOp op) {
+  auto query = cache.at<::tt::target::ttnn::TensorRef>(
+      getOperandThroughDPSOps(op.getQuery()));
+  auto key = cache.at<::tt::target::ttnn::TensorRef>(
+      getOperandThroughDPSOps(op.getKey()));
+  auto value = cache.at<::tt::target::ttnn::TensorRef>(
+      getOperandThroughDPSOps(op.getValue()));
+  auto pageTable = cache.at<::tt::target::ttnn::TensorRef>(
+      getOperandThroughDPSOps(op.getPageTable()));
+  auto curPos = cache.at<::tt::target::ttnn::TensorRef>(
+      getOperandThroughDPSOps(op.getCurPos()));
+  auto output = cache.getOrCreate(op.getResult(), tensorValueToFlatbuffer,
+                                  kHostAllocatedSize);
+  ::flatbuffers::Optional<float> scale = ::flatbuffers::nullopt;
+  if (op.getScale()) {
+    scale = op.getScale()->convertToFloat();
+  }
+
+  return ::tt::target::ttnn::CreatePagedScaledDotProductAttentionDecodeOp(
+      *cache.fbb, query, key, value, pageTable, curPos, scale, output);
+}
+
+::flatbuffers::Offset<::tt::target::ttnn::ScaledDotProductAttentionOp>
+createOp(FlatbufferObjectCache &cache, ScaledDotProductAttentionOp op) {
+  auto query = cache.at<::tt::target::ttnn::TensorRef>(
+      getOperandThroughDPSOps(op.getQuery()));
+  auto key = cache.at<::tt::target::ttnn::TensorRef>(
+      getOperandThroughDPSOps(op.getKey()));
+  auto value = cache.at<::tt::target::ttnn::TensorRef>(
+      getOperandThroughDPSOps(op.getValue()));
+  auto attentionMask =
+      op.getAttentionMask()
+          ? cache.at<::tt::target::ttnn::TensorRef>(
+                getOperandThroughDPSOps(op.getAttentionMask()))
+          : flatbuffers::Offset<::tt::target::ttnn::TensorRef>();
   auto output = cache.getOrCreate(op.getResult(), tensorValueToFlatbuffer,
                                   kHostAllocatedSize);
-  std::vector<uint8_t> rawVector;
+  ::flatbuffers::Optional<float> scale = ::flatbuffers::nullopt;
+  if (op.getScale()) {
+    scale = op.getScale()->convertToFloat();
+  }
+
+  return ::tt::target::ttnn::CreateScaledDotProductAttentionOp(
+      *cache.fbb, query, key, value, attentionMask, op.getIsCausal(), scale,
+      output);
+}
+
+static ArrayRef<char> getConstantData(ttnn::ConstantOp op) {
   if (auto data =
           mlir::dyn_cast<mlir::DenseResourceElementsAttr>(op.getValue())) {
-    ArrayRef<char> rawData = data.getData();
-    rawVector = std::vector<uint8_t>(rawData.begin(), rawData.end());
-  } else if (auto data =
-                 mlir::dyn_cast<mlir::DenseElementsAttr>(op.getValue())) {
-    ArrayRef<char> rawData = data.getRawData();
-    rawVector = std::vector<uint8_t>(rawData.begin(), rawData.end());
-  } else {
-    llvm_unreachable("Unknown constant value attribute type");
+    return data.getData();
   }
+  if (auto data = mlir::dyn_cast<mlir::DenseElementsAttr>(op.getValue())) {
+    return data.getRawData();
+  }
+  llvm_unreachable("Unknown constant value attribute type");
+}
 
-  return ::tt::target::ttnn::CreateConstantOpDirect(*cache.fbb, output,
-                                                    &rawVector);
+::flatbuffers::Offset<::tt::target::ttnn::ConstantOp>
+createOp(FlatbufferObjectCache &cache, ttnn::ConstantOp op) {
+  auto output = cache.getOrCreate(op.getResult(), tensorValueToFlatbuffer,
+                                  kHostAllocatedSize);
+
+  // Payloads are stored once per binary in TTNNBinary.constants, see
+  // constantsToFlatbuffer.
+  uint32_t constantIndex = cache.constants->getOrInsert(getConstantData(op));
+  return ::tt::target::ttnn::CreateConstantOp(*cache.fbb, output,
+                                              /*data=*/0, constantIndex);
 }
 
 template <typename EltwiseBinaryOp>
@@ -1030,6 +1152,12 @@ createEltwiseUnaryOp(FlatbufferObjectCache &cache, EltwiseUnaryOp op) {
     type = ::tt::target::ttnn::EltwiseUnaryOpType::Floor;
   } else if constexpr (std::is_same_v<EltwiseUnaryOp, GeluOp>) {
     type = ::tt::target::ttnn::EltwiseUnaryOpType::Gelu;
+    paramsType = ::tt::target::ttnn::EltwiseUnaryOpParams::
+        EltwiseOpWithFastAndApproximateModeParams;
+    params =
+        ::tt::target::ttnn::CreateEltwiseOpWithFastAndApproximateModeParams(
+            *cache.fbb, op.getApproximate())
+            .Union();
   } else if constexpr (std::is_same_v<EltwiseUnaryOp, IsFiniteOp>) {
     type = ::tt::target::ttnn::EltwiseUnaryOpType::IsFinite;
   } else if constexpr (std::is_same_v<EltwiseUnaryOp, LogicalNotOp>) {
@@ -1072,6 +1200,10 @@ createEltwiseUnaryOp(FlatbufferObjectCache &cache, EltwiseUnaryOp op) {
                  .Union();
   } else if constexpr (std::is_same_v<EltwiseUnaryOp, BitwiseNotOp>) {
     type = ::tt::target::ttnn::EltwiseUnaryOpType::BitwiseNot;
+  } else if constexpr (std::is_same_v<EltwiseUnaryOp, SiluOp>) {
+    type = ::tt::target::ttnn::EltwiseUnaryOpType::Silu;
+  } else if constexpr (std::is_same_v<EltwiseUnaryOp, ErfOp>) {
+    type = ::tt::target::ttnn::EltwiseUnaryOpType::Erf;
   } else {
     llvm_unreachable("unhandled EltwiseUnaryOp");
   }
@@ -1390,6 +1522,45 @@ createSoftmaxOp(FlatbufferObjectCache &cache, SoftmaxOp op) {
   return ::tt::target::ttnn::CreateSoftmaxOp(*cache.fbb, in, out, dimension);
 }
 
+template <typename NormOp>
+static std::pair<::flatbuffers::Offset<::tt::target::ttnn::TensorRef>,
+                 ::flatbuffers::Offset<::tt::target::ttnn::TensorRef>>
+getNormAffineParams(FlatbufferObjectCache &cache, NormOp op) {
+  auto weight = op.getWeight()
+                    ? cache.at<::tt::target::ttnn::TensorRef>(
+                          getOperandThroughDPSOps(op.getWeight()))
+                    : flatbuffers::Offset<::tt::target::ttnn::TensorRef>();
+  auto bias = op.getBias()
+                  ? cache.at<::tt::target::ttnn::TensorRef>(
+                        getOperandThroughDPSOps(op.getBias()))
+                  : flatbuffers::Offset<::tt::target::ttnn::TensorRef>();
+  return {weight, bias};
+}
+
+::flatbuffers::Offset<::tt::target::ttnn::RMSNormOp>
+createOp(FlatbufferObjectCache &cache, RMSNormOp op) {
+  auto in = cache.at<::tt::target::ttnn::TensorRef>(
+      getOperandThroughDPSOps(op.getInput()));
+  auto [weight, bias] = getNormAffineParams(cache, op);
+  auto out = cache.getOrCreate(op.getResult(), tensorValueToFlatbuffer,
+                               kHostAllocatedSize);
+
+  return ::tt::target::ttnn::CreateRMSNormOp(
+      *cache.fbb, in, weight, bias, op.getEpsilon().convertToFloat(), out);
+}
+
+::flatbuffers::Offset<::tt::target::ttnn::LayerNormOp>
+createOp(FlatbufferObjectCache &cache, LayerNormOp op) {
+  auto in = cache.at<::tt::target::ttnn::TensorRef>(
+      getOperandThroughDPSOps(op.getInput()));
+  auto [weight, bias] = getNormAffineParams(cache, op);
+  auto out = cache.getOrCreate(op.getResult(), tensorValueToFlatbuffer,
+                               kHostAllocatedSize);
+
+  return ::tt::target::ttnn::CreateLayerNormOp(
+      *cache.fbb, in, weight, bias, op.getEpsilon().convertToFloat(), out);
+}
+
 ::flatbuffers::Offset<::tt::target::ttnn::DeallocateOp>
 createDeallocateOp(FlatbufferObjectCache &cache, DeallocateOp op) {
   auto in = cache.at<::tt::target::ttnn::TensorRef>(
@@ -1423,6 +1594,34 @@ createOp(FlatbufferObjectCache &cache, tt::LoadCachedOp op,
   return ::tt::target::ttnn::CreateLoadCachedOpDirect(
       *cache.fbb, &ins, op.getCallee().str().c_str(), programIdx, &outputs);
 }
+
+::flatbuffers::Offset<::tt::target::ttnn::WhileOp>
+createOp(FlatbufferObjectCache &cache, tt::WhileOp op,
+         const llvm::StringMap<uint32_t> &programIndexMap) {
+  std::vector<::flatbuffers::Offset<::tt::target::ttnn::TensorRef>> ins;
+  for (auto input : op.getInputs()) {
+    ins.push_back(cache.at<::tt::target::ttnn::TensorRef>(
+        getOperandThroughDPSOps(input)));
+  }
+
+  std::vector<::flatbuffers::Offset<::tt::target::ttnn::TensorRef>> outputs;
+  for (auto result : op.getResults()) {
+    outputs.push_back(
+        cache.getOrCreate(result, tensorValueToFlatbuffer, kHostAllocatedSize));
+  }
+
+  auto lookupProgramIdx = [&](StringRef name) {
+    auto it = programIndexMap.find(name);
+    assert(it != programIndexMap.end() &&
+           "Program name not found in program index map!");
+    return it->second;
+  };
+
+  return ::tt::target::ttnn::CreateWhileOpDirect(
+      *cache.fbb, &ins, op.getCond().str().c_str(),
+      lookupProgramIdx(op.getCond()), op.getBody().str().c_str(),
+      lookupProgramIdx(op.getBody()), &outputs);
+}
 ::flatbuffers::Offset<::tt::target::ttnn::Operation>
 emitTTNNOperation(FlatbufferObjectCache &cache, Operation *op,
                   const llvm::StringMap<uint32_t> &programIndexMap,
@@ -1671,6 +1870,14 @@ emitTTNNOperation(FlatbufferObjectCache &cache, Operation *op,
     return createOperation(cache, createEltwiseUnaryOp(cache, geluOp),
                            debugString, locInfo);
   }
+  if (auto siluOp = dyn_cast<SiluOp>(op); siluOp) {
+    return createOperation(cache, createEltwiseUnaryOp(cache, siluOp),
+                           debugString, locInfo);
+  }
+  if (auto erfOp = dyn_cast<ErfOp>(op); erfOp) {
+    return createOperation(cache, createEltwiseUnaryOp(cache, erfOp),
+                           debugString, locInfo);
+  }
   if (auto tanOp = dyn_cast<TanOp>(op); tanOp) {
     return createOperation(cache, createEltwiseUnaryOp(cache, tanOp),
                            debugString, locInfo);
@@ -1757,6 +1964,14 @@ emitTTNNOperation(FlatbufferObjectCache &cache, Operation *op,
     return createOperation(cache, createSoftmaxOp(cache, softmaxOp),
                            debugString, locInfo);
   }
+  if (auto rmsNormOp = dyn_cast<RMSNormOp>(op); rmsNormOp) {
+    return createOperation(cache, createOp(cache, rmsNormOp), debugString,
+                           locInfo);
+  }
+  if (auto layerNormOp = dyn_cast<LayerNormOp>(op); layerNormOp) {
+    return createOperation(cache, createOp(cache, layerNormOp), debugString,
+                           locInfo);
+  }
   if (auto transposeOp = dyn_cast<TransposeOp>(op); transposeOp) {
     return createOperation(cache, createTransposeOp(cache, transposeOp),
                            debugString, locInfo);
@@ -1832,6 +2047,26 @@ emitTTNNOperation(FlatbufferObjectCache &cache, Operation *op,
     return createOperation(cache, createOp(cache, fillCacheOp), debugString,
                            locInfo);
   }
+  if (auto pagedUpdateCacheOp = dyn_cast<PagedUpdateCacheOp>(op);
+      pagedUpdateCacheOp) {
+    return createOperation(cache, createOp(cache, pagedUpdateCacheOp),
+                           debugString, locInfo);
+  }
+  if (auto pagedFillCacheOp = dyn_cast<PagedFillCacheOp>(op);
+      pagedFillCacheOp) {
+    return createOperation(cache, createOp(cache, pagedFillCacheOp),
+                           debugString, locInfo);
+  }
+  if (auto pagedSdpaDecodeOp =
+          dyn_cast<PagedScaledDotProductAttentionDecodeOp>(op);
+      pagedSdpaDecodeOp) {
+    return createOperation(cache, createOp(cache, pagedSdpaDecodeOp),
+                           debugString, locInfo);
+  }
+  if (auto sdpaOp = dyn_cast<ScaledDotProductAttentionOp>(op); sdpaOp) {
+    return createOperation(cache, createOp(cache, sdpaOp), debugString,
+                           locInfo);
+  }
   if (auto permuteOp = dyn_cast<PermuteOp>(op); permuteOp) {
     return createOperation(cache, createOp(cache, permuteOp), debugString,
                            locInfo);
@@ -1856,10 +2091,222 @@ emitTTNNOperation(FlatbufferObjectCache &cache, Operation *op,
                            createOp(cache, loadCachedOp, programIndexMap),
                            debugString, locInfo);
   }
+  if (auto whileOp = dyn_cast<tt::WhileOp>(op); whileOp) {
+    return createOperation(cache, createOp(cache, whileOp, programIndexMap),
+                           debugString, locInfo);
+  }
 
   llvm_unreachable("unhandled op in emitTTNNOperation");
 }
 
+// Returns the shape bucket of a func specialized for one, or a null offset.
+static ::flatbuffers::Offset<::tt::target::ttnn::ShapeBucket>
+shapeBucketToFlatbuffer(::flatbuffers::FlatBufferBuilder &fbb,
+                        func::FuncOp func) {
+  DictionaryAttr shapeBucket = ttmlir::utils::getShapeBucket(func);
+  if (!shapeBucket) {
+    return 0;
+  }
+
+  auto createBucketedDims = [&](DictionaryAttr attrs) {
+    std::vector<uint32_t> dims;
+    if (!attrs) {
+      return ::tt::target::ttnn::CreateBucketedDimsDirect(fbb, &dims);
+    }
+    if (auto dimsAttr = attrs.getAs<DenseI64ArrayAttr>(
+            ttmlir::utils::g_bucketedDimsAttrName)) {
+      dims.assign(dimsAttr.asArrayRef().begin(), dimsAttr.asArrayRef().end());
+    }
+    return ::tt::target::ttnn::CreateBucketedDimsDirect(fbb, &dims);
+  };
+
+  std::vector<::flatbuffers::Offset<::tt::target::ttnn::BucketedDims>> inputs;
+  for (unsigned i = 0; i < func.getNumArguments(); ++i) {
+    inputs.push_back(createBucketedDims(func.getArgAttrDict(i)));
+  }
+  std::vector<::flatbuffers::Offset<::tt::target::ttnn::BucketedDims>> outputs;
+  for (unsigned i = 0; i < func.getNumResults(); ++i) {
+    outputs.push_back(createBucketedDims(func.getResultAttrDict(i)));
+  }
+
+  std::string name = shapeBucket.getAs<StringAttr>("name").str();
+  uint64_t size = shapeBucket.getAs<IntegerAttr>("size").getInt();
+  return ::tt::target::ttnn::CreateShapeBucketDirect(fbb, name.c_str(), size,
+                                                     &inputs, &outputs);
+}
+
+// Size of the independently compressed chunks of a constant payload, chunks
+// are decompressed in parallel by the runtime.
+static constexpr size_t kConstantChunkSize = 1 << 20;
+
+static ArrayRef<uint8_t> getConstantChunk(ArrayRef<uint8_t> bytes,
+                                          size_t chunk) {
+  size_t offset = chunk * kConstantChunkSize;
+  return bytes.slice(offset,
+                     std::min(kConstantChunkSize, bytes.size() - offset));
+}
+
+static ::flatbuffers::Offset<::tt::target::ttnn::ConstantBuffer>
+createConstantBuffer(::flatbuffers::FlatBufferBuilder &fbb,
+                     ArrayRef<uint8_t> bytes,
+                     ArrayRef<SmallVector<uint8_t>> compressedChunks) {
+  size_t compressedSize = 0;
+  for (const SmallVector<uint8_t> &chunk : compressedChunks) {
+    compressedSize += chunk.size();
+  }
+
+  // Payloads that don't shrink, e.g. random weights, are kept uncompressed so
+  // that the runtime can read them in place.
+  if (compressedChunks.empty() || compressedSize >= bytes.size()) {
+    std::vector<::flatbuffers::Offset<::tt::target::ttnn::ConstantChunk>>
+        chunks = {::tt::target::ttnn::CreateConstantChunk(
+            fbb, fbb.CreateVector(bytes.data(), bytes.size()))};
+    return ::tt::target::ttnn::CreateConstantBufferDirect(
+        fbb, bytes.size(),
+        ::tt::target::ttnn::ConstantCompression::Uncompressed, bytes.size(),
+        &chunks);
+  }
+
+  std::vector<::flatbuffers::Offset<::tt::target::ttnn::ConstantChunk>> chunks;
+  chunks.reserve(compressedChunks.size());
+  for (const SmallVector<uint8_t> &chunk : compressedChunks) {
+    chunks.push_back(::tt::target::ttnn::CreateConstantChunk(
+        fbb, fbb.CreateVector(chunk.data(), chunk.size())));
+  }
+  return ::tt::target::ttnn::CreateConstantBufferDirect(
+      fbb, bytes.size(), ::tt::target::ttnn::ConstantCompression::Zstd,
+      kConstantChunkSize, &chunks);
+}
+
+static std::vector<::flatbuffers::Offset<::tt::target::ttnn::ConstantBuffer>>
+constantsToFlatbuffer(FlatbufferObjectCache &cache, ModuleOp module) {
+  bool compress = compressConstants;
+  if (compress && !llvm::compression::zstd::isAvailable()) {
+    module->emitWarning() << "ttnn-compress-constants requires LLVM built with "
+                             "zstd, storing constants uncompressed";
+    compress = false;
+  }
+
+  SmallVector<ArrayRef<uint8_t>> payloads;
+  for (ArrayRef<char> data : cache.constants->payloads) {
+    payloads.emplace_back(reinterpret_cast<const uint8_t *>(data.data()),
+                          data.size());
+  }
+
+  // Compress the chunks of all payloads at once, so that binaries with many
+  // small weights are compressed in parallel as well.
+  std::vector<std::vector<SmallVector<uint8_t>>> compressedChunks(
+      payloads.size());
+  if (compress) {
+    SmallVector<std::pair<size_t, size_t>> chunkIds;
+    for (auto [i, bytes] : llvm::enumerate(payloads)) {
+      compressedChunks[i].resize(
+          llvm::divideCeil(bytes.size(), kConstantChunkSize));
+      for (size_t chunk = 0; chunk < compressedChunks[i].size(); ++chunk) {
+        chunkIds.emplace_back(i, chunk);
+      }
+    }
+    llvm::parallelFor(0, chunkIds.size(), [&](size_t id) {
+      auto [i, chunk] = chunkIds[id];
+      llvm::compression::zstd::compress(getConstantChunk(payloads[i], chunk),
+                                        compressedChunks[i][chunk]);
+    });
+  }
+
+  std::vector<::flatbuffers::Offset<::tt::target::ttnn::ConstantBuffer>>
+      constants;
+  constants.reserve(payloads.size());
+  for (auto [bytes, chunks] : llvm::zip_equal(payloads, compressedChunks)) {
+    constants.push_back(createConstantBuffer(*cache.fbb, bytes, chunks));
+  }
+  return constants;
+}
+
+static ::flatbuffers::Offset<::tt::target::ttnn::Program>
+programToFlatbuffer(
+    FlatbufferObjectCache &cache, func::FuncOp func,
+    const llvm::StringMap<uint32_t> &programIdxMap,
+    const std::vector<::flatbuffers::Offset<::tt::target::DynamicLib>> *dylibs,
+    ::flatbuffers::Offset<::tt::target::DebugInfo> debugInfo) {
+  Program<::tt::target::ttnn::Operation> program =
+      funcOpToProgram<::tt::target::ttnn::Operation>(
+          cache, func, emitTTNNOperation, tensorValueToFlatbuffer,
+          programIdxMap);
+  ::flatbuffers::Offset<::tt::target::ttnn::ShapeBucket> shapeBucket;
+  if (!ttmlir::utils::isSubProgramFunc(func)) {
+    shapeBucket = shapeBucketToFlatbuffer(*cache.fbb, func);
+  }
+  return ::tt::target::ttnn::CreateProgramDirect(
+      *cache.fbb, program.name, &program.inputs, &program.outputs,
+      &program.ops, dylibs, debugInfo, shapeBucket);
+}
+
+using ::tt::target::copyTable;
+using ::tt::target::copyTables;
+
+// Copies a program serialized on its own into `fbb`. Dylibs and debug info
+// are shared by all programs, so they are attached here rather than copied.
+static ::flatbuffers::Offset<::tt::target::ttnn::Program> copyProgram(
+    ::flatbuffers::FlatBufferBuilder &fbb,
+    const ::tt::target::ttnn::Program &program,
+    const std::vector<::flatbuffers::Offset<::tt::target::DynamicLib>> *dylibs,
+    ::flatbuffers::Offset<::tt::target::DebugInfo> debugInfo) {
+  const reflection::Schema &schema = *reflection::GetSchema(
+      ::tt::target::ttnn::TTNNBinaryBinarySchema::data());
+  auto inputs =
+      copyTables(fbb, schema, "tt.target.ttnn.TensorRef", program.inputs());
+  auto outputs =
+      copyTables(fbb, schema, "tt.target.ttnn.TensorRef", program.outputs());
+  auto ops =
+      copyTables(fbb, schema, "tt.target.ttnn.Operation", program.operations());
+  auto shapeBucket = copyTable(fbb, schema, "tt.target.ttnn.ShapeBucket",
+                               program.shape_bucket());
+  return ::tt::target::ttnn::CreateProgramDirect(
+      fbb, program.name()->c_str(), &inputs, &outputs, &ops, dylibs, debugInfo,
+      shapeBucket);
+}
+
+// Writes the debug info to `splitDebugInfoPath` and returns the reference
+// the binary keeps to it.
+static ::flatbuffers::Offset<::tt::target::ttnn::DebugInfoRef>
+splitDebugInfoToFile(
+    ::flatbuffers::FlatBufferBuilder &fbb, ModuleOp module,
+    const std::string &source,
+    const std::unordered_map<std::string, GoldenTensor> &goldenMap,
+    const std::vector<std::pair<std::string, std::string>> &moduleCache,
+    const std::string &cpp) {
+  ::flatbuffers::FlatBufferBuilder debugInfoFbb;
+  auto debugInfo = debugInfoToFlatbuffer(debugInfoFbb, "ttnn", source,
+                                         goldenMap, moduleCache, cpp.c_str());
+  uint64_t hash = llvm::xxh3_64bits(ArrayRef<uint8_t>(
+      debugInfoFbb.GetCurrentBufferPointer(), debugInfoFbb.GetSize()));
+  ::tt::target::ttnn::FinishSizePrefixedTTNNDebugInfoBuffer(
+      debugInfoFbb,
+      ::tt::target::ttnn::CreateTTNNDebugInfo(debugInfoFbb, hash, debugInfo));
+
+  std::error_code error;
+  llvm::raw_fd_ostream file(splitDebugInfoPath.getValue(), error);
+  if (error) {
+    module->emitWarning() << "failed to write debug info to "
+                          << splitDebugInfoPath.getValue() << ": "
+                          << error.message();
+    return 0;
+  }
+  file.write(reinterpret_cast<const char *>(debugInfoFbb.GetBufferPointer()),
+             debugInfoFbb.GetSize());
+  file.close();
+  if (file.has_error()) {
+    module->emitWarning() << "failed to write debug info to "
+                          << splitDebugInfoPath.getValue() << ": "
+                          << file.error().message();
+    file.clear_error();
+    return 0;
+  }
+
+  return ::tt::target::ttnn::CreateDebugInfoRefDirect(
+      fbb, hash, splitDebugInfoPath.c_str());
+}
+
 std::shared_ptr<void> ttnnToFlatbuffer(
     Operation *op,
     const std::unordered_map<std::string, GoldenTensor> &goldenMap,
@@ -1889,14 +2336,30 @@ std::shared_ptr<void> ttnnToFlatbuffer(
       toFlatbuffer(cache, mlir::cast<tt::SystemDescAttr>(
                               module->getAttr(tt::SystemDescAttr::name)));
 
-  std::string cpp;
-  llvm::raw_string_ostream os(cpp);
-  auto result = mlir::tt::ttnn::emitTTNNAsCpp(module, os);
-  (void)result;
+  // Original funcs come first to preserve input order, const-eval and loop
+  // region funcs follow.
+  SmallVector<func::FuncOp> funcs;
+  module->walk([&](func::FuncOp func) {
+    if (!ttmlir::utils::isSubProgramFunc(func)) {
+      funcs.push_back(func);
+    }
+  });
+  module->walk([&](func::FuncOp func) {
+    if (ttmlir::utils::isSubProgramFunc(func)) {
+      funcs.push_back(func);
+    }
+  });
+  llvm::StringMap<uint32_t> programIdxMap;
+  for (auto [programIdx, func] : llvm::enumerate(funcs)) {
+    programIdxMap[func.getSymName()] = programIdx;
+  }
 
-  flatbuffers::Offset<::tt::target::DebugInfo> debugInfo =
-      debugInfoToFlatbuffer(fbb, "ttnn", rootModule, goldenMap, moduleCache,
-                            cpp.c_str());
+  std::string cpp;
+  if (embedDebugInfo) {
+    llvm::raw_string_ostream os(cpp);
+    auto result = mlir::tt::ttnn::emitTTNNAsCpp(module, os);
+    (void)result;
+  }
 
   // Handle dylib creation and packaging, if needed.
   // Currently, we only have 1 CPUModuleOp and 1 top-level ModuleOp; we use a
@@ -1920,54 +2383,68 @@ std::shared_ptr<void> ttnnToFlatbuffer(
     }
   }
 
-  size_t programIdx = 0;
-  llvm::StringMap<uint32_t> programIdxMap;
-  // Preserve original ordering by skipping const-eval in the first pass.
-  module->walk([&](func::FuncOp func) {
-    if (ttmlir::utils::isConstEvalFunc(func)) {
-      return;
+  // In parallel mode every program is serialized into its own builder and
+  // copied into `fbb` afterwards, the debug info module is printed alongside.
+  std::vector<::flatbuffers::FlatBufferBuilder> programBuilders;
+  std::string debugInfoSource;
+  if (parallelSerialization) {
+    // Assign constant indices in program order, so that binaries don't depend
+    // on the order workers reach the constants in.
+    for (func::FuncOp func : funcs) {
+      func.walk([&](ttnn::ConstantOp constantOp) {
+        cache.constants->getOrInsert(getConstantData(constantOp));
+      });
     }
-    programIdxMap[func.getSymName().str()] = programIdx++;
-  });
 
-  // Add const-eval funcs after normal funcs.
-  module->walk([&](func::FuncOp func) {
-    if (!ttmlir::utils::isConstEvalFunc(func)) {
-      return;
-    }
-    programIdxMap[func.getSymName().str()] = programIdx++;
-  });
+    programBuilders.resize(funcs.size());
+    mlir::parallelFor(
+        rootModule.getContext(), 0, funcs.size() + 1, [&](size_t i) {
+          if (i == funcs.size()) {
+            if (embedDebugInfo) {
+              debugInfoSource = getDebugInfoSource(rootModule);
+            }
+            return;
+          }
+          FlatbufferObjectCache programCache(&programBuilders[i]);
+          programCache.constants = cache.constants;
+          programBuilders[i].Finish(programToFlatbuffer(
+              programCache, funcs[i], programIdxMap, /*dylibs=*/nullptr,
+              /*debugInfo=*/0));
+        });
+  } else if (embedDebugInfo) {
+    debugInfoSource = getDebugInfoSource(rootModule);
+  }
+
+  flatbuffers::Offset<::tt::target::DebugInfo> debugInfo = 0;
+  flatbuffers::Offset<::tt::target::ttnn::DebugInfoRef> debugInfoRef = 0;
+  if (embedDebugInfo && !splitDebugInfoPath.empty()) {
+    debugInfoRef = splitDebugInfoToFile(fbb, rootModule, debugInfoSource,
+                                        goldenMap, moduleCache, cpp);
+  } else if (embedDebugInfo) {
+    debugInfo = debugInfoToFlatbuffer(fbb, "ttnn", debugInfoSource, goldenMap,
+                                      moduleCache, cpp.c_str());
+  }
 
   std::vector<::flatbuffers::Offset<::tt::target::ttnn::Program>> programs;
-  // Again, process original funcs in order first to perserve input order.
-  module->walk([&](func::FuncOp func) {
-    if (ttmlir::utils::isConstEvalFunc(func)) {
-      return;
+  for (auto [programIdx, func] : llvm::enumerate(funcs)) {
+    if (parallelSerialization) {
+      programs.push_back(copyProgram(
+          fbb,
+          *::flatbuffers::GetRoot<::tt::target::ttnn::Program>(
+              programBuilders[programIdx].GetBufferPointer()),
+          &dylibs, debugInfo));
+    } else {
+      programs.push_back(programToFlatbuffer(cache, func, programIdxMap,
+                                             &dylibs, debugInfo));
     }
-    Program<::tt::target::ttnn::Operation> program =
-        funcOpToProgram<::tt::target::ttnn::Operation>(
-            cache, func, emitTTNNOperation, tensorValueToFlatbuffer,
-            programIdxMap);
-    programs.push_back(::tt::target::ttnn::CreateProgramDirect(
-        fbb, program.name, &program.inputs, &program.outputs, &program.ops,
-        &dylibs, debugInfo));
-  });
-  // Then process const-eval funcs in 2nd pass.
-  module->walk([&](func::FuncOp func) {
-    if (!ttmlir::utils::isConstEvalFunc(func)) {
-      return;
-    }
-    Program<::tt::target::ttnn::Operation> program =
-        funcOpToProgram<::tt::target::ttnn::Operation>(
-            cache, func, emitTTNNOperation, tensorValueToFlatbuffer,
-            programIdxMap);
-    programs.push_back(::tt::target::ttnn::CreateProgramDirect(
-        fbb, program.name, &program.inputs, &program.outputs, &program.ops,
-        &dylibs, debugInfo));
-  });
+  }
+
+  std::vector<::flatbuffers::Offset<::tt::target::ttnn::ConstantBuffer>>
+      constants = constantsToFlatbuffer(cache, rootModule);
 
   auto binary = ::tt::target::ttnn::CreateTTNNBinaryDirect(
-      fbb, &binaryVersion, ::ttmlir::getGitHash(), systemDesc, &programs);
+      fbb, &binaryVersion, ::ttmlir::getGitHash(), systemDesc, &programs,
+      &constants, debugInfoRef);
 
   ::tt::target::ttnn::FinishSizePrefixedTTNNBinaryBuffer(fbb, binary);
   ::flatbuffers::Verifier verifier(fbb.GetBufferPointer(), fbb.GetSize());
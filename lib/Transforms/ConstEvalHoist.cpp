@@ -17,6 +17,7 @@
 #include "llvm/ADT/SmallSet.h"
 #include "llvm/ADT/SmallString.h"
 #include "llvm/ADT/SmallVector.h"
+#include "llvm/ADT/StringMap.h"
 
 namespace mlir::tt::transforms {
 
@@ -418,8 +419,10 @@ static void undoConstEvalImpl(mlir::ModuleOp module,
                               mlir::MLIRContext *context) {
   OpBuilder builder(context);
 
-  // Find all const-eval functions and their callers
-  llvm::DenseMap<mlir::func::FuncOp, mlir::tt::LoadCachedOp> funcToCall;
+  // Find all const-eval functions and their callers. Const-eval functions
+  // shared between shape buckets have more than one caller.
+  llvm::DenseMap<mlir::func::FuncOp, llvm::SmallVector<mlir::tt::LoadCachedOp>>
+      funcToCalls;
   llvm::SmallVector<mlir::func::FuncOp, 4> constEvalFuncs;
   llvm::SmallVector<mlir::func::FuncOp, 4> parentFuncs;
 
@@ -435,24 +438,24 @@ static void undoConstEvalImpl(mlir::ModuleOp module,
     mlir::StringRef calleeName = loadOp.getCallee();
     auto funcOp = module.lookupSymbol<mlir::func::FuncOp>(calleeName);
     assert(funcOp && ttmlir::utils::isConstEvalFunc(funcOp));
-    auto [_, inserted] = funcToCall.insert({funcOp, loadOp});
-    assert(inserted && "Found const-eval func used more than once!");
+    funcToCalls[funcOp].push_back(loadOp);
   });
 
   // Inline each const-eval function
   for (auto funcOp : constEvalFuncs) {
-    auto callIt = funcToCall.find(funcOp);
-    assert(callIt != funcToCall.end() &&
+    auto callIt = funcToCalls.find(funcOp);
+    assert(callIt != funcToCalls.end() &&
            "Found const-eval func that was never called!");
-    mlir::tt::LoadCachedOp &callOp = callIt->second;
-    // Get the parent function of this call
-    mlir::func::FuncOp parentFunc =
-        callOp->getParentOfType<mlir::func::FuncOp>();
-    if (parentFunc) {
-      parentFuncs.emplace_back(parentFunc);
-    }
+    for (mlir::tt::LoadCachedOp callOp : callIt->second) {
+      // Get the parent function of this call
+      mlir::func::FuncOp parentFunc =
+          callOp->getParentOfType<mlir::func::FuncOp>();
+      if (parentFunc) {
+        parentFuncs.emplace_back(parentFunc);
+      }
 
-    inlineConstEvalFunction(funcOp, callOp, builder);
+      inlineConstEvalFunction(funcOp, callOp, builder);
+    }
   }
 
   // Deduplicate shared ops in each function where we performed inlining
@@ -482,6 +485,48 @@ public:
 };
 } // namespace
 
+// Funcs specialized for different shape buckets of the same function usually
+// hoist identical const-eval subgraphs, e.g. the preparation of their weights.
+// Such subgraphs are merged into a single const-eval func, so the binary holds
+// one program for them and the runtime can share its cached results between
+// the buckets.
+static void deduplicateShapeBucketConstEvalFuncs(mlir::ModuleOp module) {
+  llvm::StringMap<llvm::SmallVector<mlir::func::FuncOp>> bucketConstEvalFuncs;
+  module.walk([&](mlir::tt::LoadCachedOp loadOp) {
+    mlir::DictionaryAttr shapeBucket = ttmlir::utils::getShapeBucket(
+        loadOp->getParentOfType<mlir::func::FuncOp>());
+    if (!shapeBucket) {
+      return;
+    }
+    auto bucketName = shapeBucket.getAs<mlir::StringAttr>("name");
+    assert(bucketName && "Shape bucket must have a name!");
+    bucketConstEvalFuncs[bucketName.getValue()].push_back(
+        module.lookupSymbol<mlir::func::FuncOp>(loadOp.getCallee()));
+  });
+
+  for (auto &entry : bucketConstEvalFuncs) {
+    llvm::SmallVector<mlir::func::FuncOp> uniqueFuncs;
+    for (mlir::func::FuncOp funcOp : entry.getValue()) {
+      auto *it = llvm::find_if(uniqueFuncs, [&](mlir::func::FuncOp other) {
+        return funcOp.getFunctionType() == other.getFunctionType() &&
+               OperationEquivalence::isRegionEquivalentTo(
+                   &funcOp.getBody(), &other.getBody(),
+                   OperationEquivalence::IgnoreLocations);
+      });
+      if (it == uniqueFuncs.end()) {
+        uniqueFuncs.push_back(funcOp);
+        continue;
+      }
+
+      if (failed(SymbolTable::replaceAllSymbolUses(
+              funcOp, it->getSymNameAttr(), module))) {
+        continue;
+      }
+      funcOp.erase();
+    }
+  }
+}
+
 namespace {
 // Transform pass to hoist const-eval subgraphs into separate funcs, invoked
 // w/ tt.load_cached ops.
@@ -511,6 +556,8 @@ public:
 
     // Collect functions that need processing
     module.walk([&](func::FuncOp funcOp) { processFunction(funcOp); });
+
+    deduplicateShapeBucketConstEvalFuncs(module);
   }
 
 private:
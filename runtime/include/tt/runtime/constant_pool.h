@@ -0,0 +1,49 @@
+// SPDX-FileCopyrightText: (c) 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef TT_RUNTIME_CONSTANT_POOL_H
+#define TT_RUNTIME_CONSTANT_POOL_H
+
+#include <cstdint>
+#include <mutex>
+#include <span>
+#include <vector>
+
+namespace tt::target::ttnn {
+struct TTNNBinary;
+} // namespace tt::target::ttnn
+
+namespace tt::runtime {
+
+/**
+ * Constant payloads of a TTNN binary.
+ *
+ * The compiler stores every distinct constant payload once in
+ * TTNNBinary.constants and constant ops refer to it by index. Payloads may be
+ * zstd compressed in independent chunks. The first lookup decompresses all
+ * compressed payloads of the binary, with the chunks spread across host
+ * threads, and keeps them for the lifetime of the binary. Uncompressed
+ * payloads are read in place.
+ */
+class ConstantPool {
+public:
+  ConstantPool() = default;
+
+  ConstantPool(const ConstantPool &) = delete;
+  ConstantPool &operator=(const ConstantPool &) = delete;
+
+  std::span<const std::uint8_t>
+  getData(const ::tt::target::ttnn::TTNNBinary &binary, std::uint32_t index);
+
+private:
+  void decompress(const ::tt::target::ttnn::TTNNBinary &binary);
+
+  std::once_flag decompressed;
+  // Indexed like TTNNBinary.constants, empty for uncompressed payloads.
+  std::vector<std::vector<std::uint8_t>> buffers;
+};
+
+} // namespace tt::runtime
+
+#endif // TT_RUNTIME_CONSTANT_POOL_H
@@ -0,0 +1,100 @@
+// SPDX-FileCopyrightText: (c) 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef TT_RUNTIME_DETAIL_HOST_CONVERSION_H
+#define TT_RUNTIME_DETAIL_HOST_CONVERSION_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Host-side layout and data format conversions. All conversions write into
+// caller provided buffers and split large inputs across host threads.
+namespace tt::runtime::host_conversion {
+
+inline constexpr std::uint32_t tileHeight = 32;
+inline constexpr std::uint32_t tileWidth = 32;
+inline constexpr std::uint32_t faceHeight = 16;
+inline constexpr std::uint32_t faceWidth = 16;
+inline constexpr std::uint32_t tileVolume = tileHeight * tileWidth;
+
+struct ConversionOptions {
+  // Number of worker threads, 0 means std::thread::hardware_concurrency().
+  std::uint32_t numThreads = 0;
+  // Conversions touching fewer bytes than this per thread are not split any
+  // further.
+  std::size_t minBytesPerThread = 1 << 20;
+};
+
+// Tensor viewed as a batch of row-major 2D matrices (the two innermost dims).
+struct MatrixShape {
+  std::uint64_t batch = 1;
+  std::uint32_t rows = 1;
+  std::uint32_t cols = 1;
+
+  static MatrixShape fromTensorShape(const std::vector<std::uint32_t> &shape);
+
+  std::uint32_t paddedRows() const {
+    return (rows + tileHeight - 1) / tileHeight * tileHeight;
+  }
+  std::uint32_t paddedCols() const {
+    return (cols + tileWidth - 1) / tileWidth * tileWidth;
+  }
+  std::uint64_t numTiles() const {
+    return batch * (paddedRows() / tileHeight) * (paddedCols() / tileWidth);
+  }
+};
+
+// Convert row-major data of `shape` into 32x32 tiles made of four row-major
+// 16x16 faces. `dst` must hold shape.numTiles() * tileVolume elements; tile
+// padding is zero filled.
+void tilize(const void *src, void *dst, std::uint32_t elementSize,
+            const MatrixShape &shape, const ConversionOptions &options = {});
+
+// Inverse of tilize, tile padding is dropped. `dst` must hold
+// shape.batch * shape.rows * shape.cols elements.
+void untilize(const void *src, void *dst, std::uint32_t elementSize,
+              const MatrixShape &shape, const ConversionOptions &options = {});
+
+// fp32 -> bf16 with round to nearest even, NaNs are kept as quiet NaNs.
+void float32ToBFloat16(const float *src, std::uint16_t *dst,
+                       std::size_t numElements,
+                       const ConversionOptions &options = {});
+
+void bfloat16ToFloat32(const std::uint16_t *src, float *dst,
+                       std::size_t numElements,
+                       const ConversionOptions &options = {});
+
+// Block float formats with an 8 bit exponent shared by each 16 element face
+// row. A tile stores its 64 shared exponents first, followed by sign-magnitude
+// mantissas in face order (one byte per element for BFP8, one nibble per
+// element for BFP4, low nibble first).
+enum class BlockFloatFormat { BFP8, BFP4 };
+
+std::size_t getBlockFloatTileSizeBytes(BlockFloatFormat format);
+
+// Pack tiled fp32 data (numTiles * tileVolume elements) into block float
+// tiles. `dst` must hold numTiles * getBlockFloatTileSizeBytes(format) bytes.
+void packBlockFloatTiles(const float *src, std::uint8_t *dst,
+                         std::uint64_t numTiles, BlockFloatFormat format,
+                         const ConversionOptions &options = {});
+
+// Same as above for tiled bf16 data.
+void packBlockFloatTiles(const std::uint16_t *src, std::uint8_t *dst,
+                         std::uint64_t numTiles, BlockFloatFormat format,
+                         const ConversionOptions &options = {});
+
+// Unpack block float tiles into tiled fp32 data.
+void unpackBlockFloatTiles(const std::uint8_t *src, float *dst,
+                           std::uint64_t numTiles, BlockFloatFormat format,
+                           const ConversionOptions &options = {});
+
+// Unpack block float tiles into tiled bf16 data.
+void unpackBlockFloatTiles(const std::uint8_t *src, std::uint16_t *dst,
+                           std::uint64_t numTiles, BlockFloatFormat format,
+                           const ConversionOptions &options = {});
+
+} // namespace tt::runtime::host_conversion
+
+#endif // TT_RUNTIME_DETAIL_HOST_CONVERSION_H
@@ -0,0 +1,70 @@
+// SPDX-FileCopyrightText: (c) 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef TT_RUNTIME_DETAIL_METRICS_H
+#define TT_RUNTIME_DETAIL_METRICS_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string_view>
+
+#include "tt/runtime/types.h"
+
+// Always compiled in runtime metrics. Counters are plain atomics updated with
+// relaxed ordering, so recording never takes a lock. While metrics are
+// disabled every instrumentation point costs a single relaxed load.
+namespace tt::runtime::metrics {
+
+using Clock = std::chrono::steady_clock;
+
+// histogram[0] counts calls shorter than 1us, histogram[i] calls in
+// [2^(i-1), 2^i) us. The last bucket is open ended.
+inline constexpr std::size_t numHistogramBuckets = 24;
+
+// Distinct program and op type names tracked, names past the capacity are
+// accumulated under "<other>".
+inline constexpr std::size_t maxPrograms = 256;
+inline constexpr std::size_t maxOpTypes = 512;
+
+namespace detail {
+extern std::atomic<bool> enabled;
+} // namespace detail
+
+inline bool isEnabled() {
+  return detail::enabled.load(std::memory_order_relaxed);
+}
+
+void setEnabled(bool enabled);
+
+inline std::uint64_t elapsedNs(Clock::time_point start) {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() -
+                                                              start)
+      .count();
+}
+
+// Host time spent dispatching a whole program or a single op.
+void recordProgram(std::string_view name, std::uint64_t durationNs);
+void recordOp(std::string_view name, std::uint64_t durationNs);
+
+void recordBytesToDevice(std::uint64_t numBytes);
+void recordBytesFromDevice(std::uint64_t numBytes);
+
+void recordConstEvalCacheLookup(bool hit);
+
+// Requests in flight on the device, including the new one, and the time a
+// submit blocked waiting for a free slot.
+void recordAsyncSubmit(std::uint64_t queueDepth);
+void recordAsyncStall(std::uint64_t durationNs);
+
+// Snapshot of the metrics recorded since the last reset. Counters recorded
+// concurrently with the snapshot may be partially included.
+RuntimeMetrics snapshot();
+
+// Starts a new window. Names seen so far are kept, their counters are zeroed.
+void reset();
+
+} // namespace tt::runtime::metrics
+
+#endif // TT_RUNTIME_DETAIL_METRICS_H
@@ -50,6 +50,9 @@ Tensor toLayout(Tensor tensor, Device device, Layout layout,
 bool isTensorAllocated(Tensor tensor);
 tt::target::DataType getTensorDataType(Tensor tensor);
 std::vector<std::byte> getTensorDataBuffer(::tt::runtime::Tensor tensor);
+std::optional<TensorDataView>
+getTensorDataView(::tt::runtime::Tensor tensor);
+void copyTensorDataBuffer(::tt::runtime::Tensor tensor, void *dst);
 std::vector<std::uint32_t> getTensorShape(::tt::runtime::Tensor tensor);
 std::vector<std::uint32_t> getTensorStride(::tt::runtime::Tensor tensor);
 std::uint32_t getTensorElementSize(::tt::runtime::Tensor tensor);
@@ -116,6 +119,9 @@ std::string getOpLocInfo(OpContext opContextHandle);
 Tensor getOpOutputTensor(OpContext opContextHandle,
                          CallbackContext programContextHandle);
 
+std::vector<Tensor> getOpInputTensors(OpContext opContextHandle,
+                                      CallbackContext programContextHandle);
+
 } // namespace tt::runtime::ttmetal
 
 #endif
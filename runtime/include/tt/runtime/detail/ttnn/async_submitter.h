@@ -0,0 +1,72 @@
+// SPDX-FileCopyrightText: (c) 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef TT_RUNTIME_DETAIL_TTNN_ASYNC_SUBMITTER_H
+#define TT_RUNTIME_DETAIL_TTNN_ASYNC_SUBMITTER_H
+
+#include "tt/runtime/detail/ttnn/ttnn.h"
+#include "tt/runtime/types.h"
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace tt::runtime::ttnn {
+
+/**
+ * Pipelined asynchronous program submission.
+ *
+ * Every mesh device that receives an asynchronous submit gets a runtime-owned
+ * pipeline. Host inputs are converted to the layouts the program expects and
+ * copied to the device, the program is executed and, with readback, the
+ * outputs are copied back to host tensors. Requests are handled in submission
+ * order. On devices with more than one hardware command queue, a transfer
+ * thread issues uploads and readbacks on command queue 1 while an execute
+ * thread runs programs on command queue 0, ordered with device events, so the
+ * upload of request N+1 and the readback of request N-1 overlap the execution
+ * of request N. With a single command queue the execute thread does the
+ * transfers inline.
+ */
+class AsyncSubmitter {
+public:
+  static AsyncSubmitter &get();
+
+  AsyncSubmitter(const AsyncSubmitter &) = delete;
+  AsyncSubmitter &operator=(const AsyncSubmitter &) = delete;
+
+  // Sets the number of requests in flight before submit blocks.
+  void setQueueDepth(const ::ttnn::MeshDevice &meshDevice,
+                     std::size_t queueDepth);
+
+  SubmitFuture submit(std::shared_ptr<::ttnn::MeshDevice> meshDevice,
+                      Binary executableHandle, std::uint32_t programIndex,
+                      std::vector<::tt::runtime::Tensor> inputs,
+                      bool readback);
+
+  void synchronize(const ::ttnn::MeshDevice &meshDevice);
+
+  std::size_t getQueueDepth(const ::ttnn::MeshDevice &meshDevice);
+
+  // Waits for the requests in flight on `meshDevice` and stops its pipeline.
+  void release(const ::ttnn::MeshDevice &meshDevice);
+
+private:
+  AsyncSubmitter();
+  ~AsyncSubmitter();
+
+  class Pipeline;
+
+  static constexpr std::size_t defaultQueueDepth = 4;
+
+  std::mutex mutex;
+  std::unordered_map<const ::ttnn::MeshDevice *, std::size_t> queueDepths;
+  std::unordered_map<const ::ttnn::MeshDevice *, std::shared_ptr<Pipeline>>
+      pipelines;
+};
+
+} // namespace tt::runtime::ttnn
+
+#endif // TT_RUNTIME_DETAIL_TTNN_ASYNC_SUBMITTER_H
@@ -12,6 +12,7 @@
 #include "types_generated.h"
 #include <concepts>
 #include <cstdint>
+#include <span>
 
 namespace tt::runtime::ttnn::operations::utils {
 
@@ -47,7 +48,7 @@ createMatmulProgramConfigIfNeeded(const ::tt::target::ttnn::MatmulOp *op);
 ::ttnn::operations::conv::conv2d::Conv2dConfig
 createConv2dConfig(const ::tt::target::ttnn::Conv2dConfig *memcfg);
 
-::ttnn::Tensor toTTNNTensor(const ::flatbuffers::Vector<uint8_t> *data,
+::ttnn::Tensor toTTNNTensor(std::span<const std::uint8_t> data,
                             const ::ttnn::Shape &shape,
                             const ::ttnn::DataType &dataType);
 
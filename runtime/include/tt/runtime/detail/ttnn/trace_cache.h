@@ -0,0 +1,83 @@
+// SPDX-FileCopyrightText: (c) 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef TT_RUNTIME_DETAIL_TTNN_TRACE_CACHE_H
+#define TT_RUNTIME_DETAIL_TTNN_TRACE_CACHE_H
+
+#include "tt/runtime/detail/ttnn/ttnn.h"
+#include "tt/runtime/types.h"
+#include "ttnn/operations/trace.hpp"
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace tt::runtime::ttnn {
+
+/**
+ * Whole-program metal traces of mesh devices opened with
+ * MeshDeviceOptions::enableProgramTrace.
+ *
+ * The first submit of a program with a given set of input buffers runs the
+ * program normally, which also compiles its kernels, and then captures its
+ * device commands into a trace. Later submits with the same input buffers
+ * replay the trace with a single command and return copies of the captured
+ * outputs. Programs that do host work (CPU ops, host <-> device transfers,
+ * while loops, ops reading device data on the host) and inputs that are not
+ * retained device tensors always run without a trace. Every tensor created
+ * while capturing is kept until the trace is released, including the ones the
+ * program deallocates, so a traced program holds on to all of its buffers.
+ */
+class TraceCache {
+public:
+  static TraceCache &get();
+
+  TraceCache(const TraceCache &) = delete;
+  TraceCache &operator=(const TraceCache &) = delete;
+
+  void enable(const ::ttnn::MeshDevice &meshDevice);
+
+  // Releases all traces captured on `meshDevice` and disables tracing on it.
+  void release(::ttnn::MeshDevice &meshDevice);
+
+  // Runs the program through a trace. Returns std::nullopt if the program has
+  // to be run without a trace.
+  std::optional<std::vector<::tt::runtime::Tensor>>
+  submit(std::shared_ptr<::ttnn::MeshDevice> meshDevice,
+         Binary executableHandle, std::uint32_t programIndex,
+         std::vector<::tt::runtime::Tensor> &inputs);
+
+private:
+  TraceCache() = default;
+
+  struct Entry {
+    // Entries are keyed by the address of the binary, so a binary loaded at
+    // the address of a released one must not reuse its entries.
+    std::weak_ptr<void> binary;
+    bool traceable = false;
+    // Buffer address and size of every input the trace was captured with.
+    std::vector<std::uint64_t> inputKey;
+    std::optional<::ttnn::MeshTraceId> traceId;
+    std::vector<::tt::runtime::Tensor> outputs;
+    // Every tensor created while capturing, replays write into their buffers.
+    std::vector<::tt::runtime::Tensor> buffers;
+  };
+
+  using EntryKey = std::pair<const void *, std::uint32_t>;
+  using DeviceEntries = std::map<EntryKey, Entry>;
+
+  static void releaseTrace(::ttnn::MeshDevice &meshDevice, Entry &entry);
+
+  std::mutex mutex;
+  std::unordered_map<const ::ttnn::MeshDevice *, DeviceEntries> devices;
+};
+
+} // namespace tt::runtime::ttnn
+
+#endif // TT_RUNTIME_DETAIL_TTNN_TRACE_CACHE_H
@@ -32,15 +32,20 @@
 #include "ttnn/operations/eltwise/ternary/where.hpp"
 #include "ttnn/operations/eltwise/unary/unary.hpp"
 #include "ttnn/operations/embedding/embedding.hpp"
+#include "ttnn/operations/experimental/paged_cache/paged_cache.hpp"
 #include "ttnn/operations/kv_cache/kv_cache.hpp"
 #include "ttnn/operations/matmul/matmul.hpp"
 #include "ttnn/operations/moreh/moreh_cumsum/moreh_cumsum.hpp"
+#include "ttnn/operations/normalization/layernorm/layernorm.hpp"
+#include "ttnn/operations/normalization/rmsnorm/rmsnorm.hpp"
 #include "ttnn/operations/normalization/softmax/softmax.hpp"
 #include "ttnn/operations/pool/generic/generic_pools.hpp"
 #include "ttnn/operations/pool/upsample/upsample.hpp"
 #include "ttnn/operations/reduction/argmax/argmax.hpp"
 #include "ttnn/operations/reduction/generic/generic_reductions.hpp"
 #include "ttnn/operations/reduction/prod/prod.hpp"
+#include "ttnn/operations/transformer/sdpa/sdpa.hpp"
+#include "ttnn/operations/transformer/sdpa_decode/sdpa_decode.hpp"
 #include "ttnn/tensor/host_buffer/functions.hpp"
 #include "ttnn/tensor/shape/shape.hpp"
 #include "ttnn/tensor/tensor.hpp"
@@ -115,6 +120,9 @@ inline ::tt::runtime::Tensor createEmptyTensor(Device device, Layout layout,
 bool isTensorAllocated(::tt::runtime::Tensor tensor);
 tt::target::DataType getTensorDataType(::tt::runtime::Tensor tensor);
 std::vector<std::byte> getTensorDataBuffer(::tt::runtime::Tensor tensor);
+std::optional<TensorDataView>
+getTensorDataView(::tt::runtime::Tensor tensor);
+void copyTensorDataBuffer(::tt::runtime::Tensor tensor, void *dst);
 std::vector<std::uint32_t> getTensorShape(::tt::runtime::Tensor tensor);
 std::vector<std::uint32_t> getTensorStride(::tt::runtime::Tensor tensor);
 std::uint32_t getTensorElementSize(::tt::runtime::Tensor tensor);
@@ -186,10 +194,28 @@ std::string getOpLocInfo(OpContext opContextHandle);
 ::tt::runtime::Tensor getOpOutputTensor(OpContext opContextHandle,
                                         CallbackContext programContextHandle);
 
+std::vector<::tt::runtime::Tensor>
+getOpInputTensors(OpContext opContextHandle,
+                  CallbackContext programContextHandle);
+
 std::vector<::tt::runtime::Tensor>
 submit(Device deviceHandle, Binary executableHandle, std::uint32_t programIndex,
        std::vector<::tt::runtime::Tensor> &inputs);
 
+std::vector<::tt::runtime::Tensor>
+submitBucketed(Device deviceHandle, Binary executableHandle,
+               std::string_view programName,
+               std::vector<::tt::runtime::Tensor> &inputs);
+
+SubmitFuture submitAsync(Device deviceHandle, Binary executableHandle,
+                         std::uint32_t programIndex,
+                         std::vector<::tt::runtime::Tensor> inputs,
+                         bool readback);
+
+void synchronizeAsync(Device deviceHandle);
+
+size_t getAsyncQueueDepth(Device deviceHandle);
+
 std::vector<::tt::runtime::Tensor>
 runProgram(std::shared_ptr<::ttnn::MeshDevice> meshDevice,
            Binary executableHandle, std::uint32_t programIndex,
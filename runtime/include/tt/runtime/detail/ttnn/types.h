@@ -132,11 +132,19 @@ public:
     return programOutputIds;
   }
 
+  // While a trace is captured, every tensor inserted into the pool is also
+  // kept by the pool until takeTraceTensors(), since replays of the trace
+  // write into the buffers of all of them.
+  void beginTraceCapture() { traceTensors.emplace(); }
+  bool isCapturingTrace() const { return traceTensors.has_value(); }
+  std::vector<::tt::runtime::Tensor> takeTraceTensors();
+
 private:
   std::vector<std::uint32_t> programInputIds;
   std::vector<std::uint32_t> programOutputIds;
   TensorMap intermedTensors;
   TensorPtrMap liveTensors;
+  std::optional<std::vector<::tt::runtime::Tensor>> traceTensors;
 
   const ::tt::runtime::Tensor &getRuntimeTensor(std::uint32_t globalId) const;
   ::tt::runtime::Tensor &getRuntimeTensor(std::uint32_t globalId);
@@ -0,0 +1,115 @@
+// SPDX-FileCopyrightText: (c) 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef TT_RUNTIME_PAGED_CACHE_H
+#define TT_RUNTIME_PAGED_CACHE_H
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+namespace tt::runtime {
+
+/**
+ * Allocator of the blocks of a paged KV cache.
+ *
+ * A paged cache tensor of shape [num_blocks, num_heads, block_size, head_dim]
+ * is shared by all sequences. Every sequence owns a list of blocks, mapped by
+ * the page table consumed by the paged cache ops: row `i` of the page table
+ * lists the blocks of sequence `i` in logical order. Sequences only hold blocks
+ * for the tokens they have reserved, so cache memory is sized for the tokens in
+ * flight rather than for the max context of every sequence.
+ */
+class PagedCacheAllocator {
+public:
+  PagedCacheAllocator(std::uint32_t numBlocks, std::uint32_t blockSize,
+                      std::uint32_t maxSequences,
+                      std::uint32_t maxBlocksPerSequence)
+      : blockSize(blockSize), maxBlocksPerSequence(maxBlocksPerSequence),
+        sequenceBlocks(maxSequences),
+        pageTable(static_cast<std::size_t>(maxSequences) * maxBlocksPerSequence,
+                  0) {
+    assert(blockSize > 0 && "Block size must be positive");
+    freeBlocks.reserve(numBlocks);
+    // Hand out low block ids first.
+    for (std::uint32_t block = numBlocks; block > 0; --block) {
+      freeBlocks.push_back(static_cast<std::int32_t>(block - 1));
+    }
+  }
+
+  // Grows `sequence` so that it can hold `numTokens` tokens. Returns false and
+  // leaves the allocator unchanged if there are not enough free blocks or the
+  // sequence would need more than `maxBlocksPerSequence` blocks.
+  bool reserve(std::uint32_t sequence, std::uint32_t numTokens) {
+    assert(sequence < sequenceBlocks.size() && "Sequence out of range");
+    std::vector<std::int32_t> &blocks = sequenceBlocks[sequence];
+    const std::size_t numRequiredBlocks =
+        (static_cast<std::size_t>(numTokens) + blockSize - 1) / blockSize;
+    if (numRequiredBlocks <= blocks.size()) {
+      return true;
+    }
+    const std::size_t numNewBlocks = numRequiredBlocks - blocks.size();
+    if (numRequiredBlocks > maxBlocksPerSequence ||
+        numNewBlocks > freeBlocks.size()) {
+      return false;
+    }
+    for (std::size_t i = 0; i < numNewBlocks; ++i) {
+      pageTable[getPageTableIndex(sequence, blocks.size())] = freeBlocks.back();
+      blocks.push_back(freeBlocks.back());
+      freeBlocks.pop_back();
+    }
+    return true;
+  }
+
+  // Returns all blocks of `sequence` to the allocator.
+  void release(std::uint32_t sequence) {
+    assert(sequence < sequenceBlocks.size() && "Sequence out of range");
+    std::vector<std::int32_t> &blocks = sequenceBlocks[sequence];
+    // Freed in reverse, so a sequence reserved right after gets the same
+    // blocks in the same order.
+    for (auto it = blocks.rbegin(); it != blocks.rend(); ++it) {
+      freeBlocks.push_back(*it);
+    }
+    blocks.clear();
+    std::fill_n(pageTable.begin() + getPageTableIndex(sequence, 0),
+                maxBlocksPerSequence, 0);
+  }
+
+  std::uint32_t getNumFreeBlocks() const { return freeBlocks.size(); }
+
+  std::uint32_t getBlockSize() const { return blockSize; }
+
+  // Number of tokens `sequence` can hold without reserving more blocks.
+  std::uint32_t getCapacity(std::uint32_t sequence) const {
+    assert(sequence < sequenceBlocks.size() && "Sequence out of range");
+    return sequenceBlocks[sequence].size() * blockSize;
+  }
+
+  // Row major [maxSequences, maxBlocksPerSequence] int32 page table. Entries
+  // past the blocks of a sequence are 0, the paged ops never read them since
+  // they only access positions below the capacity of the sequence.
+  const std::vector<std::int32_t> &getPageTable() const { return pageTable; }
+
+  std::vector<std::uint32_t> getPageTableShape() const {
+    return {static_cast<std::uint32_t>(sequenceBlocks.size()),
+            maxBlocksPerSequence};
+  }
+
+private:
+  std::size_t getPageTableIndex(std::uint32_t sequence,
+                                std::size_t block) const {
+    return static_cast<std::size_t>(sequence) * maxBlocksPerSequence + block;
+  }
+
+  std::uint32_t blockSize;
+  std::uint32_t maxBlocksPerSequence;
+  std::vector<std::int32_t> freeBlocks;
+  std::vector<std::vector<std::int32_t>> sequenceBlocks;
+  std::vector<std::int32_t> pageTable;
+};
+
+} // namespace tt::runtime
+
+#endif // TT_RUNTIME_PAGED_CACHE_H
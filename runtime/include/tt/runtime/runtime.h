@@ -7,6 +7,7 @@
 
 #include <cstdint>
 #include <functional>
+#include <string_view>
 #include <vector>
 
 #include "tt/runtime/types.h"
@@ -123,6 +124,14 @@ inline Tensor createEmptyTensor(Device device, Layout layout,
 bool isTensorAllocated(Tensor tensor);
 tt::target::DataType getTensorDataType(Tensor tensor);
 std::vector<std::byte> getTensorDataBuffer(Tensor tensor);
+// Returns a view over the host storage of `tensor` if it already holds the
+// row-major logical data, std::nullopt otherwise. The view is only valid while
+// `tensor` is alive and unmodified.
+std::optional<TensorDataView> getTensorDataView(Tensor tensor);
+// Writes the row-major logical data of `tensor` into `dst` with at most one
+// conversion. `dst` must hold the tensor volume times the element size, block
+// float tensors are written as fp32.
+void copyTensorDataBuffer(Tensor tensor, void *dst);
 std::uint32_t getTensorElementSize(Tensor tensor);
 std::uint32_t getTensorVolume(Tensor tensor);
 std::vector<std::uint32_t> getTensorShape(Tensor tensor);
@@ -188,10 +197,51 @@ std::string getOpLocInfo(OpContext opContextHandle);
 Tensor getOpOutputTensor(OpContext opContextHandle,
                          CallbackContext programContextHandle);
 
+// Returns host copies of the input tensors of the op, currently only supported
+// for matmul and linear ops.
+std::vector<Tensor> getOpInputTensors(OpContext opContextHandle,
+                                      CallbackContext programContextHandle);
+
 std::vector<Tensor> submit(Device deviceHandle, Binary executableHandle,
                            std::uint32_t programIndex,
                            std::vector<Tensor> &inputs);
 
+// Runs the smallest shape bucket program of `programName` that fits the inputs.
+// Bucketed dims of the inputs are zero padded up to the bucket size and the
+// bucketed dims of the outputs are sliced back to the size of the inputs.
+std::vector<Tensor> submitBucketed(Device deviceHandle,
+                                   Binary executableHandle,
+                                   std::string_view programName,
+                                   std::vector<Tensor> &inputs);
+
+// Queues the program for execution on a runtime-owned thread and returns
+// without waiting for it. Host inputs are converted to the layouts the program
+// expects and uploaded ahead of execution, and with `readback` the outputs are
+// copied back to host tensors, so consecutive submits to a device overlap
+// their transfers with execution. Submits to a device run in submission order.
+// Blocks while MeshDeviceOptions::asyncQueueDepth submits of the device are in
+// flight.
+SubmitFuture submitAsync(Device deviceHandle, Binary executableHandle,
+                         std::uint32_t programIndex, std::vector<Tensor> inputs,
+                         bool readback = false);
+
+// Blocks until all asynchronous submits to the device have completed.
+void synchronizeAsync(Device deviceHandle);
+
+// Number of asynchronous submits in flight on the device.
+size_t getAsyncQueueDepth(Device deviceHandle);
+
+// Enables collection of per program and per op type runtime metrics. Metrics
+// are disabled by default, a disabled runtime pays one atomic load per op.
+void setMetricsEnabled(bool enabled);
+bool isMetricsEnabled();
+
+// Returns the metrics collected since the last reset.
+RuntimeMetrics getMetrics();
+
+// Zeroes all metrics and starts a new collection window.
+void resetMetrics();
+
 } // namespace tt::runtime
 
 #endif
@@ -6,9 +6,12 @@
 #define TT_RUNTIME_TYPES_H
 
 #include <cassert>
+#include <cstdint>
+#include <future>
 #include <memory>
 #include <numeric>
 #include <optional>
+#include <string>
 #include <string_view>
 #include <vector>
 
@@ -133,6 +136,11 @@ struct TensorDesc {
   std::int64_t sizeBytes() const { return volume() * itemsize; }
 };
 
+struct TensorDataView {
+  const void *data = nullptr;
+  std::size_t sizeBytes = 0;
+};
+
 struct MemoryView {
   std::uint64_t numBanks = 0;
   size_t totalBytesPerBank = 0;
@@ -147,11 +155,45 @@ struct MeshDeviceOptions {
   std::vector<int> deviceIds{};
   size_t numHWCQs = 1;
   bool enableProgramCache = false;
+  // Capture submitted programs into traces and replay them on later submits
+  // with the same inputs, requires a trace region. TTNN runtime only.
+  bool enableProgramTrace = false;
+  // Requests in flight before submitAsync blocks. TTNN runtime only.
+  size_t asyncQueueDepth = 4;
   std::optional<size_t> l1SmallSize = std::nullopt;
   std::optional<size_t> traceRegionSize = std::nullopt;
   std::optional<DispatchCoreType> dispatchCoreType = std::nullopt;
 };
 
+// Call count and host dispatch time of a program or an op type.
+struct MetricsCounter {
+  std::string name;
+  std::uint64_t count = 0;
+  std::uint64_t totalNs = 0;
+  std::uint64_t minNs = 0;
+  std::uint64_t maxNs = 0;
+  // Log2 histogram of the dispatch times in microseconds, see
+  // metrics::numHistogramBuckets.
+  std::vector<std::uint64_t> histogram;
+};
+
+struct RuntimeMetrics {
+  // Time since metrics were last reset.
+  std::uint64_t windowNs = 0;
+  std::vector<MetricsCounter> programs;
+  std::vector<MetricsCounter> ops;
+  std::uint64_t bytesToDevice = 0;
+  std::uint64_t bytesFromDevice = 0;
+  std::uint64_t constEvalCacheHits = 0;
+  std::uint64_t constEvalCacheMisses = 0;
+  // Asynchronous submits, the most requests in flight on a device and the
+  // submits that blocked on a full queue.
+  std::uint64_t asyncSubmits = 0;
+  std::uint64_t asyncMaxQueueDepth = 0;
+  std::uint64_t asyncStalls = 0;
+  std::uint64_t asyncStallNs = 0;
+};
+
 struct Flatbuffer : public detail::ObjectImpl {
   using detail::ObjectImpl::ObjectImpl;
 
@@ -177,6 +219,8 @@ struct SystemDesc : public Flatbuffer {
 };
 
 class TensorCache;
+class ConstantPool;
+struct SplitDebugInfo;
 struct Binary : public Flatbuffer {
   Binary(Flatbuffer fb);
   Binary(std::shared_ptr<void> handle);
@@ -196,12 +240,26 @@ struct Binary : public Flatbuffer {
   std::vector<TensorDesc> getProgramOutputs(std::uint32_t programIndex) const;
   const ::tt::target::GoldenTensor *getDebugInfoGolden(std::string &loc) const;
 
+  // Includes the debug info of binaries compiled with split debug info
+  std::string asJson() const;
+
+  // Load split debug info from `path` instead of the path recorded by the
+  // compiler
+  void setDebugInfoPath(const std::string &path);
+
   // Get the tensor cache associated with this binary
   std::shared_ptr<TensorCache> getCache() { return cache; }
 
+  // Get the constant payloads of this binary, TTNN binaries only
+  std::shared_ptr<ConstantPool> getConstantPool() { return constantPool; }
+
 private:
   // The tensor cache associated with this binary
   std::shared_ptr<TensorCache> cache;
+  // Decompressed constant payloads, shared by all copies of this binary
+  std::shared_ptr<ConstantPool> constantPool;
+  // Split debug info, loaded on first use
+  std::shared_ptr<SplitDebugInfo> splitDebugInfo;
 };
 
 struct Device : public detail::RuntimeCheckedObjectImpl {
@@ -230,6 +288,9 @@ struct Tensor : public detail::RuntimeCheckedObjectImpl {
         event(eventHandle, runtime) {}
 };
 
+// Outputs of an asynchronous submit, see submitAsync.
+using SubmitFuture = std::shared_future<std::vector<Tensor>>;
+
 struct Layout : public detail::RuntimeCheckedObjectImpl {
   using detail::RuntimeCheckedObjectImpl::RuntimeCheckedObjectImpl;
 };
@@ -3,13 +3,19 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include <fstream>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
 
 #include "flatbuffers/idl.h"
+#include "flatbuffers/reflection.h"
 
+#include "tt/runtime/constant_pool.h"
 #include "tt/runtime/detail/logger.h"
 #include "tt/runtime/tensor_cache.h"
 #include "tt/runtime/types.h"
 #include "tt/runtime/utils.h"
+#include "ttmlir/Target/Common/CopyTable.h"
 #include "ttmlir/Target/Common/system_desc_bfbs_generated.h"
 #include "ttmlir/Target/Common/system_desc_generated.h"
 #include "ttmlir/Target/TTMetal/Target.h"
@@ -19,17 +25,33 @@
 
 namespace tt::runtime {
 
+struct SplitDebugInfo {
+  std::mutex mutex;
+  // Set by Binary::setDebugInfoPath.
+  std::optional<std::string> path;
+  // The loaded debug info file, null until first use.
+  std::shared_ptr<void> buffer;
+};
+
 Binary::Binary(Flatbuffer fb)
-    : Flatbuffer(fb), cache(std::make_shared<TensorCache>()) {}
+    : Flatbuffer(fb), cache(std::make_shared<TensorCache>()),
+      constantPool(std::make_shared<ConstantPool>()),
+      splitDebugInfo(std::make_shared<SplitDebugInfo>()) {}
 
 Binary::Binary(std::shared_ptr<void> handle)
-    : Flatbuffer(handle), cache(std::make_shared<TensorCache>()) {}
+    : Flatbuffer(handle), cache(std::make_shared<TensorCache>()),
+      constantPool(std::make_shared<ConstantPool>()),
+      splitDebugInfo(std::make_shared<SplitDebugInfo>()) {}
 
 Binary &Binary::operator=(Flatbuffer fb) {
   this->handle = fb.handle;
   if (!cache) {
     cache = std::make_shared<TensorCache>();
   }
+  // The payloads and debug info of the previous flatbuffer don't apply to the
+  // new one.
+  constantPool = std::make_shared<ConstantPool>();
+  splitDebugInfo = std::make_shared<SplitDebugInfo>();
   return *this;
 }
 
@@ -38,6 +60,8 @@ Binary &Binary::operator=(std::shared_ptr<void> handle) {
   if (!cache) {
     cache = std::make_shared<TensorCache>();
   }
+  constantPool = std::make_shared<ConstantPool>();
+  splitDebugInfo = std::make_shared<SplitDebugInfo>();
   return *this;
 }
 
@@ -79,6 +103,114 @@ std::string_view getTTMLIRGitHash(Flatbuffer binary) {
   return getBinary(binary)->ttmlir_git_hash()->c_str();
 }
 
+// Returns the split debug info of `binary`, loading it on first use. Returns
+// null if the binary embeds its debug info or the file can't be used.
+static const ::tt::target::DebugInfo *
+getSplitDebugInfo(Flatbuffer binary, SplitDebugInfo &splitDebugInfo) {
+  const auto *debugInfoRef = getBinary(binary)->debug_info_ref();
+  if (!debugInfoRef) {
+    return nullptr;
+  }
+
+  std::lock_guard<std::mutex> lock(splitDebugInfo.mutex);
+  if (!splitDebugInfo.buffer) {
+    std::string path = splitDebugInfo.path.value_or(
+        debugInfoRef->path() ? debugInfoRef->path()->str() : "");
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) {
+      LOG_WARNING("Failed to open debug info file: ", path);
+      return nullptr;
+    }
+    std::streampos size = file.tellg();
+    file.seekg(0, std::ios::beg);
+    auto buffer = ::tt::runtime::utils::malloc_shared(size);
+    file.read(static_cast<char *>(buffer.get()), size);
+
+    ::flatbuffers::Verifier verifier(static_cast<const uint8_t *>(buffer.get()),
+                                     size);
+    if (!::tt::target::ttnn::VerifySizePrefixedTTNNDebugInfoBuffer(verifier)) {
+      LOG_WARNING("Invalid debug info file: ", path);
+      return nullptr;
+    }
+    if (::tt::target::ttnn::GetSizePrefixedTTNNDebugInfo(buffer.get())
+            ->hash() != debugInfoRef->hash()) {
+      LOG_WARNING("Debug info file ", path, " belongs to a different binary");
+      return nullptr;
+    }
+    splitDebugInfo.buffer = buffer;
+  }
+
+  return ::tt::target::ttnn::GetSizePrefixedTTNNDebugInfo(
+             splitDebugInfo.buffer.get())
+      ->debug_info();
+}
+
+using ::tt::target::copyTable;
+using ::tt::target::copyTables;
+
+// Rebuilds `binary` with `debugInfo` attached to every program, the way the
+// compiler embeds it.
+static ::flatbuffers::DetachedBuffer
+withDebugInfo(const ::tt::target::ttnn::TTNNBinary &binary,
+              const ::tt::target::DebugInfo &debugInfo) {
+  const reflection::Schema &schema = *reflection::GetSchema(
+      ::tt::target::ttnn::TTNNBinaryBinarySchema::data());
+  ::flatbuffers::FlatBufferBuilder fbb;
+
+  auto debugInfoCopy =
+      copyTable(fbb, schema, "tt.target.DebugInfo", &debugInfo);
+  // Programs share their dylibs, copy every list once.
+  using DynamicLibOffsets =
+      std::vector<::flatbuffers::Offset<::tt::target::DynamicLib>>;
+  std::unordered_map<const void *, DynamicLibOffsets> dylibCopies;
+  std::vector<::flatbuffers::Offset<::tt::target::ttnn::Program>> programs;
+  for (const auto *program : *binary.programs()) {
+    auto inputs =
+        copyTables(fbb, schema, "tt.target.ttnn.TensorRef", program->inputs());
+    auto outputs =
+        copyTables(fbb, schema, "tt.target.ttnn.TensorRef", program->outputs());
+    auto ops = copyTables(fbb, schema, "tt.target.ttnn.Operation",
+                          program->operations());
+    auto [dylibs, inserted] = dylibCopies.try_emplace(program->dylibs());
+    if (inserted) {
+      dylibs->second =
+          copyTables(fbb, schema, "tt.target.DynamicLib", program->dylibs());
+    }
+    auto shapeBucket = copyTable(fbb, schema, "tt.target.ttnn.ShapeBucket",
+                                 program->shape_bucket());
+    programs.push_back(::tt::target::ttnn::CreateProgramDirect(
+        fbb, program->name()->c_str(), &inputs, &outputs, &ops,
+        program->dylibs() ? &dylibs->second : nullptr, debugInfoCopy,
+        shapeBucket));
+  }
+
+  auto systemDesc = copyTable(fbb, schema, "tt.target.SystemDesc",
+                              binary.system_desc());
+  auto constants = copyTables(fbb, schema, "tt.target.ttnn.ConstantBuffer",
+                              binary.constants());
+  auto debugInfoRef = copyTable(fbb, schema, "tt.target.ttnn.DebugInfoRef",
+                                binary.debug_info_ref());
+  ::tt::target::ttnn::FinishSizePrefixedTTNNBinaryBuffer(
+      fbb, ::tt::target::ttnn::CreateTTNNBinaryDirect(
+               fbb, binary.version(), binary.ttmlir_git_hash()->c_str(),
+               systemDesc, &programs, &constants, debugInfoRef));
+  return fbb.Release();
+}
+
+std::string asJson(Flatbuffer binary, SplitDebugInfo &splitDebugInfo) {
+  if (const ::tt::target::DebugInfo *debugInfo =
+          getSplitDebugInfo(binary, splitDebugInfo)) {
+    ::flatbuffers::DetachedBuffer merged =
+        withDebugInfo(*getBinary(binary), *debugInfo);
+    return ::tt::runtime::asJson(
+        merged.data(), ::tt::target::ttnn::TTNNBinaryBinarySchema::data(),
+        ::tt::target::ttnn::TTNNBinaryBinarySchema::size());
+  }
+  return ::tt::runtime::asJson(
+      binary.handle.get(), ::tt::target::ttnn::TTNNBinaryBinarySchema::data(),
+      ::tt::target::ttnn::TTNNBinaryBinarySchema::size());
+}
+
 std::string asJson(Flatbuffer binary) {
   return ::tt::runtime::asJson(
       binary.handle.get(), ::tt::target::ttnn::TTNNBinaryBinarySchema::data(),
@@ -119,15 +251,35 @@ std::vector<TensorDesc> getProgramOutputs(Flatbuffer binary,
   return outputs;
 }
 
-const ::tt::target::GoldenTensor *getDebugInfoGolden(Flatbuffer binary,
-                                                     std::string &loc) {
+static const ::tt::target::GoldenTensor *
+findGolden(const ::tt::target::DebugInfo &debugInfo, std::string &loc) {
+  for (const ::tt::target::GoldenKV *goldenKV :
+       *debugInfo.golden_info()->golden_map()) {
+    if (loc == goldenKV->key()->c_str()) {
+      return goldenKV->value();
+    }
+  }
+  return nullptr;
+}
+
+const ::tt::target::GoldenTensor *
+getDebugInfoGolden(Flatbuffer binary, SplitDebugInfo &splitDebugInfo,
+                   std::string &loc) {
   const auto *programs = getBinary(binary)->programs();
   for (const auto *program : *programs) {
-    for (const ::tt::target::GoldenKV *goldenKV :
-         *program->debug_info()->golden_info()->golden_map()) {
-      if (loc == goldenKV->key()->c_str()) {
-        return goldenKV->value();
-      }
+    // Binaries compiled without debug info carry no goldens.
+    if (!program->debug_info()) {
+      continue;
+    }
+    if (const auto *golden = findGolden(*program->debug_info(), loc)) {
+      return golden;
+    }
+  }
+
+  if (const ::tt::target::DebugInfo *debugInfo =
+          getSplitDebugInfo(binary, splitDebugInfo)) {
+    if (const auto *golden = findGolden(*debugInfo, loc)) {
+      return golden;
     }
   }
 
@@ -204,6 +356,10 @@ const ::tt::target::GoldenTensor *getDebugInfoGolden(Flatbuffer binary,
                                                      std::string &loc) {
   const auto *programs = getBinary(binary)->programs();
   for (const auto *program : *programs) {
+    // Binaries compiled without debug info carry no goldens.
+    if (!program->debug_info()) {
+      continue;
+    }
     for (const ::tt::target::GoldenKV *goldenKV :
          *program->debug_info()->golden_info()->golden_map()) {
       if (loc == goldenKV->key()->c_str()) {
@@ -384,7 +540,7 @@ const ::tt::target::GoldenTensor *
 Binary::getDebugInfoGolden(std::string &loc) const {
   if (::tt::target::ttnn::SizePrefixedTTNNBinaryBufferHasIdentifier(
           handle.get())) {
-    return ttnn::getDebugInfoGolden(*this, loc);
+    return ttnn::getDebugInfoGolden(*this, *splitDebugInfo, loc);
   }
 
   if (::tt::target::metal::SizePrefixedTTMetalBinaryBufferHasIdentifier(
@@ -395,4 +551,18 @@ Binary::getDebugInfoGolden(std::string &loc) const {
   LOG_FATAL("Unsupported binary format for obtaining golden information");
 }
 
+std::string Binary::asJson() const {
+  if (::tt::target::ttnn::SizePrefixedTTNNBinaryBufferHasIdentifier(
+          handle.get())) {
+    return ttnn::asJson(*this, *splitDebugInfo);
+  }
+  return Flatbuffer::asJson();
+}
+
+void Binary::setDebugInfoPath(const std::string &path) {
+  std::lock_guard<std::mutex> lock(splitDebugInfo->mutex);
+  splitDebugInfo->path = path;
+  splitDebugInfo->buffer.reset();
+}
+
 } // namespace tt::runtime
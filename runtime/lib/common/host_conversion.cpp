@@ -0,0 +1,685 @@
+// SPDX-FileCopyrightText: (c) 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "tt/runtime/detail/host_conversion.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <thread>
+
+#include "tt/runtime/detail/logger.h"
+
+// SIMD code paths are compiled with per-function target attributes and
+// selected at runtime, so the library itself builds for the baseline ISA.
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define TT_HOST_CONVERSION_X86 1
+#include <immintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace tt::runtime::host_conversion {
+
+namespace {
+
+inline constexpr std::uint32_t faceRowsPerTile =
+    (tileHeight / faceHeight) * (tileWidth / faceWidth) * faceHeight;
+inline constexpr std::uint32_t exponentSectionBytes = faceRowsPerTile;
+
+// Run `fn(begin, end)` over [0, numItems), split into contiguous chunks across
+// host threads.
+template <typename Fn>
+void parallelFor(std::uint64_t numItems, std::size_t bytesPerItem,
+                 const ConversionOptions &options, Fn &&fn) {
+  if (numItems == 0) {
+    return;
+  }
+
+  std::uint64_t numThreads = options.numThreads
+                                 ? options.numThreads
+                                 : std::thread::hardware_concurrency();
+  std::uint64_t totalBytes = numItems * bytesPerItem;
+  numThreads = std::min<std::uint64_t>(
+      {std::max<std::uint64_t>(numThreads, 1), numItems,
+       std::max<std::uint64_t>(
+           totalBytes / std::max<std::size_t>(options.minBytesPerThread, 1),
+           1)});
+
+  if (numThreads == 1) {
+    fn(std::uint64_t{0}, numItems);
+    return;
+  }
+
+  std::uint64_t chunk = (numItems + numThreads - 1) / numThreads;
+  std::vector<std::thread> workers;
+  workers.reserve(numThreads - 1);
+  for (std::uint64_t begin = chunk; begin < numItems; begin += chunk) {
+    workers.emplace_back(fn, begin, std::min(begin + chunk, numItems));
+  }
+  fn(std::uint64_t{0}, std::min(chunk, numItems));
+  for (std::thread &worker : workers) {
+    worker.join();
+  }
+}
+
+#if defined(TT_HOST_CONVERSION_X86)
+enum class SimdLevel { None, Avx2, Avx512 };
+
+SimdLevel getSimdLevel() {
+  static const SimdLevel level = [] {
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) {
+      return SimdLevel::Avx512;
+    }
+    if (__builtin_cpu_supports("avx2")) {
+      return SimdLevel::Avx2;
+    }
+    return SimdLevel::None;
+  }();
+  return level;
+}
+#endif
+
+inline std::uint16_t float32ToBFloat16Scalar(float value) {
+  std::uint32_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  // Rounding would carry a NaN payload into the exponent and produce Inf,
+  // truncate and keep the NaN quiet instead.
+  if ((bits & 0x7FFFFFFF) > 0x7F800000) {
+    return static_cast<std::uint16_t>((bits >> 16) | 0x40);
+  }
+  bits += 0x7FFF + ((bits >> 16) & 1);
+  return static_cast<std::uint16_t>(bits >> 16);
+}
+
+inline float bfloat16ToFloat32Scalar(std::uint16_t value) {
+  std::uint32_t bits = static_cast<std::uint32_t>(value) << 16;
+  float result;
+  std::memcpy(&result, &bits, sizeof(result));
+  return result;
+}
+
+// The SIMD helpers below convert whole vectors only and return the number of
+// elements converted; the caller finishes the tail with the scalar code.
+#if defined(TT_HOST_CONVERSION_X86)
+__attribute__((target("avx512f"))) std::size_t
+float32ToBFloat16Avx512(const float *src, std::uint16_t *dst,
+                        std::size_t numElements) {
+  const __m512i one = _mm512_set1_epi32(1);
+  const __m512i bias = _mm512_set1_epi32(0x7FFF);
+  const __m512i quiet = _mm512_set1_epi32(0x00400000);
+  std::size_t i = 0;
+  for (; i + 16 <= numElements; i += 16) {
+    __m512 values = _mm512_loadu_ps(src + i);
+    __m512i bits = _mm512_castps_si512(values);
+    __m512i lsb = _mm512_and_si512(_mm512_srli_epi32(bits, 16), one);
+    __m512i rounded = _mm512_add_epi32(bits, _mm512_add_epi32(bias, lsb));
+    __mmask16 nan = _mm512_cmp_ps_mask(values, values, _CMP_UNORD_Q);
+    rounded = _mm512_mask_or_epi32(rounded, nan, bits, quiet);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i),
+                        _mm512_cvtepi32_epi16(_mm512_srli_epi32(rounded, 16)));
+  }
+  return i;
+}
+
+__attribute__((target("avx512f"))) std::size_t
+bfloat16ToFloat32Avx512(const std::uint16_t *src, float *dst,
+                        std::size_t numElements) {
+  std::size_t i = 0;
+  for (; i + 16 <= numElements; i += 16) {
+    __m256i half =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i));
+    _mm512_storeu_si512(dst + i,
+                        _mm512_slli_epi32(_mm512_cvtepu16_epi32(half), 16));
+  }
+  return i;
+}
+
+// Returns the rounded bf16 values in the low half of each 32 bit lane.
+__attribute__((target("avx2"))) inline __m256i
+roundToBFloat16Avx2(__m256 values) {
+  const __m256i one = _mm256_set1_epi32(1);
+  const __m256i bias = _mm256_set1_epi32(0x7FFF);
+  __m256i bits = _mm256_castps_si256(values);
+  __m256i lsb = _mm256_and_si256(_mm256_srli_epi32(bits, 16), one);
+  __m256i rounded = _mm256_add_epi32(bits, _mm256_add_epi32(bias, lsb));
+  __m256i quiet = _mm256_or_si256(bits, _mm256_set1_epi32(0x00400000));
+  __m256i nan =
+      _mm256_castps_si256(_mm256_cmp_ps(values, values, _CMP_UNORD_Q));
+  return _mm256_srli_epi32(_mm256_blendv_epi8(rounded, quiet, nan), 16);
+}
+
+__attribute__((target("avx2"))) std::size_t
+float32ToBFloat16Avx2(const float *src, std::uint16_t *dst,
+                      std::size_t numElements) {
+  std::size_t i = 0;
+  for (; i + 16 <= numElements; i += 16) {
+    __m256i lo = roundToBFloat16Avx2(_mm256_loadu_ps(src + i));
+    __m256i hi = roundToBFloat16Avx2(_mm256_loadu_ps(src + i + 8));
+    // packus works within 128 bit lanes, restore element order afterwards.
+    __m256i packed =
+        _mm256_permute4x64_epi64(_mm256_packus_epi32(lo, hi), 0xD8);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), packed);
+  }
+  return i;
+}
+
+__attribute__((target("avx2"))) std::size_t
+bfloat16ToFloat32Avx2(const std::uint16_t *src, float *dst,
+                      std::size_t numElements) {
+  std::size_t i = 0;
+  for (; i + 8 <= numElements; i += 8) {
+    __m128i half = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i),
+                        _mm256_slli_epi32(_mm256_cvtepu16_epi32(half), 16));
+  }
+  return i;
+}
+#elif defined(__ARM_NEON)
+inline uint16x4_t roundToBFloat16Neon(float32x4_t values) {
+  const uint32x4_t one = vdupq_n_u32(1);
+  const uint32x4_t bias = vdupq_n_u32(0x7FFF);
+  uint32x4_t bits = vreinterpretq_u32_f32(values);
+  uint32x4_t rounded =
+      vaddq_u32(bits, vaddq_u32(bias, vandq_u32(vshrq_n_u32(bits, 16), one)));
+  uint32x4_t quiet = vorrq_u32(bits, vdupq_n_u32(0x00400000));
+  return vshrn_n_u32(vbslq_u32(vceqq_f32(values, values), rounded, quiet), 16);
+}
+
+std::size_t float32ToBFloat16Neon(const float *src, std::uint16_t *dst,
+                                  std::size_t numElements) {
+  std::size_t i = 0;
+  for (; i + 8 <= numElements; i += 8) {
+    uint16x4_t lo = roundToBFloat16Neon(vld1q_f32(src + i));
+    uint16x4_t hi = roundToBFloat16Neon(vld1q_f32(src + i + 4));
+    vst1q_u16(dst + i, vcombine_u16(lo, hi));
+  }
+  return i;
+}
+
+std::size_t bfloat16ToFloat32Neon(const std::uint16_t *src, float *dst,
+                                  std::size_t numElements) {
+  std::size_t i = 0;
+  for (; i + 4 <= numElements; i += 4) {
+    vst1q_u32(reinterpret_cast<std::uint32_t *>(dst + i),
+              vshlq_n_u32(vmovl_u16(vld1_u16(src + i)), 16));
+  }
+  return i;
+}
+#endif
+
+void float32ToBFloat16Range(const float *src, std::uint16_t *dst,
+                            std::size_t numElements) {
+  std::size_t i = 0;
+#if defined(TT_HOST_CONVERSION_X86)
+  switch (getSimdLevel()) {
+  case SimdLevel::Avx512:
+    i = float32ToBFloat16Avx512(src, dst, numElements);
+    break;
+  case SimdLevel::Avx2:
+    i = float32ToBFloat16Avx2(src, dst, numElements);
+    break;
+  case SimdLevel::None:
+    break;
+  }
+#elif defined(__ARM_NEON)
+  i = float32ToBFloat16Neon(src, dst, numElements);
+#endif
+  for (; i < numElements; ++i) {
+    dst[i] = float32ToBFloat16Scalar(src[i]);
+  }
+}
+
+void bfloat16ToFloat32Range(const std::uint16_t *src, float *dst,
+                            std::size_t numElements) {
+  std::size_t i = 0;
+#if defined(TT_HOST_CONVERSION_X86)
+  switch (getSimdLevel()) {
+  case SimdLevel::Avx512:
+    i = bfloat16ToFloat32Avx512(src, dst, numElements);
+    break;
+  case SimdLevel::Avx2:
+    i = bfloat16ToFloat32Avx2(src, dst, numElements);
+    break;
+  case SimdLevel::None:
+    break;
+  }
+#elif defined(__ARM_NEON)
+  i = bfloat16ToFloat32Neon(src, dst, numElements);
+#endif
+  for (; i < numElements; ++i) {
+    dst[i] = bfloat16ToFloat32Scalar(src[i]);
+  }
+}
+
+// Position of the first element of face row `faceRow` of tile
+// `(tileRow, tileCol)` within its row-major matrix.
+struct FaceRowLocation {
+  std::uint32_t row;
+  std::uint32_t col;
+};
+
+inline FaceRowLocation getFaceRowLocation(std::uint32_t tileRow,
+                                          std::uint32_t tileCol,
+                                          std::uint32_t faceRow) {
+  std::uint32_t face = faceRow / faceHeight;
+  std::uint32_t rowInFace = faceRow % faceHeight;
+  std::uint32_t facesPerRow = tileWidth / faceWidth;
+  return {tileRow * tileHeight + (face / facesPerRow) * faceHeight + rowInFace,
+          tileCol * tileWidth + (face % facesPerRow) * faceWidth};
+}
+
+// Copy one full face row. Fixed size copies are lowered to vector moves.
+inline void copyFaceRow(std::byte *dst, const std::byte *src,
+                        std::uint32_t elementSize) {
+  switch (elementSize) {
+  case 2:
+    std::memcpy(dst, src, faceWidth * 2);
+    return;
+  case 4:
+    std::memcpy(dst, src, faceWidth * 4);
+    return;
+  default:
+    std::memcpy(dst, src, faceWidth * elementSize);
+  }
+}
+
+// Copy one tile between row-major and tiled storage.
+template <bool ToTiles>
+void convertTile(const std::byte *src, std::byte *dst,
+                 std::uint32_t elementSize, const MatrixShape &shape,
+                 std::uint64_t tileIndex) {
+  std::uint32_t tilesPerRow = shape.paddedCols() / tileWidth;
+  std::uint64_t tilesPerMatrix =
+      static_cast<std::uint64_t>(shape.paddedRows() / tileHeight) * tilesPerRow;
+  std::uint64_t matrix = tileIndex / tilesPerMatrix;
+  std::uint32_t tileInMatrix =
+      static_cast<std::uint32_t>(tileIndex % tilesPerMatrix);
+  std::uint32_t tileRow = tileInMatrix / tilesPerRow;
+  std::uint32_t tileCol = tileInMatrix % tilesPerRow;
+
+  std::size_t matrixOffset =
+      matrix * static_cast<std::uint64_t>(shape.rows) * shape.cols;
+  std::size_t faceRowBytes = faceWidth * elementSize;
+  std::size_t tileOffset = tileIndex * tileVolume * elementSize;
+
+  for (std::uint32_t faceRow = 0; faceRow < faceRowsPerTile; ++faceRow) {
+    FaceRowLocation loc = getFaceRowLocation(tileRow, tileCol, faceRow);
+    std::size_t tiled = tileOffset + faceRow * faceRowBytes;
+    std::uint32_t valid =
+        loc.row < shape.rows && loc.col < shape.cols
+            ? std::min<std::uint32_t>(faceWidth, shape.cols - loc.col)
+            : 0;
+    std::size_t rowMajor =
+        (matrixOffset + static_cast<std::uint64_t>(loc.row) * shape.cols +
+         loc.col) *
+        elementSize;
+
+    if constexpr (ToTiles) {
+      if (valid == faceWidth) {
+        copyFaceRow(dst + tiled, src + rowMajor, elementSize);
+        continue;
+      }
+      std::memcpy(dst + tiled, src + rowMajor, valid * elementSize);
+      std::memset(dst + tiled + valid * elementSize, 0,
+                  faceRowBytes - valid * elementSize);
+    } else {
+      if (valid == faceWidth) {
+        copyFaceRow(dst + rowMajor, src + tiled, elementSize);
+        continue;
+      }
+      std::memcpy(dst + rowMajor, src + tiled, valid * elementSize);
+    }
+  }
+}
+
+template <BlockFloatFormat Format>
+inline constexpr std::uint32_t mantissaBits =
+    Format == BlockFloatFormat::BFP8 ? 7 : 3;
+
+// Convert `bits` into a sign-magnitude mantissa relative to `sharedExponent`,
+// rounding to nearest even and saturating at the largest mantissa.
+template <BlockFloatFormat Format>
+inline std::uint32_t toBlockFloatMantissa(std::uint32_t bits,
+                                          std::uint32_t sharedExponent) {
+  constexpr std::uint32_t numBits = mantissaBits<Format>;
+  std::uint32_t exponent = (bits >> 23) & 0xFF;
+  std::uint32_t shift = (24 - numBits) + (sharedExponent - exponent);
+  if (exponent == 0 || shift >= 32) {
+    return 0;
+  }
+
+  std::uint32_t mantissa = (1u << 23) | (bits & 0x7FFFFF);
+  std::uint32_t magnitude = mantissa >> shift;
+  std::uint32_t remainder = mantissa & ((1u << shift) - 1);
+  std::uint32_t half = 1u << (shift - 1);
+  magnitude += remainder > half || (remainder == half && (magnitude & 1));
+  magnitude = std::min(magnitude, (1u << numBits) - 1);
+
+  return magnitude == 0 ? 0 : ((bits >> 31) << numBits) | magnitude;
+}
+
+// Value of the least significant mantissa bit for `sharedExponent`.
+inline float getBlockFloatScale(std::uint32_t sharedExponent,
+                                std::uint32_t numBits) {
+  if (sharedExponent <= numBits - 1) {
+    return sharedExponent == 0
+               ? 0.0f
+               : std::ldexp(1.0f, static_cast<int>(sharedExponent) - 127 -
+                                      static_cast<int>(numBits - 1));
+  }
+  std::uint32_t bits = (sharedExponent - (numBits - 1)) << 23;
+  float scale;
+  std::memcpy(&scale, &bits, sizeof(scale));
+  return scale;
+}
+
+// Exponents come first, one per face row, followed by the mantissas.
+template <BlockFloatFormat Format>
+void packBlockFloatTile(const float *src, std::uint8_t *dst) {
+  std::uint8_t *data = dst + exponentSectionBytes;
+
+  for (std::uint32_t faceRow = 0; faceRow < faceRowsPerTile; ++faceRow) {
+    std::array<std::uint32_t, faceWidth> bits;
+    std::memcpy(bits.data(), src + faceRow * faceWidth,
+                faceWidth * sizeof(float));
+
+    std::uint32_t sharedExponent = 0;
+    for (std::uint32_t value : bits) {
+      sharedExponent = std::max(sharedExponent, (value >> 23) & 0xFF);
+    }
+    dst[faceRow] = static_cast<std::uint8_t>(sharedExponent);
+
+    std::array<std::uint8_t, faceWidth> mantissas;
+    for (std::uint32_t i = 0; i < faceWidth; ++i) {
+      mantissas[i] = static_cast<std::uint8_t>(
+          toBlockFloatMantissa<Format>(bits[i], sharedExponent));
+    }
+
+    if constexpr (Format == BlockFloatFormat::BFP8) {
+      std::memcpy(data + faceRow * faceWidth, mantissas.data(), faceWidth);
+    } else {
+      std::uint8_t *packed = data + faceRow * faceWidth / 2;
+      for (std::uint32_t i = 0; i < faceWidth / 2; ++i) {
+        packed[i] = static_cast<std::uint8_t>(mantissas[2 * i] |
+                                              (mantissas[2 * i + 1] << 4));
+      }
+    }
+  }
+}
+
+template <BlockFloatFormat Format>
+void unpackBlockFloatTile(const std::uint8_t *src, float *dst) {
+  constexpr std::uint32_t numBits = mantissaBits<Format>;
+  constexpr std::uint32_t magnitudeMask = (1u << numBits) - 1;
+  const std::uint8_t *data = src + exponentSectionBytes;
+
+  for (std::uint32_t faceRow = 0; faceRow < faceRowsPerTile; ++faceRow) {
+    float scale = getBlockFloatScale(src[faceRow], numBits);
+    for (std::uint32_t i = 0; i < faceWidth; ++i) {
+      std::uint32_t element = faceRow * faceWidth + i;
+      std::uint32_t mantissa;
+      if constexpr (Format == BlockFloatFormat::BFP8) {
+        mantissa = data[element];
+      } else {
+        mantissa = (data[element / 2] >> ((element % 2) * 4)) & 0xF;
+      }
+      float value = static_cast<float>(mantissa & magnitudeMask) * scale;
+      dst[element] = (mantissa >> numBits) ? -value : value;
+    }
+  }
+}
+
+#if defined(TT_HOST_CONVERSION_X86)
+// Vector form of toBlockFloatMantissa for eight elements.
+__attribute__((target("avx2"))) inline __m256i
+toBlockFloatMantissaAvx2(__m256i bits, __m256i sharedExponent,
+                         std::uint32_t numBits) {
+  const __m256i one = _mm256_set1_epi32(1);
+  const __m256i zero = _mm256_setzero_si256();
+  __m256i exponent =
+      _mm256_and_si256(_mm256_srli_epi32(bits, 23), _mm256_set1_epi32(0xFF));
+  __m256i shift =
+      _mm256_add_epi32(_mm256_set1_epi32(24 - numBits),
+                       _mm256_sub_epi32(sharedExponent, exponent));
+  __m256i mantissa =
+      _mm256_or_si256(_mm256_and_si256(bits, _mm256_set1_epi32(0x7FFFFF)),
+                      _mm256_set1_epi32(1 << 23));
+
+  // Lanes with shift >= 32 are masked out below, so the signed compares only
+  // see values below 2^31.
+  __m256i magnitude = _mm256_srlv_epi32(mantissa, shift);
+  __m256i remainder = _mm256_and_si256(
+      mantissa, _mm256_sub_epi32(_mm256_sllv_epi32(one, shift), one));
+  __m256i half = _mm256_sllv_epi32(one, _mm256_sub_epi32(shift, one));
+  __m256i roundUp = _mm256_or_si256(
+      _mm256_cmpgt_epi32(remainder, half),
+      _mm256_and_si256(_mm256_cmpeq_epi32(remainder, half),
+                       _mm256_cmpeq_epi32(_mm256_and_si256(magnitude, one),
+                                          one)));
+  // roundUp lanes are all ones, i.e. -1.
+  magnitude = _mm256_sub_epi32(magnitude, roundUp);
+  magnitude =
+      _mm256_min_epu32(magnitude, _mm256_set1_epi32((1 << numBits) - 1));
+
+  __m256i sign = _mm256_sllv_epi32(_mm256_srli_epi32(bits, 31),
+                                   _mm256_set1_epi32(numBits));
+  __m256i isZero = _mm256_or_si256(
+      _mm256_or_si256(_mm256_cmpeq_epi32(exponent, zero),
+                      _mm256_cmpgt_epi32(shift, _mm256_set1_epi32(31))),
+      _mm256_cmpeq_epi32(magnitude, zero));
+  return _mm256_andnot_si256(isZero, _mm256_or_si256(sign, magnitude));
+}
+
+__attribute__((target("avx2"))) void
+packBlockFloatTileAvx2(const float *src, std::uint8_t *dst,
+                       BlockFloatFormat format) {
+  std::uint32_t numBits = format == BlockFloatFormat::BFP8
+                              ? mantissaBits<BlockFloatFormat::BFP8>
+                              : mantissaBits<BlockFloatFormat::BFP4>;
+  const __m256i exponentMask = _mm256_set1_epi32(0xFF);
+  std::uint8_t *data = dst + exponentSectionBytes;
+
+  for (std::uint32_t faceRow = 0; faceRow < faceRowsPerTile; ++faceRow) {
+    const float *row = src + faceRow * faceWidth;
+    __m256i lo = _mm256_castps_si256(_mm256_loadu_ps(row));
+    __m256i hi = _mm256_castps_si256(_mm256_loadu_ps(row + 8));
+
+    __m256i exponents = _mm256_max_epu32(
+        _mm256_and_si256(_mm256_srli_epi32(lo, 23), exponentMask),
+        _mm256_and_si256(_mm256_srli_epi32(hi, 23), exponentMask));
+    __m128i maxExponent = _mm_max_epu32(_mm256_castsi256_si128(exponents),
+                                        _mm256_extracti128_si256(exponents, 1));
+    maxExponent =
+        _mm_max_epu32(maxExponent, _mm_shuffle_epi32(maxExponent, 0x4E));
+    maxExponent =
+        _mm_max_epu32(maxExponent, _mm_shuffle_epi32(maxExponent, 0xB1));
+    std::uint32_t sharedExponent =
+        static_cast<std::uint32_t>(_mm_cvtsi128_si32(maxExponent));
+    dst[faceRow] = static_cast<std::uint8_t>(sharedExponent);
+
+    __m256i shared = _mm256_set1_epi32(static_cast<int>(sharedExponent));
+    __m256i words = _mm256_permute4x64_epi64(
+        _mm256_packus_epi32(toBlockFloatMantissaAvx2(lo, shared, numBits),
+                            toBlockFloatMantissaAvx2(hi, shared, numBits)),
+        0xD8);
+    __m128i bytes = _mm_packus_epi16(_mm256_castsi256_si128(words),
+                                     _mm256_extracti128_si256(words, 1));
+
+    if (format == BlockFloatFormat::BFP8) {
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(data + faceRow * faceWidth),
+                       bytes);
+      continue;
+    }
+    // Each 16 bit word holds an even element in its low byte and the next odd
+    // element in its high byte; merge them into one byte, low nibble first.
+    __m128i nibbles = _mm_or_si128(
+        _mm_and_si128(bytes, _mm_set1_epi16(0x000F)),
+        _mm_and_si128(_mm_srli_epi16(bytes, 4), _mm_set1_epi16(0x00F0)));
+    _mm_storel_epi64(
+        reinterpret_cast<__m128i *>(data + faceRow * faceWidth / 2),
+        _mm_packus_epi16(nibbles, _mm_setzero_si128()));
+  }
+}
+#endif
+
+void packBlockFloatTile(const float *src, std::uint8_t *dst,
+                        BlockFloatFormat format) {
+#if defined(TT_HOST_CONVERSION_X86)
+  if (getSimdLevel() != SimdLevel::None) {
+    packBlockFloatTileAvx2(src, dst, format);
+    return;
+  }
+#endif
+  if (format == BlockFloatFormat::BFP8) {
+    packBlockFloatTile<BlockFloatFormat::BFP8>(src, dst);
+  } else {
+    packBlockFloatTile<BlockFloatFormat::BFP4>(src, dst);
+  }
+}
+
+void unpackBlockFloatTile(const std::uint8_t *src, float *dst,
+                          BlockFloatFormat format) {
+  if (format == BlockFloatFormat::BFP8) {
+    unpackBlockFloatTile<BlockFloatFormat::BFP8>(src, dst);
+  } else {
+    unpackBlockFloatTile<BlockFloatFormat::BFP4>(src, dst);
+  }
+}
+
+} // namespace
+
+MatrixShape
+MatrixShape::fromTensorShape(const std::vector<std::uint32_t> &shape) {
+  MatrixShape matrixShape;
+  if (shape.empty()) {
+    return matrixShape;
+  }
+
+  matrixShape.cols = shape.back();
+  if (shape.size() > 1) {
+    matrixShape.rows = shape[shape.size() - 2];
+  }
+  for (std::size_t i = 0; i + 2 < shape.size(); ++i) {
+    matrixShape.batch *= shape[i];
+  }
+  return matrixShape;
+}
+
+void tilize(const void *src, void *dst, std::uint32_t elementSize,
+            const MatrixShape &shape, const ConversionOptions &options) {
+  LOG_ASSERT(src != nullptr && dst != nullptr, "Null tilize buffer");
+  const std::byte *srcBytes = static_cast<const std::byte *>(src);
+  std::byte *dstBytes = static_cast<std::byte *>(dst);
+  parallelFor(shape.numTiles(), tileVolume * elementSize, options,
+              [&](std::uint64_t begin, std::uint64_t end) {
+                for (std::uint64_t tile = begin; tile < end; ++tile) {
+                  convertTile</*ToTiles=*/true>(srcBytes, dstBytes,
+                                                elementSize, shape, tile);
+                }
+              });
+}
+
+void untilize(const void *src, void *dst, std::uint32_t elementSize,
+              const MatrixShape &shape, const ConversionOptions &options) {
+  LOG_ASSERT(src != nullptr && dst != nullptr, "Null untilize buffer");
+  const std::byte *srcBytes = static_cast<const std::byte *>(src);
+  std::byte *dstBytes = static_cast<std::byte *>(dst);
+  parallelFor(shape.numTiles(), tileVolume * elementSize, options,
+              [&](std::uint64_t begin, std::uint64_t end) {
+                for (std::uint64_t tile = begin; tile < end; ++tile) {
+                  convertTile</*ToTiles=*/false>(srcBytes, dstBytes,
+                                                 elementSize, shape, tile);
+                }
+              });
+}
+
+void float32ToBFloat16(const float *src, std::uint16_t *dst,
+                       std::size_t numElements,
+                       const ConversionOptions &options) {
+  parallelFor(numElements, sizeof(float), options,
+              [&](std::uint64_t begin, std::uint64_t end) {
+                float32ToBFloat16Range(src + begin, dst + begin, end - begin);
+              });
+}
+
+void bfloat16ToFloat32(const std::uint16_t *src, float *dst,
+                       std::size_t numElements,
+                       const ConversionOptions &options) {
+  parallelFor(numElements, sizeof(float), options,
+              [&](std::uint64_t begin, std::uint64_t end) {
+                bfloat16ToFloat32Range(src + begin, dst + begin, end - begin);
+              });
+}
+
+std::size_t getBlockFloatTileSizeBytes(BlockFloatFormat format) {
+  switch (format) {
+  case BlockFloatFormat::BFP8:
+    return exponentSectionBytes + tileVolume;
+  case BlockFloatFormat::BFP4:
+    return exponentSectionBytes + tileVolume / 2;
+  }
+  LOG_FATAL("Unsupported block float format");
+}
+
+void packBlockFloatTiles(const float *src, std::uint8_t *dst,
+                         std::uint64_t numTiles, BlockFloatFormat format,
+                         const ConversionOptions &options) {
+  std::size_t tileBytes = getBlockFloatTileSizeBytes(format);
+  parallelFor(numTiles, tileVolume * sizeof(float), options,
+              [&](std::uint64_t begin, std::uint64_t end) {
+                for (std::uint64_t tile = begin; tile < end; ++tile) {
+                  packBlockFloatTile(src + tile * tileVolume,
+                                     dst + tile * tileBytes, format);
+                }
+              });
+}
+
+void packBlockFloatTiles(const std::uint16_t *src, std::uint8_t *dst,
+                         std::uint64_t numTiles, BlockFloatFormat format,
+                         const ConversionOptions &options) {
+  std::size_t tileBytes = getBlockFloatTileSizeBytes(format);
+  parallelFor(numTiles, tileVolume * sizeof(std::uint16_t), options,
+              [&](std::uint64_t begin, std::uint64_t end) {
+                std::array<float, tileVolume> tile;
+                for (std::uint64_t i = begin; i < end; ++i) {
+                  bfloat16ToFloat32Range(src + i * tileVolume, tile.data(),
+                                         tileVolume);
+                  packBlockFloatTile(tile.data(), dst + i * tileBytes, format);
+                }
+              });
+}
+
+void unpackBlockFloatTiles(const std::uint8_t *src, float *dst,
+                           std::uint64_t numTiles, BlockFloatFormat format,
+                           const ConversionOptions &options) {
+  std::size_t tileBytes = getBlockFloatTileSizeBytes(format);
+  parallelFor(numTiles, tileVolume * sizeof(float), options,
+              [&](std::uint64_t begin, std::uint64_t end) {
+                for (std::uint64_t tile = begin; tile < end; ++tile) {
+                  unpackBlockFloatTile(src + tile * tileBytes,
+                                       dst + tile * tileVolume, format);
+                }
+              });
+}
+
+void unpackBlockFloatTiles(const std::uint8_t *src, std::uint16_t *dst,
+                           std::uint64_t numTiles, BlockFloatFormat format,
+                           const ConversionOptions &options) {
+  std::size_t tileBytes = getBlockFloatTileSizeBytes(format);
+  parallelFor(numTiles, tileVolume * sizeof(std::uint16_t), options,
+              [&](std::uint64_t begin, std::uint64_t end) {
+                std::array<float, tileVolume> tile;
+                for (std::uint64_t i = begin; i < end; ++i) {
+                  unpackBlockFloatTile(src + i * tileBytes, tile.data(),
+                                       format);
+                  float32ToBFloat16Range(tile.data(), dst + i * tileVolume,
+                                         tileVolume);
+                }
+              });
+}
+
+} // namespace tt::runtime::host_conversion
@@ -0,0 +1,269 @@
+// SPDX-FileCopyrightText: (c) 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "tt/runtime/detail/metrics.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <limits>
+
+namespace tt::runtime::metrics {
+
+namespace detail {
+std::atomic<bool> enabled{false};
+} // namespace detail
+
+namespace {
+
+constexpr std::size_t maxNameLength = 128;
+
+std::size_t getHistogramBucket(std::uint64_t durationNs) {
+  std::uint64_t durationUs = durationNs / 1000;
+  return std::min<std::size_t>(std::bit_width(durationUs),
+                               numHistogramBuckets - 1);
+}
+
+void updateMin(std::atomic<std::uint64_t> &value, std::uint64_t candidate) {
+  std::uint64_t current = value.load(std::memory_order_relaxed);
+  while (candidate < current &&
+         !value.compare_exchange_weak(current, candidate,
+                                      std::memory_order_relaxed)) {
+  }
+}
+
+void updateMax(std::atomic<std::uint64_t> &value, std::uint64_t candidate) {
+  std::uint64_t current = value.load(std::memory_order_relaxed);
+  while (candidate > current &&
+         !value.compare_exchange_weak(current, candidate,
+                                      std::memory_order_relaxed)) {
+  }
+}
+
+struct CounterSlot {
+  // Hash of the name, 0 while the slot is free. Slots are claimed with a CAS
+  // and never released, reset only zeroes the counters.
+  std::atomic<std::uint64_t> key{0};
+  // Set once `name` is written, snapshots skip slots that are not ready yet.
+  std::atomic<bool> ready{false};
+  char name[maxNameLength] = {};
+
+  std::atomic<std::uint64_t> count{0};
+  std::atomic<std::uint64_t> totalNs{0};
+  std::atomic<std::uint64_t> minNs{std::numeric_limits<std::uint64_t>::max()};
+  std::atomic<std::uint64_t> maxNs{0};
+  std::array<std::atomic<std::uint64_t>, numHistogramBuckets> histogram{};
+
+  void setName(std::string_view value) {
+    std::size_t length = std::min(value.size(), maxNameLength - 1);
+    value.copy(name, length);
+    name[length] = '\0';
+    ready.store(true, std::memory_order_release);
+  }
+
+  void record(std::uint64_t durationNs) {
+    count.fetch_add(1, std::memory_order_relaxed);
+    totalNs.fetch_add(durationNs, std::memory_order_relaxed);
+    updateMin(minNs, durationNs);
+    updateMax(maxNs, durationNs);
+    histogram[getHistogramBucket(durationNs)].fetch_add(
+        1, std::memory_order_relaxed);
+  }
+
+  void reset() {
+    count.store(0, std::memory_order_relaxed);
+    totalNs.store(0, std::memory_order_relaxed);
+    minNs.store(std::numeric_limits<std::uint64_t>::max(),
+                std::memory_order_relaxed);
+    maxNs.store(0, std::memory_order_relaxed);
+    for (std::atomic<std::uint64_t> &bucket : histogram) {
+      bucket.store(0, std::memory_order_relaxed);
+    }
+  }
+
+  MetricsCounter snapshot() const {
+    MetricsCounter counter;
+    counter.name = name;
+    counter.count = count.load(std::memory_order_relaxed);
+    counter.totalNs = totalNs.load(std::memory_order_relaxed);
+    counter.minNs = counter.count ? minNs.load(std::memory_order_relaxed) : 0;
+    counter.maxNs = maxNs.load(std::memory_order_relaxed);
+    counter.histogram.reserve(numHistogramBuckets);
+    for (const std::atomic<std::uint64_t> &bucket : histogram) {
+      counter.histogram.push_back(bucket.load(std::memory_order_relaxed));
+    }
+    return counter;
+  }
+};
+
+// Fixed capacity open addressing table of counters keyed by name. Names are
+// identified by their 64-bit hash.
+template <std::size_t Capacity>
+class CounterTable {
+public:
+  CounterTable() { overflow.setName("<other>"); }
+
+  CounterSlot &get(std::string_view name) {
+    // 0 marks free slots, so it is never used as a key.
+    std::uint64_t key = hash(name) | 1;
+    for (std::size_t probe = 0; probe < Capacity; ++probe) {
+      CounterSlot &slot = slots[(key + probe) % Capacity];
+      std::uint64_t current = slot.key.load(std::memory_order_acquire);
+      if (current == 0) {
+        if (slot.key.compare_exchange_strong(current, key,
+                                             std::memory_order_acq_rel)) {
+          slot.setName(name);
+          return slot;
+        }
+      }
+      if (current == key) {
+        return slot;
+      }
+    }
+    return overflow;
+  }
+
+  void reset() {
+    for (CounterSlot &slot : slots) {
+      slot.reset();
+    }
+    overflow.reset();
+  }
+
+  std::vector<MetricsCounter> snapshot() const {
+    std::vector<MetricsCounter> counters;
+    auto add = [&](const CounterSlot &slot) {
+      if (slot.ready.load(std::memory_order_acquire) &&
+          slot.count.load(std::memory_order_relaxed) > 0) {
+        counters.push_back(slot.snapshot());
+      }
+    };
+    for (const CounterSlot &slot : slots) {
+      add(slot);
+    }
+    add(overflow);
+    std::sort(counters.begin(), counters.end(),
+              [](const MetricsCounter &lhs, const MetricsCounter &rhs) {
+                return lhs.totalNs > rhs.totalNs;
+              });
+    return counters;
+  }
+
+private:
+  // FNV-1a.
+  static std::uint64_t hash(std::string_view name) {
+    std::uint64_t result = 0xcbf29ce484222325ULL;
+    for (char c : name) {
+      result ^= static_cast<unsigned char>(c);
+      result *= 0x100000001b3ULL;
+    }
+    return result;
+  }
+
+  std::array<CounterSlot, Capacity> slots;
+  CounterSlot overflow;
+};
+
+struct Metrics {
+  CounterTable<maxPrograms> programs;
+  CounterTable<maxOpTypes> ops;
+  std::atomic<std::uint64_t> bytesToDevice{0};
+  std::atomic<std::uint64_t> bytesFromDevice{0};
+  std::atomic<std::uint64_t> constEvalCacheHits{0};
+  std::atomic<std::uint64_t> constEvalCacheMisses{0};
+  std::atomic<std::uint64_t> asyncSubmits{0};
+  std::atomic<std::uint64_t> asyncMaxQueueDepth{0};
+  std::atomic<std::uint64_t> asyncStalls{0};
+  std::atomic<std::uint64_t> asyncStallNs{0};
+  std::atomic<Clock::rep> windowStart{Clock::now().time_since_epoch().count()};
+
+  static Metrics &get() {
+    static Metrics metrics;
+    return metrics;
+  }
+};
+
+} // namespace
+
+void setEnabled(bool enabled) {
+  // Make sure the tables exist before any thread starts recording.
+  Metrics::get();
+  detail::enabled.store(enabled, std::memory_order_relaxed);
+}
+
+void recordProgram(std::string_view name, std::uint64_t durationNs) {
+  Metrics::get().programs.get(name).record(durationNs);
+}
+
+void recordOp(std::string_view name, std::uint64_t durationNs) {
+  Metrics::get().ops.get(name).record(durationNs);
+}
+
+void recordBytesToDevice(std::uint64_t numBytes) {
+  Metrics::get().bytesToDevice.fetch_add(numBytes, std::memory_order_relaxed);
+}
+
+void recordBytesFromDevice(std::uint64_t numBytes) {
+  Metrics::get().bytesFromDevice.fetch_add(numBytes,
+                                           std::memory_order_relaxed);
+}
+
+void recordConstEvalCacheLookup(bool hit) {
+  Metrics &metrics = Metrics::get();
+  (hit ? metrics.constEvalCacheHits : metrics.constEvalCacheMisses)
+      .fetch_add(1, std::memory_order_relaxed);
+}
+
+void recordAsyncSubmit(std::uint64_t queueDepth) {
+  Metrics &metrics = Metrics::get();
+  metrics.asyncSubmits.fetch_add(1, std::memory_order_relaxed);
+  updateMax(metrics.asyncMaxQueueDepth, queueDepth);
+}
+
+void recordAsyncStall(std::uint64_t durationNs) {
+  Metrics &metrics = Metrics::get();
+  metrics.asyncStalls.fetch_add(1, std::memory_order_relaxed);
+  metrics.asyncStallNs.fetch_add(durationNs, std::memory_order_relaxed);
+}
+
+RuntimeMetrics snapshot() {
+  Metrics &metrics = Metrics::get();
+  RuntimeMetrics result;
+  Clock::time_point windowStart(
+      Clock::duration(metrics.windowStart.load(std::memory_order_relaxed)));
+  result.windowNs = elapsedNs(windowStart);
+  result.programs = metrics.programs.snapshot();
+  result.ops = metrics.ops.snapshot();
+  result.bytesToDevice = metrics.bytesToDevice.load(std::memory_order_relaxed);
+  result.bytesFromDevice =
+      metrics.bytesFromDevice.load(std::memory_order_relaxed);
+  result.constEvalCacheHits =
+      metrics.constEvalCacheHits.load(std::memory_order_relaxed);
+  result.constEvalCacheMisses =
+      metrics.constEvalCacheMisses.load(std::memory_order_relaxed);
+  result.asyncSubmits = metrics.asyncSubmits.load(std::memory_order_relaxed);
+  result.asyncMaxQueueDepth =
+      metrics.asyncMaxQueueDepth.load(std::memory_order_relaxed);
+  result.asyncStalls = metrics.asyncStalls.load(std::memory_order_relaxed);
+  result.asyncStallNs = metrics.asyncStallNs.load(std::memory_order_relaxed);
+  return result;
+}
+
+void reset() {
+  Metrics &metrics = Metrics::get();
+  metrics.programs.reset();
+  metrics.ops.reset();
+  metrics.bytesToDevice.store(0, std::memory_order_relaxed);
+  metrics.bytesFromDevice.store(0, std::memory_order_relaxed);
+  metrics.constEvalCacheHits.store(0, std::memory_order_relaxed);
+  metrics.constEvalCacheMisses.store(0, std::memory_order_relaxed);
+  metrics.asyncSubmits.store(0, std::memory_order_relaxed);
+  metrics.asyncMaxQueueDepth.store(0, std::memory_order_relaxed);
+  metrics.asyncStalls.store(0, std::memory_order_relaxed);
+  metrics.asyncStallNs.store(0, std::memory_order_relaxed);
+  metrics.windowStart.store(Clock::now().time_since_epoch().count(),
+                            std::memory_order_relaxed);
+}
+
+} // namespace tt::runtime::metrics
@@ -0,0 +1,104 @@
+// SPDX-FileCopyrightText: (c) 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "tt/runtime/constant_pool.h"
+
+#include "tt/runtime/detail/logger.h"
+#include "ttmlir/Target/TTNN/Target.h"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+#ifdef TT_RUNTIME_ENABLE_ZSTD
+#include <zstd.h>
+#endif
+
+namespace tt::runtime {
+
+namespace {
+struct ChunkRef {
+  const ::flatbuffers::Vector<std::uint8_t> *src;
+  std::uint8_t *dst;
+  std::size_t dstSize;
+};
+} // namespace
+
+static void decompressChunk(const ChunkRef &chunk) {
+#ifdef TT_RUNTIME_ENABLE_ZSTD
+  std::size_t size = ZSTD_decompress(chunk.dst, chunk.dstSize,
+                                     chunk.src->data(), chunk.src->size());
+  LOG_ASSERT(!ZSTD_isError(size),
+             "Failed to decompress constant: ", ZSTD_getErrorName(size));
+  LOG_ASSERT(size == chunk.dstSize, "Invalid decompressed constant size");
+#else
+  LOG_FATAL("Binary has zstd compressed constants but the runtime was built "
+            "without zstd");
+#endif
+}
+
+void ConstantPool::decompress(const ::tt::target::ttnn::TTNNBinary &binary) {
+  if (!binary.constants()) {
+    return;
+  }
+
+  buffers.resize(binary.constants()->size());
+  std::vector<ChunkRef> chunks;
+  for (std::uint32_t i = 0; i < binary.constants()->size(); ++i) {
+    const auto *constant = binary.constants()->Get(i);
+    if (constant->compression() ==
+        ::tt::target::ttnn::ConstantCompression::Uncompressed) {
+      continue;
+    }
+    LOG_ASSERT(constant->compression() ==
+                   ::tt::target::ttnn::ConstantCompression::Zstd,
+               "Unsupported constant compression");
+
+    std::vector<std::uint8_t> &buffer = buffers[i];
+    buffer.resize(constant->size());
+    std::uint64_t offset = 0;
+    for (const auto *chunk : *constant->chunks()) {
+      std::uint64_t chunkSize =
+          std::min(constant->chunk_size(), constant->size() - offset);
+      chunks.push_back({chunk->data(), buffer.data() + offset, chunkSize});
+      offset += chunkSize;
+    }
+    LOG_ASSERT(offset == constant->size(), "Invalid constant chunks");
+  }
+
+  std::size_t numThreads = std::min<std::size_t>(
+      std::max(std::thread::hardware_concurrency(), 1u), chunks.size());
+  std::atomic<std::size_t> next = 0;
+  auto worker = [&]() {
+    for (std::size_t i = next++; i < chunks.size(); i = next++) {
+      decompressChunk(chunks[i]);
+    }
+  };
+  std::vector<std::thread> workers;
+  for (std::size_t i = 1; i < numThreads; ++i) {
+    workers.emplace_back(worker);
+  }
+  worker();
+  for (std::thread &thread : workers) {
+    thread.join();
+  }
+}
+
+std::span<const std::uint8_t>
+ConstantPool::getData(const ::tt::target::ttnn::TTNNBinary &binary,
+                      std::uint32_t index) {
+  std::call_once(decompressed, [&]() { decompress(binary); });
+  LOG_ASSERT(binary.constants() && index < binary.constants()->size(),
+             "Constant index out of range");
+
+  const auto *constant = binary.constants()->Get(index);
+  if (constant->compression() ==
+      ::tt::target::ttnn::ConstantCompression::Uncompressed) {
+    const auto *data = constant->chunks()->Get(0)->data();
+    return {data->data(), data->size()};
+  }
+  return buffers[index];
+}
+
+} // namespace tt::runtime
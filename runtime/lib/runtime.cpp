@@ -4,6 +4,7 @@
 
 #include "tt/runtime/runtime.h"
 #include "tt/runtime/detail/logger.h"
+#include "tt/runtime/detail/metrics.h"
 #include "tt/runtime/utils.h"
 #include "ttmlir/Target/TTNN/Target.h"
 #include "ttmlir/Version.h"
@@ -327,6 +328,23 @@ std::vector<std::byte> getTensorDataBuffer(Tensor t) {
       });
 }
 
+std::optional<TensorDataView> getTensorDataView(Tensor t) {
+  using RetType = std::optional<TensorDataView>;
+  return DISPATCH_TO_CURRENT_RUNTIME(
+      RetType,
+      [&]() -> RetType { return ::tt::runtime::ttnn::getTensorDataView(t); },
+      [&]() -> RetType {
+        return ::tt::runtime::ttmetal::getTensorDataView(t);
+      });
+}
+
+void copyTensorDataBuffer(Tensor t, void *dst) {
+  using RetType = void;
+  DISPATCH_TO_CURRENT_RUNTIME(
+      RetType, [&]() { ::tt::runtime::ttnn::copyTensorDataBuffer(t, dst); },
+      [&]() { ::tt::runtime::ttmetal::copyTensorDataBuffer(t, dst); });
+}
+
 std::vector<std::uint32_t> getTensorShape(Tensor t) {
   using RetType = std::vector<std::uint32_t>;
   return DISPATCH_TO_CURRENT_RUNTIME(
@@ -650,6 +668,21 @@ Tensor getOpOutputTensor(OpContext opContextHandle,
       });
 }
 
+std::vector<Tensor> getOpInputTensors(OpContext opContextHandle,
+                                      CallbackContext programContextHandle) {
+  using RetType = std::vector<Tensor>;
+  return DISPATCH_TO_CURRENT_RUNTIME(
+      RetType,
+      [&]() -> RetType {
+        return ::tt::runtime::ttnn::getOpInputTensors(opContextHandle,
+                                                      programContextHandle);
+      },
+      [&]() -> RetType {
+        return ::tt::runtime::ttmetal::getOpInputTensors(opContextHandle,
+                                                         programContextHandle);
+      });
+}
+
 std::vector<Tensor> submit(Device deviceHandle, Binary executableHandle,
                            std::uint32_t programIndex,
                            std::vector<Tensor> &inputs) {
@@ -666,6 +699,67 @@ std::vector<Tensor> submit(Device deviceHandle, Binary executableHandle,
       });
 }
 
+std::vector<Tensor> submitBucketed(Device deviceHandle,
+                                   Binary executableHandle,
+                                   std::string_view programName,
+                                   std::vector<Tensor> &inputs) {
+  using RetType = std::vector<Tensor>;
+  return DISPATCH_TO_CURRENT_RUNTIME(
+      RetType,
+      [&]() -> RetType {
+        return ::tt::runtime::ttnn::submitBucketed(
+            deviceHandle, executableHandle, programName, inputs);
+      },
+      [&]() -> RetType {
+        detail::fatalNotImplemented(__FUNCTION__, DeviceRuntime::TTMetal);
+      });
+}
+
+SubmitFuture submitAsync(Device deviceHandle, Binary executableHandle,
+                         std::uint32_t programIndex, std::vector<Tensor> inputs,
+                         bool readback) {
+  using RetType = SubmitFuture;
+  return DISPATCH_TO_CURRENT_RUNTIME(
+      RetType,
+      [&]() -> RetType {
+        return ::tt::runtime::ttnn::submitAsync(deviceHandle, executableHandle,
+                                                programIndex, std::move(inputs),
+                                                readback);
+      },
+      [&]() -> RetType {
+        detail::fatalNotImplemented(__FUNCTION__, DeviceRuntime::TTMetal);
+      });
+}
+
+void synchronizeAsync(Device deviceHandle) {
+  using RetType = void;
+  return DISPATCH_TO_CURRENT_RUNTIME(
+      RetType, [&]() { ::tt::runtime::ttnn::synchronizeAsync(deviceHandle); },
+      [&]() {
+        detail::fatalNotImplemented(__FUNCTION__, DeviceRuntime::TTMetal);
+      });
+}
+
+size_t getAsyncQueueDepth(Device deviceHandle) {
+  using RetType = size_t;
+  return DISPATCH_TO_CURRENT_RUNTIME(
+      RetType,
+      [&]() -> RetType {
+        return ::tt::runtime::ttnn::getAsyncQueueDepth(deviceHandle);
+      },
+      [&]() -> RetType {
+        detail::fatalNotImplemented(__FUNCTION__, DeviceRuntime::TTMetal);
+      });
+}
+
+void setMetricsEnabled(bool enabled) { metrics::setEnabled(enabled); }
+
+bool isMetricsEnabled() { return metrics::isEnabled(); }
+
+RuntimeMetrics getMetrics() { return metrics::snapshot(); }
+
+void resetMetrics() { metrics::reset(); }
+
 #undef IF_TTNN_ENABLED
 #undef IF_TTMETAL_ENABLED
 #undef DISPATCH_TO_CURRENT_RUNTIME
@@ -4,6 +4,7 @@
 
 #include "executor.h"
 #include "executor_utils.h"
+#include "program_cache.h"
 
 #include "tools/profiler/op_profiler.hpp"
 #include "tracy/Tracy.hpp"
@@ -21,6 +22,8 @@
 #include "ttmlir/Version.h"
 
 #include <cstdint>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 
@@ -49,6 +52,9 @@ private:
   void execute(const target::metal::ReturnCommand *command);
   void execute(const target::metal::EnqueueProgramCommand *command,
                const char *loc, const char *debugInfo);
+  std::shared_ptr<ProgramCache::Entry>
+  createProgram(const target::metal::EnqueueProgramCommand *command,
+                const char *debugInfo);
   void execute(const target::metal::EnqueueWriteBufferCommand *command);
   void execute(const target::metal::EnqueueReadBufferCommand *command);
   void execute(const target::metal::CreateBufferCommand *command);
@@ -260,11 +266,12 @@ void CQExecutor::execute(const target::metal::ReturnCommand *command) {
   }
 }
 
-void CQExecutor::execute(const target::metal::EnqueueProgramCommand *command,
-                         const char *loc, const char *debugInfo) {
-  ZoneScopedN("EnqueueProgramCommand");
-  tt_metal::Program program = tt_metal::CreateProgram();
-  program.set_runtime_id(getUniqueProgramRuntimeId());
+std::shared_ptr<ProgramCache::Entry>
+CQExecutor::createProgram(const target::metal::EnqueueProgramCommand *command,
+                          const char *debugInfo) {
+  auto entry = std::make_shared<ProgramCache::Entry>();
+  entry->program = tt_metal::CreateProgram();
+  tt_metal::Program &program = entry->program;
 
   for (const target::metal::KernelConfig *kernelConfig :
        *command->program()->kernels()) {
@@ -296,6 +303,7 @@ void CQExecutor::execute(const target::metal::EnqueueProgramCommand *command,
     tt_metal::SetRuntimeArgs(program, handle, coreRangeSet, rtArgsVec);
   }
 
+  entry->cbHandles.reserve(command->cbs()->size());
   for (const target::metal::CBRef *cbRef : *command->cbs()) {
     CoreRangeSet coreRangeSet =
         common::toCoreRangeSet(cbRef->buffer_ref()
@@ -304,13 +312,64 @@ void CQExecutor::execute(const target::metal::EnqueueProgramCommand *command,
                                    ->core_range_set());
     tt_metal::CircularBufferConfig config =
         createCircularBufferConfig(cbRef, deviceBuffers);
-    tt_metal::CreateCircularBuffer(program, coreRangeSet, config);
+    entry->cbHandles.push_back(
+        tt_metal::CreateCircularBuffer(program, coreRangeSet, config));
   }
 
-  tt_metal::EnqueueProgram(*cq, program, blockingCQ);
+  return entry;
+}
+
+void CQExecutor::execute(const target::metal::EnqueueProgramCommand *command,
+                         const char *loc, const char *debugInfo) {
+  ZoneScopedN("EnqueueProgramCommand");
+
+  // Kernels loaded from disk may change between executions, and binaries
+  // emitted before program hashes were introduced carry no hash.
+  bool cacheable = command->program()->program_hash() != 0 &&
+                   !debug::Env::get().loadKernelsFromDisk;
+  if (!cacheable) {
+    std::shared_ptr<ProgramCache::Entry> entry =
+        createProgram(command, debugInfo);
+    entry->program.set_runtime_id(getUniqueProgramRuntimeId());
+    tt_metal::EnqueueProgram(*cq, entry->program, blockingCQ);
+    if (debug::PerfEnv::get().enablePerfTrace) {
+      profiler::profileProgram(device, entry->program, loc);
+    }
+    return;
+  }
+
+  ProgramCache &programCache = getProgramCache(device);
+  ProgramCache::Key key = ProgramCache::getKey(command);
+  std::shared_ptr<ProgramCache::Entry> entry = programCache.find(key);
+  bool cacheHit = entry != nullptr;
+  if (!cacheHit) {
+    entry =
+        programCache.insert(std::move(key), createProgram(command, debugInfo));
+  }
+
+  // The entry may be shared with executors of concurrent submits. Rebinding
+  // the circular buffers and enqueueing both mutate the program, so they are
+  // serialized per entry.
+  std::lock_guard<std::mutex> lock(entry->mutex);
+  if (cacheHit) {
+    LOG_TRACE(logger::LogRuntimeTTMetalCommand, "Program cache hit: ",
+              command->program()->program_hash());
+    // Circular buffers refer to the buffer objects of the submit that created
+    // the program, rebind them to the buffers of this submit.
+    LOG_ASSERT(entry->cbHandles.size() == command->cbs()->size());
+    for (std::uint32_t i = 0; i < command->cbs()->size(); ++i) {
+      const target::metal::CBRef *cbRef = command->cbs()->Get(i);
+      tt_metal::UpdateDynamicCircularBufferAddress(
+          entry->program, entry->cbHandles[i],
+          *deviceBuffers.at(cbRef->buffer_ref()->global_id()));
+    }
+  }
+
+  entry->program.set_runtime_id(getUniqueProgramRuntimeId());
+  tt_metal::EnqueueProgram(*cq, entry->program, blockingCQ);
 
   if (debug::PerfEnv::get().enablePerfTrace) {
-    profiler::profileProgram(device, program, loc);
+    profiler::profileProgram(device, entry->program, loc);
   }
 }
 
@@ -426,6 +485,24 @@ void CQExecutor::execute(const target::metal::FinishCommand *) {
   tt_metal::Finish(*cq);
 }
 
+static std::mutex programCachesMutex;
+static std::unordered_map<tt_metal::IDevice *, std::unique_ptr<ProgramCache>>
+    programCaches;
+
+ProgramCache &getProgramCache(tt_metal::IDevice *device) {
+  std::lock_guard<std::mutex> lock(programCachesMutex);
+  std::unique_ptr<ProgramCache> &programCache = programCaches[device];
+  if (!programCache) {
+    programCache = std::make_unique<ProgramCache>();
+  }
+  return *programCache;
+}
+
+void clearProgramCache(tt_metal::IDevice *device) {
+  std::lock_guard<std::mutex> lock(programCachesMutex);
+  programCaches.erase(device);
+}
+
 std::vector<Tensor> executeDeviceProgram(
     tt_metal::IDevice *device, const target::metal::DeviceProgram *program,
     const std::vector<Tensor> &inputs, common::DylibManager &&dylibs) {
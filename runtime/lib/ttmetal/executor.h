@@ -8,6 +8,8 @@
 #define FMT_HEADER_ONLY
 #include "tt-metalium/mesh_device.hpp"
 
+#include "program_cache.h"
+
 #include "tt/runtime/detail/dylib.h"
 #include "tt/runtime/types.h"
 #include "ttmlir/Target/TTMetal/Target.h"
@@ -20,6 +22,13 @@ executeDeviceProgram(::tt::tt_metal::IDevice *device,
                      const std::vector<Tensor> &inputs,
                      common::DylibManager &&dylibs);
 
+// Returns the cache of compiled programs of `device`.
+ProgramCache &getProgramCache(::tt::tt_metal::IDevice *device);
+
+// Drops all cached programs of `device`, must be called before the device is
+// closed.
+void clearProgramCache(::tt::tt_metal::IDevice *device);
+
 } // namespace tt::runtime::ttmetal
 
 #endif // RUNTIME_LIB_TTMETAL_EXECUTOR_H
@@ -0,0 +1,124 @@
+// SPDX-FileCopyrightText: (c) 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef RUNTIME_LIB_TTMETAL_PROGRAM_CACHE_H
+#define RUNTIME_LIB_TTMETAL_PROGRAM_CACHE_H
+
+#define FMT_HEADER_ONLY
+#include "tt-metalium/host_api.hpp"
+
+#include "ttmlir/Target/TTMetal/Target.h"
+
+#include <cstdint>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace tt::runtime::ttmetal {
+
+// Programs compiled for a single device. Programs are keyed by the content
+// hash emitted by the compiler together with the device resources they are
+// bound to (buffer addresses and circular buffer configs), so a cached program
+// can be enqueued again as is. Only the circular buffers are rebound on reuse
+// since they refer to buffer objects that are recreated on every submit.
+//
+// The cache holds at most `capacity` programs and evicts the least recently
+// used one beyond that. Entries are handed out as shared pointers so a program
+// evicted by another thread stays alive until its current user is done. Users
+// must hold the entry's mutex while they rebind or enqueue its program.
+class ProgramCache {
+public:
+  using Key = std::pair<std::uint64_t, std::vector<std::uint64_t>>;
+
+  struct Entry {
+    ::tt::tt_metal::Program program;
+    std::vector<::tt::tt_metal::CBHandle> cbHandles;
+    std::mutex mutex;
+  };
+
+  static Key getKey(const ::tt::target::metal::EnqueueProgramCommand *command) {
+    std::vector<std::uint64_t> resources;
+    for (const ::tt::target::metal::BufferRef *buffer : *command->buffers()) {
+      resources.push_back(buffer->address());
+      resources.push_back(
+          static_cast<std::uint64_t>(buffer->desc()->memory_space()));
+    }
+    for (const ::tt::target::metal::CBRef *cb : *command->cbs()) {
+      const ::tt::target::metal::BufferRef *buffer = cb->buffer_ref();
+      const auto *config = buffer->desc()->circular_buffer_config();
+      resources.push_back(cb->port());
+      resources.push_back(buffer->address());
+      resources.push_back(
+          static_cast<std::uint64_t>(buffer->desc()->data_type()));
+      resources.push_back(config->total_size());
+      resources.push_back(config->page_size());
+      for (const ::tt::target::Dim2dRange *range : *config->core_range_set()) {
+        resources.push_back(range->loc().y());
+        resources.push_back(range->loc().x());
+        resources.push_back(range->size().y());
+        resources.push_back(range->size().x());
+      }
+    }
+    return {command->program()->program_hash(), std::move(resources)};
+  }
+
+  static constexpr std::size_t defaultCapacity = 1024;
+
+  explicit ProgramCache(std::size_t capacity = defaultCapacity)
+      : capacity(capacity) {}
+
+  std::shared_ptr<Entry> find(const Key &key) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = entries.find(key);
+    if (it == entries.end()) {
+      return nullptr;
+    }
+    recentlyUsed.splice(recentlyUsed.begin(), recentlyUsed, it->second);
+    return it->second->second;
+  }
+
+  std::shared_ptr<Entry> insert(Key key, std::shared_ptr<Entry> value) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (auto it = entries.find(key); it != entries.end()) {
+      it->second->second = value;
+      recentlyUsed.splice(recentlyUsed.begin(), recentlyUsed, it->second);
+      return value;
+    }
+
+    recentlyUsed.emplace_front(key, value);
+    entries.emplace(std::move(key), recentlyUsed.begin());
+    while (entries.size() > capacity) {
+      entries.erase(recentlyUsed.back().first);
+      recentlyUsed.pop_back();
+    }
+    return value;
+  }
+
+  void clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    entries.clear();
+    recentlyUsed.clear();
+  }
+
+  std::size_t size() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return entries.size();
+  }
+
+private:
+  using LruList = std::list<std::pair<Key, std::shared_ptr<Entry>>>;
+
+  std::mutex mutex;
+  std::size_t capacity;
+  // Most recently used first.
+  LruList recentlyUsed;
+  std::map<Key, LruList::iterator> entries;
+};
+
+} // namespace tt::runtime::ttmetal
+
+#endif // RUNTIME_LIB_TTMETAL_PROGRAM_CACHE_H
@@ -144,6 +144,9 @@ void closeMeshDevice(Device parentMesh) {
     tt_metal::detail::DumpDeviceProfileResults(ttmetalDevice);
   }
 #endif
+  for (tt_metal::IDevice *ttmetalDevice : metalMeshDevice.get_devices()) {
+    clearProgramCache(ttmetalDevice);
+  }
   metalMeshDevice.close();
 }
 
@@ -179,6 +182,9 @@ void releaseSubMeshDevice(Device subMesh) {
   LOG_ASSERT(!metalMeshDevice.is_parent_mesh(),
              "Mesh device must be a submesh");
 
+  for (tt_metal::IDevice *ttmetalDevice : metalMeshDevice.get_devices()) {
+    clearProgramCache(ttmetalDevice);
+  }
   metalMeshDevice.close();
   subMesh.handle.reset();
 }
@@ -398,6 +404,13 @@ Tensor getOpOutputTensor(OpContext opContextHandle,
   return createNullTensor();
 }
 
+std::vector<Tensor> getOpInputTensors(OpContext opContextHandle,
+                                      CallbackContext programContextHandle) {
+  // Not implemented
+  LOG_WARNING("obtaining op input tensors for metal runtime not implemented");
+  return {};
+}
+
 std::vector<std::byte> getTensorDataBuffer(Tensor tensor) {
   return std::visit(
       utils::overloaded{
@@ -415,6 +428,26 @@ std::vector<std::byte> getTensorDataBuffer(Tensor tensor) {
       tensor.as<MetalTensor>(DeviceRuntime::TTMetal));
 }
 
+std::optional<TensorDataView> getTensorDataView(Tensor tensor) {
+  return std::visit(
+      utils::overloaded{
+          [&](const TensorDesc &desc) -> std::optional<TensorDataView> {
+            return TensorDataView{tensor.data.get(),
+                                  static_cast<std::size_t>(desc.sizeBytes())};
+          },
+          [&](const DeviceBuffer &) -> std::optional<TensorDataView> {
+            return std::nullopt;
+          },
+      },
+      tensor.as<MetalTensor>(DeviceRuntime::TTMetal));
+}
+
+void copyTensorDataBuffer(Tensor tensor, void *dst) {
+  std::optional<TensorDataView> view = getTensorDataView(tensor);
+  LOG_ASSERT(view, "copyTensorDataBuffer from DeviceBuffer not supported.");
+  std::memcpy(dst, view->data, view->sizeBytes);
+}
+
 std::vector<std::uint32_t> getTensorShape(Tensor tensor) {
   return ttmetal::getTensorDesc(tensor).shape;
 }
@@ -0,0 +1,445 @@
+// SPDX-FileCopyrightText: (c) 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "tt/runtime/detail/ttnn/async_submitter.h"
+
+#include "tt/runtime/detail/logger.h"
+#include "tt/runtime/detail/metrics.h"
+#include "tt/runtime/detail/ttnn/layout_converter.h"
+#include "tt/runtime/detail/ttnn/types.h"
+#include "tt/runtime/detail/ttnn/utils.h"
+#include "ttnn/events.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+namespace tt::runtime::ttnn {
+
+using LogType = ::tt::runtime::logger::LogType;
+using MeshEvent = ::tt::tt_metal::distributed::MeshEvent;
+
+namespace {
+
+struct Request {
+  Binary executableHandle;
+  std::uint32_t programIndex;
+  std::vector<::tt::runtime::Tensor> inputs;
+  bool readback;
+  bool executed = false;
+  std::vector<::tt::runtime::Tensor> outputs;
+  // Recorded on the transfer queue after the upload and on the execute queue
+  // after the program, when transfers and execution use different queues.
+  std::optional<MeshEvent> inputsReady;
+  std::optional<MeshEvent> outputsReady;
+  std::promise<std::vector<::tt::runtime::Tensor>> promise;
+
+  Request(Binary executableHandle, std::uint32_t programIndex,
+          std::vector<::tt::runtime::Tensor> inputs, bool readback)
+      : executableHandle(executableHandle), programIndex(programIndex),
+        inputs(std::move(inputs)), readback(readback) {}
+};
+
+// A worker thread handling requests in the order they are pushed. Requests
+// pushed before destruction are still handled.
+class Stage {
+public:
+  using Handler = std::function<void(std::unique_ptr<Request>)>;
+
+  explicit Stage(Handler handler)
+      : handler(std::move(handler)), thread([this] { run(); }) {}
+
+  ~Stage() {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      stopping = true;
+    }
+    requestPushed.notify_one();
+    thread.join();
+  }
+
+  void push(std::unique_ptr<Request> request) {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      requests.push_back(std::move(request));
+    }
+    requestPushed.notify_one();
+  }
+
+private:
+  void run() {
+    while (true) {
+      std::unique_ptr<Request> request;
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        requestPushed.wait(lock,
+                           [this] { return stopping || !requests.empty(); });
+        if (requests.empty()) {
+          return;
+        }
+        request = std::move(requests.front());
+        requests.pop_front();
+      }
+      handler(std::move(request));
+    }
+  }
+
+  Handler handler;
+  std::mutex mutex;
+  std::condition_variable requestPushed;
+  std::deque<std::unique_ptr<Request>> requests;
+  bool stopping = false;
+  // Last, so that the thread starts after the other members are initialized.
+  std::thread thread;
+};
+
+} // namespace
+
+class AsyncSubmitter::Pipeline {
+public:
+  Pipeline(std::shared_ptr<::ttnn::MeshDevice> meshDevice,
+           std::size_t queueDepth)
+      : meshDevice(std::move(meshDevice)), queueDepth(queueDepth),
+        transferQueue(this->meshDevice->num_hw_cqs() > 1
+                          ? ::ttnn::QueueId(1)
+                          : ::ttnn::DefaultQueueId),
+        executeStage([this](std::unique_ptr<Request> request) {
+          execute(std::move(request));
+        }) {
+    LOG_ASSERT(queueDepth > 0, "Async queue depth must be positive");
+    // Uploads and readbacks share command queue 1, a single thread issues
+    // both so that they reach the queue in submission order.
+    if (hasTransferQueue()) {
+      transferStage.emplace([this](std::unique_ptr<Request> request) {
+        transfer(std::move(request));
+      });
+    }
+  }
+
+  // Stages are destroyed in reverse order, make sure no request is left that
+  // would be pushed to a stage that is already gone.
+  ~Pipeline() { synchronize(); }
+
+  SubmitFuture submit(Binary executableHandle, std::uint32_t programIndex,
+                      std::vector<::tt::runtime::Tensor> inputs,
+                      bool readback) {
+    std::size_t depth;
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      if (inFlight >= queueDepth) {
+        metrics::Clock::time_point start = metrics::Clock::now();
+        requestDone.wait(lock, [this] { return inFlight < queueDepth; });
+        if (metrics::isEnabled()) {
+          metrics::recordAsyncStall(metrics::elapsedNs(start));
+        }
+      }
+      depth = ++inFlight;
+    }
+    if (metrics::isEnabled()) {
+      metrics::recordAsyncSubmit(depth);
+    }
+
+    auto request = std::make_unique<Request>(executableHandle, programIndex,
+                                             std::move(inputs), readback);
+    SubmitFuture future = request->promise.get_future().share();
+    if (transferStage) {
+      transferStage->push(std::move(request));
+    } else {
+      executeStage.push(std::move(request));
+    }
+    return future;
+  }
+
+  void synchronize() {
+    std::unique_lock<std::mutex> lock(mutex);
+    requestDone.wait(lock, [this] { return inFlight == 0; });
+  }
+
+  std::size_t getQueueDepth() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return inFlight;
+  }
+
+private:
+  bool hasTransferQueue() const {
+    return transferQueue != ::ttnn::DefaultQueueId;
+  }
+
+  Device getDevice() const {
+    return Device(std::static_pointer_cast<void>(meshDevice),
+                  DeviceRuntime::TTNN);
+  }
+
+  // Uploads the inputs of requests that were not executed yet and reads back
+  // the outputs of executed ones.
+  void transfer(std::unique_ptr<Request> request) {
+    try {
+      if (request->executed) {
+        readOutputs(*request);
+      } else {
+        uploadInputs(*request);
+      }
+    } catch (...) {
+      fail(std::move(request), std::current_exception());
+      return;
+    }
+    if (request->executed) {
+      complete(std::move(request));
+    } else {
+      executeStage.push(std::move(request));
+    }
+  }
+
+  // Without a transfer queue, uploads and readbacks would be serialized with
+  // execution on the device anyway, so they run inline.
+  void execute(std::unique_ptr<Request> request) {
+    try {
+      if (!hasTransferQueue()) {
+        uploadInputs(*request);
+      }
+      runProgram(*request);
+      if (request->readback && !hasTransferQueue()) {
+        readOutputs(*request);
+      }
+    } catch (...) {
+      fail(std::move(request), std::current_exception());
+      return;
+    }
+    if (request->readback && hasTransferQueue()) {
+      transferStage->push(std::move(request));
+    } else {
+      complete(std::move(request));
+    }
+  }
+
+  // Runs in the first stage of a request. The error is thrown rather than
+  // asserted so that it reaches the caller through the future with a message
+  // telling what is wrong with the request.
+  static void validateInputs(const Request &request) {
+    const ::tt::target::ttnn::TTNNBinary &fbb =
+        *utils::getBinary(request.executableHandle);
+    if (request.programIndex >= fbb.programs()->size()) {
+      throw std::out_of_range("Invalid program index " +
+                              std::to_string(request.programIndex) +
+                              ", binary has " +
+                              std::to_string(fbb.programs()->size()) +
+                              " programs");
+    }
+    std::uint32_t numInputs =
+        fbb.programs()->Get(request.programIndex)->inputs()->size();
+    if (request.inputs.size() != numInputs) {
+      throw std::invalid_argument(
+          "Invalid input count " + std::to_string(request.inputs.size()) +
+          ", program " + std::to_string(request.programIndex) + " takes " +
+          std::to_string(numInputs) + " inputs");
+    }
+  }
+
+  // Host inputs are converted on the host and copied to the device here, any
+  // conversion that needs the device is left to runProgram.
+  void uploadInputs(Request &request) {
+    validateInputs(request);
+    bool uploaded = false;
+    for (std::uint32_t i = 0; i < request.inputs.size(); ++i) {
+      ::tt::runtime::Tensor &input = request.inputs[i];
+      const ::ttnn::Tensor &tensor =
+          input.as<TTNNTensorWrapper>(DeviceRuntime::TTNN).getTensor();
+      const LayoutDesc desiredLayout =
+          ::tt::runtime::ttnn::getLayout(request.executableHandle,
+                                         request.programIndex, i)
+              .as<LayoutDesc>(DeviceRuntime::TTNN);
+      if (!desiredLayout.isOnDevice() ||
+          !utils::isOnHost(tensor.storage_type())) {
+        continue;
+      }
+
+      LayoutDesc hostLayout(::ttnn::StorageType::HOST, desiredLayout.layout,
+                            desiredLayout.dataType, std::nullopt);
+      LayoutConverter converter(LayoutDesc::fromTensor(input), hostLayout);
+      ::ttnn::Tensor hostTensor =
+          converter.convertTensorLayout(tensor, std::nullopt);
+      ::ttnn::Tensor deviceTensor =
+          ::ttnn::to_device(hostTensor, meshDevice.get(),
+                            desiredLayout.memoryConfig, transferQueue);
+      if (metrics::isEnabled()) {
+        metrics::recordBytesToDevice(deviceTensor.padded_volume() *
+                                     deviceTensor.element_size());
+      }
+      input = utils::createRuntimeTensorFromTTNN(deviceTensor);
+      uploaded = true;
+    }
+    if (uploaded && hasTransferQueue()) {
+      request.inputsReady =
+          ::ttnn::events::record_mesh_event(meshDevice.get(), transferQueue);
+    }
+  }
+
+  void runProgram(Request &request) {
+    if (request.inputsReady) {
+      ::ttnn::events::wait_for_mesh_event(::ttnn::DefaultQueueId,
+                                          *request.inputsReady);
+    }
+    Device device = getDevice();
+    for (std::uint32_t i = 0; i < request.inputs.size(); ++i) {
+      ::tt::runtime::Tensor &input = request.inputs[i];
+      Layout layout = ::tt::runtime::ttnn::getLayout(
+          request.executableHandle, request.programIndex, i);
+      if (LayoutDesc::fromTensor(input) ==
+          layout.as<LayoutDesc>(DeviceRuntime::TTNN)) {
+        continue;
+      }
+      input = ::tt::runtime::ttnn::toLayout(input, device, layout);
+    }
+    request.outputs =
+        ::tt::runtime::ttnn::submit(device, request.executableHandle,
+                                    request.programIndex, request.inputs);
+    request.inputs.clear();
+    request.executed = true;
+    if (request.readback && hasTransferQueue()) {
+      request.outputsReady = ::ttnn::events::record_mesh_event(
+          meshDevice.get(), ::ttnn::DefaultQueueId);
+    }
+  }
+
+  void readOutputs(Request &request) {
+    if (request.outputsReady) {
+      ::ttnn::events::wait_for_mesh_event(transferQueue, *request.outputsReady);
+    }
+    for (::tt::runtime::Tensor &output : request.outputs) {
+      const TTNNTensorWrapper &tensorWrapper =
+          output.as<TTNNTensorWrapper>(DeviceRuntime::TTNN);
+      const ::ttnn::Tensor &tensor = tensorWrapper.getTensor();
+      if (utils::isOnHost(tensor.storage_type())) {
+        continue;
+      }
+      ::ttnn::Tensor hostTensor =
+          ::ttnn::from_device(tensor, /*blocking=*/true, transferQueue);
+      if (metrics::isEnabled()) {
+        metrics::recordBytesFromDevice(tensor.padded_volume() *
+                                       tensor.element_size());
+      }
+      ::tt::runtime::Tensor hostOutput =
+          utils::createRuntimeTensorFromTTNN(hostTensor);
+      if (!tensorWrapper.shouldRetain()) {
+        ::tt::runtime::ttnn::deallocateTensor(output);
+      }
+      output = hostOutput;
+    }
+  }
+
+  void complete(std::unique_ptr<Request> request) {
+    request->promise.set_value(std::move(request->outputs));
+    release();
+  }
+
+  void fail(std::unique_ptr<Request> request, std::exception_ptr error) {
+    request->promise.set_exception(error);
+    release();
+  }
+
+  void release() {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      --inFlight;
+    }
+    requestDone.notify_all();
+  }
+
+  std::shared_ptr<::ttnn::MeshDevice> meshDevice;
+  std::size_t queueDepth;
+  ::ttnn::QueueId transferQueue;
+
+  std::mutex mutex;
+  std::condition_variable requestDone;
+  std::size_t inFlight = 0;
+
+  // Last, so that the threads start after the other members are initialized.
+  Stage executeStage;
+  // Only used on devices with a second command queue.
+  std::optional<Stage> transferStage;
+};
+
+AsyncSubmitter::AsyncSubmitter() = default;
+
+AsyncSubmitter::~AsyncSubmitter() = default;
+
+AsyncSubmitter &AsyncSubmitter::get() {
+  static AsyncSubmitter asyncSubmitter;
+  return asyncSubmitter;
+}
+
+void AsyncSubmitter::setQueueDepth(const ::ttnn::MeshDevice &meshDevice,
+                                   std::size_t queueDepth) {
+  std::lock_guard<std::mutex> lock(mutex);
+  LOG_ASSERT(!pipelines.contains(&meshDevice),
+             "Async queue depth must be set before the first async submit");
+  queueDepths[&meshDevice] = queueDepth;
+}
+
+SubmitFuture
+AsyncSubmitter::submit(std::shared_ptr<::ttnn::MeshDevice> meshDevice,
+                       Binary executableHandle, std::uint32_t programIndex,
+                       std::vector<::tt::runtime::Tensor> inputs,
+                       bool readback) {
+  std::shared_ptr<Pipeline> pipeline;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    std::shared_ptr<Pipeline> &entry = pipelines[meshDevice.get()];
+    if (!entry) {
+      auto depthIt = queueDepths.find(meshDevice.get());
+      std::size_t queueDepth =
+          depthIt != queueDepths.end() ? depthIt->second : defaultQueueDepth;
+      LOG_DEBUG(LogType::LogRuntimeTTNN,
+                "Starting async submit pipeline, queue depth: ", queueDepth);
+      entry = std::make_shared<Pipeline>(meshDevice, queueDepth);
+    }
+    pipeline = entry;
+  }
+  // Submit may block on a full queue, which must not block other devices.
+  return pipeline->submit(executableHandle, programIndex, std::move(inputs),
+                          readback);
+}
+
+void AsyncSubmitter::synchronize(const ::ttnn::MeshDevice &meshDevice) {
+  std::shared_ptr<Pipeline> pipeline;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = pipelines.find(&meshDevice);
+    if (it == pipelines.end()) {
+      return;
+    }
+    pipeline = it->second;
+  }
+  pipeline->synchronize();
+}
+
+std::size_t
+AsyncSubmitter::getQueueDepth(const ::ttnn::MeshDevice &meshDevice) {
+  std::lock_guard<std::mutex> lock(mutex);
+  auto it = pipelines.find(&meshDevice);
+  return it != pipelines.end() ? it->second->getQueueDepth() : 0;
+}
+
+void AsyncSubmitter::release(const ::ttnn::MeshDevice &meshDevice) {
+  std::shared_ptr<Pipeline> pipeline;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    queueDepths.erase(&meshDevice);
+    auto it = pipelines.find(&meshDevice);
+    if (it == pipelines.end()) {
+      return;
+    }
+    pipeline = std::move(it->second);
+    pipelines.erase(it);
+  }
+  // Drains and joins the pipeline threads outside of the lock.
+  pipeline.reset();
+}
+
+} // namespace tt::runtime::ttnn
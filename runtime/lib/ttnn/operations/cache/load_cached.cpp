@@ -5,6 +5,7 @@
 #include "operations/cache/load_cached.h"
 
 #include "tt/runtime/detail/logger.h"
+#include "tt/runtime/detail/metrics.h"
 #include "tt/runtime/detail/ttnn/program_executor.h"
 #include "tt/runtime/detail/ttnn/types.h"
 #include "tt/runtime/detail/ttnn/utils.h"
@@ -17,14 +18,35 @@ namespace tt::runtime::ttnn::operations::cache {
 
 using LogType = ::tt::runtime::logger::LogType;
 
+// Programs specialized for shape buckets of the same function share their
+// const-eval funcs, so they also share the cache entries of the first of them.
+static size_t getCacheProgramIndex(const Binary &executableHandle,
+                                   size_t programIndex) {
+  const auto *programs = utils::getBinary(executableHandle)->programs();
+  const auto *shapeBucket = programs->Get(programIndex)->shape_bucket();
+  if (!shapeBucket) {
+    return programIndex;
+  }
+
+  for (size_t i = 0; i < programs->size(); ++i) {
+    const auto *otherBucket = programs->Get(i)->shape_bucket();
+    if (otherBucket && otherBucket->name()->string_view() ==
+                           shapeBucket->name()->string_view()) {
+      return i;
+    }
+  }
+  return programIndex;
+}
+
 void run(const ::tt::target::ttnn::LoadCachedOp *op, ProgramContext &context) {
   std::shared_ptr<TensorCache> cache = context.getCache();
   LOG_ASSERT(cache, "Cache must be enabled to support const-eval ops.");
 
   // Get the device ID from the parent mesh
   const int deviceId = context.getMeshDevice().id();
-  const std::string cacheKey =
-      generateCacheOuterKey(deviceId, context.getProgramIndex());
+  const std::string cacheKey = generateCacheOuterKey(
+      deviceId, getCacheProgramIndex(context.getExecutableHandle(),
+                                     context.getProgramIndex()));
   const std::string &constEvalFuncname = op->callee_name()->str();
 
   std::vector<uint64_t> inputVersions;
@@ -39,6 +61,9 @@ void run(const ::tt::target::ttnn::LoadCachedOp *op, ProgramContext &context) {
   // Get the cached tensors, which will be empty if cache is invalid
   const std::vector<Tensor> *cachedOutputs =
       cache->getAll(cacheKey, constEvalFuncname, inputVersions);
+  if (metrics::isEnabled()) {
+    metrics::recordConstEvalCacheLookup(cachedOutputs != nullptr);
+  }
 
   if (cachedOutputs) {
     LOG_DEBUG("Cache hit for function: ", constEvalFuncname.c_str());
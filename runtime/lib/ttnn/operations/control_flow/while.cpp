@@ -0,0 +1,94 @@
+// SPDX-FileCopyrightText: (c) 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "operations/control_flow/while.h"
+
+#include "tt/runtime/detail/logger.h"
+#include "tt/runtime/detail/ttnn/program_executor.h"
+#include "tt/runtime/detail/ttnn/types.h"
+#include "tt/runtime/detail/ttnn/utils.h"
+#include "tt/runtime/types.h"
+
+#include <vector>
+
+namespace tt::runtime::ttnn::operations::control_flow {
+
+// Reads the first element of a host tensor, whatever its host storage.
+template <typename T>
+static T readFirstElement(const ::ttnn::Tensor &tensor) {
+  std::vector<T> data = tensor.to_vector<T>();
+  LOG_ASSERT(!data.empty(), "While condition tensor is empty");
+  return data.front();
+}
+
+// The condition is a single element tensor. Only that element is read back to
+// the host, the loop-carried tensors stay on device.
+static bool evaluateCondition(const ::ttnn::Tensor &condition) {
+  ::ttnn::Tensor hostCondition =
+      utils::isOnDevice(condition.storage_type())
+          ? ::ttnn::from_device(condition)
+          : condition;
+
+  switch (hostCondition.dtype()) {
+  case ::ttnn::DataType::FLOAT32:
+    return readFirstElement<float>(hostCondition) != 0.0f;
+  case ::ttnn::DataType::BFLOAT16:
+    return readFirstElement<bfloat16>(hostCondition).to_float() != 0.0f;
+  case ::ttnn::DataType::INT32:
+    return readFirstElement<int32_t>(hostCondition) != 0;
+  case ::ttnn::DataType::UINT32:
+    return readFirstElement<uint32_t>(hostCondition) != 0;
+  case ::ttnn::DataType::UINT16:
+    return readFirstElement<uint16_t>(hostCondition) != 0;
+  case ::ttnn::DataType::UINT8:
+    return readFirstElement<uint8_t>(hostCondition) != 0;
+  default:
+    LOG_FATAL("Unsupported while condition data type");
+  }
+}
+
+void run(const ::tt::target::ttnn::WhileOp *op, ProgramContext &context) {
+  std::vector<::tt::runtime::Tensor> loopTensors;
+  loopTensors.reserve(op->inputs()->size());
+  for (const auto *input : *op->inputs()) {
+    loopTensors.emplace_back(
+        context.getTensorPool().getRuntimeTensorAndValidate(input));
+  }
+
+  const size_t condProgramIndex = op->cond_program_idx();
+  const size_t bodyProgramIndex = op->body_program_idx();
+  size_t numIterations = 0;
+  while (true) {
+    ProgramExecutor condExec(context.getExecutableHandle(), loopTensors,
+                             context.getMeshDevicePtr(), condProgramIndex);
+    condExec.execute();
+    std::vector<::tt::runtime::Tensor> condOutputs =
+        condExec.gatherOutputTensors();
+    LOG_ASSERT(condOutputs.size() == 1,
+               "While condition must return a single tensor");
+    if (!evaluateCondition(
+            condOutputs[0].as<::ttnn::Tensor>(DeviceRuntime::TTNN))) {
+      break;
+    }
+
+    // Loop-carried tensors of the previous iteration are released as soon as
+    // they are replaced, so their device memory can be reused by the body.
+    ProgramExecutor bodyExec(context.getExecutableHandle(), loopTensors,
+                             context.getMeshDevicePtr(), bodyProgramIndex);
+    bodyExec.execute();
+    loopTensors = bodyExec.gatherOutputTensors();
+    numIterations++;
+  }
+  LOG_DEBUG("while loop ", op->body_name()->c_str(), " finished after ",
+            numIterations, " iterations");
+
+  LOG_ASSERT(loopTensors.size() == op->outputs()->size(),
+             "Number of loop-carried tensors does not match the outputs");
+  for (size_t i = 0; i < loopTensors.size(); ++i) {
+    auto &output = loopTensors[i].as<::ttnn::Tensor>(DeviceRuntime::TTNN);
+    context.getTensorPool().insertTTNNTensorAndValidate(op->outputs()->Get(i),
+                                                        output);
+  }
+}
+} // namespace tt::runtime::ttnn::operations::control_flow
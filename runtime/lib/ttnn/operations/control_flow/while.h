@@ -0,0 +1,17 @@
+// SPDX-FileCopyrightText: (c) 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef TT_RUNTIME_TTNN_OPERATIONS_CONTROL_FLOW_WHILE_H
+#define TT_RUNTIME_TTNN_OPERATIONS_CONTROL_FLOW_WHILE_H
+
+#include "tt/runtime/detail/ttnn/types.h"
+#include "ttmlir/Target/TTNN/Target.h"
+
+namespace tt::runtime::ttnn::operations::control_flow {
+
+void run(const ::tt::target::ttnn::WhileOp *op, ProgramContext &context);
+
+} // namespace tt::runtime::ttnn::operations::control_flow
+
+#endif // TT_RUNTIME_TTNN_OPERATIONS_CONTROL_FLOW_WHILE_H
@@ -4,6 +4,7 @@
 
 #include "operations/creation/constant.h"
 
+#include "tt/runtime/constant_pool.h"
 #include "tt/runtime/detail/logger.h"
 
 #include "tt/runtime/detail/ttnn/operations/utils.h"
@@ -22,7 +23,19 @@ void run(const ::tt::target::ttnn::ConstantOp *op, ProgramContext &context) {
   ::ttnn::DataType ttnnDtype =
       ::tt::runtime::ttnn::utils::toTTNNDataType(targetDtype);
 
-  ::ttnn::Tensor out = utils::toTTNNTensor(op->data(), shape, ttnnDtype);
+  // Binaries store constant payloads once in TTNNBinary.constants, inline
+  // payloads are kept for binaries from older compilers.
+  std::span<const std::uint8_t> data;
+  if (op->constant_index() >= 0) {
+    Binary &executableHandle = context.getExecutableHandle();
+    data = executableHandle.getConstantPool()->getData(
+        *::tt::runtime::ttnn::utils::getBinary(executableHandle),
+        op->constant_index());
+  } else {
+    data = {op->data()->data(), op->data()->size()};
+  }
+
+  ::ttnn::Tensor out = utils::toTTNNTensor(data, shape, ttnnDtype);
 
   context.getTensorPool().insertTTNNTensorAndValidate(op->out(), out);
 }
@@ -12,7 +12,9 @@ void run(const ::tt::target::ttnn::DeallocateOp *op, ProgramContext &context) {
       tensorPool.getTTNNTensorWrapperAndValidate(op->in());
   ::ttnn::Tensor &ttnnTensor = tensorWrapper.getTensor();
 
-  if (!tensorWrapper.shouldRetain()) {
+  // While a trace is captured the buffer has to outlive the program, the
+  // tensor pool keeps it until the trace is released.
+  if (!tensorWrapper.shouldRetain() && !tensorPool.isCapturingTrace()) {
     ::ttnn::deallocate(ttnnTensor, op->force());
   }
 
@@ -46,8 +46,14 @@ static void runEltwiseUnaryWithFastAndApproximateModeOp(
                  outputMemoryConfig.has_value(),
              "Memory config must exist for device tensors");
 
+  bool fastAndApproximateMode = false;
+  if (const auto *params =
+          op->params_as_EltwiseOpWithFastAndApproximateModeParams()) {
+    fastAndApproximateMode = params->fast_and_approximate_mode();
+  }
+
   ::ttnn::Tensor out =
-      ttnnOp(in, /*parameter=*/false, outputMemoryConfig, std::nullopt);
+      ttnnOp(in, fastAndApproximateMode, outputMemoryConfig, std::nullopt);
 
   tensorPool.insertTTNNTensorAndValidate(op->out(), out);
 }
@@ -191,6 +197,14 @@ void run(const ::tt::target::ttnn::EltwiseUnaryOp *op,
     runEltwiseUnaryOp(op, tensorPool, ::ttnn::bitwise_not);
     break;
   }
+  case ::tt::target::ttnn::EltwiseUnaryOpType::Silu: {
+    runEltwiseUnaryOp(op, tensorPool, ::ttnn::silu);
+    break;
+  }
+  case ::tt::target::ttnn::EltwiseUnaryOpType::Erf: {
+    runEltwiseUnaryWithFastAndApproximateModeOp(op, tensorPool, ::ttnn::erf);
+    break;
+  }
   }
 }
 
@@ -0,0 +1,38 @@
+// SPDX-FileCopyrightText: (c) 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "operations/kv_cache/paged_fill_cache.h"
+
+#include "tt/runtime/detail/logger.h"
+#include "tt/runtime/detail/ttnn/utils.h"
+
+namespace tt::runtime::ttnn::operations::kv_cache {
+void run(const ::tt::target::ttnn::PagedFillCacheOp *op,
+         ProgramContext &context) {
+  ProgramTensorPool &tensorPool = context.getTensorPool();
+
+  const ::ttnn::Tensor &cache =
+      tensorPool.getTTNNTensorAndValidate(op->cache());
+  const ::ttnn::Tensor &input =
+      tensorPool.getTTNNTensorAndValidate(op->input());
+  const ::ttnn::Tensor &pageTable =
+      tensorPool.getTTNNTensorAndValidate(op->page_table());
+  const ::ttnn::Tensor &batchIdx =
+      tensorPool.getTTNNTensorAndValidate(op->batch_idx());
+
+  // ttnn::experimental::paged_fill_cache takes the sequence to fill as a
+  // scalar, read it from the batch index tensor.
+  const ::ttnn::Tensor batchIdxOnHost =
+      ::tt::runtime::ttnn::utils::isOnDevice(batchIdx.storage_type())
+          ? ::ttnn::from_device(batchIdx)
+          : batchIdx;
+  std::vector<int32_t> batchIdxData = batchIdxOnHost.to_vector<int32_t>();
+  LOG_ASSERT(batchIdxData.size() == 1 && batchIdxData[0] >= 0,
+             "Batch index of paged fill cache must be a single non-negative "
+             "value");
+
+  ::ttnn::experimental::paged_fill_cache(
+      cache, input, pageTable, static_cast<uint32_t>(batchIdxData[0]));
+}
+} // namespace tt::runtime::ttnn::operations::kv_cache
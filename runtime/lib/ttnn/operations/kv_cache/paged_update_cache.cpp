@@ -0,0 +1,29 @@
+// SPDX-FileCopyrightText: (c) 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "operations/kv_cache/paged_update_cache.h"
+
+#include "tt/runtime/detail/logger.h"
+
+namespace tt::runtime::ttnn::operations::kv_cache {
+void run(const ::tt::target::ttnn::PagedUpdateCacheOp *op,
+         ProgramContext &context) {
+  ProgramTensorPool &tensorPool = context.getTensorPool();
+
+  const ::ttnn::Tensor &cache =
+      tensorPool.getTTNNTensorAndValidate(op->cache());
+  const ::ttnn::Tensor &input =
+      tensorPool.getTTNNTensorAndValidate(op->input());
+  const ::ttnn::Tensor &updateIndex =
+      tensorPool.getTTNNTensorAndValidate(op->update_index());
+  const ::ttnn::Tensor &pageTable =
+      tensorPool.getTTNNTensorAndValidate(op->page_table());
+
+  // Positions are read by the kernel from the update index tensor, so the
+  // host side list of positions is left empty.
+  ::ttnn::experimental::paged_update_cache(
+      cache, input, /*update_idxs=*/{}, updateIndex,
+      /*share_cache=*/std::nullopt, pageTable);
+}
+} // namespace tt::runtime::ttnn::operations::kv_cache
@@ -4,6 +4,7 @@
 
 #include "operations/layout/from_device.h"
 #include "tt/runtime/detail/logger.h"
+#include "tt/runtime/detail/metrics.h"
 #include "tt/runtime/detail/ttnn/ttnn.h"
 
 #include "tt/runtime/detail/ttnn/operations/utils.h"
@@ -17,6 +18,10 @@ void run(const ::tt::target::ttnn::FromDeviceOp *op, ProgramContext &context) {
                "Calling ttnn::from_device on a host tensor");
 
   ::ttnn::Tensor out = ::ttnn::from_device(inputTensor);
+  if (::tt::runtime::metrics::isEnabled()) {
+    ::tt::runtime::metrics::recordBytesFromDevice(inputTensor.padded_volume() *
+                                                  inputTensor.element_size());
+  }
 
   tensorPool.insertTTNNTensorAndValidate(op->out(), out);
 }
@@ -4,6 +4,7 @@
 
 #include "operations/layout/to_device.h"
 #include "tt/runtime/detail/logger.h"
+#include "tt/runtime/detail/metrics.h"
 #include "tt/runtime/detail/ttnn/ttnn.h"
 
 #include "tt/runtime/detail/ttnn/operations/utils.h"
@@ -26,6 +27,10 @@ void run(const ::tt::target::ttnn::ToDeviceOp *op, ProgramContext &context) {
 
   ::ttnn::Tensor out =
       ::ttnn::to_device(inputTensor, &targetDevice, memoryConfig);
+  if (::tt::runtime::metrics::isEnabled()) {
+    ::tt::runtime::metrics::recordBytesToDevice(inputTensor.padded_volume() *
+                                                inputTensor.element_size());
+  }
 
   tensorPool.insertTTNNTensorAndValidate(op->out(), out);
 }
@@ -0,0 +1,40 @@
+// SPDX-FileCopyrightText: (c) 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "operations/normalization/rms_norm.h"
+#include "tt/runtime/detail/logger.h"
+#include "tt/runtime/detail/ttnn/ttnn.h"
+
+#include "tt/runtime/detail/ttnn/operations/utils.h"
+#include "tt/runtime/detail/ttnn/utils.h"
+
+namespace tt::runtime::ttnn::operations::normalization {
+void run(const ::tt::target::ttnn::RMSNormOp *op, ProgramContext &context) {
+  ProgramTensorPool &tensorPool = context.getTensorPool();
+  const ::ttnn::Tensor &in = tensorPool.getTTNNTensorAndValidate(op->in());
+
+  std::optional<::ttnn::Tensor> weight = std::nullopt;
+  if (op->weight()) {
+    weight = tensorPool.getTTNNTensorAndValidate(op->weight());
+  }
+
+  std::optional<::ttnn::Tensor> bias = std::nullopt;
+  if (op->bias()) {
+    bias = tensorPool.getTTNNTensorAndValidate(op->bias());
+  }
+
+  std::optional<::ttnn::MemoryConfig> outputMemoryConfig =
+      ::tt::runtime::ttnn::utils::createMemoryConfigIfNeeded(
+          ::tt::runtime::ttnn::utils::getTensorRefMemoryConfig(op->out()));
+  LOG_ASSERT(::tt::runtime::ttnn::utils::inSystemMemory(op->out()) ||
+                 outputMemoryConfig.has_value(),
+             "Memory config must exist for device tensors");
+
+  ::ttnn::Tensor out = ::ttnn::rms_norm(in, op->epsilon(), weight, bias,
+                                        /*residual_input_tensor=*/std::nullopt,
+                                        outputMemoryConfig);
+
+  tensorPool.insertTTNNTensorAndValidate(op->out(), out);
+}
+} // namespace tt::runtime::ttnn::operations::normalization
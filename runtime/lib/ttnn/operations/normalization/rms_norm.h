@@ -0,0 +1,15 @@
+// SPDX-FileCopyrightText: (c) 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef RUNTIME_LIB_TTNN_OPERATIONS_NORMALIZATION_RMS_NORM_H
+#define RUNTIME_LIB_TTNN_OPERATIONS_NORMALIZATION_RMS_NORM_H
+
+#include "tt/runtime/detail/ttnn/types.h"
+#include "ttmlir/Target/TTNN/program_generated.h"
+
+namespace tt::runtime::ttnn::operations::normalization {
+void run(const ::tt::target::ttnn::RMSNormOp *op, ProgramContext &context);
+} // namespace tt::runtime::ttnn::operations::normalization
+
+#endif
@@ -0,0 +1,45 @@
+// SPDX-FileCopyrightText: (c) 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "operations/transformer/paged_sdpa_decode.h"
+#include "tt/runtime/detail/logger.h"
+#include "tt/runtime/detail/ttnn/ttnn.h"
+
+#include "tt/runtime/detail/ttnn/operations/utils.h"
+#include "tt/runtime/detail/ttnn/utils.h"
+
+namespace tt::runtime::ttnn::operations::transformer {
+void run(const ::tt::target::ttnn::PagedScaledDotProductAttentionDecodeOp *op,
+         ProgramContext &context) {
+  ProgramTensorPool &tensorPool = context.getTensorPool();
+  const ::ttnn::Tensor &query =
+      tensorPool.getTTNNTensorAndValidate(op->query());
+  const ::ttnn::Tensor &key = tensorPool.getTTNNTensorAndValidate(op->key());
+  const ::ttnn::Tensor &value =
+      tensorPool.getTTNNTensorAndValidate(op->value());
+  const ::ttnn::Tensor &pageTable =
+      tensorPool.getTTNNTensorAndValidate(op->page_table());
+  const ::ttnn::Tensor &curPos =
+      tensorPool.getTTNNTensorAndValidate(op->cur_pos());
+
+  std::optional<float> scale = std::nullopt;
+  if (op->scale()) {
+    scale = *op->scale();
+  }
+
+  std::optional<::ttnn::MemoryConfig> outputMemoryConfig =
+      ::tt::runtime::ttnn::utils::createMemoryConfigIfNeeded(
+          ::tt::runtime::ttnn::utils::getTensorRefMemoryConfig(op->out()));
+  LOG_ASSERT(::tt::runtime::ttnn::utils::inSystemMemory(op->out()) ||
+                 outputMemoryConfig.has_value(),
+             "Memory config must exist for device tensors");
+
+  ::ttnn::Tensor out =
+      ::ttnn::transformer::paged_scaled_dot_product_attention_decode(
+          query, key, value, pageTable, /*is_causal=*/true,
+          /*attn_mask=*/std::nullopt, curPos, scale, outputMemoryConfig);
+
+  tensorPool.insertTTNNTensorAndValidate(op->out(), out);
+}
+} // namespace tt::runtime::ttnn::operations::transformer
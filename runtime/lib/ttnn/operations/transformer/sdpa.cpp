@@ -0,0 +1,45 @@
+// SPDX-FileCopyrightText: (c) 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "operations/transformer/sdpa.h"
+#include "tt/runtime/detail/logger.h"
+#include "tt/runtime/detail/ttnn/ttnn.h"
+
+#include "tt/runtime/detail/ttnn/operations/utils.h"
+#include "tt/runtime/detail/ttnn/utils.h"
+
+namespace tt::runtime::ttnn::operations::transformer {
+void run(const ::tt::target::ttnn::ScaledDotProductAttentionOp *op,
+         ProgramContext &context) {
+  ProgramTensorPool &tensorPool = context.getTensorPool();
+  const ::ttnn::Tensor &query =
+      tensorPool.getTTNNTensorAndValidate(op->query());
+  const ::ttnn::Tensor &key = tensorPool.getTTNNTensorAndValidate(op->key());
+  const ::ttnn::Tensor &value =
+      tensorPool.getTTNNTensorAndValidate(op->value());
+
+  std::optional<::ttnn::Tensor> attentionMask = std::nullopt;
+  if (op->attention_mask()) {
+    attentionMask = tensorPool.getTTNNTensorAndValidate(op->attention_mask());
+  }
+
+  std::optional<float> scale = std::nullopt;
+  if (op->scale()) {
+    scale = *op->scale();
+  }
+
+  std::optional<::ttnn::MemoryConfig> outputMemoryConfig =
+      ::tt::runtime::ttnn::utils::createMemoryConfigIfNeeded(
+          ::tt::runtime::ttnn::utils::getTensorRefMemoryConfig(op->out()));
+  LOG_ASSERT(::tt::runtime::ttnn::utils::inSystemMemory(op->out()) ||
+                 outputMemoryConfig.has_value(),
+             "Memory config must exist for device tensors");
+
+  ::ttnn::Tensor out = ::ttnn::transformer::scaled_dot_product_attention(
+      query, key, value, attentionMask, op->is_causal(), scale,
+      outputMemoryConfig);
+
+  tensorPool.insertTTNNTensorAndValidate(op->out(), out);
+}
+} // namespace tt::runtime::ttnn::operations::transformer
@@ -344,25 +344,25 @@ createConv2dConfig(const ::tt::target::ttnn::Conv2dConfig *config) {
 
 template <typename T>
 static ::ttnn::Tensor
-toTTNNTensorImpl(const ::flatbuffers::Vector<uint8_t> *data,
+toTTNNTensorImpl(std::span<const std::uint8_t> data,
                  const ::ttnn::Shape &shape, const ::ttnn::DataType &dataType) {
   std::uint64_t numElements = shape.volume();
   size_t elementSize = sizeof(T);
-  LOG_ASSERT(numElements * elementSize == data->size(), "Invalid data size");
+  LOG_ASSERT(numElements * elementSize == data.size(), "Invalid data size");
   std::vector<T> dataVec(numElements);
   for (size_t i = 0; i < numElements; i++) {
     if constexpr (std::is_same_v<T, bfloat16>) {
       dataVec[i] = bfloat16(
-          ::flatbuffers::IndirectHelper<uint16_t>::Read(data->data(), i));
+          ::flatbuffers::IndirectHelper<uint16_t>::Read(data.data(), i));
     } else {
-      dataVec[i] = ::flatbuffers::IndirectHelper<T>::Read(data->data(), i);
+      dataVec[i] = ::flatbuffers::IndirectHelper<T>::Read(data.data(), i);
     }
   }
   return ::tt::runtime::ttnn::utils::createTTNNTensor<T>(dataVec.data(), shape,
                                                          dataType);
 }
 
-::ttnn::Tensor toTTNNTensor(const ::flatbuffers::Vector<uint8_t> *data,
+::ttnn::Tensor toTTNNTensor(std::span<const std::uint8_t> data,
                             const ::ttnn::Shape &shape,
                             const ::ttnn::DataType &dataType) {
   switch (dataType) {
@@ -10,6 +10,7 @@
 #include "operations/ccl/mesh_shard.h"
 #include "operations/ccl/reduce_scatter.h"
 #include "operations/context/get_device.h"
+#include "operations/control_flow/while.h"
 #include "operations/conv/conv2d.h"
 #include "operations/conv/conv_transpose2d.h"
 #include "operations/conv/prepare_conv2d_weights.h"
@@ -37,6 +38,8 @@
 #include "operations/embedding/embedding.h"
 #include "operations/embedding/embedding_backward.h"
 #include "operations/kv_cache/fill_cache.h"
+#include "operations/kv_cache/paged_fill_cache.h"
+#include "operations/kv_cache/paged_update_cache.h"
 #include "operations/kv_cache/update_cache.h"
 #include "operations/layout/from_device.h"
 #include "operations/layout/to_device.h"
@@ -46,13 +49,18 @@
 #include "operations/layout/typecast.h"
 #include "operations/matmul/matmul.h"
 #include "operations/moreh/moreh_cumsum.h"
+#include "operations/normalization/layer_norm.h"
+#include "operations/normalization/rms_norm.h"
 #include "operations/normalization/softmax.h"
 #include "operations/pool/pool2d.h"
 #include "operations/pool/upsample.h"
 #include "operations/reduction/argmax.h"
 #include "operations/reduction/prod.h"
 #include "operations/reduction/reduction.h"
+#include "operations/transformer/paged_sdpa_decode.h"
+#include "operations/transformer/sdpa.h"
 #include "tt/runtime/detail/debug.h"
+#include "tt/runtime/detail/metrics.h"
 #include "tt/runtime/detail/ttnn/types.h"
 #include "tt/runtime/utils.h"
 
@@ -130,17 +138,35 @@ void ProgramExecutor::runCallback(
 void ProgramExecutor::execute() {
   LOG_DEBUG(LogType::LogRuntimeTTNN,
             "Starting execution of program: ", program->name()->c_str());
+  // Sampled once, so toggling metrics mid program does not record partial
+  // programs.
+  const bool collectMetrics = metrics::isEnabled();
+  metrics::Clock::time_point programStart;
+  if (collectMetrics) {
+    programStart = metrics::Clock::now();
+  }
   for (const ::tt::target::ttnn::Operation *op : *program->operations()) {
     LOG_DEBUG(LogType::LogRuntimeTTNN,
               "Executing operation: ", op->debug_info()->c_str());
     tracyLogOpLocation(op);
     runCallback(debug::Hooks::get().getPreOperatorCallback(), executableHandle,
                 op, context.get());
-    runOperation(op);
+    if (collectMetrics) {
+      metrics::Clock::time_point opStart = metrics::Clock::now();
+      runOperation(op);
+      metrics::recordOp(::tt::target::ttnn::EnumNameOpType(op->type_type()),
+                        metrics::elapsedNs(opStart));
+    } else {
+      runOperation(op);
+    }
     runCallback(debug::Hooks::get().getPostOperatorCallback(), executableHandle,
                 op, context.get());
     dumpPerfCountersIfNeeded(context->getMeshDevice());
   }
+  if (collectMetrics) {
+    metrics::recordProgram(program->name()->string_view(),
+                           metrics::elapsedNs(programStart));
+  }
   LOG_DEBUG(LogType::LogRuntimeTTNN,
             "Finished execution of program: ", program->name()->c_str());
 }
@@ -254,6 +280,14 @@ void ProgramExecutor::runOperation(const ::tt::target::ttnn::Operation *op) {
     return operations::normalization::run(op->type_as_SoftmaxOp(),
                                           getContext());
   }
+  case ::tt::target::ttnn::OpType::RMSNormOp: {
+    return operations::normalization::run(op->type_as_RMSNormOp(),
+                                          getContext());
+  }
+  case ::tt::target::ttnn::OpType::LayerNormOp: {
+    return operations::normalization::run(op->type_as_LayerNormOp(),
+                                          getContext());
+  }
   case ::tt::target::ttnn::OpType::TransposeOp: {
     return operations::data_movement::run(op->type_as_TransposeOp(),
                                           getContext());
@@ -320,6 +354,22 @@ void ProgramExecutor::runOperation(const ::tt::target::ttnn::Operation *op) {
   case ::tt::target::ttnn::OpType::FillCacheOp: {
     return operations::kv_cache::run(op->type_as_FillCacheOp(), getContext());
   }
+  case ::tt::target::ttnn::OpType::PagedUpdateCacheOp: {
+    return operations::kv_cache::run(op->type_as_PagedUpdateCacheOp(),
+                                     getContext());
+  }
+  case ::tt::target::ttnn::OpType::PagedFillCacheOp: {
+    return operations::kv_cache::run(op->type_as_PagedFillCacheOp(),
+                                     getContext());
+  }
+  case ::tt::target::ttnn::OpType::PagedScaledDotProductAttentionDecodeOp: {
+    return operations::transformer::run(
+        op->type_as_PagedScaledDotProductAttentionDecodeOp(), getContext());
+  }
+  case ::tt::target::ttnn::OpType::ScaledDotProductAttentionOp: {
+    return operations::transformer::run(
+        op->type_as_ScaledDotProductAttentionOp(), getContext());
+  }
   case ::tt::target::ttnn::OpType::UpsampleOp: {
     return operations::pool::run(op->type_as_UpsampleOp(), getContext());
   }
@@ -332,6 +382,9 @@ void ProgramExecutor::runOperation(const ::tt::target::ttnn::Operation *op) {
   case ::tt::target::ttnn::OpType::LoadCachedOp: {
     return operations::cache::run(op->type_as_LoadCachedOp(), getContext());
   }
+  case ::tt::target::ttnn::OpType::WhileOp: {
+    return operations::control_flow::run(op->type_as_WhileOp(), getContext());
+  }
   default: {
     LOG_FATAL("Unsupported operation type: ",
               ::tt::target::ttnn::EnumNameOpType(op->type_type()));
@@ -7,10 +7,14 @@
 #include "tt/runtime/detail/common.h"
 #include "tt/runtime/detail/debug.h"
 #include "tt/runtime/detail/dylib.h"
+#include "tt/runtime/detail/host_conversion.h"
 #include "tt/runtime/detail/logger.h"
+#include "tt/runtime/detail/metrics.h"
+#include "tt/runtime/detail/ttnn/async_submitter.h"
 #include "tt/runtime/detail/ttnn/debug_apis.h"
 #include "tt/runtime/detail/ttnn/layout_converter.h"
 #include "tt/runtime/detail/ttnn/program_executor.h"
+#include "tt/runtime/detail/ttnn/trace_cache.h"
 #include "tt/runtime/detail/ttnn/ttnn.h"
 #include "tt/runtime/detail/ttnn/types.h"
 #include "tt/runtime/detail/ttnn/utils.h"
@@ -19,6 +23,7 @@
 #include "ttmlir/Target/TTNN/Target.h"
 #include "ttmlir/Target/TTNN/program_generated.h"
 #include "ttmlir/Version.h"
+#include "ttnn/operations/data_movement/slice/slice.hpp"
 #include "ttnn/tensor/types.hpp"
 
 namespace tt::runtime::ttnn {
@@ -89,6 +94,10 @@ static ::tt::runtime::Tensor toHostSingleTensor(::tt::runtime::Tensor tensor,
   bool shouldRetain = tensorWrapper.shouldRetain();
 
   ::ttnn::Tensor hostTensor = ::ttnn::from_device(deviceTensor);
+  if (metrics::isEnabled()) {
+    metrics::recordBytesFromDevice(deviceTensor.padded_volume() *
+                                   deviceTensor.element_size());
+  }
 
   if (untilize) {
     hostTensor = ::ttnn::to_layout(hostTensor, ::ttnn::Layout::ROW_MAJOR,
@@ -214,80 +223,233 @@ tt::target::DataType getTensorDataType(::tt::runtime::Tensor tensor) {
   return utils::fromTTNNDataType(nnTensor.dtype());
 }
 
-std::vector<std::byte> getTensorDataBuffer(::tt::runtime::Tensor tensor) {
+// Returns the buffer backing `ttnnTensor` if it is stored in a single host
+// buffer.
+static std::optional<::tt::tt_metal::HostBuffer>
+getSingleHostBuffer(const ::ttnn::Tensor &ttnnTensor) {
+  return std::visit(
+      ::tt::runtime::utils::overloaded{
+          [](const ::tt::tt_metal::HostStorage &storage)
+              -> std::optional<::tt::tt_metal::HostBuffer> {
+            return storage.buffer;
+          },
+          [](const ::tt::tt_metal::MultiDeviceHostStorage &storage)
+              -> std::optional<::tt::tt_metal::HostBuffer> {
+            if (storage.num_buffers() != 1) {
+              return std::nullopt;
+            }
+            return storage.get_buffer(0);
+          },
+          [](auto &&) -> std::optional<::tt::tt_metal::HostBuffer> {
+            return std::nullopt;
+          }},
+      ttnnTensor.storage());
+}
+
+// Returns the matrix shape of a tiled tensor if its tiles can be converted by
+// the host conversion library, i.e. it uses 32x32 tiles and is only padded up
+// to tile boundaries.
+static std::optional<host_conversion::MatrixShape>
+getTiledMatrixShape(const ::ttnn::Tensor &ttnnTensor) {
+  if (ttnnTensor.layout() != ::ttnn::Layout::TILE) {
+    return std::nullopt;
+  }
+
+  const ::tt::tt_metal::Tile &tile = ttnnTensor.tensor_spec().tile();
+  if (tile.get_height() != host_conversion::tileHeight ||
+      tile.get_width() != host_conversion::tileWidth) {
+    return std::nullopt;
+  }
+
+  std::vector<std::uint32_t> logicalShape(ttnnTensor.logical_shape().cbegin(),
+                                          ttnnTensor.logical_shape().cend());
+  host_conversion::MatrixShape matrixShape =
+      host_conversion::MatrixShape::fromTensorShape(logicalShape);
+  const ::ttnn::Shape &paddedShape = ttnnTensor.padded_shape();
+  if (paddedShape.rank() != logicalShape.size() ||
+      paddedShape.volume() !=
+          matrixShape.numTiles() * host_conversion::tileVolume) {
+    return std::nullopt;
+  }
+  return matrixShape;
+}
+
+// Unpacks a host tiled block float tensor straight into row-major fp32 data,
+// bypassing the element-by-element conversion in ttnn. Returns false if the
+// tensor is not stored in a way the host conversion library understands.
+static bool unpackHostBlockFloatTensor(const ::ttnn::Tensor &ttnnTensor,
+                                       target::DataType dataType, void *dst) {
+  std::optional<host_conversion::MatrixShape> matrixShape =
+      getTiledMatrixShape(ttnnTensor);
+  std::optional<::tt::tt_metal::HostBuffer> hostBuffer =
+      getSingleHostBuffer(ttnnTensor);
+  if (!matrixShape || !hostBuffer) {
+    return false;
+  }
+
+  host_conversion::BlockFloatFormat format =
+      dataType == target::DataType::BFP_BFloat8
+          ? host_conversion::BlockFloatFormat::BFP8
+          : host_conversion::BlockFloatFormat::BFP4;
+  auto packed = hostBuffer->view_bytes();
+  if (packed.size() < matrixShape->numTiles() *
+                          host_conversion::getBlockFloatTileSizeBytes(format)) {
+    return false;
+  }
+
+  std::vector<float> tiled(matrixShape->numTiles() *
+                           host_conversion::tileVolume);
+  host_conversion::unpackBlockFloatTiles(
+      reinterpret_cast<const std::uint8_t *>(packed.data()), tiled.data(),
+      matrixShape->numTiles(), format);
+  host_conversion::untilize(tiled.data(), dst, sizeof(float), *matrixShape);
+  return true;
+}
+
+// Untilizes a host tiled tensor straight into `dst`. Returns false if the
+// tensor is not stored in a way the host conversion library understands.
+static bool untilizeHostTensor(const ::ttnn::Tensor &ttnnTensor, void *dst) {
+  std::optional<host_conversion::MatrixShape> matrixShape =
+      getTiledMatrixShape(ttnnTensor);
+  std::optional<::tt::tt_metal::HostBuffer> hostBuffer =
+      getSingleHostBuffer(ttnnTensor);
+  if (!matrixShape || !hostBuffer) {
+    return false;
+  }
+
+  std::uint32_t elementSize = ttnnTensor.element_size();
+  auto tiled = hostBuffer->view_bytes();
+  if (tiled.size() <
+      matrixShape->numTiles() * host_conversion::tileVolume * elementSize) {
+    return false;
+  }
+
+  host_conversion::untilize(tiled.data(), dst, elementSize, *matrixShape);
+  return true;
+}
+
+template <typename T>
+static void copyTensorElements(const ::ttnn::Tensor &ttnnTensor, void *dst) {
+  std::vector<T> vec = ttnnTensor.to_vector<T>();
+  LOG_ASSERT(vec.data() != nullptr);
+  std::memcpy(dst, vec.data(), vec.size() * sizeof(T));
+}
+
+std::optional<TensorDataView>
+getTensorDataView(::tt::runtime::Tensor tensor) {
   const ::ttnn::Tensor &ttnnTensor =
       tensor.as<::tt::runtime::ttnn::TTNNTensorWrapper>(DeviceRuntime::TTNN)
           .getTensor();
-  void *dataPtr = nullptr;
-  std::vector<std::byte> dataVec(getTensorElementSize(tensor) *
-                                 getTensorVolume(tensor));
+  // Block float data is never exposed in its packed form.
+  if (ttnnTensor.dtype() == ::ttnn::DataType::BFLOAT8_B ||
+      ttnnTensor.dtype() == ::ttnn::DataType::BFLOAT4_B ||
+      ttnnTensor.layout() != ::ttnn::Layout::ROW_MAJOR ||
+      ttnnTensor.logical_shape() != ttnnTensor.padded_shape()) {
+    return std::nullopt;
+  }
 
-  // Need to `memcpy` in each case because the vector will go out of scope if we
-  // wait until after the switch case
-  switch (getTensorDataType(tensor)) {
-  case target::DataType::BFP_BFloat4: {
-    dataVec.resize(sizeof(float) * getTensorVolume(tensor));
-    auto vec = ttnnTensor.to_vector<float>();
-    dataPtr = vec.data();
-    LOG_ASSERT(dataPtr != nullptr);
-    std::memcpy(dataVec.data(), dataPtr, dataVec.size());
-    return dataVec;
+  std::optional<::tt::tt_metal::HostBuffer> hostBuffer =
+      getSingleHostBuffer(ttnnTensor);
+  if (!hostBuffer) {
+    return std::nullopt;
+  }
+
+  auto bytes = hostBuffer->view_bytes();
+  std::size_t sizeBytes =
+      ttnnTensor.logical_volume() * ttnnTensor.element_size();
+  LOG_ASSERT(bytes.size() >= sizeBytes, "Host buffer smaller than tensor");
+  return TensorDataView{bytes.data(), sizeBytes};
+}
+
+void copyTensorDataBuffer(::tt::runtime::Tensor tensor, void *dst) {
+  if (std::optional<TensorDataView> view = getTensorDataView(tensor)) {
+    std::memcpy(dst, view->data, view->sizeBytes);
+    return;
   }
+
+  const ::ttnn::Tensor &ttnnTensor =
+      tensor.as<::tt::runtime::ttnn::TTNNTensorWrapper>(DeviceRuntime::TTNN)
+          .getTensor();
+  // Tiled host tensors are untilized straight into `dst`, everything else is
+  // converted by ttnn.
+  target::DataType dataType = getTensorDataType(tensor);
+  switch (dataType) {
+  case target::DataType::BFP_BFloat4:
   case target::DataType::BFP_BFloat8: {
-    dataVec.resize(sizeof(float) * getTensorVolume(tensor));
-    auto vec = ttnnTensor.to_vector<float>();
-    dataPtr = vec.data();
-    LOG_ASSERT(dataPtr != nullptr);
-    std::memcpy(dataVec.data(), dataPtr, dataVec.size());
-    return dataVec;
+    if (!unpackHostBlockFloatTensor(ttnnTensor, dataType, dst)) {
+      copyTensorElements<float>(ttnnTensor, dst);
+    }
+    return;
   }
   case target::DataType::Float32: {
-    auto vec = ttnnTensor.to_vector<float>();
-    dataPtr = vec.data();
-    LOG_ASSERT(dataPtr != nullptr);
-    std::memcpy(dataVec.data(), dataPtr, dataVec.size());
-    return dataVec;
+    if (!untilizeHostTensor(ttnnTensor, dst)) {
+      copyTensorElements<float>(ttnnTensor, dst);
+    }
+    return;
   }
   case target::DataType::BFloat16: {
-    auto vec = ttnnTensor.to_vector<bfloat16>();
-    dataPtr = vec.data();
-    LOG_ASSERT(dataPtr != nullptr);
-    std::memcpy(dataVec.data(), dataPtr, dataVec.size());
-    return dataVec;
+    if (!untilizeHostTensor(ttnnTensor, dst)) {
+      copyTensorElements<bfloat16>(ttnnTensor, dst);
+    }
+    return;
   }
   case target::DataType::Int32: {
-    auto vec = ttnnTensor.to_vector<std::int32_t>();
-    dataPtr = vec.data();
-    LOG_ASSERT(dataPtr != nullptr);
-    std::memcpy(dataVec.data(), dataPtr, dataVec.size());
-    return dataVec;
+    if (!untilizeHostTensor(ttnnTensor, dst)) {
+      copyTensorElements<std::int32_t>(ttnnTensor, dst);
+    }
+    return;
   }
   case target::DataType::UInt32: {
-    auto vec = ttnnTensor.to_vector<std::uint32_t>();
-    dataPtr = vec.data();
-    LOG_ASSERT(dataPtr != nullptr);
-    std::memcpy(dataVec.data(), dataPtr, dataVec.size());
-    return dataVec;
+    if (!untilizeHostTensor(ttnnTensor, dst)) {
+      copyTensorElements<std::uint32_t>(ttnnTensor, dst);
+    }
+    return;
   }
   case target::DataType::UInt16: {
-    auto vec = ttnnTensor.to_vector<std::uint16_t>();
-    dataPtr = vec.data();
-    LOG_ASSERT(dataPtr != nullptr);
-    std::memcpy(dataVec.data(), dataPtr, dataVec.size());
-    return dataVec;
+    if (!untilizeHostTensor(ttnnTensor, dst)) {
+      copyTensorElements<std::uint16_t>(ttnnTensor, dst);
+    }
+    return;
   }
   case target::DataType::UInt8: {
-    auto vec = ttnnTensor.to_vector<std::uint8_t>();
-    dataPtr = vec.data();
-    LOG_ASSERT(dataPtr != nullptr);
-    std::memcpy(dataVec.data(), dataPtr, dataVec.size());
-    return dataVec;
+    if (!untilizeHostTensor(ttnnTensor, dst)) {
+      copyTensorElements<std::uint8_t>(ttnnTensor, dst);
+    }
+    return;
   }
+  default:
+    LOG_FATAL("Unsupported datatype for underlying TTNN tensor: ",
+              target::EnumNameDataType(dataType));
+  }
+}
+
+std::vector<std::byte> getTensorDataBuffer(::tt::runtime::Tensor tensor) {
+  const ::ttnn::Tensor &ttnnTensor =
+      tensor.as<::tt::runtime::ttnn::TTNNTensorWrapper>(DeviceRuntime::TTNN)
+          .getTensor();
+  std::uint32_t elementSize = getTensorElementSize(tensor);
+  switch (getTensorDataType(tensor)) {
+  case target::DataType::BFP_BFloat4:
+  case target::DataType::BFP_BFloat8:
+    // Block float tensors are returned as fp32.
+    elementSize = sizeof(float);
+    break;
+  case target::DataType::Float32:
+  case target::DataType::BFloat16:
+  case target::DataType::Int32:
+  case target::DataType::UInt32:
+  case target::DataType::UInt16:
+  case target::DataType::UInt8:
+    break;
   default:
     LOG_ERROR("Unsupported datatype for underlying TTNN tensor, returning "
               "empty data vector");
     return {};
   }
+
+  std::vector<std::byte> dataVec(elementSize * ttnnTensor.logical_volume());
+  copyTensorDataBuffer(tensor, dataVec.data());
+  return dataVec;
 }
 
 std::vector<std::uint32_t> getTensorShape(::tt::runtime::Tensor tensor) {
@@ -380,6 +542,15 @@ Device openMeshDevice(const std::vector<uint32_t> &meshShape,
     meshDevice->enable_program_cache();
   }
 
+  if (options.enableProgramTrace) {
+    LOG_ASSERT(traceRegionSize > 0,
+               "Program trace requires a device trace region, set "
+               "MeshDeviceOptions::traceRegionSize");
+    TraceCache::get().enable(*meshDevice);
+  }
+
+  AsyncSubmitter::get().setQueueDepth(*meshDevice, options.asyncQueueDepth);
+
   LOG_DEBUG("Device grid size = { ",
             meshDevice->compute_with_storage_grid_size().x, ", ",
             meshDevice->compute_with_storage_grid_size().y, " }");
@@ -407,6 +578,8 @@ void closeMeshDevice(Device parentMesh) {
     ::tt::tt_metal::detail::DumpDeviceProfileResults(ttnnDevice);
   }
 #endif
+  AsyncSubmitter::get().release(ttnnMeshDevice);
+  TraceCache::get().release(ttnnMeshDevice);
   ttnnMeshDevice.close();
 }
 
@@ -442,6 +615,7 @@ void releaseSubMeshDevice(Device subMesh) {
 
   LOG_ASSERT(!ttnnMeshDevice.is_parent_mesh(), "Mesh device must be a submesh");
 
+  AsyncSubmitter::get().release(ttnnMeshDevice);
   ttnnMeshDevice.close();
 }
 
@@ -585,6 +759,16 @@ std::vector<::tt::runtime::Tensor> toHost(::tt::runtime::Tensor tensor,
 
   LayoutConverter converter(tensorLayoutDesc, desiredLayoutDesc);
   ::ttnn::Tensor out = converter.convertTensorLayout(ttnnTensor, meshDevice);
+  if (metrics::isEnabled()) {
+    bool inputOnHost = utils::isOnHost(ttnnTensor.storage_type());
+    bool outputOnHost = utils::isOnHost(out.storage_type());
+    if (inputOnHost && !outputOnHost) {
+      metrics::recordBytesToDevice(out.padded_volume() * out.element_size());
+    } else if (!inputOnHost && outputOnHost) {
+      metrics::recordBytesFromDevice(ttnnTensor.padded_volume() *
+                                     ttnnTensor.element_size());
+    }
+  }
 
   ::tt::runtime::Tensor result =
       utils::createRuntimeTensorFromTTNN(out, shouldRetain);
@@ -637,6 +821,10 @@ void memcpy(void *dst, ::tt::runtime::Tensor src) {
     std::memcpy(dst, srcPtr, size);
   } else {
     ::tt::tt_metal::memcpy(dst, srcTensor);
+    if (metrics::isEnabled()) {
+      metrics::recordBytesFromDevice(srcTensor.padded_volume() *
+                                     srcTensor.element_size());
+    }
   }
 }
 
@@ -661,6 +849,15 @@ void memcpy(::tt::runtime::Tensor dst, ::tt::runtime::Tensor src) {
     std::memcpy(dstPtr, srcPtr, size);
   } else {
     ::tt::tt_metal::memcpy(dstTensor, srcTensor);
+    if (metrics::isEnabled()) {
+      std::uint64_t numBytes =
+          srcTensor.padded_volume() * srcTensor.element_size();
+      if (utils::isOnHost(srcTensor.storage_type())) {
+        metrics::recordBytesToDevice(numBytes);
+      } else if (utils::isOnHost(dstTensor.storage_type())) {
+        metrics::recordBytesFromDevice(numBytes);
+      }
+    }
   }
 }
 
@@ -875,7 +1072,33 @@ std::string getOpLocInfo(OpContext opContextHandle) {
     tensorRef = opContext.type_as_UpdateCacheOp()->cache();
     break;
   }
+  case ::tt::target::ttnn::OpType::PagedFillCacheOp: {
+    tensorRef = opContext.type_as_PagedFillCacheOp()->cache();
+    break;
+  }
+  case ::tt::target::ttnn::OpType::PagedUpdateCacheOp: {
+    tensorRef = opContext.type_as_PagedUpdateCacheOp()->cache();
+    break;
+  }
+  case ::tt::target::ttnn::OpType::PagedScaledDotProductAttentionDecodeOp: {
+    tensorRef =
+        opContext.type_as_PagedScaledDotProductAttentionDecodeOp()->out();
+    break;
+  }
+  case ::tt::target::ttnn::OpType::ScaledDotProductAttentionOp: {
+    tensorRef = opContext.type_as_ScaledDotProductAttentionOp()->out();
+    break;
+  }
+  case ::tt::target::ttnn::OpType::RMSNormOp: {
+    tensorRef = opContext.type_as_RMSNormOp()->out();
+    break;
+  }
+  case ::tt::target::ttnn::OpType::LayerNormOp: {
+    tensorRef = opContext.type_as_LayerNormOp()->out();
+    break;
+  }
   case ::tt::target::ttnn::OpType::LoadCachedOp:
+  case ::tt::target::ttnn::OpType::WhileOp:
   case ::tt::target::ttnn::OpType::GetDeviceOp:
   case ::tt::target::ttnn::OpType::DeallocateOp: {
     LOG_WARNING("getting output tensor is not supported for ",
@@ -902,6 +1125,54 @@ std::string getOpLocInfo(OpContext opContextHandle) {
   return utils::createRuntimeTensorFromTTNN(hostTensor);
 }
 
+std::vector<::tt::runtime::Tensor>
+getOpInputTensors(OpContext opContextHandle,
+                  CallbackContext programContextHandle) {
+  const auto &programContext =
+      programContextHandle.as<tt::runtime::ttnn::ProgramContext>(
+          DeviceRuntime::TTNN);
+  const auto &opContext =
+      opContextHandle.as<::tt::target::ttnn::Operation>(DeviceRuntime::TTNN);
+  const ttnn::ProgramTensorPool &tensorPool = programContext.getTensorPool();
+  std::vector<const ::tt::target::ttnn::TensorRef *> tensorRefs;
+
+  switch (opContext.type_type()) {
+  case ::tt::target::ttnn::OpType::MatmulOp: {
+    const auto *matmulOp = opContext.type_as_MatmulOp();
+    tensorRefs = {matmulOp->a(), matmulOp->b()};
+    break;
+  }
+  case ::tt::target::ttnn::OpType::LinearOp: {
+    const auto *linearOp = opContext.type_as_LinearOp();
+    tensorRefs = {linearOp->a(), linearOp->b()};
+    if (linearOp->bias()) {
+      tensorRefs.push_back(linearOp->bias());
+    }
+    break;
+  }
+  default: {
+    LOG_WARNING("getting input tensors is not supported for ",
+                ::tt::target::ttnn::EnumNamesOpType()[static_cast<size_t>(
+                    opContext.type_type())]);
+    return {};
+  }
+  }
+
+  std::vector<::tt::runtime::Tensor> inputs;
+  for (const ::tt::target::ttnn::TensorRef *tensorRef : tensorRefs) {
+    if (!tensorPool.contains(tensorRef)) {
+      LOG_WARNING("Input tensor not found in tensor pool");
+      return {};
+    }
+    ::ttnn::Tensor hostTensor = ::ttnn::to_layout(
+        ::ttnn::from_device(tensorPool.getTTNNTensorAndValidate(tensorRef)),
+        ::ttnn::Layout::ROW_MAJOR, std::nullopt, std::nullopt,
+        static_cast<::ttnn::MeshDevice *>(nullptr));
+    inputs.push_back(utils::createRuntimeTensorFromTTNN(hostTensor));
+  }
+  return inputs;
+}
+
 std::vector<::tt::runtime::Tensor>
 submit(Device deviceHandle, Binary executableHandle, std::uint32_t programIndex,
        std::vector<::tt::runtime::Tensor> &inputs) {
@@ -909,12 +1180,162 @@ submit(Device deviceHandle, Binary executableHandle, std::uint32_t programIndex,
   std::shared_ptr<::ttnn::MeshDevice> meshDevice =
       deviceHandle.asSharedPtr<::ttnn::MeshDevice>(DeviceRuntime::TTNN);
 
+  if (std::optional<std::vector<::tt::runtime::Tensor>> tracedOutputs =
+          TraceCache::get().submit(meshDevice, executableHandle, programIndex,
+                                   inputs)) {
+    return *tracedOutputs;
+  }
+
   std::vector<::tt::runtime::Tensor> outputs = ::tt::runtime::ttnn::runProgram(
       std::move(meshDevice), executableHandle, programIndex, inputs);
 
   return outputs;
 }
 
+SubmitFuture submitAsync(Device deviceHandle, Binary executableHandle,
+                         std::uint32_t programIndex,
+                         std::vector<::tt::runtime::Tensor> inputs,
+                         bool readback) {
+  return AsyncSubmitter::get().submit(
+      deviceHandle.asSharedPtr<::ttnn::MeshDevice>(DeviceRuntime::TTNN),
+      executableHandle, programIndex, std::move(inputs), readback);
+}
+
+void synchronizeAsync(Device deviceHandle) {
+  AsyncSubmitter::get().synchronize(
+      deviceHandle.as<::ttnn::MeshDevice>(DeviceRuntime::TTNN));
+}
+
+size_t getAsyncQueueDepth(Device deviceHandle) {
+  return AsyncSubmitter::get().getQueueDepth(
+      deviceHandle.as<::ttnn::MeshDevice>(DeviceRuntime::TTNN));
+}
+
+static std::vector<uint32_t>
+getBucketedDims(const ::tt::target::ttnn::BucketedDims *bucketedDims) {
+  if (!bucketedDims || !bucketedDims->dims()) {
+    return {};
+  }
+  return std::vector<uint32_t>(bucketedDims->dims()->begin(),
+                               bucketedDims->dims()->end());
+}
+
+// Returns true if the non-bucketed dims of `shape` match `tensorRef`.
+static bool isShapeCompatible(const ::ttnn::Shape &shape,
+                              const ::tt::target::ttnn::TensorRef *tensorRef,
+                              const std::vector<uint32_t> &bucketedDims) {
+  const auto *expectedShape = tensorRef->desc()->shape();
+  if (expectedShape->size() != shape.rank()) {
+    return false;
+  }
+  for (uint32_t dim = 0; dim < shape.rank(); ++dim) {
+    if (std::find(bucketedDims.begin(), bucketedDims.end(), dim) ==
+            bucketedDims.end() &&
+        static_cast<uint32_t>(expectedShape->Get(dim)) != shape[dim]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+std::vector<::tt::runtime::Tensor>
+submitBucketed(Device deviceHandle, Binary executableHandle,
+               std::string_view programName,
+               std::vector<::tt::runtime::Tensor> &inputs) {
+  const ::tt::target::ttnn::TTNNBinary &fbb =
+      *utils::getBinary(executableHandle);
+
+  auto getTTNNTensor = [](::tt::runtime::Tensor tensor) -> ::ttnn::Tensor & {
+    return tensor.as<::tt::runtime::ttnn::TTNNTensorWrapper>(DeviceRuntime::TTNN)
+        .getTensor();
+  };
+
+  // All bucketed dims share a single size, which is taken from the inputs.
+  std::optional<uint32_t> actualSize;
+  std::optional<std::uint32_t> programIndex;
+  uint64_t bucketSize = std::numeric_limits<uint64_t>::max();
+  for (std::uint32_t idx = 0; idx < fbb.programs()->size(); ++idx) {
+    const ::tt::target::ttnn::Program *program = fbb.programs()->Get(idx);
+    const ::tt::target::ttnn::ShapeBucket *bucket = program->shape_bucket();
+    if (!bucket || bucket->name()->string_view() != programName) {
+      continue;
+    }
+    LOG_ASSERT(program->inputs()->size() == inputs.size(),
+               "Bucketed program ", program->name()->str(), " expects ",
+               program->inputs()->size(), " inputs, got ", inputs.size());
+
+    bool isCompatible = true;
+    for (size_t i = 0; i < inputs.size(); ++i) {
+      std::vector<uint32_t> dims = getBucketedDims(bucket->inputs()->Get(i));
+      const ::ttnn::Shape &shape = getTTNNTensor(inputs[i]).logical_shape();
+      for (uint32_t dim : dims) {
+        LOG_ASSERT(!actualSize || *actualSize == shape[dim],
+                   "Bucketed dims of the inputs must have the same size");
+        actualSize = shape[dim];
+      }
+      isCompatible &=
+          isShapeCompatible(shape, program->inputs()->Get(i), dims);
+    }
+    if (isCompatible && actualSize && bucket->size() >= *actualSize &&
+        bucket->size() < bucketSize) {
+      programIndex = idx;
+      bucketSize = bucket->size();
+    }
+  }
+  LOG_ASSERT(actualSize, "No shape bucket program found for ", programName);
+  LOG_ASSERT(programIndex, "No shape bucket of ", programName,
+             " fits bucketed size ", *actualSize);
+
+  const ::tt::target::ttnn::ShapeBucket *bucket =
+      fbb.programs()->Get(*programIndex)->shape_bucket();
+
+  // Zero pad the bucketed dims of the inputs up to the bucket size. Inputs
+  // without bucketed dims, e.g. parameters, are passed through untouched so
+  // const-eval results stay cached across calls.
+  std::vector<::tt::runtime::Tensor> bucketInputs;
+  bucketInputs.reserve(inputs.size());
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    std::vector<uint32_t> dims = getBucketedDims(bucket->inputs()->Get(i));
+    if (dims.empty() || bucketSize == *actualSize) {
+      bucketInputs.push_back(inputs[i]);
+      continue;
+    }
+    const ::ttnn::Tensor &input = getTTNNTensor(inputs[i]);
+    ::ttnn::SmallVector<::ttnn::operations::data_movement::PadSpecDim> padding(
+        input.logical_shape().rank(), {0, 0});
+    for (uint32_t dim : dims) {
+      padding[dim] = {0, static_cast<uint32_t>(bucketSize - *actualSize)};
+    }
+    bucketInputs.push_back(
+        utils::createRuntimeTensorFromTTNN(::ttnn::pad(input, padding, 0.0f)));
+  }
+
+  std::vector<::tt::runtime::Tensor> outputs =
+      submit(deviceHandle, executableHandle, *programIndex, bucketInputs);
+  if (bucketSize == *actualSize) {
+    return outputs;
+  }
+
+  // Slice the bucketed dims of the outputs back to the size of the inputs.
+  for (size_t i = 0; i < outputs.size(); ++i) {
+    std::vector<uint32_t> dims = getBucketedDims(bucket->outputs()->Get(i));
+    if (dims.empty()) {
+      continue;
+    }
+    const ::ttnn::Tensor &output = getTTNNTensor(outputs[i]);
+    const ::ttnn::Shape &shape = output.logical_shape();
+    ::ttnn::SmallVector<int32_t> begins(shape.rank(), 0);
+    ::ttnn::SmallVector<int32_t> ends(shape.cbegin(), shape.cend());
+    ::ttnn::SmallVector<int32_t> step(shape.rank(), 1);
+    for (uint32_t dim : dims) {
+      ends[dim] = *actualSize;
+    }
+    outputs[i] = utils::createRuntimeTensorFromTTNN(
+        ::ttnn::slice(output, begins, ends, step));
+  }
+  return outputs;
+}
+
 std::vector<Tensor> runProgram(std::shared_ptr<::ttnn::MeshDevice> meshDevice,
                                Binary executableHandle,
                                std::uint32_t programIndex,
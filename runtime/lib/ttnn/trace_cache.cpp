@@ -0,0 +1,229 @@
+// SPDX-FileCopyrightText: (c) 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "tt/runtime/detail/ttnn/trace_cache.h"
+
+#include "tt/runtime/detail/debug.h"
+#include "tt/runtime/detail/logger.h"
+#include "tt/runtime/detail/metrics.h"
+#include "tt/runtime/detail/ttnn/program_executor.h"
+#include "tt/runtime/detail/ttnn/types.h"
+#include "tt/runtime/detail/ttnn/utils.h"
+#include "ttmlir/Target/TTNN/program_generated.h"
+
+namespace tt::runtime::ttnn {
+
+using LogType = ::tt::runtime::logger::LogType;
+
+// Device commands of a trace are replayed as recorded, so programs that run
+// ops on the host, move data between host and device or read device data back
+// to the host to make decisions cannot be traced. Deallocations are fine:
+// inputs are retained, and the buffers of everything else the program creates
+// are kept alive by the trace.
+static bool isTraceable(const ::tt::target::ttnn::Program *program) {
+  for (const ::tt::target::ttnn::TensorRef *input : *program->inputs()) {
+    if (utils::inSystemMemory(input)) {
+      return false;
+    }
+  }
+  for (const ::tt::target::ttnn::TensorRef *output : *program->outputs()) {
+    if (utils::inSystemMemory(output)) {
+      return false;
+    }
+  }
+
+  for (const ::tt::target::ttnn::Operation *op : *program->operations()) {
+    switch (op->type_type()) {
+    case ::tt::target::ttnn::OpType::CpuOp:
+    case ::tt::target::ttnn::OpType::ToDeviceOp:
+    case ::tt::target::ttnn::OpType::FromDeviceOp:
+    case ::tt::target::ttnn::OpType::ToDTypeOp:
+    case ::tt::target::ttnn::OpType::ConstantOp:
+    case ::tt::target::ttnn::OpType::ArangeOp:
+    case ::tt::target::ttnn::OpType::FullOp:
+    case ::tt::target::ttnn::OpType::NamedFullOp:
+    case ::tt::target::ttnn::OpType::MeshShardOp:
+    case ::tt::target::ttnn::OpType::PrepareConv2dWeightsOp:
+    case ::tt::target::ttnn::OpType::WhileOp:
+    case ::tt::target::ttnn::OpType::CollectivePermuteOp:
+    case ::tt::target::ttnn::OpType::UpdateCacheOp:
+    case ::tt::target::ttnn::OpType::PagedFillCacheOp:
+      return false;
+    case ::tt::target::ttnn::OpType::ToLayoutOp:
+      if (utils::inSystemMemory(op->type_as_ToLayoutOp()->out())) {
+        return false;
+      }
+      break;
+    default:
+      break;
+    }
+  }
+  return true;
+}
+
+// Returns the buffer address and size of every input, or std::nullopt if an
+// input cannot be used by a trace. Inputs must live on device and be retained,
+// so that the deallocate ops the compiler emits after their last use leave
+// them alone. Writes into an input buffer do
+// not invalidate the trace, a replay reads whatever the buffer holds.
+static std::optional<std::vector<std::uint64_t>>
+getInputKey(std::vector<::tt::runtime::Tensor> &inputs) {
+  std::vector<std::uint64_t> inputKey;
+  inputKey.reserve(inputs.size() * 2);
+  for (::tt::runtime::Tensor &input : inputs) {
+    const TTNNTensorWrapper &tensorWrapper =
+        input.as<TTNNTensorWrapper>(DeviceRuntime::TTNN);
+    const ::ttnn::Tensor &tensor = tensorWrapper.getTensor();
+    if (!utils::isOnDevice(tensor.storage_type()) ||
+        !tensorWrapper.shouldRetain()) {
+      return std::nullopt;
+    }
+    inputKey.push_back(tensor.buffer()->address());
+    inputKey.push_back(tensor.buffer()->size());
+  }
+  return inputKey;
+}
+
+// Every replay writes into the same captured output buffers, so callers get
+// copies that the next replay does not overwrite.
+static std::vector<::tt::runtime::Tensor>
+cloneOutputs(const std::vector<::tt::runtime::Tensor> &capturedOutputs) {
+  std::vector<::tt::runtime::Tensor> outputs;
+  outputs.reserve(capturedOutputs.size());
+  for (const ::tt::runtime::Tensor &capturedOutput : capturedOutputs) {
+    const ::ttnn::Tensor &tensor =
+        capturedOutput.as<TTNNTensorWrapper>(DeviceRuntime::TTNN).getTensor();
+    ::ttnn::Tensor clone =
+        ::ttnn::clone(tensor, /*dtype=*/std::nullopt, tensor.memory_config(),
+                      /*compute_kernel_config=*/std::nullopt);
+    outputs.push_back(utils::createRuntimeTensorFromTTNN(clone));
+  }
+  return outputs;
+}
+
+TraceCache &TraceCache::get() {
+  static TraceCache traceCache;
+  return traceCache;
+}
+
+void TraceCache::enable(const ::ttnn::MeshDevice &meshDevice) {
+  std::lock_guard<std::mutex> lock(mutex);
+  devices.try_emplace(&meshDevice);
+}
+
+void TraceCache::release(::ttnn::MeshDevice &meshDevice) {
+  std::lock_guard<std::mutex> lock(mutex);
+  auto it = devices.find(&meshDevice);
+  if (it == devices.end()) {
+    return;
+  }
+  for (auto &[key, entry] : it->second) {
+    releaseTrace(meshDevice, entry);
+  }
+  devices.erase(it);
+}
+
+void TraceCache::releaseTrace(::ttnn::MeshDevice &meshDevice, Entry &entry) {
+  if (entry.traceId) {
+    ::ttnn::operations::trace::release_trace(&meshDevice, *entry.traceId);
+    entry.traceId.reset();
+  }
+  entry.inputKey.clear();
+  entry.outputs.clear();
+  entry.buffers.clear();
+}
+
+std::optional<std::vector<::tt::runtime::Tensor>>
+TraceCache::submit(std::shared_ptr<::ttnn::MeshDevice> meshDevice,
+                   Binary executableHandle, std::uint32_t programIndex,
+                   std::vector<::tt::runtime::Tensor> &inputs) {
+  // Op callbacks would not run for replayed programs.
+  if (debug::Hooks::get().getPreOperatorCallback() ||
+      debug::Hooks::get().getPostOperatorCallback()) {
+    return std::nullopt;
+  }
+
+  std::lock_guard<std::mutex> lock(mutex);
+  auto deviceIt = devices.find(meshDevice.get());
+  if (deviceIt == devices.end()) {
+    return std::nullopt;
+  }
+
+  const ::tt::target::ttnn::Program *program =
+      utils::getBinary(executableHandle)->programs()->Get(programIndex);
+  EntryKey entryKey(executableHandle.handle.get(), programIndex);
+  auto [entryIt, inserted] = deviceIt->second.try_emplace(entryKey);
+  Entry &entry = entryIt->second;
+  if (!inserted && entry.binary.lock() != executableHandle.handle) {
+    releaseTrace(*meshDevice, entry);
+    inserted = true;
+  }
+  if (inserted) {
+    entry.binary = executableHandle.handle;
+    entry.traceable = isTraceable(program);
+    if (!entry.traceable) {
+      LOG_DEBUG(LogType::LogRuntimeTTNN, "Program ", program->name()->c_str(),
+                " does host work and runs without a trace");
+    }
+  }
+  if (!entry.traceable) {
+    return std::nullopt;
+  }
+
+  std::optional<std::vector<std::uint64_t>> inputKey = getInputKey(inputs);
+  if (!inputKey) {
+    return std::nullopt;
+  }
+
+  if (entry.traceId && entry.inputKey == *inputKey) {
+    const bool collectMetrics = metrics::isEnabled();
+    metrics::Clock::time_point start;
+    if (collectMetrics) {
+      start = metrics::Clock::now();
+    }
+    ::ttnn::operations::trace::execute_trace(meshDevice.get(), *entry.traceId,
+                                             ::ttnn::DefaultQueueId,
+                                             /*blocking=*/false);
+    std::vector<::tt::runtime::Tensor> outputs = cloneOutputs(entry.outputs);
+    if (collectMetrics) {
+      metrics::recordProgram(program->name()->string_view(),
+                             metrics::elapsedNs(start));
+    }
+    return outputs;
+  }
+
+  // New input buffers, the trace captured for the previous ones is stale.
+  releaseTrace(*meshDevice, entry);
+
+  // Capture only records device commands, so the outputs of this submit come
+  // from a regular run. It also compiles the kernels, which is not allowed
+  // while capturing.
+  std::vector<::tt::runtime::Tensor> outputs =
+      runProgram(meshDevice, executableHandle, programIndex, inputs);
+
+  LOG_DEBUG(LogType::LogRuntimeTTNN,
+            "Capturing trace of program: ", program->name()->c_str());
+  ProgramExecutor executor(executableHandle, inputs, meshDevice, programIndex);
+  ProgramTensorPool &tensorPool = executor.getContext().getTensorPool();
+  tensorPool.beginTraceCapture();
+  ::ttnn::MeshTraceId traceId = ::ttnn::operations::trace::begin_trace_capture(
+      meshDevice.get(), ::ttnn::DefaultQueueId);
+  executor.execute();
+  ::ttnn::operations::trace::end_trace_capture(meshDevice.get(), traceId,
+                                               ::ttnn::DefaultQueueId);
+  entry.outputs = executor.gatherOutputTensors();
+  entry.buffers = tensorPool.takeTraceTensors();
+  entry.traceId = traceId;
+  entry.inputKey = std::move(*inputKey);
+
+  // The captured outputs are owned by the trace and never handed out, so
+  // neither callers nor programs consuming them can deallocate them.
+  for (::tt::runtime::Tensor &output : entry.outputs) {
+    output.as<TTNNTensorWrapper>(DeviceRuntime::TTNN).setRetain(true);
+  }
+
+  return outputs;
+}
+
+} // namespace tt::runtime::ttnn
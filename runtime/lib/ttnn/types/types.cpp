@@ -130,6 +130,9 @@ ProgramTensorPool::insertTTNNTensorAndValidate(
 
   ::tt::runtime::Tensor runtimeTensor =
       utils::createRuntimeTensorFromTTNN(ttnnTensor, retain);
+  if (traceTensors) {
+    traceTensors->push_back(runtimeTensor);
+  }
   auto [iter, inserted] =
       intermedTensors.insert_or_assign(globalId, runtimeTensor);
 
@@ -151,6 +154,13 @@ std::vector<::tt::runtime::Tensor> ProgramTensorPool::gatherOutputTensors() {
   return outputs;
 }
 
+std::vector<::tt::runtime::Tensor> ProgramTensorPool::takeTraceTensors() {
+  LOG_ASSERT(traceTensors, "No trace is being captured");
+  std::vector<::tt::runtime::Tensor> tensors = std::move(*traceTensors);
+  traceTensors.reset();
+  return tensors;
+}
+
 TensorPtrMapIterator
 ProgramTensorPool::erase(const ::tt::target::ttnn::TensorRef *tensorRef) {
   LOG_ASSERT(tensorRef != nullptr, "tensorRef should not be null");
@@ -0,0 +1,160 @@
+// SPDX-FileCopyrightText: (c) 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+#include "tt/runtime/detail/host_conversion.h"
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+namespace hc = ::tt::runtime::host_conversion;
+
+namespace {
+// Force splitting small inputs across threads.
+hc::ConversionOptions getThreadedOptions() {
+  hc::ConversionOptions options;
+  options.numThreads = 4;
+  options.minBytesPerThread = 1;
+  return options;
+}
+
+std::vector<float> getTestData(std::size_t numElements) {
+  std::vector<float> data(numElements);
+  for (std::size_t i = 0; i < numElements; ++i) {
+    data[i] = static_cast<float>(i % 251) * 0.25f - 31.0f;
+  }
+  return data;
+}
+} // namespace
+
+TEST(HostConversion, TilizeFaceOrder) {
+  hc::MatrixShape shape = hc::MatrixShape::fromTensorShape({32, 32});
+  std::vector<float> rowMajor(hc::tileVolume);
+  for (std::size_t i = 0; i < rowMajor.size(); ++i) {
+    rowMajor[i] = static_cast<float>(i);
+  }
+
+  std::vector<float> tiled(hc::tileVolume);
+  hc::tilize(rowMajor.data(), tiled.data(), sizeof(float), shape);
+
+  // Faces are stored in row-major order, each face is a row-major 16x16 block.
+  EXPECT_EQ(tiled[0], rowMajor[0]);
+  EXPECT_EQ(tiled[16], rowMajor[32]);
+  EXPECT_EQ(tiled[256], rowMajor[16]);
+  EXPECT_EQ(tiled[512], rowMajor[16 * 32]);
+  EXPECT_EQ(tiled[768], rowMajor[16 * 32 + 16]);
+}
+
+TEST(HostConversion, TilizeRoundTripWithPadding) {
+  hc::MatrixShape shape = hc::MatrixShape::fromTensorShape({2, 3, 45, 70});
+  ASSERT_EQ(shape.batch, 6u);
+  ASSERT_EQ(shape.numTiles(), 6u * 2 * 3);
+
+  std::vector<float> rowMajor = getTestData(shape.batch * 45 * 70);
+  std::vector<float> tiled(shape.numTiles() * hc::tileVolume, -1.0f);
+  std::vector<float> untiled(rowMajor.size());
+  hc::tilize(rowMajor.data(), tiled.data(), sizeof(float), shape,
+             getThreadedOptions());
+  hc::untilize(tiled.data(), untiled.data(), sizeof(float), shape,
+               getThreadedOptions());
+  EXPECT_EQ(rowMajor, untiled);
+
+  // The last face row of the second tile row lies entirely in the padding.
+  std::size_t paddingRow = 3 * hc::tileVolume + 3 * 256 + 15 * 16;
+  for (std::size_t i = 0; i < hc::faceWidth; ++i) {
+    EXPECT_EQ(tiled[paddingRow + i], 0.0f);
+  }
+}
+
+TEST(HostConversion, BFloat16RoundToNearestEven) {
+  // 1 + 2^-8 is exactly between two bf16 values and rounds to the even one,
+  // 1 + 3 * 2^-8 rounds up.
+  std::vector<float> src(37, 1.0f + 0.00390625f);
+  src[1] = 1.0f + 3 * 0.00390625f;
+  std::vector<std::uint16_t> dst(src.size());
+  hc::float32ToBFloat16(src.data(), dst.data(), src.size());
+  EXPECT_EQ(dst[0], 0x3F80);
+  EXPECT_EQ(dst[1], 0x3F82);
+  EXPECT_EQ(dst[36], 0x3F80);
+
+  std::vector<float> back(src.size());
+  hc::bfloat16ToFloat32(dst.data(), back.data(), dst.size());
+  EXPECT_EQ(back[0], 1.0f);
+  EXPECT_EQ(back[1], 1.0f + 4 * 0.00390625f);
+}
+
+TEST(HostConversion, BFloat16KeepsNaN) {
+  // A NaN whose payload would carry into the exponent when rounded, placed
+  // both in a full vector and in the scalar tail.
+  std::uint32_t nanBits = 0x7F80FFFF;
+  float nan;
+  std::memcpy(&nan, &nanBits, sizeof(nan));
+  std::vector<float> src(37, 1.0f);
+  src[3] = nan;
+  src[36] = nan;
+  std::vector<std::uint16_t> dst(src.size());
+  hc::float32ToBFloat16(src.data(), dst.data(), src.size());
+  EXPECT_EQ(dst[3], 0x7FC0);
+  EXPECT_EQ(dst[36], 0x7FC0);
+  EXPECT_EQ(dst[4], 0x3F80);
+
+  std::vector<float> back(src.size());
+  hc::bfloat16ToFloat32(dst.data(), back.data(), dst.size());
+  EXPECT_TRUE(std::isnan(back[3]));
+  EXPECT_TRUE(std::isnan(back[36]));
+}
+
+TEST(HostConversion, BlockFloatExactValues) {
+  std::vector<float> src(hc::tileVolume, 0.0f);
+  src[0] = 1.5f;
+  src[1] = -0.75f;
+  src[2] = 1.0f;
+
+  for (hc::BlockFloatFormat format :
+       {hc::BlockFloatFormat::BFP8, hc::BlockFloatFormat::BFP4}) {
+    std::vector<std::uint8_t> packed(hc::getBlockFloatTileSizeBytes(format));
+    std::vector<float> unpacked(hc::tileVolume);
+    hc::packBlockFloatTiles(src.data(), packed.data(), 1, format);
+    hc::unpackBlockFloatTiles(packed.data(), unpacked.data(), 1, format);
+    EXPECT_EQ(src, unpacked);
+  }
+}
+
+TEST(HostConversion, BlockFloatRoundTrip) {
+  constexpr std::uint64_t numTiles = 5;
+  std::vector<float> src = getTestData(numTiles * hc::tileVolume);
+  std::vector<std::uint16_t> srcBf16(src.size());
+  hc::float32ToBFloat16(src.data(), srcBf16.data(), src.size());
+
+  for (auto [format, tolerance] :
+       {std::pair{hc::BlockFloatFormat::BFP8, 1.0f / 64},
+        std::pair{hc::BlockFloatFormat::BFP4, 1.0f / 4}}) {
+    std::vector<std::uint8_t> packed(numTiles *
+                                     hc::getBlockFloatTileSizeBytes(format));
+    std::vector<float> unpacked(src.size());
+    hc::packBlockFloatTiles(src.data(), packed.data(), numTiles, format,
+                            getThreadedOptions());
+    hc::unpackBlockFloatTiles(packed.data(), unpacked.data(), numTiles, format,
+                              getThreadedOptions());
+
+    std::vector<std::uint8_t> packedBf16(packed.size());
+    hc::packBlockFloatTiles(srcBf16.data(), packedBf16.data(), numTiles,
+                            format, getThreadedOptions());
+
+    for (std::size_t row = 0; row < src.size() / hc::faceWidth; ++row) {
+      float rowMax = 0.0f;
+      for (std::size_t i = 0; i < hc::faceWidth; ++i) {
+        rowMax = std::max(rowMax, std::fabs(src[row * hc::faceWidth + i]));
+      }
+      for (std::size_t i = 0; i < hc::faceWidth; ++i) {
+        std::size_t index = row * hc::faceWidth + i;
+        EXPECT_LE(std::fabs(unpacked[index] - src[index]), rowMax * tolerance);
+      }
+    }
+    // The shared exponents only depend on the bf16 representable part.
+    EXPECT_EQ(std::memcmp(packed.data(), packedBf16.data(), 64), 0);
+  }
+}
@@ -0,0 +1,147 @@
+// SPDX-FileCopyrightText: (c) 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+#include "tt/runtime/detail/metrics.h"
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace metrics = ::tt::runtime::metrics;
+
+namespace {
+class RuntimeMetricsTest : public ::testing::Test {
+protected:
+  void SetUp() override {
+    metrics::setEnabled(true);
+    metrics::reset();
+  }
+  void TearDown() override { metrics::setEnabled(false); }
+};
+
+const tt::runtime::MetricsCounter *
+findCounter(const std::vector<tt::runtime::MetricsCounter> &counters,
+            const std::string &name) {
+  for (const tt::runtime::MetricsCounter &counter : counters) {
+    if (counter.name == name) {
+      return &counter;
+    }
+  }
+  return nullptr;
+}
+} // namespace
+
+TEST_F(RuntimeMetricsTest, RecordOps) {
+  metrics::recordOp("MatmulOp", 500);
+  metrics::recordOp("MatmulOp", 3000);
+  metrics::recordOp("AddOp", 100);
+
+  tt::runtime::RuntimeMetrics snapshot = metrics::snapshot();
+  ASSERT_EQ(snapshot.ops.size(), 2u);
+  // Sorted by total time.
+  EXPECT_EQ(snapshot.ops[0].name, "MatmulOp");
+
+  const tt::runtime::MetricsCounter *matmul =
+      findCounter(snapshot.ops, "MatmulOp");
+  ASSERT_NE(matmul, nullptr);
+  EXPECT_EQ(matmul->count, 2u);
+  EXPECT_EQ(matmul->totalNs, 3500u);
+  EXPECT_EQ(matmul->minNs, 500u);
+  EXPECT_EQ(matmul->maxNs, 3000u);
+  ASSERT_EQ(matmul->histogram.size(), metrics::numHistogramBuckets);
+  // 500ns is under 1us, 3us falls into [2, 4) us.
+  EXPECT_EQ(matmul->histogram[0], 1u);
+  EXPECT_EQ(matmul->histogram[2], 1u);
+}
+
+TEST_F(RuntimeMetricsTest, HistogramLastBucketIsOpenEnded) {
+  metrics::recordProgram("forward", 1000000000000ULL);
+
+  tt::runtime::RuntimeMetrics snapshot = metrics::snapshot();
+  ASSERT_EQ(snapshot.programs.size(), 1u);
+  EXPECT_EQ(snapshot.programs[0].histogram.back(), 1u);
+}
+
+TEST_F(RuntimeMetricsTest, BytesAndCache) {
+  metrics::recordBytesToDevice(1024);
+  metrics::recordBytesToDevice(1024);
+  metrics::recordBytesFromDevice(64);
+  metrics::recordConstEvalCacheLookup(false);
+  metrics::recordConstEvalCacheLookup(true);
+  metrics::recordConstEvalCacheLookup(true);
+
+  tt::runtime::RuntimeMetrics snapshot = metrics::snapshot();
+  EXPECT_EQ(snapshot.bytesToDevice, 2048u);
+  EXPECT_EQ(snapshot.bytesFromDevice, 64u);
+  EXPECT_EQ(snapshot.constEvalCacheHits, 2u);
+  EXPECT_EQ(snapshot.constEvalCacheMisses, 1u);
+}
+
+TEST_F(RuntimeMetricsTest, AsyncSubmits) {
+  metrics::recordAsyncSubmit(1);
+  metrics::recordAsyncSubmit(3);
+  metrics::recordAsyncSubmit(2);
+  metrics::recordAsyncStall(700);
+  metrics::recordAsyncStall(300);
+
+  tt::runtime::RuntimeMetrics snapshot = metrics::snapshot();
+  EXPECT_EQ(snapshot.asyncSubmits, 3u);
+  EXPECT_EQ(snapshot.asyncMaxQueueDepth, 3u);
+  EXPECT_EQ(snapshot.asyncStalls, 2u);
+  EXPECT_EQ(snapshot.asyncStallNs, 1000u);
+}
+
+TEST_F(RuntimeMetricsTest, ResetStartsNewWindow) {
+  metrics::recordOp("AddOp", 100);
+  metrics::recordBytesToDevice(16);
+  metrics::reset();
+
+  tt::runtime::RuntimeMetrics snapshot = metrics::snapshot();
+  EXPECT_TRUE(snapshot.ops.empty());
+  EXPECT_EQ(snapshot.bytesToDevice, 0u);
+
+  metrics::recordOp("AddOp", 200);
+  snapshot = metrics::snapshot();
+  ASSERT_EQ(snapshot.ops.size(), 1u);
+  EXPECT_EQ(snapshot.ops[0].count, 1u);
+  EXPECT_EQ(snapshot.ops[0].minNs, 200u);
+}
+
+TEST_F(RuntimeMetricsTest, TooManyNames) {
+  for (std::size_t i = 0; i < metrics::maxPrograms + 8; ++i) {
+    metrics::recordProgram("program_" + std::to_string(i), 1);
+  }
+
+  tt::runtime::RuntimeMetrics snapshot = metrics::snapshot();
+  std::uint64_t total = 0;
+  for (const tt::runtime::MetricsCounter &counter : snapshot.programs) {
+    total += counter.count;
+  }
+  EXPECT_EQ(total, metrics::maxPrograms + 8);
+  EXPECT_NE(findCounter(snapshot.programs, "<other>"), nullptr);
+}
+
+TEST_F(RuntimeMetricsTest, ConcurrentRecording) {
+  constexpr int numThreads = 8;
+  constexpr int numRecords = 10000;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < numThreads; ++t) {
+    threads.emplace_back([t] {
+      for (int i = 0; i < numRecords; ++i) {
+        metrics::recordOp("SharedOp", 10);
+        metrics::recordOp("Op" + std::to_string(t), 10);
+      }
+    });
+  }
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+
+  tt::runtime::RuntimeMetrics snapshot = metrics::snapshot();
+  const tt::runtime::MetricsCounter *shared =
+      findCounter(snapshot.ops, "SharedOp");
+  ASSERT_NE(shared, nullptr);
+  EXPECT_EQ(shared->count, numThreads * numRecords);
+  EXPECT_EQ(snapshot.ops.size(), numThreads + 1u);
+}
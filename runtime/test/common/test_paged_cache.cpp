@@ -0,0 +1,65 @@
+// SPDX-FileCopyrightText: (c) 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+#include "tt/runtime/paged_cache.h"
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+using ::tt::runtime::PagedCacheAllocator;
+
+TEST(PagedCacheAllocatorTest, ReserveGrowsPageTable) {
+  PagedCacheAllocator allocator(/*numBlocks=*/8, /*blockSize=*/32,
+                                /*maxSequences=*/2,
+                                /*maxBlocksPerSequence=*/4);
+  EXPECT_EQ(allocator.getPageTableShape(),
+            (std::vector<std::uint32_t>{2, 4}));
+
+  ASSERT_TRUE(allocator.reserve(0, 33));
+  EXPECT_EQ(allocator.getCapacity(0), 64u);
+  EXPECT_EQ(allocator.getNumFreeBlocks(), 6u);
+
+  // Already covered by the reserved blocks.
+  ASSERT_TRUE(allocator.reserve(0, 64));
+  EXPECT_EQ(allocator.getNumFreeBlocks(), 6u);
+
+  ASSERT_TRUE(allocator.reserve(1, 1));
+  ASSERT_TRUE(allocator.reserve(0, 65));
+  EXPECT_EQ(allocator.getPageTable(),
+            (std::vector<std::int32_t>{0, 1, 3, 0, 2, 0, 0, 0}));
+}
+
+TEST(PagedCacheAllocatorTest, ReserveFailureAllocatesNothing) {
+  PagedCacheAllocator allocator(/*numBlocks=*/3, /*blockSize=*/16,
+                                /*maxSequences=*/2,
+                                /*maxBlocksPerSequence=*/4);
+  ASSERT_TRUE(allocator.reserve(0, 32));
+
+  // Needs 2 more blocks, only 1 is free.
+  EXPECT_FALSE(allocator.reserve(1, 32));
+  EXPECT_EQ(allocator.getNumFreeBlocks(), 1u);
+  EXPECT_EQ(allocator.getCapacity(1), 0u);
+
+  // Past the max blocks of a sequence.
+  EXPECT_FALSE(allocator.reserve(0, 16 * 5));
+  EXPECT_EQ(allocator.getCapacity(0), 32u);
+}
+
+TEST(PagedCacheAllocatorTest, ReleaseReusesBlocks) {
+  PagedCacheAllocator allocator(/*numBlocks=*/4, /*blockSize=*/16,
+                                /*maxSequences=*/2,
+                                /*maxBlocksPerSequence=*/4);
+  ASSERT_TRUE(allocator.reserve(0, 64));
+  EXPECT_FALSE(allocator.reserve(1, 1));
+
+  allocator.release(0);
+  EXPECT_EQ(allocator.getNumFreeBlocks(), 4u);
+  EXPECT_EQ(allocator.getCapacity(0), 0u);
+  EXPECT_EQ(allocator.getPageTable(),
+            (std::vector<std::int32_t>(8, 0)));
+
+  ASSERT_TRUE(allocator.reserve(1, 20));
+  EXPECT_EQ(allocator.getPageTable(),
+            (std::vector<std::int32_t>{0, 0, 0, 0, 0, 1, 0, 0}));
+}
@@ -0,0 +1,116 @@
+# SPDX-FileCopyrightText: (c) 2025 Tenstorrent AI ULC
+#
+# SPDX-License-Identifier: Apache-2.0
+
+import os
+import pytest
+import ttrt
+import ttrt.runtime
+import torch
+from ttrt.common.util import *
+from ..utils import (
+    TT_MLIR_HOME,
+    Helper,
+    DeviceContext,
+    get_runtime_tensor_from_torch,
+)
+
+FLATBUFFER_BASE_PATH = (
+    f"{TT_MLIR_HOME}/build/test/ttmlir/Silicon/TTNN/n150/async/Output"
+)
+
+SHAPE = (64, 128)
+
+
+def initialize_binary(helper: Helper, request):
+    binary_path = os.path.join(FLATBUFFER_BASE_PATH, "async_submit.mlir.tmp.ttnn")
+    assert os.path.exists(binary_path), f"Binary file not found: {binary_path}"
+    helper.initialize(request.node.name, binary_path)
+    helper.check_constraints()
+
+
+def to_torch(tensor):
+    host = ttrt.runtime.to_host(tensor, untilize=True)[0]
+    result = torch.empty(SHAPE, dtype=torch.bfloat16)
+    ttrt.runtime.memcpy(result.data_ptr(), host)
+    ttrt.runtime.deallocate_tensor(host, force=True)
+    return result
+
+
+# With one command queue the execute thread uploads and reads back inline, with
+# two a transfer thread uses the second queue.
+@pytest.mark.parametrize("num_hw_cqs", [1, 2])
+def test_submit_async_order(helper: Helper, num_hw_cqs, request):
+    initialize_binary(helper, request)
+
+    # Host inputs are uploaded by the pipeline and outputs are read back.
+    inputs_torch = [
+        [torch.randn(SHAPE, dtype=torch.bfloat16) for _ in range(2)] for _ in range(8)
+    ]
+    with DeviceContext(mesh_shape=[1, 1], num_hw_cqs=num_hw_cqs) as device:
+        futures = [
+            ttrt.runtime.submit_async(
+                device,
+                helper.binary.fbb,
+                0,
+                [get_runtime_tensor_from_torch(input) for input in inputs],
+                readback=True,
+            )
+            for inputs in inputs_torch
+        ]
+        ttrt.runtime.synchronize_async(device)
+        assert ttrt.runtime.get_async_queue_depth(device) == 0
+        assert all(future.is_ready() for future in futures)
+
+        for future, (lhs, rhs) in zip(futures, inputs_torch):
+            outputs = future.get()
+            assert len(outputs) == 1
+            result = to_torch(outputs[0])
+            assert torch.allclose(result, lhs + rhs, rtol=1e-2, atol=1e-2)
+    helper.teardown()
+
+
+def test_submit_async_queue_depth(helper: Helper, request):
+    initialize_binary(helper, request)
+
+    inputs = [
+        get_runtime_tensor_from_torch(torch.randn(SHAPE, dtype=torch.bfloat16))
+        for _ in range(2)
+    ]
+    with DeviceContext(mesh_shape=[1, 1], async_queue_depth=1) as device:
+        first = ttrt.runtime.submit_async(device, helper.binary.fbb, 0, inputs)
+        assert ttrt.runtime.get_async_queue_depth(device) <= 1
+        # With a single request allowed in flight, the second submit returns only
+        # once the first one is done.
+        second = ttrt.runtime.submit_async(device, helper.binary.fbb, 0, inputs)
+        assert first.is_ready()
+        assert ttrt.runtime.get_async_queue_depth(device) <= 1
+        ttrt.runtime.synchronize_async(device)
+        assert ttrt.runtime.get_async_queue_depth(device) == 0
+        for future in (first, second):
+            for output in future.get():
+                ttrt.runtime.deallocate_tensor(output, force=True)
+    helper.teardown()
+
+
+def test_submit_async_error(helper: Helper, request):
+    initialize_binary(helper, request)
+
+    # The program takes two inputs, the request is rejected by the pipeline.
+    inputs = [
+        get_runtime_tensor_from_torch(torch.randn(SHAPE, dtype=torch.bfloat16))
+        for _ in range(3)
+    ]
+    with DeviceContext(mesh_shape=[1, 1]) as device:
+        failed = ttrt.runtime.submit_async(device, helper.binary.fbb, 0, inputs)
+        with pytest.raises(ValueError, match="Invalid input count 3"):
+            failed.get()
+        ttrt.runtime.synchronize_async(device)
+        assert ttrt.runtime.get_async_queue_depth(device) == 0
+
+        # A failed request does not stop the pipeline.
+        outputs = ttrt.runtime.submit_async(
+            device, helper.binary.fbb, 0, inputs[:2], readback=True
+        ).get()
+        assert len(outputs) == 1
+    helper.teardown()
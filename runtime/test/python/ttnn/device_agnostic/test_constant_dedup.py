@@ -0,0 +1,121 @@
+# SPDX-FileCopyrightText: (c) 2025 Tenstorrent AI ULC
+#
+# SPDX-License-Identifier: Apache-2.0
+
+import os
+import pytest
+import ttrt
+import ttrt.runtime
+import torch
+from ttrt.common.util import *
+from ..utils import (
+    TT_MLIR_HOME,
+    Helper,
+    DeviceContext,
+    get_runtime_tensor_from_torch,
+    get_to_layout_inputs,
+)
+
+FLATBUFFER_BASE_PATH = f"{TT_MLIR_HOME}/build/test/ttmlir/Silicon/TTNN/n150/Output"
+
+SMALL_CONSTANT = torch.tensor([[-1.1, 2.2, -3.3], [4.4, -5.5, 6.6]])
+LARGE_CONSTANT = torch.arange(32, dtype=torch.float32).repeat(32, 1)
+
+
+def initialize_binary(helper: Helper, request, file_name):
+    binary_path = os.path.join(FLATBUFFER_BASE_PATH, file_name)
+    assert os.path.exists(binary_path), f"Binary file not found: {binary_path}"
+    helper.initialize(request.node.name, binary_path)
+    helper.check_constraints()
+
+
+def get_program_index(helper: Helper, name):
+    programs = helper.binary.fbb_dict["programs"]
+    return next(i for i, program in enumerate(programs) if program["name"] == name)
+
+
+# Returns the constant table index of every constant op of the program.
+def get_constant_indices(helper: Helper, name):
+    program = helper.binary.fbb_dict["programs"][get_program_index(helper, name)]
+    return [
+        op["type"]["constant_index"]
+        for op in program["operations"]
+        if op["type_type"] == "ConstantOp"
+    ]
+
+
+def get_stored_size(constant):
+    return sum(len(chunk["data"]) for chunk in constant["chunks"])
+
+
+@pytest.mark.parametrize("compressed", [False, True])
+def test_constant_table(helper: Helper, compressed, request):
+    file_name = (
+        "constant_dedup.mlir.tmp.compressed.ttnn"
+        if compressed
+        else "constant_dedup.mlir.tmp.ttnn"
+    )
+    initialize_binary(helper, request, file_name)
+
+    # The small payload is shared by two programs, every payload is stored once.
+    constants = helper.binary.fbb_dict["constants"]
+    assert len(constants) == 2
+    [add_index] = get_constant_indices(helper, "add_constant")
+    [multiply_index] = get_constant_indices(helper, "multiply_constant")
+    [large_index] = get_constant_indices(helper, "add_large_constant")
+    assert add_index == multiply_index
+    assert large_index != add_index
+    # Payloads are not inlined into the constant ops.
+    for program in helper.binary.fbb_dict["programs"]:
+        for op in program["operations"]:
+            if op["type_type"] == "ConstantOp":
+                assert not op["type"].get("data")
+
+    small = constants[add_index]
+    assert small["size"] == SMALL_CONSTANT.numel() * SMALL_CONSTANT.element_size()
+    assert small["compression"] == "Uncompressed"
+    assert bytes(small["chunks"][0]["data"]) == SMALL_CONSTANT.numpy().tobytes()
+
+    large = constants[large_index]
+    large_size = LARGE_CONSTANT.numel() * LARGE_CONSTANT.element_size()
+    assert large["size"] == large_size
+    if compressed:
+        assert large["compression"] == "Zstd"
+        assert len(large["chunks"]) == 1
+        assert get_stored_size(large) < large_size
+    else:
+        assert large["compression"] == "Uncompressed"
+        assert bytes(large["chunks"][0]["data"]) == LARGE_CONSTANT.numpy().tobytes()
+    helper.teardown()
+
+
+# The runtime reads the large payload through the decompressed constant pool.
+@pytest.mark.parametrize("compressed", [False, True])
+def test_large_constant_execution(helper: Helper, compressed, request):
+    file_name = (
+        "constant_dedup.mlir.tmp.compressed.ttnn"
+        if compressed
+        else "constant_dedup.mlir.tmp.ttnn"
+    )
+    initialize_binary(helper, request, file_name)
+    program_index = get_program_index(helper, "add_large_constant")
+
+    activations = torch.randn((32, 32), dtype=torch.float32)
+    result_torch = torch.empty((32, 32), dtype=torch.float32)
+    with DeviceContext(mesh_shape=[1, 1]) as device:
+        inputs = get_to_layout_inputs(
+            device,
+            [get_runtime_tensor_from_torch(activations)],
+            helper.binary,
+            program_index,
+        )
+        outputs = ttrt.runtime.submit(device, helper.binary.fbb, program_index, inputs)
+        result = ttrt.runtime.to_host(outputs[0], untilize=True)[0]
+        ttrt.runtime.memcpy(result_torch.data_ptr(), result)
+        ttrt.runtime.deallocate_tensor(outputs[0], force=True)
+        ttrt.runtime.deallocate_tensor(result, force=True)
+
+    assert torch.allclose(
+        result_torch, activations + LARGE_CONSTANT, rtol=1e-2, atol=1e-1
+    )
+    helper.teardown()
@@ -0,0 +1,103 @@
+# SPDX-FileCopyrightText: (c) 2025 Tenstorrent AI ULC
+#
+# SPDX-License-Identifier: Apache-2.0
+
+import os
+import pytest
+import ttrt
+import ttrt.runtime
+import torch
+from ttrt.common.util import *
+from ..utils import (
+    TT_MLIR_HOME,
+    Helper,
+    DeviceContext,
+    assert_pcc,
+    get_runtime_tensor_from_torch,
+    get_to_layout_inputs,
+)
+
+FLATBUFFER_BASE_PATH = (
+    f"{TT_MLIR_HOME}/build/test/ttmlir/Silicon/TTNN/n150/optimizer/Output"
+)
+
+INPUT_SHAPE = (1, 8, 8, 2)
+OUTPUT_SHAPE = (1, 8, 8, 4)
+
+
+def initialize_binary(helper: Helper, request):
+    binary_path = os.path.join(
+        FLATBUFFER_BASE_PATH, "prepare_conv2d_weights_on_host.mlir.tmp.ttnn"
+    )
+    if not os.path.exists(binary_path):
+        pytest.skip("prepare_conv2d_weights_on_host.mlir requires opmodel")
+    helper.initialize(request.node.name, binary_path)
+    helper.check_constraints()
+
+
+def get_program_index(helper: Helper, name):
+    programs = helper.binary.fbb_dict["programs"]
+    return next(i for i, program in enumerate(programs) if program["name"] == name)
+
+
+# The weights the test stores as constants.
+def get_weights(shape):
+    return ((torch.arange(torch.Size(shape).numel()) % 16 - 8) / 8).reshape(shape)
+
+
+def run_program(helper: Helper, device, name, inputs):
+    program_index = get_program_index(helper, name)
+    inputs = get_to_layout_inputs(
+        device,
+        [get_runtime_tensor_from_torch(input) for input in inputs],
+        helper.binary,
+        program_index,
+    )
+    output = ttrt.runtime.submit(device, helper.binary.fbb, program_index, inputs)[0]
+    host = ttrt.runtime.to_host(output, untilize=True)[0]
+    result = torch.empty(OUTPUT_SHAPE, dtype=torch.bfloat16)
+    ttrt.runtime.memcpy(result.data_ptr(), host)
+    ttrt.runtime.deallocate_tensor(output, force=True)
+    ttrt.runtime.deallocate_tensor(host, force=True)
+    return result
+
+
+# Both programs run the same height sharded conv2d, one with the weight matrix
+# prepared on the host at compile time and one with the weights prepared by
+# ttnn::prepare_conv_weights, so the outputs only match if the host layout is
+# the one ttnn produces.
+@pytest.mark.parametrize(
+    "kernel, weight_shape", [("1x1", (4, 2, 1, 1)), ("3x3", (4, 2, 3, 3))]
+)
+def test_conv2d_weights_on_host(helper: Helper, kernel, weight_shape, request):
+    initialize_binary(helper, request)
+
+    activations = torch.randn(INPUT_SHAPE, dtype=torch.bfloat16)
+    weights = get_weights(weight_shape).to(torch.bfloat16)
+    with DeviceContext(mesh_shape=[1, 1]) as device:
+        on_host = run_program(helper, device, f"conv2d_{kernel}_on_host", [activations])
+        on_device = run_program(
+            helper, device, f"conv2d_{kernel}_on_device", [activations, weights]
+        )
+
+    assert torch.equal(on_host, on_device)
+    helper.teardown()
+
+
+# Grouped convolutions are prepared on the device, check the weights stored in
+# the binary give the reference result.
+def test_conv2d_grouped_weights(helper: Helper, request):
+    initialize_binary(helper, request)
+
+    activations = torch.randn(INPUT_SHAPE, dtype=torch.bfloat16)
+    with DeviceContext(mesh_shape=[1, 1]) as device:
+        result = run_program(helper, device, "conv2d_grouped", [activations])
+
+    golden = torch.nn.functional.conv2d(
+        activations.permute(0, 3, 1, 2).float(),
+        get_weights((4, 1, 3, 3)),
+        padding=1,
+        groups=2,
+    ).permute(0, 2, 3, 1)
+    assert_pcc(result.float(), golden)
+    helper.teardown()
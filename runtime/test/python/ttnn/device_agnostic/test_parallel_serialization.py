@@ -0,0 +1,110 @@
+# SPDX-FileCopyrightText: (c) 2025 Tenstorrent AI ULC
+#
+# SPDX-License-Identifier: Apache-2.0
+
+import os
+import pytest
+import ttrt
+import ttrt.runtime
+import torch
+from ttrt.common.util import *
+from ..utils import (
+    TT_MLIR_HOME,
+    Helper,
+    DeviceContext,
+    get_torch_inputs,
+    get_runtime_tensor_from_torch,
+    get_torch_output_container,
+    get_to_layout_inputs,
+)
+
+FLATBUFFER_BASE_PATH = f"{TT_MLIR_HOME}/build/test/ttmlir/Silicon/TTNN/n150/Output"
+
+
+def load_binary(helper: Helper, file_name):
+    binary_path = os.path.join(FLATBUFFER_BASE_PATH, file_name)
+    assert os.path.exists(binary_path), f"Binary file not found: {binary_path}"
+    return Binary(helper.logger, helper.file_manager, binary_path)
+
+
+# Tensor global ids are unique per binary in serial mode and per program in
+# parallel mode, so they are compared as a renumbering.
+def normalize_global_ids(value, renumbering):
+    if isinstance(value, dict):
+        return {
+            key: (
+                renumbering.setdefault(item, len(renumbering))
+                if key == "global_id"
+                else normalize_global_ids(item, renumbering)
+            )
+            for key, item in value.items()
+        }
+    if isinstance(value, list):
+        return [normalize_global_ids(item, renumbering) for item in value]
+    return value
+
+
+@pytest.mark.parametrize(
+    "file_name",
+    [
+        "parallel_serialization.mlir.tmp.ttnn",
+        "parallel_serialization.mlir.tmp.nodebug.ttnn",
+    ],
+)
+def test_matches_serial_binary(helper: Helper, file_name, request):
+    helper.initialize(request.node.name)
+    serial = load_binary(helper, "parallel_serialization.mlir.tmp.serial.ttnn")
+    parallel = load_binary(helper, file_name)
+    with_debug_info = "nodebug" not in file_name
+
+    serial_dict = serial.fbb_dict
+    parallel_dict = parallel.fbb_dict
+    assert parallel_dict["version"] == serial_dict["version"]
+    assert parallel_dict["system_desc"] == serial_dict["system_desc"]
+    assert parallel_dict["constants"] == serial_dict["constants"]
+    assert len(parallel_dict["constants"]) == 1
+    assert len(parallel_dict["programs"]) == len(serial_dict["programs"])
+
+    for serial_program, parallel_program in zip(
+        serial_dict["programs"], parallel_dict["programs"]
+    ):
+        if with_debug_info:
+            assert parallel_program["debug_info"] == serial_program["debug_info"]
+        else:
+            assert not parallel_program.get("debug_info")
+        serial_program.pop("debug_info", None)
+        parallel_program.pop("debug_info", None)
+        assert normalize_global_ids(parallel_program, {}) == normalize_global_ids(
+            serial_program, {}
+        )
+    helper.teardown()
+
+
+# Both binaries run every program with the same inputs to the same outputs.
+def test_parallel_binary_execution(helper: Helper, request):
+    helper.initialize(request.node.name)
+    serial = load_binary(helper, "parallel_serialization.mlir.tmp.serial.ttnn")
+    parallel = load_binary(helper, "parallel_serialization.mlir.tmp.ttnn")
+    parallel.check_system_desc(helper.query)
+
+    with DeviceContext(mesh_shape=[1, 1]) as device:
+        for program_index in range(parallel.get_num_programs()):
+            program = parallel.get_program(program_index)
+            inputs_torch = get_torch_inputs(program)
+            results = []
+            for binary in (serial, parallel):
+                inputs = get_to_layout_inputs(
+                    device,
+                    [get_runtime_tensor_from_torch(input) for input in inputs_torch],
+                    binary,
+                    program_index,
+                )
+                outputs = ttrt.runtime.submit(device, binary.fbb, program_index, inputs)
+                result = ttrt.runtime.to_host(outputs[0], untilize=True)[0]
+                result_torch = get_torch_output_container(program)
+                ttrt.runtime.memcpy(result_torch.data_ptr(), result)
+                ttrt.runtime.deallocate_tensor(outputs[0], force=True)
+                ttrt.runtime.deallocate_tensor(result, force=True)
+                results.append(result_torch)
+            assert torch.equal(results[0], results[1])
+    helper.teardown()
@@ -0,0 +1,67 @@
+# SPDX-FileCopyrightText: (c) 2025 Tenstorrent AI ULC
+#
+# SPDX-License-Identifier: Apache-2.0
+
+import json
+import os
+import pytest
+import torch
+from ttrt.common.api import API
+from ttrt.common.callback import quantize_block_float
+from ..utils import TT_MLIR_HOME
+
+FLATBUFFER_BASE_PATH = (
+    f"{TT_MLIR_HOME}/build/test/ttmlir/Silicon/TTNN/n150/matmul/Output"
+)
+
+
+def test_quantize_block_float():
+    # Values with few mantissa bits survive, the small values of a block that
+    # share its large exponent are flushed.
+    tensor = torch.tensor([[1.0, -3.0, 5.0, 96.0] + [0.0] * 12])
+    assert torch.equal(quantize_block_float(tensor, mantissa_bits=7), tensor)
+    quantized = quantize_block_float(tensor, mantissa_bits=3)
+    assert torch.equal(quantized[0, :4], torch.tensor([0.0, 0.0, 0.0, 96.0]))
+
+    # Blocks are formed along the last dim, padding a partial block. Values are
+    # off by at most a step, the largest ones can be clamped to the max mantissa.
+    tensor = torch.randn(4, 40)
+    for mantissa_bits in (3, 7):
+        quantized = quantize_block_float(tensor, mantissa_bits)
+        assert quantized.shape == tensor.shape
+        blocks = torch.nn.functional.pad(tensor, (0, 8)).reshape(-1, 16)
+        step = 2 ** (
+            torch.floor(torch.log2(blocks.abs().amax(dim=1))) - (mantissa_bits - 1)
+        )
+        error = torch.nn.functional.pad(quantized - tensor, (0, 8)).reshape(-1, 16)
+        assert torch.all(error.abs() <= step.unsqueeze(1))
+
+
+@pytest.mark.skipif(
+    os.environ.get("TT_RUNTIME_DEBUG", "OFF") != "ON",
+    reason="precision sensitivity runs in an op callback, which needs TT_RUNTIME_DEBUG",
+)
+def test_precision_sensitivity_report(tmp_path):
+    binary_path = os.path.join(
+        FLATBUFFER_BASE_PATH, "matmul_precision_sensitivity.mlir.tmp.ttnn"
+    )
+    assert os.path.exists(binary_path), f"Binary file not found: {binary_path}"
+    report_path = tmp_path / "sensitivity.json"
+
+    run_instance = API.Run(
+        args={
+            "binary": binary_path,
+            "--precision-sensitivity": str(report_path),
+            "--disable-golden": True,
+            "--result-file": str(tmp_path / "result.json"),
+        }
+    )
+    run_instance()
+
+    with open(report_path) as f:
+        report = json.load(f)
+    # Both matmuls are reported by location name, and the format with fewer
+    # mantissa bits always loses more.
+    assert set(report) == {"matmul_0", "matmul_1"}
+    for errors in report.values():
+        assert 0.0 < errors["bfp_bf8"] < errors["bfp_bf4"]
@@ -0,0 +1,146 @@
+# SPDX-FileCopyrightText: (c) 2025 Tenstorrent AI ULC
+#
+# SPDX-License-Identifier: Apache-2.0
+
+import os
+import pytest
+import ttrt
+import ttrt.runtime
+import torch
+from ttrt.common.util import *
+from ..utils import (
+    TT_MLIR_HOME,
+    Helper,
+    DeviceContext,
+    get_runtime_tensor_from_torch,
+    get_to_layout_inputs,
+)
+
+FLATBUFFER_BASE_PATH = (
+    f"{TT_MLIR_HOME}/build/test/ttmlir/Silicon/TTNN/n150/trace/Output"
+)
+
+SHAPE = (64, 128)
+
+
+def initialize_binary(helper: Helper, request):
+    binary_path = os.path.join(FLATBUFFER_BASE_PATH, "program_trace.mlir.tmp.ttnn")
+    assert os.path.exists(binary_path), f"Binary file not found: {binary_path}"
+    helper.initialize(request.node.name, binary_path)
+    helper.check_constraints()
+    assert helper.binary.get_num_programs() == 2
+
+
+# Ops run by the program executor. Trace replays do not go through the
+# executor, so this count only grows on regular runs and captures.
+def get_op_count(name):
+    metrics = ttrt.runtime.get_metrics()
+    return sum(op.count for op in metrics.ops if op.name == name)
+
+
+def get_device_inputs(device, helper: Helper, program_index, inputs_torch):
+    inputs_runtime = [get_runtime_tensor_from_torch(input) for input in inputs_torch]
+    inputs_runtime = get_to_layout_inputs(
+        device, inputs_runtime, helper.binary, program_index
+    )
+    # Traces are only used for inputs the program cannot deallocate.
+    for input in inputs_runtime:
+        input.set_retain(True)
+    return inputs_runtime
+
+
+def to_torch(tensor):
+    host = ttrt.runtime.to_host(tensor, untilize=True)[0]
+    result = torch.empty(SHAPE, dtype=torch.bfloat16)
+    ttrt.runtime.memcpy(result.data_ptr(), host)
+    ttrt.runtime.deallocate_tensor(host, force=True)
+    return result
+
+
+def assert_close(tensor, golden):
+    assert torch.allclose(to_torch(tensor), golden, rtol=1e-2, atol=1e-2)
+
+
+def test_program_trace_replay(helper: Helper, request):
+    initialize_binary(helper, request)
+
+    lhs = torch.randn(SHAPE, dtype=torch.bfloat16)
+    rhs = torch.randn(SHAPE, dtype=torch.bfloat16)
+    ttrt.runtime.set_metrics_enabled(True)
+    with DeviceContext(mesh_shape=[1, 1], enable_program_trace=True) as device:
+        inputs = get_device_inputs(device, helper, 0, [lhs, rhs])
+        ttrt.runtime.reset_metrics()
+
+        # The first submit runs the program and then captures it.
+        captured = ttrt.runtime.submit(device, helper.binary.fbb, 0, inputs)
+        assert_close(captured[0], lhs + rhs)
+        assert get_op_count("EltwiseBinaryOp") == 2
+
+        replayed = ttrt.runtime.submit(device, helper.binary.fbb, 0, inputs)
+        assert_close(replayed[0], lhs + rhs)
+        assert get_op_count("EltwiseBinaryOp") == 2
+
+        # Writing new data into an input buffer keeps the trace, and the replay
+        # must not overwrite the outputs of the previous submit.
+        new_lhs = torch.randn(SHAPE, dtype=torch.bfloat16)
+        new_lhs_device = get_device_inputs(device, helper, 0, [new_lhs])[0]
+        new_lhs_host = ttrt.runtime.to_host(new_lhs_device, untilize=False)[0]
+        ttrt.runtime.memcpy(inputs[0], new_lhs_host)
+        updated = ttrt.runtime.submit(device, helper.binary.fbb, 0, inputs)
+        assert_close(updated[0], new_lhs + rhs)
+        assert_close(replayed[0], lhs + rhs)
+        assert get_op_count("EltwiseBinaryOp") == 2
+
+        # New input buffers invalidate the trace, it is captured again.
+        new_inputs = get_device_inputs(device, helper, 0, [rhs, rhs])
+        recaptured = ttrt.runtime.submit(device, helper.binary.fbb, 0, new_inputs)
+        assert_close(recaptured[0], rhs + rhs)
+        assert get_op_count("EltwiseBinaryOp") == 4
+
+        for tensor in (
+            captured
+            + replayed
+            + updated
+            + recaptured
+            + inputs
+            + new_inputs
+            + [new_lhs_device, new_lhs_host]
+        ):
+            ttrt.runtime.deallocate_tensor(tensor, force=True)
+    ttrt.runtime.set_metrics_enabled(False)
+    helper.teardown()
+
+
+def test_program_trace_deallocate(helper: Helper, request):
+    initialize_binary(helper, request)
+
+    lhs = torch.randn(SHAPE, dtype=torch.bfloat16)
+    rhs = torch.randn(SHAPE, dtype=torch.bfloat16)
+    ttrt.runtime.set_metrics_enabled(True)
+    with DeviceContext(mesh_shape=[1, 1], enable_program_trace=True) as device:
+        inputs = get_device_inputs(device, helper, 1, [lhs, rhs])
+        ttrt.runtime.reset_metrics()
+
+        # The program deallocates its inputs and an intermediate, it is still
+        # run and then captured.
+        captured = ttrt.runtime.submit(device, helper.binary.fbb, 1, inputs)
+        assert_close(captured[0], (lhs + rhs) * rhs)
+        assert get_op_count("EltwiseBinaryOp") == 4
+        assert get_op_count("DeallocateOp") > 0
+
+        # Tensors allocated after the capture must not get the buffer of the
+        # deallocated intermediate, replays would write into it.
+        fill = torch.full(SHAPE, 3.0, dtype=torch.bfloat16)
+        others = get_device_inputs(device, helper, 1, [fill, fill])
+        for _ in range(3):
+            replayed = ttrt.runtime.submit(device, helper.binary.fbb, 1, inputs)
+            assert_close(replayed[0], (lhs + rhs) * rhs)
+            ttrt.runtime.deallocate_tensor(replayed[0], force=True)
+        assert get_op_count("EltwiseBinaryOp") == 4
+        for other in others:
+            assert_close(other, fill)
+
+        for tensor in captured + inputs + others:
+            ttrt.runtime.deallocate_tensor(tensor, force=True)
+    ttrt.runtime.set_metrics_enabled(False)
+    helper.teardown()
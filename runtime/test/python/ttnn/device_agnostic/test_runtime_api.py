@@ -47,6 +47,30 @@ def test_tensor_buffer_api(shape, dtype):
     assert torch.equal(torch_tensor, reconstructed_tensor)
 
 
+@pytest.mark.parametrize("shape", [(64, 128)])
+@pytest.mark.parametrize("dtype", [torch.float32, torch.bfloat16])
+def test_tensor_data_view(shape, dtype):
+    torch_tensor = torch.randn(shape, dtype=dtype)
+    rt_tensor = ttrt.runtime.create_tensor(
+        torch_tensor.data_ptr(),
+        list(torch_tensor.shape),
+        list(torch_tensor.stride()),
+        torch_tensor.element_size(),
+        Binary.Program.to_data_type(dtype),
+    )
+    assert rt_tensor.has_data_view()
+
+    view = memoryview(rt_tensor)
+    assert view.readonly
+    assert list(view.shape) == list(shape)
+    assert view.nbytes == torch_tensor.numel() * torch_tensor.element_size()
+
+    # Borrowed host tensors are exposed without copying.
+    view_tensor = torch.frombuffer(view, dtype=dtype).reshape(shape)
+    assert view_tensor.data_ptr() == torch_tensor.data_ptr()
+    assert torch.equal(torch_tensor, view_tensor)
+
+
 @pytest.mark.parametrize("should_retain", [True, False])
 def test_tensor_retain_api(helper: Helper, should_retain, request):
     helper.initialize(request.node.name)
@@ -0,0 +1,78 @@
+# SPDX-FileCopyrightText: (c) 2025 Tenstorrent AI ULC
+#
+# SPDX-License-Identifier: Apache-2.0
+
+import os
+import pytest
+import ttrt
+import ttrt.runtime
+import torch
+from ttrt.common.util import *
+from ..utils import (
+    TT_MLIR_HOME,
+    Helper,
+    DeviceContext,
+    assert_pcc,
+    get_runtime_tensor_from_torch,
+    get_to_layout_inputs,
+)
+
+FLATBUFFER_BASE_PATH = f"{TT_MLIR_HOME}/build/test/ttmlir/Silicon/StableHLO/n150/Output"
+
+
+def initialize_binary(helper: Helper, request):
+    binary_path = os.path.join(FLATBUFFER_BASE_PATH, "shape_bucketing.mlir.tmp.ttnn")
+    assert os.path.exists(binary_path), f"Binary file not found: {binary_path}"
+    helper.initialize(request.node.name, binary_path)
+    helper.check_constraints()
+    buckets = [
+        helper.binary.get_program(i).program["shape_bucket"]
+        for i in range(helper.binary.get_num_programs())
+    ]
+    assert sorted(bucket["size"] for bucket in buckets) == [32, 64]
+    assert all(bucket["name"] == "forward" for bucket in buckets)
+
+
+# 32 matches a bucket exactly, 40 is zero padded to the 64 bucket and the
+# output is sliced back.
+@pytest.mark.parametrize("seq_len", [32, 40])
+def test_submit_bucketed(helper: Helper, seq_len, request):
+    initialize_binary(helper, request)
+
+    activations = torch.randn((1, seq_len, 64), dtype=torch.float32)
+    weights = torch.randn((64, 64), dtype=torch.float32)
+    inputs_runtime = [
+        get_runtime_tensor_from_torch(activations),
+        get_runtime_tensor_from_torch(weights),
+    ]
+
+    with DeviceContext(mesh_shape=[1, 1]) as device:
+        inputs_runtime = get_to_layout_inputs(device, inputs_runtime, helper.binary, 0)
+        outputs = ttrt.runtime.submit_bucketed(
+            device, helper.binary.fbb, "forward", inputs_runtime
+        )
+        assert len(outputs) == 1
+        result = ttrt.runtime.to_host(outputs[0], untilize=True)[0]
+        assert list(result.get_shape()) == [1, seq_len, 64]
+        result_torch = torch.empty((1, seq_len, 64), dtype=torch.float32)
+        ttrt.runtime.memcpy(result_torch.data_ptr(), result)
+        ttrt.runtime.deallocate_tensor(outputs[0], force=True)
+        ttrt.runtime.deallocate_tensor(result, force=True)
+
+    assert_pcc(activations @ weights, result_torch, threshold=0.99)
+    helper.teardown()
+
+
+def test_submit_bucketed_too_large(helper: Helper, request):
+    initialize_binary(helper, request)
+
+    inputs_runtime = [
+        get_runtime_tensor_from_torch(torch.randn((1, 65, 64))),
+        get_runtime_tensor_from_torch(torch.randn((64, 64))),
+    ]
+    with DeviceContext(mesh_shape=[1, 1]) as device:
+        with pytest.raises(Exception):
+            ttrt.runtime.submit_bucketed(
+                device, helper.binary.fbb, "forward", inputs_runtime
+            )
+    helper.teardown()
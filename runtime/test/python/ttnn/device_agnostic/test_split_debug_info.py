@@ -0,0 +1,72 @@
+# SPDX-FileCopyrightText: (c) 2025 Tenstorrent AI ULC
+#
+# SPDX-License-Identifier: Apache-2.0
+
+import os
+import shutil
+import ttrt
+import ttrt.binary
+from ..utils import TT_MLIR_HOME
+
+FLATBUFFER_BASE_PATH = f"{TT_MLIR_HOME}/build/test/ttmlir/Silicon/TTNN/n150/Output"
+BINARY_PATH = os.path.join(FLATBUFFER_BASE_PATH, "split_debug_info.mlir.tmp.ttnn")
+DEBUG_INFO_PATH = os.path.join(
+    FLATBUFFER_BASE_PATH, "split_debug_info.mlir.tmp.ttnndbg"
+)
+OTHER_DEBUG_INFO_PATH = os.path.join(
+    FLATBUFFER_BASE_PATH, "split_debug_info.mlir.tmp.other.ttnndbg"
+)
+
+
+def load_binary():
+    assert os.path.exists(BINARY_PATH), f"Binary file not found: {BINARY_PATH}"
+    return ttrt.binary.load_binary_from_path(BINARY_PATH)
+
+
+def get_debug_info(binary):
+    return ttrt.binary.as_dict(binary)["programs"][0].get("debug_info")
+
+
+# The split binary only refers to its debug info file.
+def test_debug_info_ref():
+    binary_dict = ttrt.binary.as_dict(load_binary())
+    assert os.path.samefile(binary_dict["debug_info_ref"]["path"], DEBUG_INFO_PATH)
+
+
+def test_load_debug_info():
+    binary = load_binary()
+    debug_info = get_debug_info(binary)
+    assert debug_info is not None
+    assert "@split_debug_info " in debug_info["mlir"]["source"]
+    assert "ttnn.add" in debug_info["mlir"]["source"]
+    # The compiler doesn't store goldens, the lookup goes through the loaded
+    # file and finds none.
+    assert binary.get_debug_info_golden("add") is None
+
+
+def test_moved_debug_info(tmp_path):
+    moved_path = str(tmp_path / "moved.ttnndbg")
+    shutil.copyfile(DEBUG_INFO_PATH, moved_path)
+    binary = load_binary()
+    binary.set_debug_info_path(moved_path)
+    debug_info = get_debug_info(binary)
+    assert debug_info is not None
+    assert "@split_debug_info " in debug_info["mlir"]["source"]
+
+
+# The debug info file of another binary fails the hash check and is ignored,
+# setting the path again reloads the file.
+def test_debug_info_hash_mismatch():
+    binary = load_binary()
+    binary.set_debug_info_path(OTHER_DEBUG_INFO_PATH)
+    assert get_debug_info(binary) is None
+    assert binary.get_debug_info_golden("add") is None
+
+    binary.set_debug_info_path(DEBUG_INFO_PATH)
+    assert get_debug_info(binary) is not None
+
+
+def test_missing_debug_info(tmp_path):
+    binary = load_binary()
+    binary.set_debug_info_path(str(tmp_path / "missing.ttnndbg"))
+    assert get_debug_info(binary) is None
@@ -0,0 +1,57 @@
+# SPDX-FileCopyrightText: (c) 2025 Tenstorrent AI ULC
+#
+# SPDX-License-Identifier: Apache-2.0
+
+import os
+import pytest
+import ttrt
+import ttrt.runtime
+import torch
+from ttrt.common.util import *
+from ..utils import (
+    TT_MLIR_HOME,
+    Helper,
+    DeviceContext,
+    get_torch_inputs,
+    get_runtime_tensor_from_torch,
+    get_torch_output_container,
+    get_to_layout_inputs,
+)
+
+FLATBUFFER_BASE_PATH = (
+    f"{TT_MLIR_HOME}/build/test/ttmlir/Silicon/TTNN/n150/control_flow/Output"
+)
+
+
+@pytest.mark.parametrize("start", [7.0, 10.0])
+def test_while_loop(helper: Helper, start, request):
+    binary_path = os.path.join(FLATBUFFER_BASE_PATH, "while.mlir.tmp.ttnn")
+    assert os.path.exists(binary_path), f"Binary file not found: {binary_path}"
+    helper.initialize(request.node.name, binary_path)
+    helper.check_constraints()
+
+    # The loop regions are emitted as separate programs after the main one.
+    assert helper.binary.get_num_programs() == 3
+    program: Binary.Program = helper.binary.get_program(0)
+    assert program.num_inputs() == 2
+
+    inputs_torch = get_torch_inputs(program)
+    inputs_torch[0].fill_(start)
+    inputs_runtime = [get_runtime_tensor_from_torch(input) for input in inputs_torch]
+    torch_result_tensor = get_torch_output_container(program)
+
+    with DeviceContext(mesh_shape=[1, 1]) as device:
+        inputs_runtime = get_to_layout_inputs(device, inputs_runtime, helper.binary, 0)
+        outputs = ttrt.runtime.submit(device, helper.binary.fbb, 0, inputs_runtime)
+        assert len(outputs) == 1
+        result = ttrt.runtime.to_host(outputs[0], untilize=True)[0]
+        ttrt.runtime.memcpy(torch_result_tensor.data_ptr(), result)
+        ttrt.runtime.deallocate_tensor(outputs[0], force=True)
+        ttrt.runtime.deallocate_tensor(result, force=True)
+
+    # The body doubles the data once per iteration while the counter is below
+    # 10, a loop that starts at 10 returns its input unchanged.
+    num_iterations = max(0, 10 - int(start))
+    golden = inputs_torch[1] * (2**num_iterations)
+    assert torch.allclose(golden, torch_result_tensor, rtol=1e-2, atol=1e-2)
+    helper.teardown()
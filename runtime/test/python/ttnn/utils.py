@@ -53,11 +53,24 @@ class Helper:
 
 
 class DeviceContext:
-    def __init__(self, mesh_shape, mesh_offset=None, enable_program_cache=None):
+    def __init__(
+        self,
+        mesh_shape,
+        mesh_offset=None,
+        enable_program_cache=None,
+        enable_program_trace=False,
+        async_queue_depth=None,
+        num_hw_cqs=None,
+    ):
         options = ttrt.runtime.MeshDeviceOptions()
         if mesh_offset is not None:
             options.mesh_offset = mesh_offset
         options.enable_program_cache = enable_program_cache
+        options.enable_program_trace = enable_program_trace
+        if async_queue_depth is not None:
+            options.async_queue_depth = async_queue_depth
+        if num_hw_cqs is not None:
+            options.num_hw_cqs = num_hw_cqs
         self.device = ttrt.runtime.open_mesh_device(mesh_shape, options)
 
     def __enter__(self):
@@ -0,0 +1,134 @@
+// SPDX-FileCopyrightText: (c) 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+// Measures the throughput of the host conversion library.
+//
+// Usage: host-conversion-benchmark [rows] [cols] [iterations] [threads]
+
+#include "tt/runtime/detail/host_conversion.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace hc = ::tt::runtime::host_conversion;
+
+namespace {
+
+// Runs `fn` `iterations` times and reports the throughput as the number of
+// bytes read and written per second.
+void report(const std::string &name, std::size_t bytesPerIteration,
+            std::uint32_t iterations, const std::function<void()> &fn) {
+  // Warm up caches and page in the destination buffers.
+  fn();
+
+  auto start = std::chrono::steady_clock::now();
+  for (std::uint32_t i = 0; i < iterations; ++i) {
+    fn();
+  }
+  std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+
+  double gbPerSecond = static_cast<double>(bytesPerIteration) * iterations /
+                       elapsed.count() / 1e9;
+  std::cout << std::left << std::setw(24) << name << std::right
+            << std::setw(10) << std::fixed << std::setprecision(2)
+            << gbPerSecond << " GB/s" << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  std::uint32_t rows = argc > 1 ? std::stoul(argv[1]) : 4096;
+  std::uint32_t cols = argc > 2 ? std::stoul(argv[2]) : 4096;
+  std::uint32_t iterations = argc > 3 ? std::stoul(argv[3]) : 10;
+
+  hc::ConversionOptions options;
+  options.numThreads = argc > 4 ? std::stoul(argv[4]) : 0;
+
+  hc::MatrixShape shape;
+  shape.rows = rows;
+  shape.cols = cols;
+  std::size_t numElements = static_cast<std::size_t>(rows) * cols;
+  std::size_t numTiledElements = shape.numTiles() * hc::tileVolume;
+
+  std::mt19937 gen(0);
+  std::normal_distribution<float> dist;
+  std::vector<float> rowMajor(numElements);
+  for (float &value : rowMajor) {
+    value = dist(gen);
+  }
+
+  std::vector<float> tiled(numTiledElements);
+  std::vector<float> untiled(numElements);
+  std::vector<std::uint16_t> bf16(numElements);
+  std::vector<std::uint16_t> tiledBf16(numTiledElements);
+  std::vector<std::uint8_t> bfp8(
+      shape.numTiles() *
+      hc::getBlockFloatTileSizeBytes(hc::BlockFloatFormat::BFP8));
+  std::vector<std::uint8_t> bfp4(
+      shape.numTiles() *
+      hc::getBlockFloatTileSizeBytes(hc::BlockFloatFormat::BFP4));
+
+  std::cout << "shape " << rows << "x" << cols << ", " << iterations
+            << " iterations" << std::endl;
+
+  report("tilize fp32", 2 * numElements * sizeof(float), iterations, [&] {
+    hc::tilize(rowMajor.data(), tiled.data(), sizeof(float), shape, options);
+  });
+  report("untilize fp32", 2 * numElements * sizeof(float), iterations, [&] {
+    hc::untilize(tiled.data(), untiled.data(), sizeof(float), shape, options);
+  });
+  report("fp32 -> bf16", numElements * (sizeof(float) + sizeof(std::uint16_t)),
+         iterations, [&] {
+           hc::float32ToBFloat16(rowMajor.data(), bf16.data(), numElements,
+                                 options);
+         });
+  report("bf16 -> fp32", numElements * (sizeof(float) + sizeof(std::uint16_t)),
+         iterations, [&] {
+           hc::bfloat16ToFloat32(bf16.data(), untiled.data(), numElements,
+                                 options);
+         });
+
+  hc::float32ToBFloat16(tiled.data(), tiledBf16.data(), numTiledElements,
+                        options);
+  struct BlockFloatCase {
+    const char *name;
+    hc::BlockFloatFormat format;
+    std::vector<std::uint8_t> &packed;
+  };
+  for (const BlockFloatCase &blockFloat :
+       {BlockFloatCase{"bfp8", hc::BlockFloatFormat::BFP8, bfp8},
+        BlockFloatCase{"bfp4", hc::BlockFloatFormat::BFP4, bfp4}}) {
+    std::string name = blockFloat.name;
+    report("fp32 -> " + name,
+           numTiledElements * sizeof(float) + blockFloat.packed.size(),
+           iterations, [&] {
+             hc::packBlockFloatTiles(tiled.data(), blockFloat.packed.data(),
+                                     shape.numTiles(), blockFloat.format,
+                                     options);
+           });
+    report("bf16 -> " + name,
+           numTiledElements * sizeof(std::uint16_t) + blockFloat.packed.size(),
+           iterations, [&] {
+             hc::packBlockFloatTiles(tiledBf16.data(), blockFloat.packed.data(),
+                                     shape.numTiles(), blockFloat.format,
+                                     options);
+           });
+    report(name + " -> fp32",
+           numTiledElements * sizeof(float) + blockFloat.packed.size(),
+           iterations, [&] {
+             hc::unpackBlockFloatTiles(blockFloat.packed.data(), tiled.data(),
+                                       shape.numTiles(), blockFloat.format,
+                                       options);
+           });
+  }
+
+  return EXIT_SUCCESS;
+}
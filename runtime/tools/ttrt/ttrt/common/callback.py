@@ -25,6 +25,7 @@ class CallbackRuntimeConfig:
         enable_debugger=False,
         golden_report={},
         memory_report={},
+        enable_precision_sensitivity=False,
     ):
         self.device = device
         self.artifact_dir = artifact_dir
@@ -38,6 +39,10 @@ class CallbackRuntimeConfig:
         self.enable_debugger = enable_debugger
         self.golden_report = golden_report
         self.memory_report = memory_report
+        self.enable_precision_sensitivity = enable_precision_sensitivity
+        # Collected across all programs of a binary, since op location names
+        # are unique within the module.
+        self.precision_sensitivity_report = {}
         self.counter = -1
 
     def start_new_callback(self, artifact_dir):
@@ -62,6 +67,14 @@ class CallbackRuntimeConfig:
 
         self.logging.debug(f"Saved memory report to={memory_report_path}")
 
+    def save_precision_sensitivity_report(self, precision_sensitivity_path):
+        with open(precision_sensitivity_path, "w") as json_file:
+            json.dump(self.precision_sensitivity_report, json_file, indent=4)
+
+        self.logging.debug(
+            f"Saved precision sensitivity report to={precision_sensitivity_path}"
+        )
+
     def check_pcc(self):
         for loc, golden_data in self.golden_report.items():
             if golden_data["actual_pcc"] < golden_data["expected_pcc"]:
@@ -262,6 +275,94 @@ def memory(callback_runtime_config, binary, program_context, op_context):
     ] = op_memory_report
 
 
+"""
+-----------------------PRECISION SENSITIVITY CALLBACK-----------------------
+"""
+
+# Mantissa bits of the block-float formats the automatic precision pass can
+# store weights in, keyed by the names it reads from the sensitivity file.
+BLOCK_FLOAT_MANTISSA_BITS = {"bfp_bf8": 7, "bfp_bf4": 3}
+
+
+def quantize_block_float(tensor, mantissa_bits, block_size=16):
+    """Round `tensor` like a tiled tensor stored in a block-float format.
+
+    Every `block_size` consecutive values of a row share the exponent of their
+    largest magnitude and keep `mantissa_bits` bits of mantissa with an
+    explicit leading one, like a face row of a bfp tile.
+    """
+    import torch
+
+    tensor = tensor.to(torch.float32)
+    shape = tensor.shape
+    padding = (-shape[-1]) % block_size
+    blocks = torch.nn.functional.pad(tensor, (0, padding)).reshape(-1, block_size)
+
+    max_abs = blocks.abs().amax(dim=1, keepdim=True)
+    exponent = torch.floor(torch.log2(max_abs.clamp(min=torch.finfo().tiny)))
+    step = torch.pow(2.0, exponent - (mantissa_bits - 1))
+    max_mantissa = 2**mantissa_bits - 1
+    quantized = (blocks / step).round().clamp(-max_mantissa, max_mantissa) * step
+
+    return quantized.reshape(*shape[:-1], shape[-1] + padding)[..., : shape[-1]]
+
+
+def get_loc_name(loc):
+    """Return the name of a `loc("name")` location, or None for other ones."""
+    match = re.match(r'loc\("([^"]*)"', loc)
+    return match.group(1) if match else None
+
+
+def precision_sensitivity(callback_runtime_config, binary, program_context, op_context):
+    import torch
+    import ttrt.runtime
+
+    logging = callback_runtime_config.logging
+    debug_str = ttrt.runtime.get_op_debug_str(op_context)
+    if not re.search(r'"ttnn\.(matmul|linear)"', debug_str):
+        return
+
+    # The automatic precision pass looks ops up by their location name.
+    loc_name = get_loc_name(ttrt.runtime.get_op_loc_info(op_context))
+    if not loc_name:
+        logging.debug("Op has no location name - skipping precision sensitivity")
+        return
+
+    inputs = []
+    for tensor in ttrt.runtime.get_op_input_tensors(op_context, program_context):
+        dtype = ttrt_datatype_to_torch_dtype(tensor.get_dtype())
+        inputs.append(
+            torch.frombuffer(tensor.get_data_buffer(), dtype=dtype)
+            .reshape(tensor.get_shape())
+            .to(torch.float32)
+        )
+    if len(inputs) < 2:
+        logging.debug("Op inputs not available - skipping precision sensitivity")
+        return
+
+    a, weight = inputs[0], inputs[1]
+    bias = inputs[2] if len(inputs) > 2 else None
+
+    def execute(b):
+        lhs = a.transpose(-1, -2) if "transpose_a = true" in debug_str else a
+        rhs = b.transpose(-1, -2) if "transpose_b = true" in debug_str else b
+        result = torch.matmul(lhs, rhs)
+        return result + bias if bias is not None else result
+
+    # Host f32 reference of the op with its weight as stored on device, and the
+    # same op re-executed with the weight rounded to each block-float format.
+    reference = execute(weight)
+    reference_norm = torch.linalg.vector_norm(reference).item()
+    results = {}
+    for format_name, mantissa_bits in BLOCK_FLOAT_MANTISSA_BITS.items():
+        output = execute(quantize_block_float(weight, mantissa_bits))
+        error = torch.linalg.vector_norm(output - reference).item()
+        results[format_name] = error / reference_norm if reference_norm > 0 else 0.0
+
+    logging.debug(f"Precision sensitivity of {loc_name}: {results}")
+    callback_runtime_config.precision_sensitivity_report[loc_name] = results
+
+
 """
 -----------------------DEBUGGER CALLBACK-----------------------
 """
@@ -295,6 +396,11 @@ def post_op_callback(callback_runtime_config, binary, program_context, op_contex
     if callback_runtime_config.enable_memory:
         memory(callback_runtime_config, binary, program_context, op_context)
 
+    if callback_runtime_config.enable_precision_sensitivity:
+        precision_sensitivity(
+            callback_runtime_config, binary, program_context, op_context
+        )
+
     if callback_runtime_config.enable_debugger:
         debugger(callback_runtime_config, binary, program_context, op_context)
 
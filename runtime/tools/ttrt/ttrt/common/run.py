@@ -3,6 +3,7 @@
 # SPDX-License-Identifier: Apache-2.0
 
 import os
+import time
 
 from ttrt.common.util import *
 from ttrt.common.query import Query
@@ -214,6 +215,13 @@ class Run:
             choices=[True, False],
             help="check for memory leaks (use in conjunction with --memory)",
         )
+        Run.register_arg(
+            name="--precision-sensitivity",
+            type=str,
+            default="",
+            choices=None,
+            help="path of a JSON file to write the error of every matmul and linear op with its weight stored in bfp_bf8 and bfp_bf4, for the automatic-precision-sensitivity-path option of the compiler (use with a single binary, requires a runtime built with TT_RUNTIME_DEBUG)",
+        )
         Run.register_arg(
             name="--disable-eth-dispatch",
             type=bool,
@@ -249,6 +257,20 @@ class Run:
             choices=[True, False],
             help="enable program cache in ttnn runtime",
         )
+        Run.register_arg(
+            name="--enable-program-trace",
+            type=bool,
+            default=False,
+            choices=[True, False],
+            help="capture programs into traces and replay them on later loops in ttnn runtime, requires --trace-region-size",
+        )
+        Run.register_arg(
+            name="--trace-region-size",
+            type=int,
+            default=0,
+            choices=None,
+            help="size of the device trace region in bytes",
+        )
         Run.register_arg(
             name="--dump-device-rate",
             type=int,
@@ -511,6 +533,9 @@ class Run:
             mesh_options = ttrt.runtime.MeshDeviceOptions()
             mesh_options.dispatch_core_type = dispatch_core_type
             mesh_options.enable_program_cache = self["--enable-program-cache"]
+            mesh_options.enable_program_trace = self["--enable-program-trace"]
+            if self["--trace-region-size"] > 0:
+                mesh_options.trace_region_size = self["--trace-region-size"]
             device = ttrt.runtime.open_mesh_device(mesh_shape, mesh_options)
 
             for bin in binaries:
@@ -540,6 +565,9 @@ class Run:
                         not self["--disable-golden"],
                         self["--memory"],
                         self["--debugger"],
+                        enable_precision_sensitivity=bool(
+                            self["--precision-sensitivity"]
+                        ),
                     )
 
                     callback_env = ttrt.runtime.DebugHooks.get(
@@ -696,6 +724,7 @@ class Run:
                             device, inputs, bin.fbb, program_index
                         )
 
+                        runtime_loop_times = []
                         for loop in range(self["--loops"]):
                             self.logging.debug(
                                 f"starting loop={loop+1}/{self['--loops']} for binary={bin.file_path}"
@@ -725,6 +754,7 @@ class Run:
                                             f"Cannot dirty input tensor {input_idx}, only {len(inputs)} inputs available"
                                         )
 
+                            loop_start = time.perf_counter()
                             runtime_outputs = ttrt.runtime.submit(
                                 device,
                                 bin.fbb,
@@ -741,6 +771,7 @@ class Run:
                                 )
 
                             ttrt.runtime.wait(runtime_outputs)
+                            runtime_loop_times.append(time.perf_counter() - loop_start)
                             for i, runtime_output_tensor in enumerate(runtime_outputs):
                                 output_host = ttrt.runtime.to_host(
                                     runtime_output_tensor, untilize=True
@@ -807,13 +838,19 @@ class Run:
                                 device, inputs, bin.fbb, program_index
                             )
 
+                            emitc_loop_times = []
                             for loop in range(self["--loops"]):
+                                loop_start = time.perf_counter()
                                 emitc_outs = ttrt.runtime.testing.run_so_program(
                                     emitc_dylib_handle,
                                     fwd_func_sym,
                                     inputs,
                                     device,
                                 )
+                                ttrt.runtime.wait(emitc_outs)
+                                emitc_loop_times.append(
+                                    time.perf_counter() - loop_start
+                                )
                                 emitc_outs = [
                                     ttrt.runtime.to_host(emitc_out, untilize=True)[0]
                                     for emitc_out in emitc_outs
@@ -838,6 +875,23 @@ class Run:
                                 f"EmitC tensors match for {bin.file_path}"
                             )
 
+                            # The first loop compiles kernels and fills the
+                            # const-eval caches, later loops are steady state.
+                            if self["--loops"] > 1:
+                                runtime_ms = (
+                                    1000
+                                    * sum(runtime_loop_times[1:])
+                                    / len(runtime_loop_times[1:])
+                                )
+                                emitc_ms = (
+                                    1000
+                                    * sum(emitc_loop_times[1:])
+                                    / len(emitc_loop_times[1:])
+                                )
+                                self.logging.info(
+                                    f"Steady-state latency of program_index={program_index}: runtime={runtime_ms:.3f}ms, emitc={emitc_ms:.3f}ms"
+                                )
+
                         if self["--identity"]:
                             self.logging.debug(
                                 f"checking identity with rtol={self['--rtol']} and atol={self['--atol']}"
@@ -944,6 +998,11 @@ class Run:
                             if self["--check-memory-leak"]:
                                 post_op_callback_runtime_config.check_memory_leak()
 
+                    if self["--precision-sensitivity"]:
+                        post_op_callback_runtime_config.save_precision_sensitivity_report(
+                            self["--precision-sensitivity"]
+                        )
+
                 except Exception as e:
                     result = "error"
                     if isinstance(e, TTRTTestException):
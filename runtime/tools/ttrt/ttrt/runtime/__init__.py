@@ -16,6 +16,9 @@ try:
         DebugPerfEnv,
         DebugHooks,
         MeshDeviceOptions,
+        MetricsCounter,
+        RuntimeMetrics,
+        PagedCacheAllocator,
         get_current_runtime,
         set_current_runtime,
         set_compatible_runtime,
@@ -42,6 +45,10 @@ try:
         WorkaroundEnv,
         get_op_loc_info,
         unregister_hooks,
+        set_metrics_enabled,
+        is_metrics_enabled,
+        get_metrics,
+        reset_metrics,
     )
 except ModuleNotFoundError:
     raise ImportError(
@@ -2,9 +2,11 @@
 //
 // SPDX-License-Identifier: Apache-2.0
 
+#include <chrono>
 #include <sstream>
 
 #include "tt/runtime/detail/debug.h"
+#include "tt/runtime/paged_cache.h"
 #include "tt/runtime/runtime.h"
 #include "tt/runtime/utils.h"
 #include "tt/runtime/workarounds.h"
@@ -19,6 +21,29 @@
 
 namespace py = pybind11;
 
+// Python buffer format of the elements exposed by `getTensorDataView`. bf16
+// has no buffer format and is exposed as raw 16 bit words.
+static std::string getBufferFormat(tt::target::DataType dataType) {
+  switch (dataType) {
+  case tt::target::DataType::Float32:
+    return py::format_descriptor<float>::format();
+  case tt::target::DataType::Float16:
+    return "e";
+  case tt::target::DataType::BFloat16:
+  case tt::target::DataType::UInt16:
+    return py::format_descriptor<std::uint16_t>::format();
+  case tt::target::DataType::Int32:
+    return py::format_descriptor<std::int32_t>::format();
+  case tt::target::DataType::UInt32:
+    return py::format_descriptor<std::uint32_t>::format();
+  case tt::target::DataType::UInt8:
+    return py::format_descriptor<std::uint8_t>::format();
+  default:
+    throw py::buffer_error("Unsupported data type for the buffer protocol: " +
+                           std::string(tt::target::EnumNameDataType(dataType)));
+  }
+}
+
 PYBIND11_MODULE(_C, m) {
   m.doc() = "ttrt.runtime python extension for interacting with the "
             "Tenstorrent devices";
@@ -45,11 +70,68 @@ PYBIND11_MODULE(_C, m) {
       .def("get_memory_view", &tt::runtime::detail::getMemoryView,
            py::arg("device_id") = 0);
   py::class_<tt::runtime::Event>(m, "Event");
+  py::class_<tt::runtime::SubmitFuture>(m, "SubmitFuture")
+      .def(
+          "get",
+          [](const tt::runtime::SubmitFuture &future) {
+            py::gil_scoped_release release;
+            return future.get();
+          },
+          "Wait for the submit and return its output tensors, rethrows the "
+          "error of a failed submit")
+      .def("is_ready", [](const tt::runtime::SubmitFuture &future) {
+        return future.wait_for(std::chrono::seconds(0)) ==
+               std::future_status::ready;
+      });
   py::class_<tt::runtime::TensorDesc>(m, "TensorDesc")
       .def_readonly("shape", &tt::runtime::TensorDesc::shape)
       .def_readonly("stride", &tt::runtime::TensorDesc::stride)
       .def_readonly("item_size", &tt::runtime::TensorDesc::itemsize)
       .def_readonly("dtype", &tt::runtime::TensorDesc::dataType);
+  py::class_<tt::runtime::MetricsCounter>(m, "MetricsCounter")
+      .def_readonly("name", &tt::runtime::MetricsCounter::name)
+      .def_readonly("count", &tt::runtime::MetricsCounter::count)
+      .def_readonly("total_ns", &tt::runtime::MetricsCounter::totalNs)
+      .def_readonly("min_ns", &tt::runtime::MetricsCounter::minNs)
+      .def_readonly("max_ns", &tt::runtime::MetricsCounter::maxNs)
+      .def_readonly("histogram", &tt::runtime::MetricsCounter::histogram);
+  py::class_<tt::runtime::RuntimeMetrics>(m, "RuntimeMetrics")
+      .def_readonly("window_ns", &tt::runtime::RuntimeMetrics::windowNs)
+      .def_readonly("programs", &tt::runtime::RuntimeMetrics::programs)
+      .def_readonly("ops", &tt::runtime::RuntimeMetrics::ops)
+      .def_readonly("bytes_to_device",
+                    &tt::runtime::RuntimeMetrics::bytesToDevice)
+      .def_readonly("bytes_from_device",
+                    &tt::runtime::RuntimeMetrics::bytesFromDevice)
+      .def_readonly("const_eval_cache_hits",
+                    &tt::runtime::RuntimeMetrics::constEvalCacheHits)
+      .def_readonly("const_eval_cache_misses",
+                    &tt::runtime::RuntimeMetrics::constEvalCacheMisses)
+      .def_readonly("async_submits", &tt::runtime::RuntimeMetrics::asyncSubmits)
+      .def_readonly("async_max_queue_depth",
+                    &tt::runtime::RuntimeMetrics::asyncMaxQueueDepth)
+      .def_readonly("async_stalls", &tt::runtime::RuntimeMetrics::asyncStalls)
+      .def_readonly("async_stall_ns",
+                    &tt::runtime::RuntimeMetrics::asyncStallNs);
+  py::class_<tt::runtime::PagedCacheAllocator>(m, "PagedCacheAllocator")
+      .def(py::init<std::uint32_t, std::uint32_t, std::uint32_t,
+                    std::uint32_t>(),
+           py::arg("num_blocks"), py::arg("block_size"),
+           py::arg("max_sequences"), py::arg("max_blocks_per_sequence"))
+      .def("reserve", &tt::runtime::PagedCacheAllocator::reserve,
+           py::arg("sequence"), py::arg("num_tokens"),
+           "Grow the sequence to hold num_tokens tokens, returns False and "
+           "allocates nothing if the cache is out of blocks")
+      .def("release", &tt::runtime::PagedCacheAllocator::release,
+           py::arg("sequence"))
+      .def("get_num_free_blocks",
+           &tt::runtime::PagedCacheAllocator::getNumFreeBlocks)
+      .def("get_block_size", &tt::runtime::PagedCacheAllocator::getBlockSize)
+      .def("get_capacity", &tt::runtime::PagedCacheAllocator::getCapacity,
+           py::arg("sequence"))
+      .def("get_page_table", &tt::runtime::PagedCacheAllocator::getPageTable)
+      .def("get_page_table_shape",
+           &tt::runtime::PagedCacheAllocator::getPageTableShape);
   py::class_<tt::runtime::MeshDeviceOptions>(m, "MeshDeviceOptions")
       .def(py::init<>())
       .def_readwrite("mesh_offset", &tt::runtime::MeshDeviceOptions::meshOffset)
@@ -57,6 +139,10 @@ PYBIND11_MODULE(_C, m) {
       .def_readwrite("num_hw_cqs", &tt::runtime::MeshDeviceOptions::numHWCQs)
       .def_readwrite("enable_program_cache",
                      &tt::runtime::MeshDeviceOptions::enableProgramCache)
+      .def_readwrite("enable_program_trace",
+                     &tt::runtime::MeshDeviceOptions::enableProgramTrace)
+      .def_readwrite("async_queue_depth",
+                     &tt::runtime::MeshDeviceOptions::asyncQueueDepth)
       .def_property(
           "l1_small_size",
           [](const tt::runtime::MeshDeviceOptions &o) {
@@ -94,7 +180,29 @@ PYBIND11_MODULE(_C, m) {
                     : std::make_optional(
                           value.cast<tt::runtime::DispatchCoreType>());
           });
-  py::class_<tt::runtime::Tensor>(m, "Tensor")
+  py::class_<tt::runtime::Tensor>(m, "Tensor", py::buffer_protocol())
+      .def_buffer([](tt::runtime::Tensor self) {
+        // Exposes the host storage without copying, the returned buffer keeps
+        // the tensor alive.
+        std::optional<tt::runtime::TensorDataView> view =
+            tt::runtime::getTensorDataView(self);
+        if (!view) {
+          throw py::buffer_error(
+              "Tensor storage is not a row-major host buffer, use "
+              "get_data_buffer() instead");
+        }
+        tt::runtime::TensorDesc desc = tt::runtime::getTensorDesc(self);
+        std::vector<py::ssize_t> shape(desc.shape.begin(), desc.shape.end());
+        std::vector<py::ssize_t> strides(shape.size());
+        py::ssize_t stride = desc.itemsize;
+        for (std::size_t i = shape.size(); i-- > 0;) {
+          strides[i] = stride;
+          stride *= shape[i];
+        }
+        return py::buffer_info(const_cast<void *>(view->data), desc.itemsize,
+                               getBufferFormat(desc.dataType), shape.size(),
+                               shape, strides, /*readonly=*/true);
+      })
       .def("is_allocated",
            [](tt::runtime::Tensor self) {
              return tt::runtime::isTensorAllocated(self);
@@ -138,7 +246,10 @@ PYBIND11_MODULE(_C, m) {
             return py::bytes(reinterpret_cast<const char *>(vec.data()),
                              vec.size());
           },
-          py::return_value_policy::take_ownership);
+          py::return_value_policy::take_ownership)
+      .def("has_data_view", [](tt::runtime::Tensor self) {
+        return tt::runtime::getTensorDataView(self).has_value();
+      });
   py::class_<tt::runtime::Layout>(m, "Layout");
   py::class_<tt::runtime::OpContext>(m, "OpContext");
   py::class_<tt::runtime::CallbackContext>(m, "CallbackContext");
@@ -268,6 +379,51 @@ PYBIND11_MODULE(_C, m) {
       py::arg("inputs"),
       "Submit a ttnn binary for execution, returns a vector of output tensors."
       "The input tensors will be moved and consumed.");
+  m.def(
+      "submit_bucketed",
+      [](::tt::runtime::Device device, ::tt::runtime::Binary &executable,
+         const std::string &programName,
+         std::vector<::tt::runtime::Tensor> &inputs)
+          -> std::vector<::tt::runtime::Tensor> {
+        return ::tt::runtime::submitBucketed(device, executable, programName,
+                                             inputs);
+      },
+      py::arg("device"), py::arg("executable"), py::arg("program_name"),
+      py::arg("inputs"),
+      "Submit the smallest shape bucket of a ttnn program that fits the "
+      "inputs, returns a vector of output tensors sliced to the input size.");
+  m.def(
+      "submit_async",
+      [](::tt::runtime::Device device, ::tt::runtime::Binary &executable,
+         std::uint32_t programIndex, std::vector<::tt::runtime::Tensor> inputs,
+         bool readback) -> ::tt::runtime::SubmitFuture {
+        py::gil_scoped_release release;
+        return ::tt::runtime::submitAsync(device, executable, programIndex,
+                                          std::move(inputs), readback);
+      },
+      py::arg("device"), py::arg("executable"), py::arg("program_index"),
+      py::arg("inputs"), py::arg("readback") = false,
+      "Queue a ttnn binary for execution on a runtime thread, returns a "
+      "future of the output tensors. Host inputs are uploaded and, with "
+      "readback, outputs are copied to the host while other submits execute.");
+  m.def(
+      "synchronize_async",
+      [](::tt::runtime::Device device) {
+        py::gil_scoped_release release;
+        ::tt::runtime::synchronizeAsync(device);
+      },
+      py::arg("device"), "Wait for all async submits to the device");
+  m.def("get_async_queue_depth", &tt::runtime::getAsyncQueueDepth,
+        py::arg("device"), "Number of async submits in flight on the device");
+  m.def("set_metrics_enabled", &tt::runtime::setMetricsEnabled,
+        py::arg("enabled"),
+        "Enable or disable collection of runtime op metrics.");
+  m.def("is_metrics_enabled", &tt::runtime::isMetricsEnabled,
+        "Whether runtime op metrics are being collected.");
+  m.def("get_metrics", &tt::runtime::getMetrics,
+        "Get the runtime metrics collected since the last reset.");
+  m.def("reset_metrics", &tt::runtime::resetMetrics,
+        "Reset the runtime metrics and start a new collection window.");
   m.def(
       "wait", [](::tt::runtime::Event event) { ::tt::runtime::wait(event); },
       py::arg("event"));
@@ -291,6 +447,8 @@ PYBIND11_MODULE(_C, m) {
                    : std::optional<tt::runtime::Tensor>(tensor);
       },
       "Get the output tensor of the op");
+  m.def("get_op_input_tensors", &tt::runtime::getOpInputTensors,
+        "Get the input tensors of a matmul or linear op");
   m.def("get_op_debug_str", &tt::runtime::getOpDebugString,
         "Get the debug string of the op");
   m.def("get_op_loc_info", &tt::runtime::getOpLocInfo,
@@ -0,0 +1,23 @@
+// REQUIRES: stablehlo
+// RUN: ttmlir-opt --stablehlo-to-ttir-pipeline %s | FileCheck %s
+
+module @jit_paged_attention attributes {} {
+  func.func @paged_update_cache(%cache: tensor<128x8x32x64xbf16>, %input: tensor<1x4x8x64xbf16>, %update_index: tensor<4xi32>, %page_table: tensor<4x16xi32>) -> tensor<128x8x32x64xbf16> {
+    // CHECK: "ttir.paged_update_cache"(%arg0, %arg1, %arg2, %arg3)
+    %0 = stablehlo.custom_call @tt.paged_update_cache(%cache, %input, %update_index, %page_table) : (tensor<128x8x32x64xbf16>, tensor<1x4x8x64xbf16>, tensor<4xi32>, tensor<4x16xi32>) -> tensor<128x8x32x64xbf16>
+    return %0 : tensor<128x8x32x64xbf16>
+  }
+
+  func.func @paged_fill_cache(%cache: tensor<128x8x32x64xbf16>, %input: tensor<1x8x256x64xbf16>, %page_table: tensor<4x16xi32>, %batch_idx: tensor<1xi32>) -> tensor<128x8x32x64xbf16> {
+    // CHECK: "ttir.paged_fill_cache"(%arg0, %arg1, %arg2, %arg3)
+    %0 = stablehlo.custom_call @tt.paged_fill_cache(%cache, %input, %page_table, %batch_idx) : (tensor<128x8x32x64xbf16>, tensor<1x8x256x64xbf16>, tensor<4x16xi32>, tensor<1xi32>) -> tensor<128x8x32x64xbf16>
+    return %0 : tensor<128x8x32x64xbf16>
+  }
+
+  func.func @paged_sdpa_decode(%query: tensor<1x4x32x64xbf16>, %key: tensor<128x8x32x64xbf16>, %value: tensor<128x8x32x64xbf16>, %page_table: tensor<4x16xi32>, %cur_pos: tensor<4xi32>) -> tensor<1x4x32x64xbf16> {
+    // CHECK: %[[EMPTY:[0-9]+]] = ttir.empty() : tensor<1x4x32x64xbf16>
+    // CHECK: "ttir.paged_scaled_dot_product_attention_decode"(%arg0, %arg1, %arg2, %arg3, %arg4, %[[EMPTY]]) <{scale = 1.250000e-01 : f32}>
+    %0 = stablehlo.custom_call @tt.paged_scaled_dot_product_attention_decode(%query, %key, %value, %page_table, %cur_pos) {mhlo.frontend_attributes = {scale = "0.125"}} : (tensor<1x4x32x64xbf16>, tensor<128x8x32x64xbf16>, tensor<128x8x32x64xbf16>, tensor<4x16xi32>, tensor<4xi32>) -> tensor<1x4x32x64xbf16>
+    return %0 : tensor<1x4x32x64xbf16>
+  }
+}
@@ -0,0 +1,21 @@
+// REQUIRES: stablehlo
+// RUN: ttmlir-opt --stablehlo-to-ttir-pipeline="shape-bucket-sizes=128,256" %s | FileCheck %s
+
+// The pipeline option runs shape bucketing before the conversion to TTIR.
+module @jit_shape_bucketing attributes {} {
+  // CHECK-NOT: func.func public @forward(
+  // CHECK-LABEL: func.func public @forward_bucket_128
+  // CHECK-SAME: %arg0: tensor<1x128x64xf32> {tt.bucketed_dims = array<i64: 1>}
+  // CHECK-SAME: shape_bucket = {name = "forward", size = 128 : i64}
+  // CHECK: "ttir.add"
+  // CHECK-SAME: -> tensor<1x128x64xf32>
+  // CHECK-LABEL: func.func public @forward_bucket_256
+  // CHECK-SAME: %arg0: tensor<1x256x64xf32> {tt.bucketed_dims = array<i64: 1>}
+  // CHECK-SAME: shape_bucket = {name = "forward", size = 256 : i64}
+  // CHECK: "ttir.add"
+  // CHECK-SAME: -> tensor<1x256x64xf32>
+  func.func public @forward(%arg0: tensor<1x?x64xf32>) -> tensor<1x?x64xf32> {
+    %0 = stablehlo.add %arg0, %arg0 : tensor<1x?x64xf32>
+    return %0 : tensor<1x?x64xf32>
+  }
+}
@@ -0,0 +1,34 @@
+// REQUIRES: stablehlo
+// RUN: ttmlir-opt --stablehlo-to-ttir-pipeline %s | FileCheck %s
+
+module @jit_while attributes {} {
+  func.func public @test_while(%arg0: tensor<f32>, %arg1: tensor<32x32xf32>) -> tensor<32x32xf32> {
+    // CHECK-LABEL: func.func public @test_while
+    // CHECK: %[[WHILE:.*]]:2 = tt.while(@test_while_while_cond_0, @test_while_while_body_0, [%arg0, %arg1]) : (tensor<1xf32>, tensor<32x32xf32>) -> (tensor<1xf32>, tensor<32x32xf32>)
+    // CHECK: return %[[WHILE]]#1 : tensor<32x32xf32>
+    %0:2 = stablehlo.while(%iterArg = %arg0, %iterArg_0 = %arg1) : tensor<f32>, tensor<32x32xf32>
+    cond {
+      %cst = stablehlo.constant dense<1.000000e+01> : tensor<f32>
+      %1 = stablehlo.compare LT, %iterArg, %cst : (tensor<f32>, tensor<f32>) -> tensor<i1>
+      stablehlo.return %1 : tensor<i1>
+    } do {
+      %cst = stablehlo.constant dense<1.000000e+00> : tensor<f32>
+      %1 = stablehlo.add %iterArg, %cst : tensor<f32>
+      %2 = stablehlo.multiply %iterArg_0, %iterArg_0 : tensor<32x32xf32>
+      stablehlo.return %1, %2 : tensor<f32>, tensor<32x32xf32>
+    }
+    return %0#1 : tensor<32x32xf32>
+  }
+  // CHECK-LABEL: func.func private @test_while_while_cond_0
+  // CHECK-SAME: (%arg0: tensor<1xf32>, %arg1: tensor<32x32xf32>) -> tensor<1xi1>
+  // CHECK-SAME: attributes {loop_region}
+  // CHECK: "ttir.lt"(%arg0
+  // CHECK: return %{{.*}} : tensor<1xi1>
+
+  // CHECK-LABEL: func.func private @test_while_while_body_0
+  // CHECK-SAME: (%arg0: tensor<1xf32>, %arg1: tensor<32x32xf32>) -> (tensor<1xf32>, tensor<32x32xf32>)
+  // CHECK-SAME: attributes {loop_region}
+  // CHECK: %[[ADD:.*]] = "ttir.add"(%arg0
+  // CHECK: %[[MUL:.*]] = "ttir.multiply"(%arg1, %arg1
+  // CHECK: return %[[ADD]], %[[MUL]] : tensor<1xf32>, tensor<32x32xf32>
+}
@@ -0,0 +1,12 @@
+// RUN: ttmlir-opt --convert-ttir-to-linalg %s | FileCheck %s
+
+module {
+  func.func @test_erf(%arg0: tensor<13x21x3xf32>) -> tensor<13x21x3xf32> {
+    %0 = ttir.empty() : tensor<13x21x3xf32>
+    // CHECK: [[VAL0:%[0-9]+]] = linalg.generic {{.*}} ins(%arg0 : tensor<13x21x3xf32>)
+    // CHECK: math.erf
+    %1 = "ttir.erf"(%arg0, %0) : (tensor<13x21x3xf32>, tensor<13x21x3xf32>) -> tensor<13x21x3xf32>
+    // CHECK: return [[VAL0]]
+    return %1 : tensor<13x21x3xf32>
+  }
+}
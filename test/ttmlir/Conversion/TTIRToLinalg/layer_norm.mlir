@@ -0,0 +1,22 @@
+// RUN: ttmlir-opt --convert-ttir-to-linalg %s | FileCheck %s
+
+module {
+  func.func @test_layer_norm(%arg0: tensor<32x64xf32>, %arg1: tensor<64xf32>, %arg2: tensor<64xf32>) -> tensor<32x64xf32> {
+    %0 = ttir.empty() : tensor<32x64xf32>
+    // CHECK: [[SUM:%[0-9]+]] = linalg.generic {{.*}}iterator_types = ["parallel", "reduction"]{{.*}} ins(%arg0 : tensor<32x64xf32>) outs({{.*}} : tensor<32xf32>)
+    // CHECK: arith.addf
+    // CHECK: [[SQUARED_DEVIATION_SUM:%[0-9]+]] = linalg.generic {{.*}}iterator_types = ["parallel", "reduction"]{{.*}} ins(%arg0, [[SUM]] : tensor<32x64xf32>, tensor<32xf32>) outs({{.*}} : tensor<32xf32>)
+    // CHECK: arith.divf
+    // CHECK: arith.subf
+    // CHECK: arith.mulf
+    // CHECK: [[RESULT:%[0-9]+]] = linalg.generic {{.*}}iterator_types = ["parallel", "parallel"]{{.*}} ins(%arg0, [[SUM]], [[SQUARED_DEVIATION_SUM]], %arg1, %arg2 : tensor<32x64xf32>, tensor<32xf32>, tensor<32xf32>, tensor<64xf32>, tensor<64xf32>)
+    // CHECK: arith.subf
+    // CHECK: math.rsqrt
+    // CHECK: arith.mulf
+    // CHECK: arith.mulf
+    // CHECK: arith.addf
+    %1 = "ttir.layer_norm"(%arg0, %arg1, %arg2, %0) <{epsilon = 9.99999974E-6 : f32, operandSegmentSizes = array<i32: 1, 1, 1, 1>}> : (tensor<32x64xf32>, tensor<64xf32>, tensor<64xf32>, tensor<32x64xf32>) -> tensor<32x64xf32>
+    // CHECK: return [[RESULT]]
+    return %1 : tensor<32x64xf32>
+  }
+}
@@ -0,0 +1,15 @@
+// RUN: ttmlir-opt --convert-ttir-to-linalg %s | FileCheck %s
+
+module {
+  func.func @test_rms_norm(%arg0: tensor<32x64xf32>, %arg1: tensor<64xf32>) -> tensor<32x64xf32> {
+    %0 = ttir.empty() : tensor<32x64xf32>
+    // CHECK: [[SUM:%[0-9]+]] = linalg.generic {{.*}}iterator_types = ["parallel", "reduction"]{{.*}} ins(%arg0 : tensor<32x64xf32>) outs({{.*}} : tensor<32xf32>)
+    // CHECK: arith.mulf
+    // CHECK: arith.addf
+    // CHECK: [[RESULT:%[0-9]+]] = linalg.generic {{.*}}iterator_types = ["parallel", "parallel"]{{.*}} ins(%arg0, [[SUM]], %arg1 : tensor<32x64xf32>, tensor<32xf32>, tensor<64xf32>)
+    // CHECK: math.rsqrt
+    %1 = "ttir.rms_norm"(%arg0, %arg1, %0) <{epsilon = 9.99999997E-7 : f32, operandSegmentSizes = array<i32: 1, 1, 0, 1>}> : (tensor<32x64xf32>, tensor<64xf32>, tensor<32x64xf32>) -> tensor<32x64xf32>
+    // CHECK: return [[RESULT]]
+    return %1 : tensor<32x64xf32>
+  }
+}
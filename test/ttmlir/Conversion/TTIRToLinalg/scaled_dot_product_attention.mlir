@@ -0,0 +1,27 @@
+// RUN: ttmlir-opt --convert-ttir-to-linalg %s | FileCheck %s
+
+module {
+  func.func @sdpa_causal_gqa(%arg0: tensor<1x8x32x64xf32>, %arg1: tensor<1x2x32x64xf32>, %arg2: tensor<1x2x32x64xf32>) -> tensor<1x8x32x64xf32> {
+    %0 = ttir.empty() : tensor<1x8x32x64xf32>
+    // CHECK-NOT: ttir.scaled_dot_product_attention
+    // CHECK: linalg.generic {{.*}}iterator_types = ["parallel", "parallel", "parallel", "parallel", "reduction"]{{.*}} ins(%arg0, %arg1 : tensor<1x8x32x64xf32>, tensor<1x2x32x64xf32>)
+    // CHECK: arith.cmpi ugt
+    // CHECK: arith.select
+    // CHECK: arith.maximumf
+    // CHECK: math.exp
+    // CHECK: linalg.generic {{.*}} ins({{.*}}, %arg2 : tensor<1x8x32x32xf32>, tensor<1x8x32xf32>, tensor<1x2x32x64xf32>)
+    // CHECK: arith.divf
+    %1 = "ttir.scaled_dot_product_attention"(%arg0, %arg1, %arg2, %0) <{is_causal = true}> : (tensor<1x8x32x64xf32>, tensor<1x2x32x64xf32>, tensor<1x2x32x64xf32>, tensor<1x8x32x64xf32>) -> tensor<1x8x32x64xf32>
+    return %1 : tensor<1x8x32x64xf32>
+  }
+
+  func.func @sdpa_mask(%arg0: tensor<2x4x32x64xf32>, %arg1: tensor<2x4x32x64xf32>, %arg2: tensor<2x4x32x64xf32>, %arg3: tensor<1x1x32x32xf32>) -> tensor<2x4x32x64xf32> {
+    %0 = ttir.empty() : tensor<2x4x32x64xf32>
+    // CHECK-NOT: ttir.scaled_dot_product_attention
+    // CHECK: linalg.generic {{.*}} ins({{.*}}, %arg3 : tensor<2x4x32x32xf32>, tensor<1x1x32x32xf32>)
+    // CHECK: arith.mulf
+    // CHECK: arith.addf
+    %1 = "ttir.scaled_dot_product_attention"(%arg0, %arg1, %arg2, %arg3, %0) <{scale = 5.000000e-01 : f32}> : (tensor<2x4x32x64xf32>, tensor<2x4x32x64xf32>, tensor<2x4x32x64xf32>, tensor<1x1x32x32xf32>, tensor<2x4x32x64xf32>) -> tensor<2x4x32x64xf32>
+    return %1 : tensor<2x4x32x64xf32>
+  }
+}
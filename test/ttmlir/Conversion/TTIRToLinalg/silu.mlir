@@ -0,0 +1,15 @@
+// RUN: ttmlir-opt --convert-ttir-to-linalg %s | FileCheck %s
+
+module {
+  func.func @test_silu(%arg0: tensor<13x21x3xf32>) -> tensor<13x21x3xf32> {
+    %0 = ttir.empty() : tensor<13x21x3xf32>
+    // CHECK: [[VAL0:%[0-9]+]] = linalg.generic {{.*}} ins(%arg0 : tensor<13x21x3xf32>)
+    // CHECK: arith.negf
+    // CHECK: math.exp
+    // CHECK: arith.addf
+    // CHECK: arith.divf
+    %1 = "ttir.silu"(%arg0, %0) : (tensor<13x21x3xf32>, tensor<13x21x3xf32>) -> tensor<13x21x3xf32>
+    // CHECK: return [[VAL0]]
+    return %1 : tensor<13x21x3xf32>
+  }
+}
@@ -145,4 +145,47 @@ module {
     ttir.await %arg1 : (memref<1x1x!tt.tile<32x32, f32>, #l1_>)
     return
   }
+
+  //===----------------------------------------------------------------------===//
+  // TTIR fused operations
+  //===----------------------------------------------------------------------===//
+
+  // CHECK-LABEL: func.func @test_fused_mul_exp_max_lowering
+  func.func @test_fused_mul_exp_max_lowering(%arg0: memref<1x1x!tt.tile<32x32, f32>, #l1_>, %arg1: memref<1x1x!tt.tile<32x32, f32>, #l1_>, %arg2: memref<1x1x!tt.tile<32x32, f32>, #l1_>, %arg3: memref<1x1x!tt.tile<32x32, f32>, #l1_>) attributes {ttir.thread = #ttir.thread<compute>} {
+    %c0 = arith.constant 0 : index
+    ttir.await %arg0, %arg1, %arg2 : (memref<1x1x!tt.tile<32x32, f32>, #l1_>, memref<1x1x!tt.tile<32x32, f32>, #l1_>, memref<1x1x!tt.tile<32x32, f32>, #l1_>)
+    %collapse_shape = memref.collapse_shape %arg0 [[0, 1]] : memref<1x1x!tt.tile<32x32, f32>, #l1_> into memref<1x!tt.tile<32x32, f32>, #l1_>
+    %collapse_shape_0 = memref.collapse_shape %arg1 [[0, 1]] : memref<1x1x!tt.tile<32x32, f32>, #l1_> into memref<1x!tt.tile<32x32, f32>, #l1_>
+    %collapse_shape_1 = memref.collapse_shape %arg2 [[0, 1]] : memref<1x1x!tt.tile<32x32, f32>, #l1_> into memref<1x!tt.tile<32x32, f32>, #l1_>
+    %collapse_shape_2 = memref.collapse_shape %arg3 [[0, 1]] : memref<1x1x!tt.tile<32x32, f32>, #l1_> into memref<1x!tt.tile<32x32, f32>, #l1_>
+    %0 = memref.load %collapse_shape[%c0] : memref<1x!tt.tile<32x32, f32>, #l1_>
+    %1 = memref.load %collapse_shape_0[%c0] : memref<1x!tt.tile<32x32, f32>, #l1_>
+    %2 = memref.load %collapse_shape_1[%c0] : memref<1x!tt.tile<32x32, f32>, #l1_>
+    // CHECK-NOT: ttir.tile_mul
+    // CHECK: ttkernel.binary_op_init_common
+    // CHECK: ttkernel.mul_tiles_init
+    // CHECK: ttkernel.mul_tiles
+    %3 = "ttir.tile_mul"(%0, %1) : (!tt.tile<32x32, f32>, !tt.tile<32x32, f32>) -> !tt.tile<32x32, f32>
+    // The intermediate stays in DST, only the second operand of the binary
+    // SFPU op is copied in. The SFPU is configured after the FPU op heading
+    // the chain.
+    // CHECK-NOT: ttkernel.copy_tile
+    // CHECK: ttkernel.init_sfpu
+    // CHECK-NOT: ttkernel.copy_tile
+    // CHECK: ttkernel.exp_tile_init
+    // CHECK: ttkernel.exp_tile
+    %4 = "ttir.tile_exp"(%3) : (!tt.tile<32x32, f32>) -> !tt.tile<32x32, f32>
+    // CHECK-NOT: ttkernel.init_sfpu
+    // CHECK: ttkernel.copy_tile_init
+    // CHECK: ttkernel.copy_tile
+    // CHECK-NOT: ttkernel.copy_tile
+    // CHECK: ttkernel.max_tile_init
+    // CHECK: ttkernel.max_tile
+    %5 = "ttir.tile_maximum"(%4, %2) : (!tt.tile<32x32, f32>, !tt.tile<32x32, f32>) -> !tt.tile<32x32, f32>
+    // CHECK: ttkernel.pack_tile
+    memref.store %5, %collapse_shape_2[%c0] : memref<1x!tt.tile<32x32, f32>, #l1_>
+    ttir.yield %arg3 : (memref<1x1x!tt.tile<32x32, f32>, #l1_>)
+    ttir.await %arg3 : (memref<1x1x!tt.tile<32x32, f32>, #l1_>)
+    return
+  }
 }
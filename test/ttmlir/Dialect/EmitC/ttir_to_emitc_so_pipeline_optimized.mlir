@@ -0,0 +1,29 @@
+// RUN: ttmlir-opt --ttir-to-emitc-so-pipeline="system-desc-path=%system_desc_path% enable-const-eval=true optimize-emitc=true" %s > %t.mlir
+// RUN: FileCheck %s --input-file=%t.mlir
+// RUN: ttmlir-translate --mlir-to-cpp %t.mlir > %t.cpp
+// RUN: FileCheck %s --check-prefix=CPP --input-file=%t.cpp
+//
+// This test checks the optimized emission mode of the TTIR to EmitC SO pipeline: const-eval results are cached in a
+// static model state, and the outputs are moved into the returned vector.
+
+// CHECK: emitc.global static @g_model_state : !emitc.opaque<"::ttnn::ModelState">
+// CHECK-LABEL: func.func @forward
+// CHECK: emitc.call_opaque "::ttnn::constEvalFuncWrapper"
+// CHECK: emitc.call_opaque "::ttnn::getConstEvalResult"
+// CHECK: emitc.call_opaque "utilMoveVec"
+
+// CPP: static ::ttnn::ModelState g_model_state;
+// CPP: = &forward_const_eval_0;
+// CPP: ::ttnn::constEvalFuncWrapper(
+// CPP: ::ttnn::getConstEvalResult(
+// CPP: utilMoveVec(
+
+module {
+  func.func @forward(%arg0: tensor<32x32xbf16> {tt.argument_type = #tt.argument_type<input>}, %arg1: tensor<32x32xbf16> {tt.argument_type = #tt.argument_type<parameter>}, %arg2: tensor<32x32xbf16> {tt.argument_type = #tt.argument_type<parameter>}) -> tensor<32x32xbf16> {
+    %0 = ttir.empty() : tensor<32x32xbf16>
+    %1 = "ttir.add"(%arg1, %arg2, %0) : (tensor<32x32xbf16>, tensor<32x32xbf16>, tensor<32x32xbf16>) -> tensor<32x32xbf16>
+    %2 = ttir.empty() : tensor<32x32xbf16>
+    %3 = "ttir.multiply"(%arg0, %1, %2) : (tensor<32x32xbf16>, tensor<32x32xbf16>, tensor<32x32xbf16>) -> tensor<32x32xbf16>
+    return %3 : tensor<32x32xbf16>
+  }
+}
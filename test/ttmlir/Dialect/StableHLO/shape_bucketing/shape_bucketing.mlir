@@ -0,0 +1,27 @@
+// REQUIRES: stablehlo
+// RUN: ttmlir-opt --shape-bucketing="bucket-sizes=256,128" %s | FileCheck %s
+
+module {
+  // CHECK-NOT: func.func public @forward(
+  // CHECK-LABEL: func.func public @forward_bucket_128
+  // CHECK-SAME: %arg0: tensor<1x128x64xf32> {tt.bucketed_dims = array<i64: 1>}
+  // CHECK-SAME: %arg1: tensor<64x64xf32>)
+  // CHECK-SAME: -> (tensor<1x128x64xf32> {tt.bucketed_dims = array<i64: 1>})
+  // CHECK-SAME: shape_bucket = {name = "forward", size = 128 : i64}
+  // CHECK: stablehlo.dot_general {{.*}} -> tensor<1x128x64xf32>
+  // CHECK-LABEL: func.func public @forward_bucket_256
+  // CHECK-SAME: %arg0: tensor<1x256x64xf32> {tt.bucketed_dims = array<i64: 1>}
+  // CHECK-SAME: shape_bucket = {name = "forward", size = 256 : i64}
+  // CHECK: stablehlo.dot_general {{.*}} -> tensor<1x256x64xf32>
+  func.func public @forward(%arg0: tensor<1x?x64xf32>, %arg1: tensor<64x64xf32>) -> tensor<1x?x64xf32> {
+    %0 = stablehlo.dot_general %arg0, %arg1, contracting_dims = [2] x [0] : (tensor<1x?x64xf32>, tensor<64x64xf32>) -> tensor<1x?x64xf32>
+    return %0 : tensor<1x?x64xf32>
+  }
+
+  // Functions with static shapes are left untouched.
+  // CHECK-LABEL: func.func public @static_forward
+  // CHECK-NOT: shape_bucket
+  func.func public @static_forward(%arg0: tensor<1x32x64xf32>) -> tensor<1x32x64xf32> {
+    return %arg0 : tensor<1x32x64xf32>
+  }
+}
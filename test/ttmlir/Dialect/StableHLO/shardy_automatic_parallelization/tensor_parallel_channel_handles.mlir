@@ -0,0 +1,19 @@
+// REQUIRES: stablehlo
+// RUN: ttmlir-opt --automatic-sharding-pipeline="mesh-shape=1,2 automatic-arg-analysis automatic-tensor-parallel" %s > %t.mlir
+// RUN: FileCheck %s --input-file=%t.mlir
+
+// Every generated all-reduce gets its own channel.
+func.func public @two_mlps(%arg0: tensor<32x1024xf32>, %arg1: tensor<1024x4096xf32>, %arg2: tensor<4096x1024xf32>, %arg3: tensor<32x1024xf32>, %arg4: tensor<1024x4096xf32>, %arg5: tensor<4096x1024xf32>) -> (tensor<32x1024xf32>, tensor<32x1024xf32>) {
+  %0 = stablehlo.dot_general %arg0, %arg1, contracting_dims = [1] x [0] : (tensor<32x1024xf32>, tensor<1024x4096xf32>) -> tensor<32x4096xf32>
+  %1 = stablehlo.tanh %0 : tensor<32x4096xf32>
+  %2 = stablehlo.dot_general %1, %arg2, contracting_dims = [1] x [0] : (tensor<32x4096xf32>, tensor<4096x1024xf32>) -> tensor<32x1024xf32>
+  %3 = stablehlo.dot_general %arg3, %arg4, contracting_dims = [1] x [0] : (tensor<32x1024xf32>, tensor<1024x4096xf32>) -> tensor<32x4096xf32>
+  %4 = stablehlo.tanh %3 : tensor<32x4096xf32>
+  %5 = stablehlo.dot_general %4, %arg5, contracting_dims = [1] x [0] : (tensor<32x4096xf32>, tensor<4096x1024xf32>) -> tensor<32x1024xf32>
+  return %2, %5 : tensor<32x1024xf32>, tensor<32x1024xf32>
+}
+
+// CHECK: "stablehlo.all_reduce"
+// CHECK-SAME: channel_handle = #stablehlo.channel_handle<handle = 1, type = 1>
+// CHECK: "stablehlo.all_reduce"
+// CHECK-SAME: channel_handle = #stablehlo.channel_handle<handle = 2, type = 1>
@@ -0,0 +1,29 @@
+// REQUIRES: stablehlo
+// RUN: ttmlir-opt --automatic-sharding-pipeline="mesh-shape=1,2 automatic-arg-analysis automatic-tensor-parallel" %s > %t.mlir
+// RUN: FileCheck %s --input-file=%t.mlir
+
+// CHECK: sdy.mesh @mesh = <["default"=1, "model"=2]>
+
+func.func public @mlp(%arg0: tensor<32x1024xf32>, %arg1: tensor<1024x4096xf32>, %arg2: tensor<4096x1024xf32>) -> tensor<32x1024xf32> {
+  %0 = stablehlo.dot_general %arg0, %arg1, contracting_dims = [1] x [0] : (tensor<32x1024xf32>, tensor<1024x4096xf32>) -> tensor<32x4096xf32>
+  %1 = stablehlo.tanh %0 : tensor<32x4096xf32>
+  %2 = stablehlo.dot_general %1, %arg2, contracting_dims = [1] x [0] : (tensor<32x4096xf32>, tensor<4096x1024xf32>) -> tensor<32x1024xf32>
+  return %2 : tensor<32x1024xf32>
+}
+
+// CHECK: sdy.manual_computation(%arg0, %arg1, %arg2) in_shardings=[<@mesh, [{}, {}]>, <@mesh, [{}, {"model"}]>, <@mesh, [{"model"}, {}]>] out_shardings=[<@mesh, [{}, {}]>]
+// CHECK: stablehlo.dot_general %arg3, %arg4, contracting_dims = [1] x [0] : (tensor<32x1024xf32>, tensor<1024x2048xf32>) -> tensor<32x2048xf32>
+// CHECK: stablehlo.tanh %{{.*}} : tensor<32x2048xf32>
+// CHECK: %[[DOT:.*]] = stablehlo.dot_general %{{.*}}, %arg5, contracting_dims = [1] x [0] : (tensor<32x2048xf32>, tensor<2048x1024xf32>) -> tensor<32x1024xf32>
+// CHECK: "stablehlo.all_reduce"(%[[DOT]])
+// CHECK-NOT: tt.tensor_parallel_all_reduce
+
+// A function without a column/row pair falls back to batch parallelism along
+// the same mesh axis.
+func.func public @no_pair(%arg0: tensor<32x1x32x64xf32>, %arg1: tensor<32x1x32x64xf32>) -> tensor<32x1x32x64xf32> {
+  %0 = stablehlo.add %arg0, %arg1 : tensor<32x1x32x64xf32>
+  return %0 : tensor<32x1x32x64xf32>
+}
+
+// CHECK: sdy.manual_computation(%arg0, %arg1) in_shardings=[<@mesh, [{"model"}, {}, {}, {}]>, <@mesh, [{"model"}, {}, {}, {}]>] out_shardings=[<@mesh, [{"model"}, {}, {}, {}]>]
+// CHECK: stablehlo.add %arg2, %arg3 : tensor<16x1x32x64xf32>
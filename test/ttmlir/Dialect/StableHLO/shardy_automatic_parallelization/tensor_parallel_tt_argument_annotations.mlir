@@ -0,0 +1,19 @@
+// REQUIRES: stablehlo
+// RUN: ttmlir-opt --automatic-sharding-pipeline="mesh-shape=1,2 automatic-arg-analysis automatic-tensor-parallel argument-types=mlp=input,parameter,parameter" %s > %t.mlir
+// RUN: FileCheck %s --input-file=%t.mlir
+
+// User provided tt argument annotations take precedence over the tensor
+// parallel search.
+
+// CHECK: sdy.mesh @mesh = <["default"=1, "batch"=2]>
+
+func.func public @mlp(%arg0: tensor<32x1024xf32>, %arg1: tensor<1024x4096xf32>, %arg2: tensor<4096x1024xf32>) -> tensor<32x1024xf32> {
+  %0 = stablehlo.dot_general %arg0, %arg1, contracting_dims = [1] x [0] : (tensor<32x1024xf32>, tensor<1024x4096xf32>) -> tensor<32x4096xf32>
+  %1 = stablehlo.tanh %0 : tensor<32x4096xf32>
+  %2 = stablehlo.dot_general %1, %arg2, contracting_dims = [1] x [0] : (tensor<32x4096xf32>, tensor<4096x1024xf32>) -> tensor<32x1024xf32>
+  return %2 : tensor<32x1024xf32>
+}
+
+// CHECK: sdy.manual_computation(%arg0, %arg1, %arg2) in_shardings=[<@mesh, [{"batch"}, {}]>, <@mesh, [{}, {}]>, <@mesh, [{}, {}]>] out_shardings=[<@mesh, [{"batch"}, {}]>]
+// CHECK-NOT: "model"
+// CHECK-NOT: stablehlo.all_reduce
@@ -0,0 +1,123 @@
+// RUN: ttmlir-opt --ttir-quantized-domain-fusion %s | FileCheck %s
+
+module {
+  // CHECK-LABEL: func.func @matmul_qdq
+  func.func @matmul_qdq(%arg0: tensor<32x64x!quant.uniform<i8:f32, 5.000000e-01>>, %arg1: tensor<64x32x!quant.uniform<i8:f32, 2.500000e-01>>) -> tensor<32x32x!quant.uniform<i8:f32, 1.000000e+00>> {
+    // CHECK-NOT: "ttir.dequantize"
+    // CHECK: %[[MATMUL:[0-9]+]] = "ttir.matmul"(%arg0, %arg1, %{{[0-9]+}}) {{.*}} -> tensor<32x32x!quant.uniform<i32:f32, 1.250000e-01>>
+    // CHECK: %[[RET:[0-9]+]] = "ttir.requantize"(%[[MATMUL]], %{{[0-9]+}}) {{.*}} -> tensor<32x32x!quant.uniform<i8:f32, 1.000000e+00>>
+    // CHECK-NOT: "ttir.quantize"
+    // CHECK: return %[[RET]]
+    %0 = ttir.empty() : tensor<32x64xf32>
+    %1 = "ttir.dequantize"(%arg0, %0) : (tensor<32x64x!quant.uniform<i8:f32, 5.000000e-01>>, tensor<32x64xf32>) -> tensor<32x64xf32>
+    %2 = ttir.empty() : tensor<64x32xf32>
+    %3 = "ttir.dequantize"(%arg1, %2) : (tensor<64x32x!quant.uniform<i8:f32, 2.500000e-01>>, tensor<64x32xf32>) -> tensor<64x32xf32>
+    %4 = ttir.empty() : tensor<32x32xf32>
+    %5 = "ttir.matmul"(%1, %3, %4) : (tensor<32x64xf32>, tensor<64x32xf32>, tensor<32x32xf32>) -> tensor<32x32xf32>
+    %6 = ttir.empty() : tensor<32x32x!quant.uniform<i8:f32, 1.000000e+00>>
+    %7 = "ttir.quantize"(%5, %6) : (tensor<32x32xf32>, tensor<32x32x!quant.uniform<i8:f32, 1.000000e+00>>) -> tensor<32x32x!quant.uniform<i8:f32, 1.000000e+00>>
+    return %7 : tensor<32x32x!quant.uniform<i8:f32, 1.000000e+00>>
+  }
+
+  // CHECK-LABEL: func.func @linear_float_bias_qdq
+  func.func @linear_float_bias_qdq(%arg0: tensor<32x64x!quant.uniform<i8:f32, 5.000000e-01>>, %arg1: tensor<64x32x!quant.uniform<i8:f32, 2.500000e-01>>, %arg2: tensor<32xf32>) -> tensor<32x32x!quant.uniform<i8:f32, 1.000000e+00>> {
+    // CHECK: %[[BIAS:[0-9]+]] = "ttir.quantize"(%arg2, %{{[0-9]+}}) {{.*}} -> tensor<32x!quant.uniform<i32:f32, 1.250000e-01>>
+    // CHECK: %[[LINEAR:[0-9]+]] = "ttir.linear"(%arg0, %arg1, %[[BIAS]], %{{[0-9]+}}) {{.*}} -> tensor<32x32x!quant.uniform<i32:f32, 1.250000e-01>>
+    // CHECK: "ttir.requantize"(%[[LINEAR]], %{{[0-9]+}})
+    %0 = ttir.empty() : tensor<32x64xf32>
+    %1 = "ttir.dequantize"(%arg0, %0) : (tensor<32x64x!quant.uniform<i8:f32, 5.000000e-01>>, tensor<32x64xf32>) -> tensor<32x64xf32>
+    %2 = ttir.empty() : tensor<64x32xf32>
+    %3 = "ttir.dequantize"(%arg1, %2) : (tensor<64x32x!quant.uniform<i8:f32, 2.500000e-01>>, tensor<64x32xf32>) -> tensor<64x32xf32>
+    %4 = ttir.empty() : tensor<32x32xf32>
+    %5 = "ttir.linear"(%1, %3, %arg2, %4) : (tensor<32x64xf32>, tensor<64x32xf32>, tensor<32xf32>, tensor<32x32xf32>) -> tensor<32x32xf32>
+    %6 = ttir.empty() : tensor<32x32x!quant.uniform<i8:f32, 1.000000e+00>>
+    %7 = "ttir.quantize"(%5, %6) : (tensor<32x32xf32>, tensor<32x32x!quant.uniform<i8:f32, 1.000000e+00>>) -> tensor<32x32x!quant.uniform<i8:f32, 1.000000e+00>>
+    return %7 : tensor<32x32x!quant.uniform<i8:f32, 1.000000e+00>>
+  }
+
+  // Asymmetric inputs need zero point correction, so the island is kept.
+  // CHECK-LABEL: func.func @matmul_asymmetric_not_fused
+  func.func @matmul_asymmetric_not_fused(%arg0: tensor<32x64x!quant.uniform<i8:f32, 5.000000e-01:3>>, %arg1: tensor<64x32x!quant.uniform<i8:f32, 2.500000e-01>>) -> tensor<32x32x!quant.uniform<i8:f32, 1.000000e+00>> {
+    // CHECK: "ttir.dequantize"
+    // CHECK: "ttir.matmul"({{.*}}) : (tensor<32x64xf32>, tensor<64x32xf32>, tensor<32x32xf32>) -> tensor<32x32xf32>
+    // CHECK: "ttir.quantize"
+    %0 = ttir.empty() : tensor<32x64xf32>
+    %1 = "ttir.dequantize"(%arg0, %0) : (tensor<32x64x!quant.uniform<i8:f32, 5.000000e-01:3>>, tensor<32x64xf32>) -> tensor<32x64xf32>
+    %2 = ttir.empty() : tensor<64x32xf32>
+    %3 = "ttir.dequantize"(%arg1, %2) : (tensor<64x32x!quant.uniform<i8:f32, 2.500000e-01>>, tensor<64x32xf32>) -> tensor<64x32xf32>
+    %4 = ttir.empty() : tensor<32x32xf32>
+    %5 = "ttir.matmul"(%1, %3, %4) : (tensor<32x64xf32>, tensor<64x32xf32>, tensor<32x32xf32>) -> tensor<32x32xf32>
+    %6 = ttir.empty() : tensor<32x32x!quant.uniform<i8:f32, 1.000000e+00>>
+    %7 = "ttir.quantize"(%5, %6) : (tensor<32x32xf32>, tensor<32x32x!quant.uniform<i8:f32, 1.000000e+00>>) -> tensor<32x32x!quant.uniform<i8:f32, 1.000000e+00>>
+    return %7 : tensor<32x32x!quant.uniform<i8:f32, 1.000000e+00>>
+  }
+
+  // Moving the inputs to the accumulator only subtracts the zero point of
+  // %arg1, the epilogue is the only requantize which rounds.
+  // CHECK-LABEL: func.func @add_qdq
+  func.func @add_qdq(%arg0: tensor<32x32x!quant.uniform<i8:f32, 5.000000e-01>>, %arg1: tensor<32x32x!quant.uniform<i8:f32, 5.000000e-01:2>>) -> tensor<32x32x!quant.uniform<i8:f32, 1.000000e+00:4>> {
+    // CHECK: %[[LHS:[0-9]+]] = "ttir.requantize"(%arg0, %{{[0-9]+}}) {{.*}} -> tensor<32x32x!quant.uniform<i32:f32, 5.000000e-01>>
+    // CHECK: %[[RHS:[0-9]+]] = "ttir.requantize"(%arg1, %{{[0-9]+}}) {{.*}} -> tensor<32x32x!quant.uniform<i32:f32, 5.000000e-01>>
+    // CHECK: %[[ADD:[0-9]+]] = "ttir.add"(%[[LHS]], %[[RHS]], %{{[0-9]+}})
+    // CHECK: "ttir.requantize"(%[[ADD]], %{{[0-9]+}}) {{.*}} -> tensor<32x32x!quant.uniform<i8:f32, 1.000000e+00:4>>
+    %0 = ttir.empty() : tensor<32x32xf32>
+    %1 = "ttir.dequantize"(%arg0, %0) : (tensor<32x32x!quant.uniform<i8:f32, 5.000000e-01>>, tensor<32x32xf32>) -> tensor<32x32xf32>
+    %2 = ttir.empty() : tensor<32x32xf32>
+    %3 = "ttir.dequantize"(%arg1, %2) : (tensor<32x32x!quant.uniform<i8:f32, 5.000000e-01:2>>, tensor<32x32xf32>) -> tensor<32x32xf32>
+    %4 = ttir.empty() : tensor<32x32xf32>
+    %5 = "ttir.add"(%1, %3, %4) : (tensor<32x32xf32>, tensor<32x32xf32>, tensor<32x32xf32>) -> tensor<32x32xf32>
+    %6 = ttir.empty() : tensor<32x32x!quant.uniform<i8:f32, 1.000000e+00:4>>
+    %7 = "ttir.quantize"(%5, %6) : (tensor<32x32xf32>, tensor<32x32x!quant.uniform<i8:f32, 1.000000e+00:4>>) -> tensor<32x32x!quant.uniform<i8:f32, 1.000000e+00:4>>
+    return %7 : tensor<32x32x!quant.uniform<i8:f32, 1.000000e+00:4>>
+  }
+
+  // Inputs of different scales would both be rounded before the add, so the
+  // island is kept.
+  // CHECK-LABEL: func.func @add_different_scales_not_fused
+  func.func @add_different_scales_not_fused(%arg0: tensor<32x32x!quant.uniform<i8:f32, 5.000000e-01>>, %arg1: tensor<32x32x!quant.uniform<i8:f32, 2.500000e-01>>) -> tensor<32x32x!quant.uniform<i8:f32, 1.000000e+00>> {
+    // CHECK: "ttir.dequantize"
+    // CHECK: "ttir.dequantize"
+    // CHECK: "ttir.add"({{.*}}) : (tensor<32x32xf32>, tensor<32x32xf32>, tensor<32x32xf32>) -> tensor<32x32xf32>
+    // CHECK: "ttir.quantize"
+    %0 = ttir.empty() : tensor<32x32xf32>
+    %1 = "ttir.dequantize"(%arg0, %0) : (tensor<32x32x!quant.uniform<i8:f32, 5.000000e-01>>, tensor<32x32xf32>) -> tensor<32x32xf32>
+    %2 = ttir.empty() : tensor<32x32xf32>
+    %3 = "ttir.dequantize"(%arg1, %2) : (tensor<32x32x!quant.uniform<i8:f32, 2.500000e-01>>, tensor<32x32xf32>) -> tensor<32x32xf32>
+    %4 = ttir.empty() : tensor<32x32xf32>
+    %5 = "ttir.add"(%1, %3, %4) : (tensor<32x32xf32>, tensor<32x32xf32>, tensor<32x32xf32>) -> tensor<32x32xf32>
+    %6 = ttir.empty() : tensor<32x32x!quant.uniform<i8:f32, 1.000000e+00>>
+    %7 = "ttir.quantize"(%5, %6) : (tensor<32x32xf32>, tensor<32x32x!quant.uniform<i8:f32, 1.000000e+00>>) -> tensor<32x32x!quant.uniform<i8:f32, 1.000000e+00>>
+    return %7 : tensor<32x32x!quant.uniform<i8:f32, 1.000000e+00>>
+  }
+
+  // Every requantize step rounds and clamps, so the chain is not collapsed.
+  // CHECK-LABEL: func.func @keep_requantize_chain
+  func.func @keep_requantize_chain(%arg0: tensor<32x32x!quant.uniform<i8:f32, 5.000000e-01>>) -> tensor<32x32xf32> {
+    // CHECK-NOT: "ttir.quantize"
+    // CHECK: %[[REQ0:[0-9]+]] = "ttir.requantize"(%arg0, %{{[0-9]+}}) {{.*}} -> tensor<32x32x!quant.uniform<i8:f32, 2.500000e-01>>
+    // CHECK: %[[REQ1:[0-9]+]] = "ttir.requantize"(%[[REQ0]], %{{[0-9]+}}) {{.*}} -> tensor<32x32x!quant.uniform<i8:f32, 1.250000e-01>>
+    // CHECK: %[[RET:[0-9]+]] = "ttir.dequantize"(%[[REQ1]], %{{[0-9]+}})
+    // CHECK: return %[[RET]]
+    %0 = ttir.empty() : tensor<32x32xf32>
+    %1 = "ttir.dequantize"(%arg0, %0) : (tensor<32x32x!quant.uniform<i8:f32, 5.000000e-01>>, tensor<32x32xf32>) -> tensor<32x32xf32>
+    %2 = ttir.empty() : tensor<32x32x!quant.uniform<i8:f32, 2.500000e-01>>
+    %3 = "ttir.quantize"(%1, %2) : (tensor<32x32xf32>, tensor<32x32x!quant.uniform<i8:f32, 2.500000e-01>>) -> tensor<32x32x!quant.uniform<i8:f32, 2.500000e-01>>
+    %4 = ttir.empty() : tensor<32x32x!quant.uniform<i8:f32, 1.250000e-01>>
+    %5 = "ttir.requantize"(%3, %4) : (tensor<32x32x!quant.uniform<i8:f32, 2.500000e-01>>, tensor<32x32x!quant.uniform<i8:f32, 1.250000e-01>>) -> tensor<32x32x!quant.uniform<i8:f32, 1.250000e-01>>
+    %6 = ttir.empty() : tensor<32x32xf32>
+    %7 = "ttir.dequantize"(%5, %6) : (tensor<32x32x!quant.uniform<i8:f32, 1.250000e-01>>, tensor<32x32xf32>) -> tensor<32x32xf32>
+    return %7 : tensor<32x32xf32>
+  }
+
+  // CHECK-LABEL: func.func @fold_identity_requantize
+  func.func @fold_identity_requantize(%arg0: tensor<32x32x!quant.uniform<i8:f32, 5.000000e-01>>) -> tensor<32x32xf32> {
+    // CHECK-NOT: "ttir.requantize"
+    // CHECK: %[[RET:[0-9]+]] = "ttir.dequantize"(%arg0, %{{[0-9]+}})
+    // CHECK: return %[[RET]]
+    %0 = ttir.empty() : tensor<32x32x!quant.uniform<i8:f32, 5.000000e-01>>
+    %1 = "ttir.requantize"(%arg0, %0) : (tensor<32x32x!quant.uniform<i8:f32, 5.000000e-01>>, tensor<32x32x!quant.uniform<i8:f32, 5.000000e-01>>) -> tensor<32x32x!quant.uniform<i8:f32, 5.000000e-01>>
+    %2 = ttir.empty() : tensor<32x32xf32>
+    %3 = "ttir.dequantize"(%1, %2) : (tensor<32x32x!quant.uniform<i8:f32, 5.000000e-01>>, tensor<32x32xf32>) -> tensor<32x32xf32>
+    return %3 : tensor<32x32xf32>
+  }
+}
@@ -0,0 +1,59 @@
+// RUN: ttmlir-opt --const-eval-hoist-transform %s -o %t1.mlir
+// RUN: FileCheck %s < %t1.mlir
+// RUN: ttmlir-opt --undo-const-eval %t1.mlir -o %t2.mlir
+// RUN: FileCheck %s --check-prefix=UNDONE < %t2.mlir
+
+// Buckets of the same function share identical const-eval funcs. Undoing
+// const-eval inlines the shared func into every caller.
+module {
+  // CHECK-LABEL: func.func @forward_bucket_32_const_eval_0
+  // CHECK: "ttir.subtract"(%{{.*}}, %{{.*}}, %{{.*}})
+
+  // CHECK-LABEL: func.func @forward_bucket_32(
+  // CHECK: tt.load_cached(@forward_bucket_32_const_eval_0, [%arg1, %arg2])
+  func.func @forward_bucket_32(%arg0: tensor<32x64xbf16> {tt.argument_type = #tt.argument_type<input>}, %arg1: tensor<64x64xbf16> {tt.argument_type = #tt.argument_type<parameter>}, %arg2: tensor<64x64xbf16> {tt.argument_type = #tt.argument_type<constant>}) -> tensor<32x64xbf16> attributes {shape_bucket = {name = "forward", size = 32 : i64}} {
+    %0 = ttir.empty() : tensor<64x64xbf16>
+    %1 = "ttir.subtract"(%arg1, %arg2, %0) : (tensor<64x64xbf16>, tensor<64x64xbf16>, tensor<64x64xbf16>) -> tensor<64x64xbf16>
+    %2 = ttir.empty() : tensor<32x64xbf16>
+    %3 = "ttir.matmul"(%arg0, %1, %2) : (tensor<32x64xbf16>, tensor<64x64xbf16>, tensor<32x64xbf16>) -> tensor<32x64xbf16>
+    return %3 : tensor<32x64xbf16>
+  }
+
+  // CHECK-NOT: func.func @forward_bucket_64_const_eval_0
+  // CHECK-LABEL: func.func @forward_bucket_64(
+  // CHECK: tt.load_cached(@forward_bucket_32_const_eval_0, [%arg1, %arg2])
+  func.func @forward_bucket_64(%arg0: tensor<64x64xbf16> {tt.argument_type = #tt.argument_type<input>}, %arg1: tensor<64x64xbf16> {tt.argument_type = #tt.argument_type<parameter>}, %arg2: tensor<64x64xbf16> {tt.argument_type = #tt.argument_type<constant>}) -> tensor<64x64xbf16> attributes {shape_bucket = {name = "forward", size = 64 : i64}} {
+    %0 = ttir.empty() : tensor<64x64xbf16>
+    %1 = "ttir.subtract"(%arg1, %arg2, %0) : (tensor<64x64xbf16>, tensor<64x64xbf16>, tensor<64x64xbf16>) -> tensor<64x64xbf16>
+    %2 = ttir.empty() : tensor<64x64xbf16>
+    %3 = "ttir.matmul"(%arg0, %1, %2) : (tensor<64x64xbf16>, tensor<64x64xbf16>, tensor<64x64xbf16>) -> tensor<64x64xbf16>
+    return %3 : tensor<64x64xbf16>
+  }
+
+  // Funcs outside of shape buckets keep their own const-eval funcs.
+  // CHECK-LABEL: func.func @other_const_eval_0
+  // CHECK-LABEL: func.func @other(
+  // CHECK: tt.load_cached(@other_const_eval_0, [%arg1, %arg2])
+  func.func @other(%arg0: tensor<64x64xbf16> {tt.argument_type = #tt.argument_type<input>}, %arg1: tensor<64x64xbf16> {tt.argument_type = #tt.argument_type<parameter>}, %arg2: tensor<64x64xbf16> {tt.argument_type = #tt.argument_type<constant>}) -> tensor<64x64xbf16> {
+    %0 = ttir.empty() : tensor<64x64xbf16>
+    %1 = "ttir.subtract"(%arg1, %arg2, %0) : (tensor<64x64xbf16>, tensor<64x64xbf16>, tensor<64x64xbf16>) -> tensor<64x64xbf16>
+    %2 = ttir.empty() : tensor<64x64xbf16>
+    %3 = "ttir.matmul"(%arg0, %1, %2) : (tensor<64x64xbf16>, tensor<64x64xbf16>, tensor<64x64xbf16>) -> tensor<64x64xbf16>
+    return %3 : tensor<64x64xbf16>
+  }
+
+  // UNDONE-NOT: const_eval_0
+  // UNDONE-LABEL: func.func @forward_bucket_32(
+  // UNDONE-NOT: tt.load_cached
+  // UNDONE: "ttir.subtract"(%arg1, %arg2, %{{.*}})
+  // UNDONE: "ttir.matmul"(%arg0
+  // UNDONE-NOT: const_eval_0
+  // UNDONE-LABEL: func.func @forward_bucket_64(
+  // UNDONE-NOT: tt.load_cached
+  // UNDONE: "ttir.subtract"(%arg1, %arg2, %{{.*}})
+  // UNDONE: "ttir.matmul"(%arg0
+  // UNDONE-NOT: const_eval_0
+  // UNDONE-LABEL: func.func @other(
+  // UNDONE-NOT: tt.load_cached
+  // UNDONE: "ttir.subtract"(%arg1, %arg2, %{{.*}})
+}
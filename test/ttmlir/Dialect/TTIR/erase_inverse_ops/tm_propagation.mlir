@@ -0,0 +1,123 @@
+// RUN: ttmlir-opt --ttir-propagate-tms %s | FileCheck %s
+// RUN: ttmlir-opt --ttir-propagate-tms="report-path=%t.json" %s -o /dev/null
+// RUN: FileCheck %s --check-prefix=REPORT --input-file=%t.json
+module {
+    // CHECK-LABEL: func.func @reduction_commute
+    func.func @reduction_commute(%arg0: tensor<4x8x16xbf16>) -> tensor<8x16xbf16> {
+        // CHECK-NOT: "ttir.permute"
+        // CHECK: %[[SUM:[0-9]+]] = "ttir.sum"(%arg0, %{{[0-9]+}}) <{dim_arg = [0 : i32], keep_dim = false}> : (tensor<4x8x16xbf16>, tensor<8x16xbf16>) -> tensor<8x16xbf16>
+        // CHECK-NOT: "ttir.permute"
+        // CHECK: return %[[SUM]]
+        %0 = tensor.empty() : tensor<4x16x8xbf16>
+        %1 = "ttir.permute"(%arg0, %0) <{permutation = array<i64: 0, 2, 1>}> : (tensor<4x8x16xbf16>, tensor<4x16x8xbf16>) -> tensor<4x16x8xbf16>
+        %2 = tensor.empty() : tensor<16x8xbf16>
+        %3 = "ttir.sum"(%1, %2) <{dim_arg = [0 : i32], keep_dim = false}> : (tensor<4x16x8xbf16>, tensor<16x8xbf16>) -> tensor<16x8xbf16>
+        %4 = tensor.empty() : tensor<8x16xbf16>
+        %5 = "ttir.permute"(%3, %4) <{permutation = array<i64: 1, 0>}> : (tensor<16x8xbf16>, tensor<8x16xbf16>) -> tensor<8x16xbf16>
+        return %5 : tensor<8x16xbf16>
+    }
+
+    // CHECK-LABEL: func.func @reduction_keep_dim_commute
+    func.func @reduction_keep_dim_commute(%arg0: tensor<4x8x16xbf16>) -> tensor<4x8x1xbf16> {
+        // CHECK-NOT: "ttir.permute"
+        // CHECK: %[[MAX:[0-9]+]] = "ttir.max"(%arg0, %{{[0-9]+}}) <{dim_arg = [2 : i32], keep_dim = true}> : (tensor<4x8x16xbf16>, tensor<4x8x1xbf16>) -> tensor<4x8x1xbf16>
+        // CHECK-NOT: "ttir.permute"
+        // CHECK: return %[[MAX]]
+        %0 = tensor.empty() : tensor<4x16x8xbf16>
+        %1 = "ttir.permute"(%arg0, %0) <{permutation = array<i64: 0, 2, 1>}> : (tensor<4x8x16xbf16>, tensor<4x16x8xbf16>) -> tensor<4x16x8xbf16>
+        %2 = tensor.empty() : tensor<4x1x8xbf16>
+        %3 = "ttir.max"(%1, %2) <{dim_arg = [1 : i32], keep_dim = true}> : (tensor<4x16x8xbf16>, tensor<4x1x8xbf16>) -> tensor<4x1x8xbf16>
+        %4 = tensor.empty() : tensor<4x8x1xbf16>
+        %5 = "ttir.permute"(%3, %4) <{permutation = array<i64: 0, 2, 1>}> : (tensor<4x1x8xbf16>, tensor<4x8x1xbf16>) -> tensor<4x8x1xbf16>
+        return %5 : tensor<4x8x1xbf16>
+    }
+
+    // CHECK-LABEL: func.func @concat_commute
+    func.func @concat_commute(%arg0: tensor<1x32x64xbf16>, %arg1: tensor<1x32x64xbf16>) -> tensor<1x32x128xbf16> {
+        // CHECK-NOT: "ttir.permute"
+        // CHECK: %[[CONCAT:[0-9]+]] = "ttir.concat"(%arg0, %arg1, %{{[0-9]+}}) <{dim = 2 : si32}> : (tensor<1x32x64xbf16>, tensor<1x32x64xbf16>, tensor<1x32x128xbf16>) -> tensor<1x32x128xbf16>
+        // CHECK-NOT: "ttir.permute"
+        // CHECK: return %[[CONCAT]]
+        %0 = tensor.empty() : tensor<1x64x32xbf16>
+        %1 = "ttir.permute"(%arg0, %0) <{permutation = array<i64: 0, 2, 1>}> : (tensor<1x32x64xbf16>, tensor<1x64x32xbf16>) -> tensor<1x64x32xbf16>
+        %2 = tensor.empty() : tensor<1x64x32xbf16>
+        %3 = "ttir.permute"(%arg1, %2) <{permutation = array<i64: 0, 2, 1>}> : (tensor<1x32x64xbf16>, tensor<1x64x32xbf16>) -> tensor<1x64x32xbf16>
+        %4 = tensor.empty() : tensor<1x128x32xbf16>
+        %5 = "ttir.concat"(%1, %3, %4) <{dim = 1 : si32}> : (tensor<1x64x32xbf16>, tensor<1x64x32xbf16>, tensor<1x128x32xbf16>) -> tensor<1x128x32xbf16>
+        %6 = tensor.empty() : tensor<1x32x128xbf16>
+        %7 = "ttir.permute"(%5, %6) <{permutation = array<i64: 0, 2, 1>}> : (tensor<1x128x32xbf16>, tensor<1x32x128xbf16>) -> tensor<1x32x128xbf16>
+        return %7 : tensor<1x32x128xbf16>
+    }
+
+    // CHECK-LABEL: func.func @slice_commute
+    func.func @slice_commute(%arg0: tensor<4x32x64xbf16>) -> tensor<4x32x16xbf16> {
+        // CHECK-NOT: "ttir.permute"
+        // CHECK: %[[SLICE:[0-9]+]] = "ttir.slice"(%arg0, %{{[0-9]+}}) <{begins = [0 : i32, 0 : i32, 0 : i32], ends = [4 : i32, 32 : i32, 16 : i32], step = [1 : i32, 1 : i32, 1 : i32]}> : (tensor<4x32x64xbf16>, tensor<4x32x16xbf16>) -> tensor<4x32x16xbf16>
+        // CHECK-NOT: "ttir.permute"
+        // CHECK: return %[[SLICE]]
+        %0 = tensor.empty() : tensor<4x64x32xbf16>
+        %1 = "ttir.permute"(%arg0, %0) <{permutation = array<i64: 0, 2, 1>}> : (tensor<4x32x64xbf16>, tensor<4x64x32xbf16>) -> tensor<4x64x32xbf16>
+        %2 = tensor.empty() : tensor<4x16x32xbf16>
+        %3 = "ttir.slice"(%1, %2) <{begins = [0 : i32, 0 : i32, 0 : i32], ends = [4 : i32, 16 : i32, 32 : i32], step = [1 : i32, 1 : i32, 1 : i32]}> : (tensor<4x64x32xbf16>, tensor<4x16x32xbf16>) -> tensor<4x16x32xbf16>
+        %4 = tensor.empty() : tensor<4x32x16xbf16>
+        %5 = "ttir.permute"(%3, %4) <{permutation = array<i64: 0, 2, 1>}> : (tensor<4x16x32xbf16>, tensor<4x32x16xbf16>) -> tensor<4x32x16xbf16>
+        return %5 : tensor<4x32x16xbf16>
+    }
+
+    // CHECK-LABEL: func.func @matmul_commute
+    func.func @matmul_commute(%arg0: tensor<64x128xbf16>, %arg1: tensor<128x32xbf16>) -> tensor<32x64xbf16> {
+        // CHECK-NOT: "ttir.transpose"
+        // CHECK: %[[MATMUL:[0-9]+]] = "ttir.matmul"(%arg1, %arg0, %{{[0-9]+}}) <{transpose_a = true, transpose_b = true}> : (tensor<128x32xbf16>, tensor<64x128xbf16>, tensor<32x64xbf16>) -> tensor<32x64xbf16>
+        // CHECK-NOT: "ttir.transpose"
+        // CHECK: return %[[MATMUL]]
+        %0 = tensor.empty() : tensor<64x32xbf16>
+        %1 = "ttir.matmul"(%arg0, %arg1, %0) : (tensor<64x128xbf16>, tensor<128x32xbf16>, tensor<64x32xbf16>) -> tensor<64x32xbf16>
+        %2 = tensor.empty() : tensor<32x64xbf16>
+        %3 = "ttir.transpose"(%1, %2) <{dim0 = 0 : si32, dim1 = 1 : si32}> : (tensor<64x32xbf16>, tensor<32x64xbf16>) -> tensor<32x64xbf16>
+        return %3 : tensor<32x64xbf16>
+    }
+
+    // Moving the permute above the sum would make it permute the larger sum
+    // input without cancelling any TM, so the function is left untouched.
+    // CHECK-LABEL: func.func @no_commute_more_bytes
+    func.func @no_commute_more_bytes(%arg0: tensor<4x8x16xbf16>) -> tensor<16x8xbf16> {
+        // CHECK: %[[SUM:[0-9]+]] = "ttir.sum"(%arg0
+        // CHECK: "ttir.permute"(%[[SUM]]
+        %0 = tensor.empty() : tensor<8x16xbf16>
+        %1 = "ttir.sum"(%arg0, %0) <{dim_arg = [0 : i32], keep_dim = false}> : (tensor<4x8x16xbf16>, tensor<8x16xbf16>) -> tensor<8x16xbf16>
+        %2 = tensor.empty() : tensor<16x8xbf16>
+        %3 = "ttir.permute"(%1, %2) <{permutation = array<i64: 1, 0>}> : (tensor<8x16xbf16>, tensor<16x8xbf16>) -> tensor<16x8xbf16>
+        return %3 : tensor<16x8xbf16>
+    }
+
+    // Loop region functions are only executed by their tt.while op, so they
+    // are left untouched like const-eval functions.
+    // CHECK-LABEL: func.func private @loop_body
+    func.func private @loop_body(%arg0: tensor<4x8x16xbf16>) -> tensor<8x16xbf16> attributes {loop_region} {
+        // CHECK: "ttir.permute"(%arg0
+        // CHECK: "ttir.sum"
+        // CHECK: "ttir.permute"
+        %0 = tensor.empty() : tensor<4x16x8xbf16>
+        %1 = "ttir.permute"(%arg0, %0) <{permutation = array<i64: 0, 2, 1>}> : (tensor<4x8x16xbf16>, tensor<4x16x8xbf16>) -> tensor<4x16x8xbf16>
+        %2 = tensor.empty() : tensor<16x8xbf16>
+        %3 = "ttir.sum"(%1, %2) <{dim_arg = [0 : i32], keep_dim = false}> : (tensor<4x16x8xbf16>, tensor<16x8xbf16>) -> tensor<16x8xbf16>
+        %4 = tensor.empty() : tensor<8x16xbf16>
+        %5 = "ttir.permute"(%3, %4) <{permutation = array<i64: 1, 0>}> : (tensor<16x8xbf16>, tensor<8x16xbf16>) -> tensor<8x16xbf16>
+        return %5 : tensor<8x16xbf16>
+    }
+}
+
+// REPORT: "name": "reduction_commute"
+// REPORT: "tms_eliminated": 2
+// REPORT: "name": "reduction_keep_dim_commute"
+// REPORT: "tms_eliminated": 2
+// REPORT: "name": "concat_commute"
+// REPORT: "tms_eliminated": 3
+// REPORT: "name": "slice_commute"
+// REPORT: "tms_eliminated": 2
+// REPORT: "name": "matmul_commute"
+// REPORT: "tms_eliminated": 1
+// REPORT: "name": "no_commute_more_bytes"
+// REPORT: "tms_eliminated": 0
+// REPORT-NOT: "name": "loop_body"
+// REPORT: "tms_eliminated": 10
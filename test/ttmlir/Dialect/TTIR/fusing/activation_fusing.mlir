@@ -0,0 +1,90 @@
+// RUN: ttmlir-opt %s -ttir-fusing | FileCheck %s
+
+module {
+  // CHECK-LABEL: func.func @gelu_erf_fusion
+  func.func @gelu_erf_fusion(%arg0: tensor<32x64xf32>) -> tensor<32x64xf32> {
+    // CHECK-NOT: ttir.erf
+    // CHECK: %[[RESULT:.*]] = "ttir.gelu"(%arg0, %{{.*}}) <{approximate = false}> : (tensor<32x64xf32>, tensor<32x64xf32>) -> tensor<32x64xf32>
+    // CHECK-NOT: ttir.multiply
+    // CHECK: return %[[RESULT]]
+    %0 = "ttir.constant"() <{value = dense<0.707106769> : tensor<32x64xf32>}> : () -> tensor<32x64xf32>
+    %1 = ttir.empty() : tensor<32x64xf32>
+    %2 = "ttir.multiply"(%arg0, %0, %1) : (tensor<32x64xf32>, tensor<32x64xf32>, tensor<32x64xf32>) -> tensor<32x64xf32>
+    %3 = ttir.empty() : tensor<32x64xf32>
+    %4 = "ttir.erf"(%2, %3) : (tensor<32x64xf32>, tensor<32x64xf32>) -> tensor<32x64xf32>
+    %5 = "ttir.constant"() <{value = dense<1.000000e+00> : tensor<32x64xf32>}> : () -> tensor<32x64xf32>
+    %6 = ttir.empty() : tensor<32x64xf32>
+    %7 = "ttir.add"(%4, %5, %6) : (tensor<32x64xf32>, tensor<32x64xf32>, tensor<32x64xf32>) -> tensor<32x64xf32>
+    %8 = "ttir.constant"() <{value = dense<5.000000e-01> : tensor<32x64xf32>}> : () -> tensor<32x64xf32>
+    %9 = ttir.empty() : tensor<32x64xf32>
+    %10 = "ttir.multiply"(%arg0, %8, %9) : (tensor<32x64xf32>, tensor<32x64xf32>, tensor<32x64xf32>) -> tensor<32x64xf32>
+    %11 = ttir.empty() : tensor<32x64xf32>
+    %12 = "ttir.multiply"(%10, %7, %11) : (tensor<32x64xf32>, tensor<32x64xf32>, tensor<32x64xf32>) -> tensor<32x64xf32>
+    return %12 : tensor<32x64xf32>
+  }
+}
+
+// Tanh approximation with the cube spelled as pow and the 0.5 as a division.
+module {
+  // CHECK-LABEL: func.func @gelu_tanh_fusion
+  func.func @gelu_tanh_fusion(%arg0: tensor<32x64xbf16>) -> tensor<32x64xbf16> {
+    // CHECK-NOT: ttir.tanh
+    // CHECK: %[[RESULT:.*]] = "ttir.gelu"(%arg0, %{{.*}}) <{approximate = true}> : (tensor<32x64xbf16>, tensor<32x64xbf16>) -> tensor<32x64xbf16>
+    // CHECK-NOT: ttir.div
+    // CHECK: return %[[RESULT]]
+    %0 = "ttir.constant"() <{value = dense<3.000000e+00> : tensor<32x64xbf16>}> : () -> tensor<32x64xbf16>
+    %1 = ttir.empty() : tensor<32x64xbf16>
+    %2 = "ttir.pow"(%arg0, %0, %1) : (tensor<32x64xbf16>, tensor<32x64xbf16>, tensor<32x64xbf16>) -> tensor<32x64xbf16>
+    %3 = "ttir.constant"() <{value = dense<4.467770e-02> : tensor<32x64xbf16>}> : () -> tensor<32x64xbf16>
+    %4 = ttir.empty() : tensor<32x64xbf16>
+    %5 = "ttir.multiply"(%3, %2, %4) : (tensor<32x64xbf16>, tensor<32x64xbf16>, tensor<32x64xbf16>) -> tensor<32x64xbf16>
+    %6 = ttir.empty() : tensor<32x64xbf16>
+    %7 = "ttir.add"(%arg0, %5, %6) : (tensor<32x64xbf16>, tensor<32x64xbf16>, tensor<32x64xbf16>) -> tensor<32x64xbf16>
+    %8 = "ttir.constant"() <{value = dense<7.968750e-01> : tensor<32x64xbf16>}> : () -> tensor<32x64xbf16>
+    %9 = ttir.empty() : tensor<32x64xbf16>
+    %10 = "ttir.multiply"(%7, %8, %9) : (tensor<32x64xbf16>, tensor<32x64xbf16>, tensor<32x64xbf16>) -> tensor<32x64xbf16>
+    %11 = ttir.empty() : tensor<32x64xbf16>
+    %12 = "ttir.tanh"(%10, %11) : (tensor<32x64xbf16>, tensor<32x64xbf16>) -> tensor<32x64xbf16>
+    %13 = "ttir.constant"() <{value = dense<1.000000e+00> : tensor<32x64xbf16>}> : () -> tensor<32x64xbf16>
+    %14 = ttir.empty() : tensor<32x64xbf16>
+    %15 = "ttir.add"(%13, %12, %14) : (tensor<32x64xbf16>, tensor<32x64xbf16>, tensor<32x64xbf16>) -> tensor<32x64xbf16>
+    %16 = ttir.empty() : tensor<32x64xbf16>
+    %17 = "ttir.multiply"(%arg0, %15, %16) : (tensor<32x64xbf16>, tensor<32x64xbf16>, tensor<32x64xbf16>) -> tensor<32x64xbf16>
+    %18 = "ttir.constant"() <{value = dense<2.000000e+00> : tensor<32x64xbf16>}> : () -> tensor<32x64xbf16>
+    %19 = ttir.empty() : tensor<32x64xbf16>
+    %20 = "ttir.div"(%17, %18, %19) : (tensor<32x64xbf16>, tensor<32x64xbf16>, tensor<32x64xbf16>) -> tensor<32x64xbf16>
+    return %20 : tensor<32x64xbf16>
+  }
+}
+
+// Gated MLP: up * (gate * sigmoid(gate)) becomes silu(gate) * up.
+module {
+  // CHECK-LABEL: func.func @silu_gated_fusion
+  func.func @silu_gated_fusion(%arg0: tensor<32x128xf32>, %arg1: tensor<32x128xf32>) -> tensor<32x128xf32> {
+    // CHECK-NOT: ttir.sigmoid
+    // CHECK: %[[SILU:.*]] = "ttir.silu"(%arg0, %{{.*}})
+    // CHECK: %[[RESULT:.*]] = "ttir.multiply"({{.*}}%[[SILU]]
+    // CHECK: return %[[RESULT]]
+    %0 = ttir.empty() : tensor<32x128xf32>
+    %1 = "ttir.sigmoid"(%arg0, %0) : (tensor<32x128xf32>, tensor<32x128xf32>) -> tensor<32x128xf32>
+    %2 = ttir.empty() : tensor<32x128xf32>
+    %3 = "ttir.multiply"(%arg0, %1, %2) : (tensor<32x128xf32>, tensor<32x128xf32>, tensor<32x128xf32>) -> tensor<32x128xf32>
+    %4 = ttir.empty() : tensor<32x128xf32>
+    %5 = "ttir.multiply"(%arg1, %3, %4) : (tensor<32x128xf32>, tensor<32x128xf32>, tensor<32x128xf32>) -> tensor<32x128xf32>
+    return %5 : tensor<32x128xf32>
+  }
+}
+
+// The sigmoid is reused, so it is kept.
+module {
+  // CHECK-LABEL: func.func @silu_no_fusion_multiple_uses
+  func.func @silu_no_fusion_multiple_uses(%arg0: tensor<32x128xf32>) -> (tensor<32x128xf32>, tensor<32x128xf32>) {
+    // CHECK-NOT: ttir.silu
+    // CHECK: ttir.sigmoid
+    %0 = ttir.empty() : tensor<32x128xf32>
+    %1 = "ttir.sigmoid"(%arg0, %0) : (tensor<32x128xf32>, tensor<32x128xf32>) -> tensor<32x128xf32>
+    %2 = ttir.empty() : tensor<32x128xf32>
+    %3 = "ttir.multiply"(%arg0, %1, %2) : (tensor<32x128xf32>, tensor<32x128xf32>, tensor<32x128xf32>) -> tensor<32x128xf32>
+    return %3, %1 : tensor<32x128xf32>, tensor<32x128xf32>
+  }
+}
@@ -0,0 +1,93 @@
+// RUN: ttmlir-opt %s -ttir-fusing | FileCheck %s
+
+module {
+  // CHECK-LABEL: func.func @rms_norm_fusion
+  func.func @rms_norm_fusion(%arg0: tensor<1x32x128xf32>, %arg1: tensor<128xf32>) -> tensor<1x32x128xf32> {
+    // CHECK-NOT: ttir.mean
+    // CHECK-NOT: ttir.rsqrt
+    // CHECK: %[[RESULT:.*]] = "ttir.rms_norm"(%arg0, %arg1, %{{.*}}) <{epsilon = 9.99999997E-7 : f32, operandSegmentSizes = array<i32: 1, 1, 0, 1>}>
+    // CHECK-NOT: ttir.multiply
+    // CHECK: return %[[RESULT]]
+    %0 = ttir.empty() : tensor<1x32x128xf32>
+    %1 = "ttir.multiply"(%arg0, %arg0, %0) : (tensor<1x32x128xf32>, tensor<1x32x128xf32>, tensor<1x32x128xf32>) -> tensor<1x32x128xf32>
+    %2 = ttir.empty() : tensor<1x32x1xf32>
+    %3 = "ttir.mean"(%1, %2) <{dim_arg = [-1 : i32], keep_dim = true}> : (tensor<1x32x128xf32>, tensor<1x32x1xf32>) -> tensor<1x32x1xf32>
+    %4 = "ttir.constant"() <{value = dense<1.000000e-06> : tensor<1x32x1xf32>}> : () -> tensor<1x32x1xf32>
+    %5 = ttir.empty() : tensor<1x32x1xf32>
+    %6 = "ttir.add"(%3, %4, %5) : (tensor<1x32x1xf32>, tensor<1x32x1xf32>, tensor<1x32x1xf32>) -> tensor<1x32x1xf32>
+    %7 = ttir.empty() : tensor<1x32x1xf32>
+    %8 = "ttir.rsqrt"(%6, %7) : (tensor<1x32x1xf32>, tensor<1x32x1xf32>) -> tensor<1x32x1xf32>
+    %9 = ttir.empty() : tensor<1x32x128xf32>
+    %10 = "ttir.broadcast"(%8, %9) <{broadcast_dimensions = array<i64: 1, 1, 128>}> : (tensor<1x32x1xf32>, tensor<1x32x128xf32>) -> tensor<1x32x128xf32>
+    %11 = ttir.empty() : tensor<1x32x128xf32>
+    %12 = "ttir.multiply"(%arg0, %10, %11) : (tensor<1x32x128xf32>, tensor<1x32x128xf32>, tensor<1x32x128xf32>) -> tensor<1x32x128xf32>
+    %13 = ttir.empty() : tensor<1x32x128xf32>
+    %14 = "ttir.multiply"(%12, %arg1, %13) : (tensor<1x32x128xf32>, tensor<128xf32>, tensor<1x32x128xf32>) -> tensor<1x32x128xf32>
+    return %14 : tensor<1x32x128xf32>
+  }
+}
+
+// The weight and bias are reshaped to 1D.
+module {
+  // CHECK-LABEL: func.func @layer_norm_fusion
+  func.func @layer_norm_fusion(%arg0: tensor<32x64xf32>, %arg1: tensor<1x64xf32>, %arg2: tensor<1x64xf32>) -> tensor<32x64xf32> {
+    // CHECK-DAG: %[[WEIGHT:.*]] = "ttir.reshape"(%arg1, %{{.*}}) <{shape = [64 : i32]}>
+    // CHECK-DAG: %[[BIAS:.*]] = "ttir.reshape"(%arg2, %{{.*}}) <{shape = [64 : i32]}>
+    // CHECK-NOT: ttir.mean
+    // CHECK: %[[RESULT:.*]] = "ttir.layer_norm"(%arg0, %[[WEIGHT]], %[[BIAS]], %{{.*}}) <{epsilon = 9.99999974E-6 : f32, operandSegmentSizes = array<i32: 1, 1, 1, 1>}>
+    // CHECK-NOT: ttir.add
+    // CHECK: return %[[RESULT]]
+    %0 = ttir.empty() : tensor<32x1xf32>
+    %1 = "ttir.mean"(%arg0, %0) <{dim_arg = [1 : i32], keep_dim = true}> : (tensor<32x64xf32>, tensor<32x1xf32>) -> tensor<32x1xf32>
+    %2 = ttir.empty() : tensor<32x64xf32>
+    %3 = "ttir.broadcast"(%1, %2) <{broadcast_dimensions = array<i64: 1, 64>}> : (tensor<32x1xf32>, tensor<32x64xf32>) -> tensor<32x64xf32>
+    %4 = ttir.empty() : tensor<32x64xf32>
+    %5 = "ttir.subtract"(%arg0, %3, %4) : (tensor<32x64xf32>, tensor<32x64xf32>, tensor<32x64xf32>) -> tensor<32x64xf32>
+    %6 = "ttir.constant"() <{value = dense<2.000000e+00> : tensor<32x64xf32>}> : () -> tensor<32x64xf32>
+    %7 = ttir.empty() : tensor<32x64xf32>
+    %8 = "ttir.pow"(%5, %6, %7) : (tensor<32x64xf32>, tensor<32x64xf32>, tensor<32x64xf32>) -> tensor<32x64xf32>
+    %9 = ttir.empty() : tensor<32x1xf32>
+    %10 = "ttir.mean"(%8, %9) <{dim_arg = [-1 : i32], keep_dim = true}> : (tensor<32x64xf32>, tensor<32x1xf32>) -> tensor<32x1xf32>
+    %11 = "ttir.constant"() <{value = dense<1.000000e-05> : tensor<32x1xf32>}> : () -> tensor<32x1xf32>
+    %12 = ttir.empty() : tensor<32x1xf32>
+    %13 = "ttir.add"(%10, %11, %12) : (tensor<32x1xf32>, tensor<32x1xf32>, tensor<32x1xf32>) -> tensor<32x1xf32>
+    %14 = ttir.empty() : tensor<32x1xf32>
+    %15 = "ttir.rsqrt"(%13, %14) : (tensor<32x1xf32>, tensor<32x1xf32>) -> tensor<32x1xf32>
+    %16 = ttir.empty() : tensor<32x64xf32>
+    %17 = "ttir.broadcast"(%15, %16) <{broadcast_dimensions = array<i64: 1, 64>}> : (tensor<32x1xf32>, tensor<32x64xf32>) -> tensor<32x64xf32>
+    %18 = ttir.empty() : tensor<32x64xf32>
+    %19 = "ttir.multiply"(%5, %17, %18) : (tensor<32x64xf32>, tensor<32x64xf32>, tensor<32x64xf32>) -> tensor<32x64xf32>
+    %20 = ttir.empty() : tensor<32x64xf32>
+    %21 = "ttir.broadcast"(%arg1, %20) <{broadcast_dimensions = array<i64: 32, 1>}> : (tensor<1x64xf32>, tensor<32x64xf32>) -> tensor<32x64xf32>
+    %22 = ttir.empty() : tensor<32x64xf32>
+    %23 = "ttir.multiply"(%19, %21, %22) : (tensor<32x64xf32>, tensor<32x64xf32>, tensor<32x64xf32>) -> tensor<32x64xf32>
+    %24 = ttir.empty() : tensor<32x64xf32>
+    %25 = "ttir.broadcast"(%arg2, %24) <{broadcast_dimensions = array<i64: 32, 1>}> : (tensor<1x64xf32>, tensor<32x64xf32>) -> tensor<32x64xf32>
+    %26 = ttir.empty() : tensor<32x64xf32>
+    %27 = "ttir.add"(%23, %25, %26) : (tensor<32x64xf32>, tensor<32x64xf32>, tensor<32x64xf32>) -> tensor<32x64xf32>
+    return %27 : tensor<32x64xf32>
+  }
+}
+
+// The mean square is reused, so the chain is not fused.
+module {
+  // CHECK-LABEL: func.func @rms_norm_no_fusion_multiple_uses
+  func.func @rms_norm_no_fusion_multiple_uses(%arg0: tensor<32x64xf32>) -> (tensor<32x64xf32>, tensor<32x1xf32>) {
+    // CHECK-NOT: ttir.rms_norm
+    // CHECK: ttir.rsqrt
+    %0 = ttir.empty() : tensor<32x64xf32>
+    %1 = "ttir.multiply"(%arg0, %arg0, %0) : (tensor<32x64xf32>, tensor<32x64xf32>, tensor<32x64xf32>) -> tensor<32x64xf32>
+    %2 = ttir.empty() : tensor<32x1xf32>
+    %3 = "ttir.mean"(%1, %2) <{dim_arg = [-1 : i32], keep_dim = true}> : (tensor<32x64xf32>, tensor<32x1xf32>) -> tensor<32x1xf32>
+    %4 = "ttir.constant"() <{value = dense<1.000000e-06> : tensor<32x1xf32>}> : () -> tensor<32x1xf32>
+    %5 = ttir.empty() : tensor<32x1xf32>
+    %6 = "ttir.add"(%3, %4, %5) : (tensor<32x1xf32>, tensor<32x1xf32>, tensor<32x1xf32>) -> tensor<32x1xf32>
+    %7 = ttir.empty() : tensor<32x1xf32>
+    %8 = "ttir.rsqrt"(%6, %7) : (tensor<32x1xf32>, tensor<32x1xf32>) -> tensor<32x1xf32>
+    %9 = ttir.empty() : tensor<32x64xf32>
+    %10 = "ttir.broadcast"(%8, %9) <{broadcast_dimensions = array<i64: 1, 64>}> : (tensor<32x1xf32>, tensor<32x64xf32>) -> tensor<32x64xf32>
+    %11 = ttir.empty() : tensor<32x64xf32>
+    %12 = "ttir.multiply"(%arg0, %10, %11) : (tensor<32x64xf32>, tensor<32x64xf32>, tensor<32x64xf32>) -> tensor<32x64xf32>
+    return %12, %3 : tensor<32x64xf32>, tensor<32x1xf32>
+  }
+}
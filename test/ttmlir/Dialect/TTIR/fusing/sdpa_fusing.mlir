@@ -0,0 +1,167 @@
+// RUN: ttmlir-opt %s -ttir-fusing | FileCheck %s
+
+module {
+  // CHECK-LABEL: func.func @sdpa_fusion_with_mask
+  func.func @sdpa_fusion_with_mask(%arg0: tensor<1x8x32x64xbf16>, %arg1: tensor<1x8x32x64xbf16>, %arg2: tensor<1x8x32x64xbf16>, %arg3: tensor<1x1x32x32xbf16>) -> tensor<1x8x32x64xbf16> {
+    // CHECK-NOT: ttir.transpose
+    // CHECK-NOT: ttir.matmul
+    // CHECK-NOT: ttir.softmax
+    // CHECK: %[[RESULT:.*]] = "ttir.scaled_dot_product_attention"(%arg0, %arg1, %arg2, %arg3, %{{.*}}) <{is_causal = false, scale = 1.250000e-01 : f32}>
+    // CHECK: return %[[RESULT]]
+    %0 = ttir.empty() : tensor<1x8x64x32xbf16>
+    %1 = "ttir.transpose"(%arg1, %0) <{dim0 = -2 : si32, dim1 = -1 : si32}> : (tensor<1x8x32x64xbf16>, tensor<1x8x64x32xbf16>) -> tensor<1x8x64x32xbf16>
+    %2 = ttir.empty() : tensor<1x8x32x32xbf16>
+    %3 = "ttir.matmul"(%arg0, %1, %2) : (tensor<1x8x32x64xbf16>, tensor<1x8x64x32xbf16>, tensor<1x8x32x32xbf16>) -> tensor<1x8x32x32xbf16>
+    %4 = "ttir.constant"() <{value = dense<1.250000e-01> : tensor<1x8x32x32xbf16>}> : () -> tensor<1x8x32x32xbf16>
+    %5 = ttir.empty() : tensor<1x8x32x32xbf16>
+    %6 = "ttir.multiply"(%3, %4, %5) : (tensor<1x8x32x32xbf16>, tensor<1x8x32x32xbf16>, tensor<1x8x32x32xbf16>) -> tensor<1x8x32x32xbf16>
+    %7 = ttir.empty() : tensor<1x8x32x32xbf16>
+    %8 = "ttir.add"(%6, %arg3, %7) : (tensor<1x8x32x32xbf16>, tensor<1x1x32x32xbf16>, tensor<1x8x32x32xbf16>) -> tensor<1x8x32x32xbf16>
+    %9 = ttir.empty() : tensor<1x8x32x32xbf16>
+    %10 = "ttir.softmax"(%8, %9) <{dimension = -1 : si32}> : (tensor<1x8x32x32xbf16>, tensor<1x8x32x32xbf16>) -> tensor<1x8x32x32xbf16>
+    %11 = ttir.empty() : tensor<1x8x32x64xbf16>
+    %12 = "ttir.matmul"(%10, %arg2, %11) : (tensor<1x8x32x32xbf16>, tensor<1x8x32x64xbf16>, tensor<1x8x32x64xbf16>) -> tensor<1x8x32x64xbf16>
+    return %12 : tensor<1x8x32x64xbf16>
+  }
+}
+
+// Causal mask constant and key/value heads repeated for GQA.
+module {
+  // CHECK-LABEL: func.func @sdpa_fusion_causal_gqa
+  func.func @sdpa_fusion_causal_gqa(%arg0: tensor<1x8x32x32xbf16>, %arg1: tensor<1x2x32x32xbf16>, %arg2: tensor<1x2x32x32xbf16>) -> tensor<1x8x32x32xbf16> {
+    // CHECK-NOT: ttir.repeat_interleave
+    // CHECK-NOT: ttir.matmul
+    // CHECK: %[[RESULT:.*]] = "ttir.scaled_dot_product_attention"(%arg0, %arg1, %arg2, %{{.*}}) <{is_causal = true, scale = 1.250000e-01 : f32}> : (tensor<1x8x32x32xbf16>, tensor<1x2x32x32xbf16>, tensor<1x2x32x32xbf16>, tensor<1x8x32x32xbf16>) -> tensor<1x8x32x32xbf16>
+    // CHECK: return %[[RESULT]]
+    %0 = ttir.empty() : tensor<1x8x32x32xbf16>
+    %1 = "ttir.repeat_interleave"(%arg1, %0) <{dim = 1 : si32, repeats = 4 : ui32}> : (tensor<1x2x32x32xbf16>, tensor<1x8x32x32xbf16>) -> tensor<1x8x32x32xbf16>
+    %2 = ttir.empty() : tensor<1x8x32x32xbf16>
+    %3 = "ttir.repeat_interleave"(%arg2, %2) <{dim = 1 : si32, repeats = 4 : ui32}> : (tensor<1x2x32x32xbf16>, tensor<1x8x32x32xbf16>) -> tensor<1x8x32x32xbf16>
+    %4 = ttir.empty() : tensor<1x8x32x32xbf16>
+    %5 = "ttir.matmul"(%arg0, %1, %4) <{transpose_b = true}> : (tensor<1x8x32x32xbf16>, tensor<1x8x32x32xbf16>, tensor<1x8x32x32xbf16>) -> tensor<1x8x32x32xbf16>
+    %6 = "ttir.constant"() <{value = dense<8.000000e+00> : tensor<1x8x32x32xbf16>}> : () -> tensor<1x8x32x32xbf16>
+    %7 = ttir.empty() : tensor<1x8x32x32xbf16>
+    %8 = "ttir.div"(%5, %6, %7) : (tensor<1x8x32x32xbf16>, tensor<1x8x32x32xbf16>, tensor<1x8x32x32xbf16>) -> tensor<1x8x32x32xbf16>
+    %9 = "ttir.constant"() <{value = dense<[[[[0.0, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09], [0.0, 0.0, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09], [0.0, 0.0, 0.0, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09], [0.0, 0.0, 0.0, 0.0, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09], [0.0, 0.0, 0.0, 0.0, 0.0, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09], [0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09], [0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09], [0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09], [0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09], [0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09], [0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09], [0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09], [0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09], [0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09], [0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09], [0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09], [0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09], [0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09], [0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09], [0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09], [0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09], [0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09], [0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09], [0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09], [0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09], [0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09], [0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09], [0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0e+09, -1.0e+09, -1.0e+09, -1.0e+09], [0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0e+09, -1.0e+09, -1.0e+09], [0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0e+09, -1.0e+09], [0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0e+09], [0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0]]]]> : tensor<1x1x32x32xbf16>}> : () -> tensor<1x1x32x32xbf16>
+    %10 = ttir.empty() : tensor<1x8x32x32xbf16>
+    %11 = "ttir.add"(%8, %9, %10) : (tensor<1x8x32x32xbf16>, tensor<1x1x32x32xbf16>, tensor<1x8x32x32xbf16>) -> tensor<1x8x32x32xbf16>
+    %12 = ttir.empty() : tensor<1x8x32x32xbf16>
+    %13 = "ttir.softmax"(%11, %12) <{dimension = 3 : si32}> : (tensor<1x8x32x32xbf16>, tensor<1x8x32x32xbf16>) -> tensor<1x8x32x32xbf16>
+    %14 = ttir.empty() : tensor<1x8x32x32xbf16>
+    %15 = "ttir.matmul"(%13, %3, %14) : (tensor<1x8x32x32xbf16>, tensor<1x8x32x32xbf16>, tensor<1x8x32x32xbf16>) -> tensor<1x8x32x32xbf16>
+    return %15 : tensor<1x8x32x32xbf16>
+  }
+}
+
+// K^T which isn't a transpose of K is transposed back, no scale means 1.0.
+module {
+  // CHECK-LABEL: func.func @sdpa_fusion_transposed_key
+  func.func @sdpa_fusion_transposed_key(%arg0: tensor<2x4x32x64xbf16>, %arg1: tensor<2x4x64x32xbf16>, %arg2: tensor<2x4x32x64xbf16>) -> tensor<2x4x32x64xbf16> {
+    // CHECK: %[[KEY:.*]] = "ttir.transpose"(%arg1, %{{.*}}) <{dim0 = -2 : si32, dim1 = -1 : si32}> : (tensor<2x4x64x32xbf16>, tensor<2x4x32x64xbf16>) -> tensor<2x4x32x64xbf16>
+    // CHECK: "ttir.scaled_dot_product_attention"(%arg0, %[[KEY]], %arg2, %{{.*}}) <{is_causal = false, scale = 1.000000e+00 : f32}>
+    // CHECK-NOT: ttir.matmul
+    %0 = ttir.empty() : tensor<2x4x32x32xbf16>
+    %1 = "ttir.matmul"(%arg0, %arg1, %0) : (tensor<2x4x32x64xbf16>, tensor<2x4x64x32xbf16>, tensor<2x4x32x32xbf16>) -> tensor<2x4x32x32xbf16>
+    %2 = ttir.empty() : tensor<2x4x32x32xbf16>
+    %3 = "ttir.softmax"(%1, %2) <{dimension = -1 : si32}> : (tensor<2x4x32x32xbf16>, tensor<2x4x32x32xbf16>) -> tensor<2x4x32x32xbf16>
+    %4 = ttir.empty() : tensor<2x4x32x64xbf16>
+    %5 = "ttir.matmul"(%3, %arg2, %4) : (tensor<2x4x32x32xbf16>, tensor<2x4x32x64xbf16>, tensor<2x4x32x64xbf16>) -> tensor<2x4x32x64xbf16>
+    return %5 : tensor<2x4x32x64xbf16>
+  }
+}
+
+// Test case with a negative pattern - the scores are used elsewhere.
+module {
+  // CHECK-LABEL: func.func @no_fusion_scores_multiple_users
+  func.func @no_fusion_scores_multiple_users(%arg0: tensor<1x8x32x64xbf16>, %arg1: tensor<1x8x32x64xbf16>, %arg2: tensor<1x8x32x64xbf16>) -> (tensor<1x8x32x64xbf16>, tensor<1x8x32x32xbf16>) {
+    // CHECK: ttir.matmul
+    // CHECK: ttir.softmax
+    // CHECK: ttir.matmul
+    // CHECK-NOT: ttir.scaled_dot_product_attention
+    %0 = ttir.empty() : tensor<1x8x32x32xbf16>
+    %1 = "ttir.matmul"(%arg0, %arg1, %0) <{transpose_b = true}> : (tensor<1x8x32x64xbf16>, tensor<1x8x32x64xbf16>, tensor<1x8x32x32xbf16>) -> tensor<1x8x32x32xbf16>
+    %2 = ttir.empty() : tensor<1x8x32x32xbf16>
+    %3 = "ttir.softmax"(%1, %2) <{dimension = -1 : si32}> : (tensor<1x8x32x32xbf16>, tensor<1x8x32x32xbf16>) -> tensor<1x8x32x32xbf16>
+    %4 = ttir.empty() : tensor<1x8x32x64xbf16>
+    %5 = "ttir.matmul"(%3, %arg2, %4) : (tensor<1x8x32x32xbf16>, tensor<1x8x32x64xbf16>, tensor<1x8x32x64xbf16>) -> tensor<1x8x32x64xbf16>
+    return %5, %1 : tensor<1x8x32x64xbf16>, tensor<1x8x32x32xbf16>
+  }
+}
+
+// The kernel only takes bf16, f32 attention isn't fused.
+module {
+  // CHECK-LABEL: func.func @no_fusion_f32
+  func.func @no_fusion_f32(%arg0: tensor<1x8x32x64xf32>, %arg1: tensor<1x8x32x64xf32>, %arg2: tensor<1x8x32x64xf32>) -> tensor<1x8x32x64xf32> {
+    // CHECK: ttir.softmax
+    // CHECK-NOT: ttir.scaled_dot_product_attention
+    %0 = ttir.empty() : tensor<1x8x32x32xf32>
+    %1 = "ttir.matmul"(%arg0, %arg1, %0) <{transpose_b = true}> : (tensor<1x8x32x64xf32>, tensor<1x8x32x64xf32>, tensor<1x8x32x32xf32>) -> tensor<1x8x32x32xf32>
+    %2 = ttir.empty() : tensor<1x8x32x32xf32>
+    %3 = "ttir.softmax"(%1, %2) <{dimension = -1 : si32}> : (tensor<1x8x32x32xf32>, tensor<1x8x32x32xf32>) -> tensor<1x8x32x32xf32>
+    %4 = ttir.empty() : tensor<1x8x32x64xf32>
+    %5 = "ttir.matmul"(%3, %arg2, %4) : (tensor<1x8x32x32xf32>, tensor<1x8x32x64xf32>, tensor<1x8x32x64xf32>) -> tensor<1x8x32x64xf32>
+    return %5 : tensor<1x8x32x64xf32>
+  }
+}
+
+// Sequence lengths must be a multiple of the tile height.
+module {
+  // CHECK-LABEL: func.func @no_fusion_unaligned_query_len
+  func.func @no_fusion_unaligned_query_len(%arg0: tensor<1x8x40x64xbf16>, %arg1: tensor<1x8x32x64xbf16>, %arg2: tensor<1x8x32x64xbf16>) -> tensor<1x8x40x64xbf16> {
+    // CHECK: ttir.softmax
+    // CHECK-NOT: ttir.scaled_dot_product_attention
+    %0 = ttir.empty() : tensor<1x8x40x32xbf16>
+    %1 = "ttir.matmul"(%arg0, %arg1, %0) <{transpose_b = true}> : (tensor<1x8x40x64xbf16>, tensor<1x8x32x64xbf16>, tensor<1x8x40x32xbf16>) -> tensor<1x8x40x32xbf16>
+    %2 = ttir.empty() : tensor<1x8x40x32xbf16>
+    %3 = "ttir.softmax"(%1, %2) <{dimension = -1 : si32}> : (tensor<1x8x40x32xbf16>, tensor<1x8x40x32xbf16>) -> tensor<1x8x40x32xbf16>
+    %4 = ttir.empty() : tensor<1x8x40x64xbf16>
+    %5 = "ttir.matmul"(%3, %arg2, %4) : (tensor<1x8x40x32xbf16>, tensor<1x8x32x64xbf16>, tensor<1x8x40x64xbf16>) -> tensor<1x8x40x64xbf16>
+    return %5 : tensor<1x8x40x64xbf16>
+  }
+}
+
+module {
+  // CHECK-LABEL: func.func @no_fusion_unaligned_key_len
+  func.func @no_fusion_unaligned_key_len(%arg0: tensor<1x8x32x64xbf16>, %arg1: tensor<1x8x48x64xbf16>, %arg2: tensor<1x8x48x64xbf16>) -> tensor<1x8x32x64xbf16> {
+    // CHECK: ttir.softmax
+    // CHECK-NOT: ttir.scaled_dot_product_attention
+    %0 = ttir.empty() : tensor<1x8x32x48xbf16>
+    %1 = "ttir.matmul"(%arg0, %arg1, %0) <{transpose_b = true}> : (tensor<1x8x32x64xbf16>, tensor<1x8x48x64xbf16>, tensor<1x8x32x48xbf16>) -> tensor<1x8x32x48xbf16>
+    %2 = ttir.empty() : tensor<1x8x32x48xbf16>
+    %3 = "ttir.softmax"(%1, %2) <{dimension = -1 : si32}> : (tensor<1x8x32x48xbf16>, tensor<1x8x32x48xbf16>) -> tensor<1x8x32x48xbf16>
+    %4 = ttir.empty() : tensor<1x8x32x64xbf16>
+    %5 = "ttir.matmul"(%3, %arg2, %4) : (tensor<1x8x32x48xbf16>, tensor<1x8x48x64xbf16>, tensor<1x8x32x64xbf16>) -> tensor<1x8x32x64xbf16>
+    return %5 : tensor<1x8x32x64xbf16>
+  }
+}
+
+// The head dim must be tile aligned and at most 256.
+module {
+  // CHECK-LABEL: func.func @no_fusion_unaligned_head_dim
+  func.func @no_fusion_unaligned_head_dim(%arg0: tensor<1x8x32x48xbf16>, %arg1: tensor<1x8x32x48xbf16>, %arg2: tensor<1x8x32x48xbf16>) -> tensor<1x8x32x48xbf16> {
+    // CHECK: ttir.softmax
+    // CHECK-NOT: ttir.scaled_dot_product_attention
+    %0 = ttir.empty() : tensor<1x8x32x32xbf16>
+    %1 = "ttir.matmul"(%arg0, %arg1, %0) <{transpose_b = true}> : (tensor<1x8x32x48xbf16>, tensor<1x8x32x48xbf16>, tensor<1x8x32x32xbf16>) -> tensor<1x8x32x32xbf16>
+    %2 = ttir.empty() : tensor<1x8x32x32xbf16>
+    %3 = "ttir.softmax"(%1, %2) <{dimension = -1 : si32}> : (tensor<1x8x32x32xbf16>, tensor<1x8x32x32xbf16>) -> tensor<1x8x32x32xbf16>
+    %4 = ttir.empty() : tensor<1x8x32x48xbf16>
+    %5 = "ttir.matmul"(%3, %arg2, %4) : (tensor<1x8x32x32xbf16>, tensor<1x8x32x48xbf16>, tensor<1x8x32x48xbf16>) -> tensor<1x8x32x48xbf16>
+    return %5 : tensor<1x8x32x48xbf16>
+  }
+}
+
+module {
+  // CHECK-LABEL: func.func @no_fusion_large_head_dim
+  func.func @no_fusion_large_head_dim(%arg0: tensor<1x8x32x512xbf16>, %arg1: tensor<1x8x32x512xbf16>, %arg2: tensor<1x8x32x512xbf16>) -> tensor<1x8x32x512xbf16> {
+    // CHECK: ttir.softmax
+    // CHECK-NOT: ttir.scaled_dot_product_attention
+    %0 = ttir.empty() : tensor<1x8x32x32xbf16>
+    %1 = "ttir.matmul"(%arg0, %arg1, %0) <{transpose_b = true}> : (tensor<1x8x32x512xbf16>, tensor<1x8x32x512xbf16>, tensor<1x8x32x32xbf16>) -> tensor<1x8x32x32xbf16>
+    %2 = ttir.empty() : tensor<1x8x32x32xbf16>
+    %3 = "ttir.softmax"(%1, %2) <{dimension = -1 : si32}> : (tensor<1x8x32x32xbf16>, tensor<1x8x32x32xbf16>) -> tensor<1x8x32x32xbf16>
+    %4 = ttir.empty() : tensor<1x8x32x512xbf16>
+    %5 = "ttir.matmul"(%3, %arg2, %4) : (tensor<1x8x32x32xbf16>, tensor<1x8x32x512xbf16>, tensor<1x8x32x512xbf16>) -> tensor<1x8x32x512xbf16>
+    return %5 : tensor<1x8x32x512xbf16>
+  }
+}
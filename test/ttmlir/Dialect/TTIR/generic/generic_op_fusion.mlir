@@ -0,0 +1,104 @@
+// RUN: ttmlir-opt --tt-register-device --ttir-to-ttir-generic="use-tile-matmul=false" --canonicalize --ttir-generic-op-fusion %s | FileCheck %s
+
+!ttype = tensor<128x96xf32>
+
+!lhs = tensor<128x96xf32>
+!rhs = tensor<96x64xf32>
+!matmul_result = tensor<128x64xf32>
+
+module {
+  // CHECK-LABEL: func @fuse_elementwise_chain
+  func.func @fuse_elementwise_chain(%lhs: !ttype, %rhs: !ttype, %out: !ttype) -> (!ttype) {
+    // CHECK: ttir.generic
+    // CHECK-NEXT: ins(%{{[a-z0-9_]+}}, %{{[a-z0-9_]+}} :
+    // CHECK: linalg.generic
+    // CHECK: ttir.tile_mul
+    // CHECK-NEXT: ttir.tile_exp
+    // CHECK-NEXT: ttir.tile_sin
+    // CHECK-NEXT: linalg.yield
+    // CHECK-NOT: ttir.generic
+    // CHECK: return
+    %0 = "ttir.multiply"(%lhs, %rhs, %out) : (!ttype, !ttype, !ttype) -> !ttype
+    %1 = "ttir.exp"(%0, %out) : (!ttype, !ttype) -> !ttype
+    %2 = "ttir.sin"(%1, %out) : (!ttype, !ttype) -> !ttype
+    return %2: !ttype
+  }
+
+  // CHECK-LABEL: func @fuse_into_binary_sfpu
+  func.func @fuse_into_binary_sfpu(%lhs: !ttype, %rhs: !ttype, %out: !ttype) -> (!ttype) {
+    // CHECK: ttir.generic
+    // CHECK-NEXT: ins(%{{[a-z0-9_]+}}, %{{[a-z0-9_]+}} :
+    // CHECK: ttir.tile_exp
+    // CHECK-NEXT: ttir.tile_div
+    // CHECK-NOT: ttir.generic
+    // CHECK: return
+    %0 = "ttir.exp"(%lhs, %out) : (!ttype, !ttype) -> !ttype
+    %1 = "ttir.div"(%0, %rhs, %out) : (!ttype, !ttype, !ttype) -> !ttype
+    return %1: !ttype
+  }
+
+  // CHECK-LABEL: func @no_fuse_into_fpu_or_second_operand
+  func.func @no_fuse_into_fpu_or_second_operand(%lhs: !ttype, %rhs: !ttype, %out: !ttype) -> (!ttype) {
+    // FPU ops read both operands from CBs, so exp is not fused into add. The
+    // intermediate can only be chained through DST as the first operand, so
+    // add is fused into maximum but sin is not.
+    // CHECK: ttir.generic
+    // CHECK: ttir.tile_exp
+    // CHECK: ttir.generic
+    // CHECK: ttir.tile_sin
+    // CHECK: ttir.generic
+    // CHECK: ttir.tile_add
+    // CHECK-NEXT: ttir.tile_maximum
+    %0 = "ttir.exp"(%lhs, %out) : (!ttype, !ttype) -> !ttype
+    %1 = "ttir.add"(%0, %rhs, %out) : (!ttype, !ttype, !ttype) -> !ttype
+    %2 = "ttir.sin"(%lhs, %out) : (!ttype, !ttype) -> !ttype
+    %3 = "ttir.maximum"(%1, %2, %out) : (!ttype, !ttype, !ttype) -> !ttype
+    return %3: !ttype
+  }
+
+  // CHECK-LABEL: func @no_fuse_multiple_uses
+  func.func @no_fuse_multiple_uses(%arg: !ttype, %out: !ttype) -> (!ttype, !ttype) {
+    // CHECK: ttir.generic
+    // CHECK: ttir.tile_exp
+    // CHECK: ttir.generic
+    // CHECK: ttir.tile_sin
+    // CHECK: ttir.generic
+    // CHECK: ttir.tile_log
+    %0 = "ttir.exp"(%arg, %out) : (!ttype, !ttype) -> !ttype
+    %1 = "ttir.sin"(%0, %out) : (!ttype, !ttype) -> !ttype
+    %2 = "ttir.log"(%0, %out) : (!ttype, !ttype) -> !ttype
+    return %1, %2: !ttype, !ttype
+  }
+
+  // CHECK-LABEL: func @fuse_matmul_epilogue
+  func.func @fuse_matmul_epilogue(%lhs: !lhs, %rhs: !rhs, %bias: !matmul_result, %out: !matmul_result) -> (!matmul_result) {
+    // CHECK: ttir.generic{{.+}}iterator_types = [#parallel, #parallel, #reduction]
+    // CHECK-NEXT: ins(%{{[a-z0-9_]+}}, %{{[a-z0-9_]+}}, %{{[a-z0-9_]+}} :
+    // CHECK: ^compute0(%[[CB0:[a-z0-9_]+]]: {{.+}}, %[[CB1:[a-z0-9_]+]]: {{.+}}, %[[CB2:[a-z0-9_]+]]: {{.+}}, %[[CB3:[a-z0-9_]+]]: {{.+}}):
+    // CHECK-NEXT: ttir.tile_matmul_block"(%[[CB0]], %[[CB1]], %[[CB3]])
+    // CHECK-NEXT: linalg.generic{{.+}}ins(%[[CB3]] : {{.+}}) outs(%[[CB3]] : {{.+}})
+    // CHECK: ttir.tile_exp
+    // CHECK: linalg.generic{{.+}}ins(%[[CB3]], %[[CB2]] : {{.+}}) outs(%[[CB3]] : {{.+}})
+    // CHECK: ttir.tile_maximum
+    // CHECK-NOT: ttir.generic
+    // CHECK: return
+    %0 = "ttir.matmul"(%lhs, %rhs, %out) : (!lhs, !rhs, !matmul_result) -> (!matmul_result)
+    %1 = "ttir.exp"(%0, %out) : (!matmul_result, !matmul_result) -> !matmul_result
+    %2 = "ttir.maximum"(%1, %bias, %out) : (!matmul_result, !matmul_result, !matmul_result) -> !matmul_result
+    return %2 : !matmul_result
+  }
+
+  // CHECK-LABEL: func @no_fuse_matmul_fpu_epilogue
+  func.func @no_fuse_matmul_fpu_epilogue(%lhs: !lhs, %rhs: !rhs, %bias: !matmul_result, %out: !matmul_result) -> (!matmul_result) {
+    // An FPU epilogue would read the matmul block from the output CB while
+    // packing its result into the same block, so it stays a separate generic.
+    // CHECK: ttir.generic
+    // CHECK: ttir.tile_matmul_block
+    // CHECK-NOT: linalg.generic
+    // CHECK: ttir.generic
+    // CHECK: ttir.tile_add
+    %0 = "ttir.matmul"(%lhs, %rhs, %out) : (!lhs, !rhs, !matmul_result) -> (!matmul_result)
+    %1 = "ttir.add"(%0, %bias, %out) : (!matmul_result, !matmul_result, !matmul_result) -> !matmul_result
+    return %1 : !matmul_result
+  }
+}
@@ -0,0 +1,94 @@
+// RUN: ttmlir-opt --tt-wrap-device-module --ttir-cpu-hoist-transform="auto-placement=true placement-report-path=%t.json" %s | FileCheck %s
+// RUN: FileCheck %s --input-file=%t.json --check-prefix=REPORT
+// RUN: ttmlir-opt --tt-wrap-device-module --ttir-cpu-hoist-transform="auto-placement=true device-locs=keep_exp" %s | FileCheck %s --check-prefix=OVERRIDE
+// RUN: ttmlir-opt --tt-wrap-device-module --ttir-cpu-hoist-transform="host-locs=force_add" %s | FileCheck %s --check-prefix=FORCE
+
+// A chain of small ops costs less on the host than three kernel dispatches.
+// CHECK-LABEL: func.func @small_chain
+// OVERRIDE-LABEL: func.func @small_chain
+// FORCE-LABEL: func.func @small_chain
+func.func @small_chain(%arg0: tensor<32x32xf32>, %arg1: tensor<32x32xf32>) -> tensor<32x32xf32> {
+  // CHECK: call @hoisted_ttir_add_ttir_exp_ttir_multiply_32x32_32x32_32x32_{{[0-9a-f]+}}_func_decl
+  // CHECK-NOT: "ttir.
+  // CHECK: return
+  // OVERRIDE: "ttir.add"
+  // OVERRIDE: "ttir.exp"
+  // OVERRIDE: "ttir.multiply"
+  // OVERRIDE-NOT: call
+  // FORCE-NOT: call
+  %0 = ttir.empty() : tensor<32x32xf32>
+  %1 = "ttir.add"(%arg0, %arg1, %0) : (tensor<32x32xf32>, tensor<32x32xf32>, tensor<32x32xf32>) -> tensor<32x32xf32> loc("chain_add")
+  %2 = ttir.empty() : tensor<32x32xf32>
+  %3 = "ttir.exp"(%1, %2) : (tensor<32x32xf32>, tensor<32x32xf32>) -> tensor<32x32xf32> loc("keep_exp")
+  %4 = ttir.empty() : tensor<32x32xf32>
+  %5 = "ttir.multiply"(%3, %arg1, %4) : (tensor<32x32xf32>, tensor<32x32xf32>, tensor<32x32xf32>) -> tensor<32x32xf32> loc("chain_multiply")
+  return %5 : tensor<32x32xf32>
+}
+
+// A single op doesn't save enough dispatch time to pay for the copies.
+// CHECK-LABEL: func.func @single_op
+// FORCE-LABEL: func.func @single_op
+func.func @single_op(%arg0: tensor<32x32xf32>, %arg1: tensor<32x32xf32>) -> tensor<32x32xf32> {
+  // CHECK-NOT: call
+  // CHECK: "ttir.add"
+  // FORCE: call @hoisted_ttir_add_32x32_32x32_32x32_func_decl
+  %0 = ttir.empty() : tensor<32x32xf32>
+  %1 = "ttir.add"(%arg0, %arg1, %0) : (tensor<32x32xf32>, tensor<32x32xf32>, tensor<32x32xf32>) -> tensor<32x32xf32> loc("force_add")
+  return %1 : tensor<32x32xf32>
+}
+
+// An input used by both ops is copied to the host once, which makes the pair
+// cheaper on the host.
+// CHECK-LABEL: func.func @shared_input
+func.func @shared_input(%arg0: tensor<32x32xf32>, %arg1: tensor<32x32xf32>) -> tensor<32x32xf32> {
+  // CHECK: call @hoisted_ttir_add_ttir_multiply_32x32_32x32_32x32_{{[0-9a-f]+}}_func_decl
+  // CHECK-NOT: "ttir.
+  // CHECK: return
+  %0 = ttir.empty() : tensor<32x32xf32>
+  %1 = "ttir.add"(%arg0, %arg1, %0) : (tensor<32x32xf32>, tensor<32x32xf32>, tensor<32x32xf32>) -> tensor<32x32xf32>
+  %2 = ttir.empty() : tensor<32x32xf32>
+  %3 = "ttir.multiply"(%1, %arg1, %2) : (tensor<32x32xf32>, tensor<32x32xf32>, tensor<32x32xf32>) -> tensor<32x32xf32>
+  return %3 : tensor<32x32xf32>
+}
+
+// The add result is also returned, so it can't be in the hoisted function of
+// its users. Alone it stays on the device, the exp and multiply are hoisted.
+// CHECK-LABEL: func.func @escaping_intermediate
+func.func @escaping_intermediate(%arg0: tensor<32x32xf32>, %arg1: tensor<32x32xf32>) -> (tensor<32x32xf32>, tensor<32x32xf32>) {
+  // CHECK: %[[ADD:[0-9]+]] = "ttir.add"
+  // CHECK: call @hoisted_ttir_exp_ttir_multiply_{{.*}}_func_decl(%[[ADD]], %{{[0-9]+}})
+  // CHECK-NOT: "ttir.
+  // CHECK: return
+  %0 = ttir.empty() : tensor<32x32xf32>
+  %1 = "ttir.add"(%arg0, %arg1, %0) : (tensor<32x32xf32>, tensor<32x32xf32>, tensor<32x32xf32>) -> tensor<32x32xf32>
+  %2 = ttir.empty() : tensor<32x32xf32>
+  %3 = "ttir.exp"(%1, %2) : (tensor<32x32xf32>, tensor<32x32xf32>) -> tensor<32x32xf32>
+  %4 = ttir.empty() : tensor<32x32xf32>
+  %5 = "ttir.multiply"(%3, %1, %4) : (tensor<32x32xf32>, tensor<32x32xf32>, tensor<32x32xf32>) -> tensor<32x32xf32>
+  return %1, %5 : tensor<32x32xf32>, tensor<32x32xf32>
+}
+
+// Integer ops would lose precision in the f32 host path and stay on the device.
+// CHECK-LABEL: func.func @integer_chain
+func.func @integer_chain(%arg0: tensor<32x32xi32>, %arg1: tensor<32x32xi32>) -> tensor<32x32xi32> {
+  // CHECK-NOT: call
+  // CHECK: "ttir.add"
+  // CHECK: "ttir.multiply"
+  // CHECK: "ttir.subtract"
+  %0 = ttir.empty() : tensor<32x32xi32>
+  %1 = "ttir.add"(%arg0, %arg1, %0) : (tensor<32x32xi32>, tensor<32x32xi32>, tensor<32x32xi32>) -> tensor<32x32xi32>
+  %2 = ttir.empty() : tensor<32x32xi32>
+  %3 = "ttir.multiply"(%1, %arg1, %2) : (tensor<32x32xi32>, tensor<32x32xi32>, tensor<32x32xi32>) -> tensor<32x32xi32>
+  %4 = ttir.empty() : tensor<32x32xi32>
+  %5 = "ttir.subtract"(%3, %arg0, %4) : (tensor<32x32xi32>, tensor<32x32xi32>, tensor<32x32xi32>) -> tensor<32x32xi32>
+  return %5 : tensor<32x32xi32>
+}
+
+// REPORT: "op": "ttir.add"
+// REPORT-NEXT: "loc": "chain_add"
+// REPORT-NEXT: "placement": "host"
+// REPORT-NEXT: "reason": "cost"
+// REPORT: "op": "ttir.add"
+// REPORT-NEXT: "loc": "force_add"
+// REPORT-NEXT: "placement": "device"
+// REPORT-NEXT: "reason": "cost"
@@ -0,0 +1,71 @@
+// RUN: ttmlir-opt --tt-wrap-device-module --ttir-cpu-hoist-transform %s | FileCheck %s
+// RUN: ttmlir-opt --tt-wrap-device-module --ttir-cpu-hoist-transform="cluster-ops=false" %s | FileCheck %s --check-prefix=NOCLUSTER
+
+// CHECK-LABEL: func.func @chain
+// NOCLUSTER-LABEL: func.func @chain
+func.func @chain(%arg0: tensor<32x32xf32>, %arg1: tensor<32x32xf32>) -> tensor<32x32xf32> {
+  // CHECK: %[[OUT:.*]] = ttir.empty() : tensor<32x32xf32>
+  // CHECK: %{{.*}} = call @hoisted_ttir_add_ttir_multiply_32x32_32x32_32x32_[[CHAIN:[0-9a-f]+]]_func_decl(%arg0, %arg1, %[[OUT]])
+  // CHECK-NOT: call
+  // NOCLUSTER: call @hoisted_ttir_add_32x32_32x32_32x32_func_decl
+  // NOCLUSTER: call @hoisted_ttir_multiply_32x32_32x32_32x32_func_decl
+  %0 = ttir.empty() : tensor<32x32xf32>
+  %1 = "ttir.add"(%arg0, %arg1, %0) {should_hoist} : (tensor<32x32xf32>, tensor<32x32xf32>, tensor<32x32xf32>) -> tensor<32x32xf32>
+  %2 = ttir.empty() : tensor<32x32xf32>
+  %3 = "ttir.multiply"(%1, %arg1, %2) {should_hoist} : (tensor<32x32xf32>, tensor<32x32xf32>, tensor<32x32xf32>) -> tensor<32x32xf32>
+  // CHECK: return
+  return %3 : tensor<32x32xf32>
+}
+
+// The result of the add is also used on the device, so the add and the
+// multiply are hoisted separately.
+// CHECK-LABEL: func.func @fan_out
+func.func @fan_out(%arg0: tensor<32x32xf32>, %arg1: tensor<32x32xf32>) -> tensor<32x32xf32> {
+  // CHECK: %[[ADD:.*]] = call @hoisted_ttir_add_32x32_32x32_32x32_func_decl
+  // CHECK: %[[MUL:.*]] = call @hoisted_ttir_multiply_32x32_32x32_32x32_func_decl(%[[ADD]]
+  // CHECK: "ttir.subtract"(%[[MUL]], %[[ADD]]
+  %0 = ttir.empty() : tensor<32x32xf32>
+  %1 = "ttir.add"(%arg0, %arg1, %0) {should_hoist} : (tensor<32x32xf32>, tensor<32x32xf32>, tensor<32x32xf32>) -> tensor<32x32xf32>
+  %2 = ttir.empty() : tensor<32x32xf32>
+  %3 = "ttir.multiply"(%1, %arg1, %2) {should_hoist} : (tensor<32x32xf32>, tensor<32x32xf32>, tensor<32x32xf32>) -> tensor<32x32xf32>
+  %4 = ttir.empty() : tensor<32x32xf32>
+  %5 = "ttir.subtract"(%3, %1, %4) : (tensor<32x32xf32>, tensor<32x32xf32>, tensor<32x32xf32>) -> tensor<32x32xf32>
+  return %5 : tensor<32x32xf32>
+}
+
+// The exp between the hoisted ops is cheaper to run on the host than copying
+// its operand to the device and its result back.
+// CHECK-LABEL: func.func @small_sandwich
+func.func @small_sandwich(%arg0: tensor<32x32xf32>, %arg1: tensor<32x32xf32>) -> tensor<32x32xf32> {
+  // CHECK: call @hoisted_ttir_add_ttir_exp_ttir_multiply_32x32_32x32_32x32_{{[0-9a-f]+}}_func_decl
+  // CHECK-NOT: ttir.exp
+  // CHECK: return
+  %0 = ttir.empty() : tensor<32x32xf32>
+  %1 = "ttir.add"(%arg0, %arg1, %0) {should_hoist} : (tensor<32x32xf32>, tensor<32x32xf32>, tensor<32x32xf32>) -> tensor<32x32xf32>
+  %2 = ttir.empty() : tensor<32x32xf32>
+  %3 = "ttir.exp"(%1, %2) : (tensor<32x32xf32>, tensor<32x32xf32>) -> tensor<32x32xf32>
+  %4 = ttir.empty() : tensor<32x32xf32>
+  %5 = "ttir.multiply"(%3, %arg1, %4) {should_hoist} : (tensor<32x32xf32>, tensor<32x32xf32>, tensor<32x32xf32>) -> tensor<32x32xf32>
+  return %5 : tensor<32x32xf32>
+}
+
+// For a large tensor, running the exp on the host costs more than the copies.
+// CHECK-LABEL: func.func @large_sandwich
+func.func @large_sandwich(%arg0: tensor<4096x4096xf32>, %arg1: tensor<4096x4096xf32>) -> tensor<4096x4096xf32> {
+  // CHECK: call @hoisted_ttir_add_4096x4096_4096x4096_4096x4096_func_decl
+  // CHECK: "ttir.exp"
+  // CHECK: call @hoisted_ttir_multiply_4096x4096_4096x4096_4096x4096_func_decl
+  %0 = ttir.empty() : tensor<4096x4096xf32>
+  %1 = "ttir.add"(%arg0, %arg1, %0) {should_hoist} : (tensor<4096x4096xf32>, tensor<4096x4096xf32>, tensor<4096x4096xf32>) -> tensor<4096x4096xf32>
+  %2 = ttir.empty() : tensor<4096x4096xf32>
+  %3 = "ttir.exp"(%1, %2) : (tensor<4096x4096xf32>, tensor<4096x4096xf32>) -> tensor<4096x4096xf32>
+  %4 = ttir.empty() : tensor<4096x4096xf32>
+  %5 = "ttir.multiply"(%3, %arg1, %4) {should_hoist} : (tensor<4096x4096xf32>, tensor<4096x4096xf32>, tensor<4096x4096xf32>) -> tensor<4096x4096xf32>
+  return %5 : tensor<4096x4096xf32>
+}
+
+// CHECK: tt.cpu_module {
+// CHECK: func.func @hoisted_ttir_add_ttir_multiply_32x32_32x32_32x32_[[CHAIN]]_func(%[[A:.*]]: tensor<32x32xf32> {bufferization.access = "read"}, %[[B:.*]]: tensor<32x32xf32> {bufferization.access = "read"}, %[[C:.*]]: tensor<32x32xf32> {bufferization.access = "write"})
+// CHECK: %[[TMP:.*]] = ttir.empty() : tensor<32x32xf32>
+// CHECK: %[[SUM:.*]] = "ttir.add"(%[[A]], %[[B]], %[[TMP]])
+// CHECK: "ttir.multiply"(%[[SUM]], %[[B]], %[[C]])
@@ -0,0 +1,44 @@
+// RUN: ttmlir-opt --tt-register-device --ttnn-workaround --canonicalize %s | FileCheck %s
+#dram = #ttnn.buffer_type<dram>
+#ttnn_layout = #ttnn.ttnn_layout<(d0, d1, d2, d3) -> (d0 * 256 + d1 * 32 + d2, d3), <1x1>, memref<8x2x!tt.tile<32x32, f32>, #dram>, <interleaved>>
+#ttnn_layout1 = #ttnn.ttnn_layout<(d0, d1, d2, d3) -> (d0 * 64 + d1 * 32 + d2, d3), <1x1>, memref<2x2x!tt.tile<32x32, f32>, #dram>, <interleaved>>
+#ttnn_layout2 = #ttnn.ttnn_layout<(d0, d1, d2, d3) -> (d0 * 32 + d1 * 32 + d2, d3), <1x1>, memref<32x32xf32, #dram>, <interleaved>>
+module attributes {} {
+  func.func @sdpa(%arg0: tensor<1x8x32x64xf32, #ttnn_layout>, %arg1: tensor<1x2x32x64xf32, #ttnn_layout1>, %arg2: tensor<1x2x32x64xf32, #ttnn_layout1>, %arg3: tensor<1x1x32x32xf32, #ttnn_layout2>) -> tensor<1x8x32x64xf32, #ttnn_layout> {
+    // Check that the query, key and value operands are cast to bf16.
+    // CHECK: %[[QUERY:.*]] = "ttnn.to_layout"(%arg0
+    // CHECK-SAME: dtype = #tt.supportedDataTypes<bf16>
+    // CHECK-SAME: layout = #ttnn.layout<tile>
+    // CHECK-SAME: -> tensor<1x8x32x64xbf16
+    // CHECK: %[[KEY:.*]] = "ttnn.to_layout"(%arg1
+    // CHECK-SAME: dtype = #tt.supportedDataTypes<bf16>
+    // CHECK-SAME: -> tensor<1x2x32x64xbf16
+    // CHECK: %[[VALUE:.*]] = "ttnn.to_layout"(%arg2
+    // CHECK-SAME: dtype = #tt.supportedDataTypes<bf16>
+    // CHECK-SAME: -> tensor<1x2x32x64xbf16
+    // Check that the row-major mask is tilized and cast to bf16.
+    // CHECK: %[[MASK:.*]] = "ttnn.to_layout"(%arg3
+    // CHECK-SAME: dtype = #tt.supportedDataTypes<bf16>
+    // CHECK-SAME: layout = #ttnn.layout<tile>
+    // CHECK-SAME: -> tensor<1x1x32x32xbf16
+    // CHECK: %[[SDPA:.*]] = "ttnn.scaled_dot_product_attention"(%[[QUERY]], %[[KEY]], %[[VALUE]], %[[MASK]])
+    // CHECK-SAME: -> tensor<1x8x32x64xbf16
+    %0 = "ttnn.scaled_dot_product_attention"(%arg0, %arg1, %arg2, %arg3) <{is_causal = false, scale = 1.250000e-01 : f32}> : (tensor<1x8x32x64xf32, #ttnn_layout>, tensor<1x2x32x64xf32, #ttnn_layout1>, tensor<1x2x32x64xf32, #ttnn_layout1>, tensor<1x1x32x32xf32, #ttnn_layout2>) -> tensor<1x8x32x64xf32, #ttnn_layout>
+    // Check that the output operand is cast back to f32.
+    // CHECK: "ttnn.to_layout"(%[[SDPA]]
+    // CHECK-SAME: dtype = #tt.supportedDataTypes<f32>
+    // CHECK-SAME: -> tensor<1x8x32x64xf32
+    return %0 : tensor<1x8x32x64xf32, #ttnn_layout>
+  }
+
+  func.func @sdpa_causal(%arg0: tensor<1x8x32x64xf32, #ttnn_layout>, %arg1: tensor<1x2x32x64xf32, #ttnn_layout1>, %arg2: tensor<1x2x32x64xf32, #ttnn_layout1>) -> tensor<1x8x32x64xf32, #ttnn_layout> {
+    // CHECK-LABEL: func.func @sdpa_causal
+    // CHECK-COUNT-3: "ttnn.to_layout"
+    // CHECK: "ttnn.scaled_dot_product_attention"
+    // CHECK-SAME: (tensor<1x8x32x64xbf16, {{.*}}>, tensor<1x2x32x64xbf16, {{.*}}>, tensor<1x2x32x64xbf16, {{.*}}>) -> tensor<1x8x32x64xbf16
+    %0 = "ttnn.scaled_dot_product_attention"(%arg0, %arg1, %arg2) <{is_causal = true}> : (tensor<1x8x32x64xf32, #ttnn_layout>, tensor<1x2x32x64xf32, #ttnn_layout1>, tensor<1x2x32x64xf32, #ttnn_layout1>) -> tensor<1x8x32x64xf32, #ttnn_layout>
+    // CHECK: "ttnn.to_layout"
+    // CHECK-SAME: dtype = #tt.supportedDataTypes<f32>
+    return %0 : tensor<1x8x32x64xf32, #ttnn_layout>
+  }
+}
@@ -0,0 +1,46 @@
+// RUN: ttmlir-opt --split-input-file --ttir-to-ttnn-backend-pipeline="mesh-shape=1,2 enable-ccl-overlap-scheduling=true" %s | FileCheck %s
+// Unit tests for ttnn CCL overlap scheduling
+
+// -----
+
+// Verify that all_gather is hoisted above independent compute and that its
+// consumer stays after that compute.
+module attributes {} {
+  // CHECK-LABEL: all_gather_overlap
+  func.func @all_gather_overlap(%arg0: tensor<1x1x32x32xbf16>, %arg1: tensor<1x1x32x64xbf16>) -> tensor<1x1x32x64xbf16> {
+    %0 = ttir.empty() : tensor<1x1x32x64xbf16>
+    %1 = "ttir.multiply"(%arg1, %arg1, %0) : (tensor<1x1x32x64xbf16>, tensor<1x1x32x64xbf16>, tensor<1x1x32x64xbf16>) -> tensor<1x1x32x64xbf16>
+    %2 = ttir.empty() : tensor<1x1x32x64xbf16>
+    %3 = "ttir.all_gather"(%arg0, %2) <{all_gather_dim = 3 : si32, cluster_axis = 1 : ui32}> : (tensor<1x1x32x32xbf16>, tensor<1x1x32x64xbf16>) -> tensor<1x1x32x64xbf16>
+    %4 = ttir.empty() : tensor<1x1x32x64xbf16>
+    %5 = "ttir.add"(%3, %1, %4) : (tensor<1x1x32x64xbf16>, tensor<1x1x32x64xbf16>, tensor<1x1x32x64xbf16>) -> tensor<1x1x32x64xbf16>
+    // CHECK: "ttnn.all_gather"
+    // CHECK: "ttnn.multiply"
+    // CHECK: "ttnn.add"
+    return %5 : tensor<1x1x32x64xbf16>
+  }
+}
+
+// -----
+
+// Verify that a collective is hoisted above independent compute, that a
+// collective depending on that compute stays after it and that the relative
+// order of collectives is preserved.
+module attributes {} {
+  // CHECK-LABEL: collectives_keep_order
+  func.func @collectives_keep_order(%arg0: tensor<1x1x32x32xbf16>, %arg1: tensor<1x1x32x32xbf16>) -> tensor<1x1x32x64xbf16> {
+    %0 = ttir.empty() : tensor<1x1x32x32xbf16>
+    %1 = "ttir.exp"(%arg1, %0) : (tensor<1x1x32x32xbf16>, tensor<1x1x32x32xbf16>) -> tensor<1x1x32x32xbf16>
+    %2 = ttir.empty() : tensor<1x1x32x64xbf16>
+    %3 = "ttir.all_gather"(%arg0, %2) <{all_gather_dim = 3 : si32, cluster_axis = 1 : ui32}> : (tensor<1x1x32x32xbf16>, tensor<1x1x32x64xbf16>) -> tensor<1x1x32x64xbf16>
+    %4 = ttir.empty() : tensor<1x1x32x64xbf16>
+    %5 = "ttir.all_gather"(%1, %4) <{all_gather_dim = 3 : si32, cluster_axis = 1 : ui32}> : (tensor<1x1x32x32xbf16>, tensor<1x1x32x64xbf16>) -> tensor<1x1x32x64xbf16>
+    %6 = ttir.empty() : tensor<1x1x32x64xbf16>
+    %7 = "ttir.add"(%3, %5, %6) : (tensor<1x1x32x64xbf16>, tensor<1x1x32x64xbf16>, tensor<1x1x32x64xbf16>) -> tensor<1x1x32x64xbf16>
+    // CHECK: %[[FIRST:.*]] = "ttnn.all_gather"
+    // CHECK: %[[EXP:.*]] = "ttnn.exp"
+    // CHECK: %[[SECOND:.*]] = "ttnn.all_gather"(%[[EXP]]
+    // CHECK: "ttnn.add"(%[[FIRST]], %[[SECOND]])
+    return %7 : tensor<1x1x32x64xbf16>
+  }
+}
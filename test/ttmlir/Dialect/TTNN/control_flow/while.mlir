@@ -0,0 +1,40 @@
+// RUN: ttmlir-opt --ttir-to-ttnn-backend-pipeline %s | FileCheck %s
+
+module {
+  // CHECK-LABEL: func.func @forward(
+  func.func @forward(%arg0: tensor<1xf32>, %arg1: tensor<32x32xf32>) -> tensor<32x32xf32> {
+    // CHECK: %[[WHILE:.*]]:2 = tt.while(@forward_while_cond_0, @forward_while_body_0, [%{{.*}}, %{{.*}}])
+    // CHECK: return %[[WHILE]]#1
+    %0:2 = tt.while(@forward_while_cond_0, @forward_while_body_0, [%arg0, %arg1]) : (tensor<1xf32>, tensor<32x32xf32>) -> (tensor<1xf32>, tensor<32x32xf32>)
+    return %0#1 : tensor<32x32xf32>
+  }
+
+  // Loop regions are lowered like any other function but are not optimized,
+  // and the runtime owns the loop-carried tensors.
+  // CHECK-LABEL: func.func private @forward_while_cond_0
+  // CHECK-SAME: attributes {loop_region}
+  // CHECK: "ttnn.lt"
+  // CHECK-NOT: "ttnn.deallocate"(%arg0
+  // CHECK: return
+  func.func private @forward_while_cond_0(%arg0: tensor<1xf32>, %arg1: tensor<32x32xf32>) -> tensor<1xf32> attributes {loop_region} {
+    %0 = "ttir.constant"() <{value = dense<1.000000e+01> : tensor<1xf32>}> : () -> tensor<1xf32>
+    %1 = ttir.empty() : tensor<1xf32>
+    %2 = "ttir.lt"(%arg0, %0, %1) : (tensor<1xf32>, tensor<1xf32>, tensor<1xf32>) -> tensor<1xf32>
+    return %2 : tensor<1xf32>
+  }
+
+  // CHECK-LABEL: func.func private @forward_while_body_0
+  // CHECK-SAME: attributes {loop_region}
+  // CHECK: %[[COUNTER:.*]] = "ttnn.add"(%arg0
+  // CHECK: %[[DATA:.*]] = "ttnn.add"(%arg1, %arg1)
+  // CHECK-NOT: "ttnn.deallocate"(%arg
+  // CHECK: return %[[COUNTER]], %[[DATA]]
+  func.func private @forward_while_body_0(%arg0: tensor<1xf32>, %arg1: tensor<32x32xf32>) -> (tensor<1xf32>, tensor<32x32xf32>) attributes {loop_region} {
+    %0 = "ttir.constant"() <{value = dense<1.000000e+00> : tensor<1xf32>}> : () -> tensor<1xf32>
+    %1 = ttir.empty() : tensor<1xf32>
+    %2 = "ttir.add"(%arg0, %0, %1) : (tensor<1xf32>, tensor<1xf32>, tensor<1xf32>) -> tensor<1xf32>
+    %3 = ttir.empty() : tensor<32x32xf32>
+    %4 = "ttir.add"(%arg1, %arg1, %3) : (tensor<32x32xf32>, tensor<32x32xf32>, tensor<32x32xf32>) -> tensor<32x32xf32>
+    return %2, %4 : tensor<1xf32>, tensor<32x32xf32>
+  }
+}
@@ -0,0 +1,12 @@
+// RUN: ttmlir-opt --ttir-to-ttnn-backend-pipeline %s | FileCheck %s
+module attributes {} {
+  func.func @forward(%arg0: tensor<64x128xf32>) -> tensor<64x128xf32> {
+    %0 = ttir.empty() : tensor<64x128xf32>
+    %1 = "ttir.gelu"(%arg0, %0) <{approximate = true}> : (tensor<64x128xf32>, tensor<64x128xf32>) -> tensor<64x128xf32>
+    // CHECK: "ttnn.gelu"
+    // CHECK-SAME: approximate = true
+    // CHECK-SAME: tensor<64x128xf32
+    // CHECK-SAME: -> tensor<64x128xf32
+    return %1 : tensor<64x128xf32>
+  }
+}
@@ -0,0 +1,123 @@
+// RUN: ttmlir-opt --tt-register-device --ttnn-matmul-epilogue-fusing %s | FileCheck %s
+
+#dram = #ttnn.buffer_type<dram>
+#l1 = #ttnn.buffer_type<l1>
+#ttnn_layout = #ttnn.ttnn_layout<(d0, d1) -> (d0, d1), <1x1>, memref<2x3x!tt.tile<32x32, bf16>, #dram>, <interleaved>>
+#ttnn_layout1 = #ttnn.ttnn_layout<(d0, d1) -> (d0, d1), <1x1>, memref<3x4x!tt.tile<32x32, bf16>, #dram>, <interleaved>>
+#ttnn_layout2 = #ttnn.ttnn_layout<(d0, d1) -> (d0, d1), <1x1>, memref<2x4x!tt.tile<32x32, bf16>, #dram>, <interleaved>>
+#ttnn_layout3 = #ttnn.ttnn_layout<(d0) -> (0, d0), <1x1>, memref<1x4x!tt.tile<32x32, bf16>, #dram>, <interleaved>>
+#ttnn_layout4 = #ttnn.ttnn_layout<(d0, d1) -> (d0, d1), <2x4>, memref<1x1x!tt.tile<32x32, bf16>, #l1>, <block_sharded>>
+#ttnn_layout5 = #ttnn.ttnn_layout<(d0, d1) -> (d0, d1), <1x1>, memref<1x4x!tt.tile<32x32, bf16>, #dram>, <interleaved>>
+#ttnn_layout6 = #ttnn.ttnn_layout<(d0, d1) -> (d0, d1), <1x1>, memref<2x4x!tt.tile<32x32, bf16>, #l1>, <interleaved>>
+module {
+  // CHECK-LABEL: func.func @matmul_bias_relu
+  func.func @matmul_bias_relu(%arg0: tensor<64x96xbf16, #ttnn_layout>, %arg1: tensor<96x128xbf16, #ttnn_layout1>, %arg2: tensor<128xbf16, #ttnn_layout3>) -> tensor<64x128xbf16, #ttnn_layout2> {
+    // CHECK: %[[RESULT:.*]] = "ttnn.linear"(%arg0, %arg1, %arg2)
+    // CHECK-SAME: activation = "relu"
+    // CHECK-NOT: "ttnn.add"
+    // CHECK-NOT: "ttnn.relu"
+    // CHECK: return %[[RESULT]]
+    %0 = "ttnn.matmul"(%arg0, %arg1) : (tensor<64x96xbf16, #ttnn_layout>, tensor<96x128xbf16, #ttnn_layout1>) -> tensor<64x128xbf16, #ttnn_layout2>
+    %1 = "ttnn.add"(%0, %arg2) : (tensor<64x128xbf16, #ttnn_layout2>, tensor<128xbf16, #ttnn_layout3>) -> tensor<64x128xbf16, #ttnn_layout2>
+    %2 = "ttnn.relu"(%1) : (tensor<64x128xbf16, #ttnn_layout2>) -> tensor<64x128xbf16, #ttnn_layout2>
+    return %2 : tensor<64x128xbf16, #ttnn_layout2>
+  }
+
+  // CHECK-LABEL: func.func @matmul_silu
+  func.func @matmul_silu(%arg0: tensor<64x96xbf16, #ttnn_layout>, %arg1: tensor<96x128xbf16, #ttnn_layout1>) -> tensor<64x128xbf16, #ttnn_layout2> {
+    // CHECK: %[[RESULT:.*]] = "ttnn.matmul"(%arg0, %arg1) <{activation = "silu"
+    // CHECK-NOT: "ttnn.silu"
+    // CHECK: return %[[RESULT]]
+    %0 = "ttnn.matmul"(%arg0, %arg1) : (tensor<64x96xbf16, #ttnn_layout>, tensor<96x128xbf16, #ttnn_layout1>) -> tensor<64x128xbf16, #ttnn_layout2>
+    %1 = "ttnn.silu"(%0) : (tensor<64x128xbf16, #ttnn_layout2>) -> tensor<64x128xbf16, #ttnn_layout2>
+    return %1 : tensor<64x128xbf16, #ttnn_layout2>
+  }
+
+  // The gelu matmul activation is the approximate gelu.
+  // CHECK-LABEL: func.func @linear_row_bias_gelu
+  func.func @linear_row_bias_gelu(%arg0: tensor<64x96xbf16, #ttnn_layout>, %arg1: tensor<96x128xbf16, #ttnn_layout1>, %arg2: tensor<1x128xbf16, #ttnn_layout5>) -> tensor<64x128xbf16, #ttnn_layout2> {
+    // CHECK: %[[RESULT:.*]] = "ttnn.linear"(%arg0, %arg1, %arg2)
+    // CHECK-SAME: activation = "gelu"
+    // CHECK-NOT: "ttnn.add"
+    // CHECK-NOT: "ttnn.gelu"
+    // CHECK: return %[[RESULT]]
+    %0 = "ttnn.linear"(%arg0, %arg1) : (tensor<64x96xbf16, #ttnn_layout>, tensor<96x128xbf16, #ttnn_layout1>) -> tensor<64x128xbf16, #ttnn_layout2>
+    %1 = "ttnn.add"(%arg2, %0) : (tensor<1x128xbf16, #ttnn_layout5>, tensor<64x128xbf16, #ttnn_layout2>) -> tensor<64x128xbf16, #ttnn_layout2>
+    %2 = "ttnn.gelu"(%1) <{approximate = true}> : (tensor<64x128xbf16, #ttnn_layout2>) -> tensor<64x128xbf16, #ttnn_layout2>
+    return %2 : tensor<64x128xbf16, #ttnn_layout2>
+  }
+
+  // Exact gelu has no matmul activation, so it's kept.
+  // CHECK-LABEL: func.func @matmul_exact_gelu
+  func.func @matmul_exact_gelu(%arg0: tensor<64x96xbf16, #ttnn_layout>, %arg1: tensor<96x128xbf16, #ttnn_layout1>) -> tensor<64x128xbf16, #ttnn_layout2> {
+    // CHECK: %[[MATMUL:.*]] = "ttnn.matmul"(%arg0, %arg1)
+    // CHECK-NOT: activation
+    // CHECK: %[[RESULT:.*]] = "ttnn.gelu"(%[[MATMUL]])
+    // CHECK: return %[[RESULT]]
+    %0 = "ttnn.matmul"(%arg0, %arg1) : (tensor<64x96xbf16, #ttnn_layout>, tensor<96x128xbf16, #ttnn_layout1>) -> tensor<64x128xbf16, #ttnn_layout2>
+    %1 = "ttnn.gelu"(%0) : (tensor<64x128xbf16, #ttnn_layout2>) -> tensor<64x128xbf16, #ttnn_layout2>
+    return %1 : tensor<64x128xbf16, #ttnn_layout2>
+  }
+
+  // ttnn::linear only broadcasts a single bias row, so a full-shape residual
+  // stays a separate add, and the gelu following it isn't fused either.
+  // CHECK-LABEL: func.func @linear_residual_gelu
+  func.func @linear_residual_gelu(%arg0: tensor<64x96xbf16, #ttnn_layout>, %arg1: tensor<96x128xbf16, #ttnn_layout1>, %arg2: tensor<64x128xbf16, #ttnn_layout2>) -> tensor<64x128xbf16, #ttnn_layout2> {
+    // CHECK: %[[LINEAR:.*]] = "ttnn.linear"(%arg0, %arg1)
+    // CHECK-NOT: activation
+    // CHECK: %[[ADD:.*]] = "ttnn.add"(%arg2, %[[LINEAR]])
+    // CHECK: %[[RESULT:.*]] = "ttnn.gelu"(%[[ADD]])
+    // CHECK: return %[[RESULT]]
+    %0 = "ttnn.linear"(%arg0, %arg1) : (tensor<64x96xbf16, #ttnn_layout>, tensor<96x128xbf16, #ttnn_layout1>) -> tensor<64x128xbf16, #ttnn_layout2>
+    %1 = "ttnn.add"(%arg2, %0) : (tensor<64x128xbf16, #ttnn_layout2>, tensor<64x128xbf16, #ttnn_layout2>) -> tensor<64x128xbf16, #ttnn_layout2>
+    %2 = "ttnn.gelu"(%1) : (tensor<64x128xbf16, #ttnn_layout2>) -> tensor<64x128xbf16, #ttnn_layout2>
+    return %2 : tensor<64x128xbf16, #ttnn_layout2>
+  }
+
+  // The matmul result is also returned, so nothing is fused.
+  // CHECK-LABEL: func.func @matmul_multiple_uses
+  func.func @matmul_multiple_uses(%arg0: tensor<64x96xbf16, #ttnn_layout>, %arg1: tensor<96x128xbf16, #ttnn_layout1>) -> (tensor<64x128xbf16, #ttnn_layout2>, tensor<64x128xbf16, #ttnn_layout2>) {
+    // CHECK: "ttnn.matmul"
+    // CHECK-NOT: activation
+    // CHECK: "ttnn.relu"
+    %0 = "ttnn.matmul"(%arg0, %arg1) : (tensor<64x96xbf16, #ttnn_layout>, tensor<96x128xbf16, #ttnn_layout1>) -> tensor<64x128xbf16, #ttnn_layout2>
+    %1 = "ttnn.relu"(%0) : (tensor<64x128xbf16, #ttnn_layout2>) -> tensor<64x128xbf16, #ttnn_layout2>
+    return %0, %1 : tensor<64x128xbf16, #ttnn_layout2>, tensor<64x128xbf16, #ttnn_layout2>
+  }
+
+  // The relu output is sharded to L1 while the matmul writes DRAM, so the
+  // relu stays in its sharding chain.
+  // CHECK-LABEL: func.func @matmul_relu_sharded
+  func.func @matmul_relu_sharded(%arg0: tensor<64x96xbf16, #ttnn_layout>, %arg1: tensor<96x128xbf16, #ttnn_layout1>) -> tensor<64x128xbf16, #ttnn_layout4> {
+    // CHECK: "ttnn.matmul"
+    // CHECK-NOT: activation
+    // CHECK: "ttnn.relu"
+    %0 = "ttnn.matmul"(%arg0, %arg1) : (tensor<64x96xbf16, #ttnn_layout>, tensor<96x128xbf16, #ttnn_layout1>) -> tensor<64x128xbf16, #ttnn_layout2>
+    %1 = "ttnn.relu"(%0) : (tensor<64x128xbf16, #ttnn_layout2>) -> tensor<64x128xbf16, #ttnn_layout4>
+    return %1 : tensor<64x128xbf16, #ttnn_layout4>
+  }
+
+  // The linear output is sharded to L1 by the layout analysis while the relu
+  // writes DRAM, so the relu is kept.
+  // CHECK-LABEL: func.func @linear_sharded_relu
+  func.func @linear_sharded_relu(%arg0: tensor<64x96xbf16, #ttnn_layout>, %arg1: tensor<96x128xbf16, #ttnn_layout1>) -> tensor<64x128xbf16, #ttnn_layout2> {
+    // CHECK: "ttnn.linear"
+    // CHECK-NOT: activation
+    // CHECK: "ttnn.relu"
+    %0 = "ttnn.linear"(%arg0, %arg1) : (tensor<64x96xbf16, #ttnn_layout>, tensor<96x128xbf16, #ttnn_layout1>) -> tensor<64x128xbf16, #ttnn_layout4>
+    %1 = "ttnn.relu"(%0) : (tensor<64x128xbf16, #ttnn_layout4>) -> tensor<64x128xbf16, #ttnn_layout2>
+    return %1 : tensor<64x128xbf16, #ttnn_layout2>
+  }
+
+  // The relu writes L1 interleaved while the matmul writes DRAM. The matmul
+  // was never validated with the relu's layout, so the relu is kept.
+  // CHECK-LABEL: func.func @matmul_relu_l1_interleaved
+  func.func @matmul_relu_l1_interleaved(%arg0: tensor<64x96xbf16, #ttnn_layout>, %arg1: tensor<96x128xbf16, #ttnn_layout1>) -> tensor<64x128xbf16, #ttnn_layout6> {
+    // CHECK: "ttnn.matmul"
+    // CHECK-NOT: activation
+    // CHECK: "ttnn.relu"
+    %0 = "ttnn.matmul"(%arg0, %arg1) : (tensor<64x96xbf16, #ttnn_layout>, tensor<96x128xbf16, #ttnn_layout1>) -> tensor<64x128xbf16, #ttnn_layout2>
+    %1 = "ttnn.relu"(%0) : (tensor<64x128xbf16, #ttnn_layout2>) -> tensor<64x128xbf16, #ttnn_layout6>
+    return %1 : tensor<64x128xbf16, #ttnn_layout6>
+  }
+}
@@ -0,0 +1,46 @@
+// RUN: ttmlir-opt --ttir-to-ttnn-backend-pipeline="enable-fusing-pass=true" %s | FileCheck %s
+
+// Matmul epilogues are fused by the backend pipeline once the layouts are
+// picked.
+module {
+  // CHECK-LABEL: func.func @matmul_bias_relu
+  func.func @matmul_bias_relu(%arg0: tensor<64x96xbf16>, %arg1: tensor<96x128xbf16>, %arg2: tensor<1x128xbf16>) -> tensor<64x128xbf16> {
+    // CHECK: %[[RESULT:.*]] = "ttnn.linear"
+    // CHECK-SAME: activation = "relu"
+    // CHECK-NOT: "ttnn.add"
+    // CHECK-NOT: "ttnn.relu"
+    // CHECK: return %[[RESULT]]
+    %0 = ttir.empty() : tensor<64x128xbf16>
+    %1 = "ttir.matmul"(%arg0, %arg1, %0) : (tensor<64x96xbf16>, tensor<96x128xbf16>, tensor<64x128xbf16>) -> tensor<64x128xbf16>
+    %2 = ttir.empty() : tensor<64x128xbf16>
+    %3 = "ttir.add"(%1, %arg2, %2) : (tensor<64x128xbf16>, tensor<1x128xbf16>, tensor<64x128xbf16>) -> tensor<64x128xbf16>
+    %4 = ttir.empty() : tensor<64x128xbf16>
+    %5 = "ttir.relu"(%3, %4) : (tensor<64x128xbf16>, tensor<64x128xbf16>) -> tensor<64x128xbf16>
+    return %5 : tensor<64x128xbf16>
+  }
+
+  // CHECK-LABEL: func.func @matmul_approximate_gelu
+  func.func @matmul_approximate_gelu(%arg0: tensor<64x96xbf16>, %arg1: tensor<96x128xbf16>) -> tensor<64x128xbf16> {
+    // CHECK: %[[RESULT:.*]] = "ttnn.matmul"
+    // CHECK-SAME: activation = "gelu"
+    // CHECK-NOT: "ttnn.gelu"
+    // CHECK: return %[[RESULT]]
+    %0 = ttir.empty() : tensor<64x128xbf16>
+    %1 = "ttir.matmul"(%arg0, %arg1, %0) : (tensor<64x96xbf16>, tensor<96x128xbf16>, tensor<64x128xbf16>) -> tensor<64x128xbf16>
+    %2 = ttir.empty() : tensor<64x128xbf16>
+    %3 = "ttir.gelu"(%1, %2) <{approximate = true}> : (tensor<64x128xbf16>, tensor<64x128xbf16>) -> tensor<64x128xbf16>
+    return %3 : tensor<64x128xbf16>
+  }
+
+  // CHECK-LABEL: func.func @matmul_exact_gelu
+  func.func @matmul_exact_gelu(%arg0: tensor<64x96xbf16>, %arg1: tensor<96x128xbf16>) -> tensor<64x128xbf16> {
+    // CHECK: "ttnn.matmul"
+    // CHECK-NOT: activation
+    // CHECK: "ttnn.gelu"
+    %0 = ttir.empty() : tensor<64x128xbf16>
+    %1 = "ttir.matmul"(%arg0, %arg1, %0) : (tensor<64x96xbf16>, tensor<96x128xbf16>, tensor<64x128xbf16>) -> tensor<64x128xbf16>
+    %2 = ttir.empty() : tensor<64x128xbf16>
+    %3 = "ttir.gelu"(%1, %2) : (tensor<64x128xbf16>, tensor<64x128xbf16>) -> tensor<64x128xbf16>
+    return %3 : tensor<64x128xbf16>
+  }
+}
@@ -0,0 +1,22 @@
+// RUN: ttmlir-opt --ttir-to-ttnn-backend-pipeline %s | FileCheck %s
+module attributes {} {
+  func.func @paged_update_cache(%cache: tensor<128x8x32x64xbf16>, %input: tensor<1x4x8x64xbf16>, %update_index: tensor<4xi32>, %page_table: tensor<4x16xi32>) -> tensor<128x8x32x64xbf16> {
+    // CHECK: "ttnn.paged_update_cache"
+    %0 = "ttir.paged_update_cache"(%cache, %input, %update_index, %page_table) : (tensor<128x8x32x64xbf16>, tensor<1x4x8x64xbf16>, tensor<4xi32>, tensor<4x16xi32>) -> tensor<128x8x32x64xbf16>
+    return %0 : tensor<128x8x32x64xbf16>
+  }
+
+  func.func @paged_fill_cache(%cache: tensor<128x8x32x64xbf16>, %input: tensor<1x8x256x64xbf16>, %page_table: tensor<4x16xi32>, %batch_idx: tensor<1xi32>) -> tensor<128x8x32x64xbf16> {
+    // CHECK: "ttnn.paged_fill_cache"
+    %0 = "ttir.paged_fill_cache"(%cache, %input, %page_table, %batch_idx) : (tensor<128x8x32x64xbf16>, tensor<1x8x256x64xbf16>, tensor<4x16xi32>, tensor<1xi32>) -> tensor<128x8x32x64xbf16>
+    return %0 : tensor<128x8x32x64xbf16>
+  }
+
+  func.func @paged_sdpa_decode(%query: tensor<1x4x32x64xbf16>, %key: tensor<128x8x32x64xbf16>, %value: tensor<128x8x32x64xbf16>, %page_table: tensor<4x16xi32>, %cur_pos: tensor<4xi32>) -> tensor<1x4x32x64xbf16> {
+    %0 = ttir.empty() : tensor<1x4x32x64xbf16>
+    // CHECK: "ttnn.paged_scaled_dot_product_attention_decode"
+    // CHECK-SAME: scale = 1.250000e-01 : f32
+    %1 = "ttir.paged_scaled_dot_product_attention_decode"(%query, %key, %value, %page_table, %cur_pos, %0) <{scale = 0.125 : f32}> : (tensor<1x4x32x64xbf16>, tensor<128x8x32x64xbf16>, tensor<128x8x32x64xbf16>, tensor<4x16xi32>, tensor<4xi32>, tensor<1x4x32x64xbf16>) -> tensor<1x4x32x64xbf16>
+    return %1 : tensor<1x4x32x64xbf16>
+  }
+}
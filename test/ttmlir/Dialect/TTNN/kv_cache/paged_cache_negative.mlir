@@ -0,0 +1,29 @@
+// RUN: not ttmlir-opt --split-input-file %s 2>&1 | FileCheck %s
+// Negative tests for paged cache ops
+
+module attributes {} {
+  func.func @paged_update_cache_index_shape(%cache: tensor<128x8x32x64xbf16>, %input: tensor<1x4x8x64xbf16>, %update_index: tensor<2xi32>, %page_table: tensor<4x16xi32>) -> tensor<128x8x32x64xbf16> {
+    // CHECK: error: 'ttir.paged_update_cache' op Update index must be a 1D integer tensor with one position per sequence
+    %0 = "ttir.paged_update_cache"(%cache, %input, %update_index, %page_table) : (tensor<128x8x32x64xbf16>, tensor<1x4x8x64xbf16>, tensor<2xi32>, tensor<4x16xi32>) -> tensor<128x8x32x64xbf16>
+    return %0 : tensor<128x8x32x64xbf16>
+  }
+}
+
+// -----
+module attributes {} {
+  func.func @paged_fill_cache_too_long(%cache: tensor<128x8x32x64xbf16>, %input: tensor<1x8x1024x64xbf16>, %page_table: tensor<4x16xi32>, %batch_idx: tensor<1xi32>) -> tensor<128x8x32x64xbf16> {
+    // CHECK: error: 'ttir.paged_fill_cache' op Input sequence length 1024 exceeds the capacity of a sequence in the page table (512)
+    %0 = "ttir.paged_fill_cache"(%cache, %input, %page_table, %batch_idx) : (tensor<128x8x32x64xbf16>, tensor<1x8x1024x64xbf16>, tensor<4x16xi32>, tensor<1xi32>) -> tensor<128x8x32x64xbf16>
+    return %0 : tensor<128x8x32x64xbf16>
+  }
+}
+
+// -----
+module attributes {} {
+  func.func @paged_sdpa_decode_heads(%query: tensor<1x4x12x64xbf16>, %key: tensor<128x8x32x64xbf16>, %value: tensor<128x8x32x64xbf16>, %page_table: tensor<4x16xi32>, %cur_pos: tensor<4xi32>) -> tensor<1x4x12x64xbf16> {
+    %0 = ttir.empty() : tensor<1x4x12x64xbf16>
+    // CHECK: error: 'ttir.paged_scaled_dot_product_attention_decode' op Number of query heads must be a multiple of the number of key/value heads
+    %1 = "ttir.paged_scaled_dot_product_attention_decode"(%query, %key, %value, %page_table, %cur_pos, %0) : (tensor<1x4x12x64xbf16>, tensor<128x8x32x64xbf16>, tensor<128x8x32x64xbf16>, tensor<4x16xi32>, tensor<4xi32>, tensor<1x4x12x64xbf16>) -> tensor<1x4x12x64xbf16>
+    return %1 : tensor<1x4x12x64xbf16>
+  }
+}
@@ -0,0 +1,28 @@
+// RUN: ttmlir-opt --ttir-to-ttnn-backend-pipeline="automatic-precision-budget=0.07 automatic-precision-report-path=%t.json" %s | FileCheck %s
+// RUN: FileCheck %s --check-prefix=REPORT --input-file=%t.json
+
+// Both weights fit in bfp_bf8. Only the larger one also fits in bfp_bf4 within
+// the budget, since it saves more bytes for the same estimated error.
+module {
+  // CHECK-DAG: "ttnn.typecast"(%{{.*}}) <{dtype = #tt.supportedDataTypes<bfp_bf4>}>
+  // CHECK-DAG: "ttnn.typecast"(%{{.*}}) <{dtype = #tt.supportedDataTypes<bfp_bf8>}>
+  // CHECK-LABEL: func.func @forward(
+  // CHECK: tt.load_cached
+  // CHECK: "ttnn.matmul"
+  // CHECK: "ttnn.matmul"
+  func.func @forward(%arg0: tensor<32x128xbf16> {tt.argument_type = #tt.argument_type<input>}, %arg1: tensor<128x128xbf16> {tt.argument_type = #tt.argument_type<parameter>}, %arg2: tensor<128x64xbf16> {tt.argument_type = #tt.argument_type<parameter>}) -> tensor<32x64xbf16> {
+    %0 = ttir.empty() : tensor<32x128xbf16>
+    %1 = "ttir.matmul"(%arg0, %arg1, %0) : (tensor<32x128xbf16>, tensor<128x128xbf16>, tensor<32x128xbf16>) -> tensor<32x128xbf16> loc("matmul_0")
+    %2 = ttir.empty() : tensor<32x64xbf16>
+    %3 = "ttir.matmul"(%1, %arg2, %2) : (tensor<32x128xbf16>, tensor<128x64xbf16>, tensor<32x64xbf16>) -> tensor<32x64xbf16> loc("matmul_1")
+    return %3 : tensor<32x64xbf16>
+  }
+}
+
+// REPORT: "matmul_0"
+// REPORT: "data_type": "bfp_bf4"
+// REPORT: "matmul_1"
+// REPORT: "data_type": "bfp_bf8"
+// REPORT: "estimated_error"
+// REPORT-NEXT: "bytes_before": 49152
+// REPORT-NEXT: "bytes_after": 16384
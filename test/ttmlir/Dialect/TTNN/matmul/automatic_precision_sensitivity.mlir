@@ -0,0 +1,50 @@
+// RUN: ttmlir-opt --ttir-to-ttnn-backend-pipeline="automatic-precision-budget=0.05 automatic-precision-sensitivity-path=%S/Inputs/automatic_precision_sensitivity.json automatic-precision-report-path=%t.measured.json" %s | FileCheck %s --check-prefix=MEASURED
+// RUN: FileCheck %s --check-prefix=MEASURED-REPORT --input-file=%t.measured.json
+// RUN: ttmlir-opt --ttir-to-ttnn-backend-pipeline="automatic-precision-budget=0.01 automatic-precision-report-path=%t.bf8.json" %s | FileCheck %s --check-prefix=BF8
+// RUN: FileCheck %s --check-prefix=BF8-REPORT --input-file=%t.bf8.json
+// RUN: ttmlir-opt --ttir-to-ttnn-backend-pipeline="automatic-precision-budget=0.001 automatic-precision-report-path=%t.none.json" %s | FileCheck %s --check-prefix=NONE
+// RUN: FileCheck %s --check-prefix=NONE-REPORT --input-file=%t.none.json
+
+// The same weights as in automatic_precision.mlir under other budgets, and
+// with errors measured by `ttrt run --precision-sensitivity`.
+module {
+  func.func @forward(%arg0: tensor<32x128xbf16> {tt.argument_type = #tt.argument_type<input>}, %arg1: tensor<128x128xbf16> {tt.argument_type = #tt.argument_type<parameter>}, %arg2: tensor<128x64xbf16> {tt.argument_type = #tt.argument_type<parameter>}) -> tensor<32x64xbf16> {
+    %0 = ttir.empty() : tensor<32x128xbf16>
+    %1 = "ttir.matmul"(%arg0, %arg1, %0) : (tensor<32x128xbf16>, tensor<128x128xbf16>, tensor<32x128xbf16>) -> tensor<32x128xbf16> loc("matmul_0")
+    %2 = ttir.empty() : tensor<32x64xbf16>
+    %3 = "ttir.matmul"(%1, %arg2, %2) : (tensor<32x128xbf16>, tensor<128x64xbf16>, tensor<32x64xbf16>) -> tensor<32x64xbf16> loc("matmul_1")
+    return %3 : tensor<32x64xbf16>
+  }
+}
+
+// matmul_0 is measured too sensitive for either block-float format within the
+// budget and stays bf16, while matmul_1 goes down to bfp_bf4.
+// MEASURED-NOT: bfp_bf8
+// MEASURED: "ttnn.typecast"(%{{.*}}) <{dtype = #tt.supportedDataTypes<bfp_bf4>}>
+// MEASURED-NOT: "ttnn.typecast"
+// MEASURED-LABEL: func.func @forward(
+// MEASURED-REPORT: "matmul_0"
+// MEASURED-REPORT: "data_type": "bf16"
+// MEASURED-REPORT: "matmul_1"
+// MEASURED-REPORT: "data_type": "bfp_bf4"
+// MEASURED-REPORT: "estimated_error"
+// MEASURED-REPORT-NEXT: "bytes_before": 49152
+// MEASURED-REPORT-NEXT: "bytes_after": 37376
+
+// With the default errors both weights fit in bfp_bf8, neither in bfp_bf4.
+// BF8-NOT: bfp_bf4
+// BF8-COUNT-2: "ttnn.typecast"(%{{.*}}) <{dtype = #tt.supportedDataTypes<bfp_bf8>}>
+// BF8-LABEL: func.func @forward(
+// BF8-REPORT: "matmul_0"
+// BF8-REPORT: "data_type": "bfp_bf8"
+// BF8-REPORT: "matmul_1"
+// BF8-REPORT: "data_type": "bfp_bf8"
+// BF8-REPORT: "estimated_error"
+// BF8-REPORT-NEXT: "bytes_before": 49152
+// BF8-REPORT-NEXT: "bytes_after": 26112
+
+// The default bfp_bf8 error alone exceeds the budget, nothing is converted.
+// NONE-NOT: "ttnn.typecast"
+// NONE-REPORT: "estimated_error": 0
+// NONE-REPORT-NEXT: "bytes_before": 49152
+// NONE-REPORT-NEXT: "bytes_after": 49152
@@ -0,0 +1,21 @@
+// RUN: ttmlir-opt --ttir-to-ttnn-backend-pipeline %s | FileCheck %s
+module attributes {} {
+  func.func @layer_norm(%arg0: tensor<32x128xbf16>) -> tensor<32x128xbf16> {
+    %0 = ttir.empty() : tensor<32x128xbf16>
+    // CHECK: "ttnn.layer_norm"
+    // CHECK-SAME: epsilon = 9.99999974E-6 : f32
+    // CHECK-SAME: operandSegmentSizes = array<i32: 1, 0, 0>
+    // CHECK-SAME: -> tensor<32x128xbf16
+    %1 = "ttir.layer_norm"(%arg0, %0) <{epsilon = 9.99999974E-6 : f32, operandSegmentSizes = array<i32: 1, 0, 0, 1>}> : (tensor<32x128xbf16>, tensor<32x128xbf16>) -> tensor<32x128xbf16>
+    return %1 : tensor<32x128xbf16>
+  }
+
+  func.func @layer_norm_affine(%arg0: tensor<32x128xbf16>, %arg1: tensor<128xbf16>, %arg2: tensor<128xbf16>) -> tensor<32x128xbf16> {
+    %0 = ttir.empty() : tensor<32x128xbf16>
+    // CHECK: "ttnn.layer_norm"
+    // CHECK-SAME: operandSegmentSizes = array<i32: 1, 1, 1>
+    // CHECK-SAME: -> tensor<32x128xbf16
+    %1 = "ttir.layer_norm"(%arg0, %arg1, %arg2, %0) <{epsilon = 9.99999974E-6 : f32, operandSegmentSizes = array<i32: 1, 1, 1, 1>}> : (tensor<32x128xbf16>, tensor<128xbf16>, tensor<128xbf16>, tensor<32x128xbf16>) -> tensor<32x128xbf16>
+    return %1 : tensor<32x128xbf16>
+  }
+}
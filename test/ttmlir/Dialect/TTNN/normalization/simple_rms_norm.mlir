@@ -0,0 +1,21 @@
+// RUN: ttmlir-opt --ttir-to-ttnn-backend-pipeline %s | FileCheck %s
+module attributes {} {
+  func.func @rms_norm(%arg0: tensor<32x128xbf16>) -> tensor<32x128xbf16> {
+    %0 = ttir.empty() : tensor<32x128xbf16>
+    // CHECK: "ttnn.rms_norm"
+    // CHECK-SAME: epsilon = 9.99999997E-7 : f32
+    // CHECK-SAME: operandSegmentSizes = array<i32: 1, 0, 0>
+    // CHECK-SAME: -> tensor<32x128xbf16
+    %1 = "ttir.rms_norm"(%arg0, %0) <{epsilon = 9.99999997E-7 : f32, operandSegmentSizes = array<i32: 1, 0, 0, 1>}> : (tensor<32x128xbf16>, tensor<32x128xbf16>) -> tensor<32x128xbf16>
+    return %1 : tensor<32x128xbf16>
+  }
+
+  func.func @rms_norm_weight(%arg0: tensor<32x128xbf16>, %arg1: tensor<128xbf16>) -> tensor<32x128xbf16> {
+    %0 = ttir.empty() : tensor<32x128xbf16>
+    // CHECK: "ttnn.rms_norm"
+    // CHECK-SAME: operandSegmentSizes = array<i32: 1, 1, 0>
+    // CHECK-SAME: -> tensor<32x128xbf16
+    %1 = "ttir.rms_norm"(%arg0, %arg1, %0) <{epsilon = 9.99999997E-7 : f32, operandSegmentSizes = array<i32: 1, 1, 0, 1>}> : (tensor<32x128xbf16>, tensor<128xbf16>, tensor<32x128xbf16>) -> tensor<32x128xbf16>
+    return %1 : tensor<32x128xbf16>
+  }
+}
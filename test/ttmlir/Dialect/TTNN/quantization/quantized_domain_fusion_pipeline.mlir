@@ -0,0 +1,29 @@
+// RUN: ttmlir-opt --ttir-to-ttnn-backend-pipeline="enable-quantized-domain-fusion=true" %s | FileCheck %s --check-prefix=FUSED
+// RUN: ttmlir-opt --ttir-to-ttnn-backend-pipeline %s | FileCheck %s --check-prefix=DEFAULT
+module {
+  func.func @matmul_qdq(%arg0: tensor<32x64x!quant.uniform<i8:f32, 5.000000e-01>>, %arg1: tensor<64x32x!quant.uniform<i8:f32, 2.500000e-01>>) -> tensor<32x32x!quant.uniform<i8:f32, 1.000000e+00>> {
+    // The storage types are widened to i32 before the fusion.
+    // FUSED-LABEL: func.func @matmul_qdq(
+    // FUSED-SAME: tensor<32x64x!quant.uniform<i32:f32, 5.000000e-01>
+    // FUSED-NOT: "ttnn.dequantize"
+    // FUSED: %[[MATMUL:[0-9]+]] = "ttnn.matmul"(%arg0, %arg1)
+    // FUSED-SAME: -> tensor<32x32x!quant.uniform<i32:f32, 1.250000e-01>
+    // FUSED: "ttnn.requantize"(%[[MATMUL]])
+    // FUSED-SAME: -> tensor<32x32x!quant.uniform<i32:f32, 1.000000e+00>
+    // FUSED-NOT: "ttnn.quantize"
+    // DEFAULT-LABEL: func.func @matmul_qdq(
+    // DEFAULT: "ttnn.dequantize"
+    // DEFAULT: "ttnn.matmul"
+    // DEFAULT-SAME: -> tensor<32x32xf32
+    // DEFAULT: "ttnn.quantize"
+    %0 = ttir.empty() : tensor<32x64xf32>
+    %1 = "ttir.dequantize"(%arg0, %0) : (tensor<32x64x!quant.uniform<i8:f32, 5.000000e-01>>, tensor<32x64xf32>) -> tensor<32x64xf32>
+    %2 = ttir.empty() : tensor<64x32xf32>
+    %3 = "ttir.dequantize"(%arg1, %2) : (tensor<64x32x!quant.uniform<i8:f32, 2.500000e-01>>, tensor<64x32xf32>) -> tensor<64x32xf32>
+    %4 = ttir.empty() : tensor<32x32xf32>
+    %5 = "ttir.matmul"(%1, %3, %4) : (tensor<32x64xf32>, tensor<64x32xf32>, tensor<32x32xf32>) -> tensor<32x32xf32>
+    %6 = ttir.empty() : tensor<32x32x!quant.uniform<i8:f32, 1.000000e+00>>
+    %7 = "ttir.quantize"(%5, %6) : (tensor<32x32xf32>, tensor<32x32x!quant.uniform<i8:f32, 1.000000e+00>>) -> tensor<32x32x!quant.uniform<i8:f32, 1.000000e+00>>
+    return %7 : tensor<32x32x!quant.uniform<i8:f32, 1.000000e+00>>
+  }
+}
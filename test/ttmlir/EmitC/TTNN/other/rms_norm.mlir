@@ -0,0 +1,10 @@
+// RUN: ttmlir-opt --ttir-to-ttnn-backend-pipeline="system-desc-path=%system_desc_path%" %s > %t.mlir
+// RUN: ttmlir-translate --ttnn-to-flatbuffer %t.mlir > %basename_t.ttnn
+// RUN: ttmlir-opt --ttnn-modify-signatures-for-dylib --convert-ttnn-to-emitc %t.mlir > %t2.mlir
+// RUN: ttmlir-translate --mlir-to-cpp %t2.mlir > %basename_t.cpp
+
+func.func @rms_norm(%arg0: tensor<32x128xbf16>, %arg1: tensor<128xbf16>) -> tensor<32x128xbf16> {
+  %0 = ttir.empty() : tensor<32x128xbf16>
+  %1 = "ttir.rms_norm"(%arg0, %arg1, %0) <{epsilon = 9.99999997E-7 : f32, operandSegmentSizes = array<i32: 1, 1, 0, 1>}> : (tensor<32x128xbf16>, tensor<128xbf16>, tensor<32x128xbf16>) -> tensor<32x128xbf16>
+  return %1 : tensor<32x128xbf16>
+}
@@ -0,0 +1,22 @@
+// REQUIRES: stablehlo
+// RUN: rm -rf %t.ttnn
+// RUN: rm -rf %t.mlir
+// RUN: ttmlir-opt --stablehlo-to-ttir-pipeline="shape-bucket-sizes=32,64" %s | \
+// RUN:     ttmlir-opt --ttir-to-ttnn-backend-pipeline="system-desc-path=%system_desc_path%" > %t.mlir
+// RUN: ttmlir-translate --ttnn-to-flatbuffer %t.mlir > %t.ttnn
+// RUN: FileCheck --input-file=%t.mlir %s
+
+// The binary is also executed through submit_bucketed by
+// runtime/test/python/ttnn/device_agnostic/test_shape_bucketing.py.
+module @jit_shape_bucketing attributes {} {
+  // CHECK-LABEL: func.func public @forward_bucket_32
+  // CHECK: "ttnn.matmul"
+  // CHECK-SAME: -> tensor<1x32x64xf32
+  // CHECK-LABEL: func.func public @forward_bucket_64
+  // CHECK: "ttnn.matmul"
+  // CHECK-SAME: -> tensor<1x64x64xf32
+  func.func public @forward(%arg0: tensor<1x?x64xf32>, %arg1: tensor<64x64xf32>) -> tensor<1x?x64xf32> {
+    %0 = stablehlo.dot_general %arg0, %arg1, contracting_dims = [2] x [0] : (tensor<1x?x64xf32>, tensor<64x64xf32>) -> tensor<1x?x64xf32>
+    return %0 : tensor<1x?x64xf32>
+  }
+}
@@ -0,0 +1,35 @@
+// RUN: ttmlir-opt --ttir-to-ttnn-backend-pipeline="system-desc-path=%system_desc_path%" %s > %t.mlir
+// RUN: FileCheck %s --input-file=%t.mlir
+// RUN: ttmlir-translate --ttnn-to-flatbuffer %t.mlir > %t.ttnn
+
+// Doubles %arg1 until the counter reaches 10. The binary is also executed by
+// runtime/test/python/ttnn/device_agnostic/test_while.py.
+module {
+  // CHECK-LABEL: func.func @forward(
+  func.func @forward(%arg0: tensor<1xf32>, %arg1: tensor<32x32xf32>) -> tensor<32x32xf32> {
+    // CHECK: tt.while(@forward_while_cond_0, @forward_while_body_0
+    %0:2 = tt.while(@forward_while_cond_0, @forward_while_body_0, [%arg0, %arg1]) : (tensor<1xf32>, tensor<32x32xf32>) -> (tensor<1xf32>, tensor<32x32xf32>)
+    return %0#1 : tensor<32x32xf32>
+  }
+
+  // CHECK-LABEL: func.func private @forward_while_cond_0
+  func.func private @forward_while_cond_0(%arg0: tensor<1xf32>, %arg1: tensor<32x32xf32>) -> tensor<1xf32> attributes {loop_region} {
+    %0 = "ttir.constant"() <{value = dense<1.000000e+01> : tensor<1xf32>}> : () -> tensor<1xf32>
+    %1 = ttir.empty() : tensor<1xf32>
+    // CHECK: "ttnn.lt"
+    %2 = "ttir.lt"(%arg0, %0, %1) : (tensor<1xf32>, tensor<1xf32>, tensor<1xf32>) -> tensor<1xf32>
+    return %2 : tensor<1xf32>
+  }
+
+  // CHECK-LABEL: func.func private @forward_while_body_0
+  func.func private @forward_while_body_0(%arg0: tensor<1xf32>, %arg1: tensor<32x32xf32>) -> (tensor<1xf32>, tensor<32x32xf32>) attributes {loop_region} {
+    %0 = "ttir.constant"() <{value = dense<1.000000e+00> : tensor<1xf32>}> : () -> tensor<1xf32>
+    %1 = ttir.empty() : tensor<1xf32>
+    // CHECK: "ttnn.add"
+    %2 = "ttir.add"(%arg0, %0, %1) : (tensor<1xf32>, tensor<1xf32>, tensor<1xf32>) -> tensor<1xf32>
+    %3 = ttir.empty() : tensor<32x32xf32>
+    // CHECK: "ttnn.add"
+    %4 = "ttir.add"(%arg1, %arg1, %3) : (tensor<32x32xf32>, tensor<32x32xf32>, tensor<32x32xf32>) -> tensor<32x32xf32>
+    return %2, %4 : tensor<1xf32>, tensor<32x32xf32>
+  }
+}
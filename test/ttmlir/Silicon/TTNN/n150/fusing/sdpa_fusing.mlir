@@ -0,0 +1,50 @@
+// RUN: ttmlir-opt --ttir-to-ttnn-backend-pipeline="system-desc-path=%system_desc_path% enable-fusing-pass=true" %s > %t.mlir
+// RUN: FileCheck %s --input-file=%t.mlir
+// RUN: ttmlir-translate --ttnn-to-flatbuffer %t.mlir > %t.ttnn
+
+module {
+  // CHECK-LABEL: func.func @sdpa_fusion_gqa
+  func.func @sdpa_fusion_gqa(%arg0: tensor<1x8x32x64xbf16>, %arg1: tensor<1x2x32x64xbf16>, %arg2: tensor<1x2x32x64xbf16>, %arg3: tensor<1x1x32x32xbf16>) -> tensor<1x8x32x64xbf16> {
+    // CHECK-NOT: ttnn.repeat_interleave
+    // CHECK-NOT: ttnn.softmax
+    // CHECK: "ttnn.scaled_dot_product_attention"
+    // CHECK-NOT: ttnn.matmul
+    %0 = ttir.empty() : tensor<1x8x32x64xbf16>
+    %1 = "ttir.repeat_interleave"(%arg1, %0) <{dim = 1 : si32, repeats = 4 : ui32}> : (tensor<1x2x32x64xbf16>, tensor<1x8x32x64xbf16>) -> tensor<1x8x32x64xbf16>
+    %2 = ttir.empty() : tensor<1x8x32x64xbf16>
+    %3 = "ttir.repeat_interleave"(%arg2, %2) <{dim = 1 : si32, repeats = 4 : ui32}> : (tensor<1x2x32x64xbf16>, tensor<1x8x32x64xbf16>) -> tensor<1x8x32x64xbf16>
+    %4 = ttir.empty() : tensor<1x8x32x32xbf16>
+    %5 = "ttir.matmul"(%arg0, %1, %4) <{transpose_b = true}> : (tensor<1x8x32x64xbf16>, tensor<1x8x32x64xbf16>, tensor<1x8x32x32xbf16>) -> tensor<1x8x32x32xbf16>
+    %6 = "ttir.constant"() <{value = dense<1.250000e-01> : tensor<1x8x32x32xbf16>}> : () -> tensor<1x8x32x32xbf16>
+    %7 = ttir.empty() : tensor<1x8x32x32xbf16>
+    %8 = "ttir.multiply"(%5, %6, %7) : (tensor<1x8x32x32xbf16>, tensor<1x8x32x32xbf16>, tensor<1x8x32x32xbf16>) -> tensor<1x8x32x32xbf16>
+    %9 = ttir.empty() : tensor<1x8x32x32xbf16>
+    %10 = "ttir.add"(%8, %arg3, %9) : (tensor<1x8x32x32xbf16>, tensor<1x1x32x32xbf16>, tensor<1x8x32x32xbf16>) -> tensor<1x8x32x32xbf16>
+    %11 = ttir.empty() : tensor<1x8x32x32xbf16>
+    %12 = "ttir.softmax"(%10, %11) <{dimension = -1 : si32}> : (tensor<1x8x32x32xbf16>, tensor<1x8x32x32xbf16>) -> tensor<1x8x32x32xbf16>
+    %13 = ttir.empty() : tensor<1x8x32x64xbf16>
+    %14 = "ttir.matmul"(%12, %3, %13) : (tensor<1x8x32x32xbf16>, tensor<1x8x32x64xbf16>, tensor<1x8x32x64xbf16>) -> tensor<1x8x32x64xbf16>
+    return %14 : tensor<1x8x32x64xbf16>
+  }
+
+  // CHECK-LABEL: func.func @no_sdpa_fusion_f32
+  func.func @no_sdpa_fusion_f32(%arg0: tensor<1x4x64x32xf32>, %arg1: tensor<1x4x64x32xf32>, %arg2: tensor<1x4x64x32xf32>, %arg3: tensor<1x1x64x64xf32>) -> tensor<1x4x64x32xf32> {
+    // The flash attention kernel only takes bf16, f32 attention keeps its
+    // precision and runs unfused.
+    // CHECK-NOT: ttnn.scaled_dot_product_attention
+    // CHECK: ttnn.softmax
+    // CHECK-NOT: ttnn.scaled_dot_product_attention
+    %0 = ttir.empty() : tensor<1x4x64x64xf32>
+    %1 = "ttir.matmul"(%arg0, %arg1, %0) <{transpose_b = true}> : (tensor<1x4x64x32xf32>, tensor<1x4x64x32xf32>, tensor<1x4x64x64xf32>) -> tensor<1x4x64x64xf32>
+    %2 = "ttir.constant"() <{value = dense<0.176776692> : tensor<1x4x64x64xf32>}> : () -> tensor<1x4x64x64xf32>
+    %3 = ttir.empty() : tensor<1x4x64x64xf32>
+    %4 = "ttir.multiply"(%1, %2, %3) : (tensor<1x4x64x64xf32>, tensor<1x4x64x64xf32>, tensor<1x4x64x64xf32>) -> tensor<1x4x64x64xf32>
+    %5 = ttir.empty() : tensor<1x4x64x64xf32>
+    %6 = "ttir.add"(%4, %arg3, %5) : (tensor<1x4x64x64xf32>, tensor<1x1x64x64xf32>, tensor<1x4x64x64xf32>) -> tensor<1x4x64x64xf32>
+    %7 = ttir.empty() : tensor<1x4x64x64xf32>
+    %8 = "ttir.softmax"(%6, %7) <{dimension = -1 : si32}> : (tensor<1x4x64x64xf32>, tensor<1x4x64x64xf32>) -> tensor<1x4x64x64xf32>
+    %9 = ttir.empty() : tensor<1x4x64x32xf32>
+    %10 = "ttir.matmul"(%8, %arg2, %9) : (tensor<1x4x64x64xf32>, tensor<1x4x64x32xf32>, tensor<1x4x64x32xf32>) -> tensor<1x4x64x32xf32>
+    return %10 : tensor<1x4x64x32xf32>
+  }
+}
@@ -0,0 +1,13 @@
+// RUN: ttmlir-opt --ttir-to-ttnn-backend-pipeline="system-desc-path=%system_desc_path%" %s > %t.mlir
+// RUN: FileCheck %s --input-file=%t.mlir
+// RUN: ttmlir-translate --ttnn-to-flatbuffer %t.mlir > %t.ttnn
+module {
+  func.func @forward(%cache: tensor<128x8x32x64xbf16>, %input: tensor<1x4x8x64xbf16>, %update_index: tensor<4xi32>, %page_table: tensor<4x16xi32>, %query: tensor<1x4x32x64xbf16>, %value: tensor<128x8x32x64xbf16>) -> tensor<1x4x32x64xbf16> {
+    // CHECK: "ttnn.paged_update_cache"
+    %0 = "ttir.paged_update_cache"(%cache, %input, %update_index, %page_table) : (tensor<128x8x32x64xbf16>, tensor<1x4x8x64xbf16>, tensor<4xi32>, tensor<4x16xi32>) -> tensor<128x8x32x64xbf16>
+    %1 = ttir.empty() : tensor<1x4x32x64xbf16>
+    // CHECK: "ttnn.paged_scaled_dot_product_attention_decode"
+    %2 = "ttir.paged_scaled_dot_product_attention_decode"(%query, %0, %value, %page_table, %update_index, %1) : (tensor<1x4x32x64xbf16>, tensor<128x8x32x64xbf16>, tensor<128x8x32x64xbf16>, tensor<4x16xi32>, tensor<4xi32>, tensor<1x4x32x64xbf16>) -> tensor<1x4x32x64xbf16>
+    return %2 : tensor<1x4x32x64xbf16>
+  }
+}
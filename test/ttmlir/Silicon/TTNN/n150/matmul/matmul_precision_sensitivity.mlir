@@ -0,0 +1,19 @@
+// RUN: ttmlir-opt --ttir-to-ttnn-backend-pipeline="system-desc-path=%system_desc_path%" %s > %t.mlir
+// RUN: FileCheck %s --input-file=%t.mlir
+// RUN: ttmlir-translate --ttnn-to-flatbuffer %t.mlir > %t.ttnn
+
+// Run with ttrt run --precision-sensitivity by
+// runtime/test/python/ttnn/device_agnostic/test_precision_sensitivity.py.
+module {
+  // CHECK-LABEL: func.func @forward(
+  func.func @forward(%arg0: tensor<64x128xbf16>, %arg1: tensor<128x128xbf16>, %arg2: tensor<64x128xbf16>) -> tensor<64x64xbf16> {
+    // CHECK: "ttnn.matmul"
+    // CHECK: "ttnn.matmul"
+    // CHECK-SAME: transpose_b = true
+    %0 = ttir.empty() : tensor<64x128xbf16>
+    %1 = "ttir.matmul"(%arg0, %arg1, %0) : (tensor<64x128xbf16>, tensor<128x128xbf16>, tensor<64x128xbf16>) -> tensor<64x128xbf16> loc("matmul_0")
+    %2 = ttir.empty() : tensor<64x64xbf16>
+    %3 = "ttir.matmul"(%1, %arg2, %2) <{transpose_b = true}> : (tensor<64x128xbf16>, tensor<64x128xbf16>, tensor<64x64xbf16>) -> tensor<64x64xbf16> loc("matmul_1")
+    return %3 : tensor<64x64xbf16>
+  }
+}
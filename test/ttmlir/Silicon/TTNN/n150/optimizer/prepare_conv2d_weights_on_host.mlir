@@ -0,0 +1,113 @@
+// REQUIRES: opmodel
+// RUN: ttmlir-opt --ttir-to-ttnn-backend-pipeline="system-desc-path=%system_desc_path% enable-optimizer=true prepare-conv2d-weights-on-host=true override-conv2d-config=conv2d_1x1_host=shard_layout#height_sharded,conv2d_1x1_device=shard_layout#height_sharded,conv2d_3x3_host=shard_layout#height_sharded,conv2d_3x3_device=shard_layout#height_sharded,conv2d_grouped=shard_layout#height_sharded" %s -o %t.mlir
+// RUN: FileCheck %s --input-file=%t.mlir
+// RUN: ttmlir-translate --ttnn-to-flatbuffer %t.mlir > %t.ttnn
+
+// Constant weights of height sharded convolutions are stored prepared in the
+// binary, the runtime doesn't prepare them. Every such function has a twin
+// taking the same weights as an argument, which ttnn prepares on the device,
+// so that the ttrt test test_conv2d_weights_on_host.py can compare the host
+// prepared weights against ttnn::prepare_conv_weights.
+// Weights hold ((k % 16) - 8) / 8 at flat OIHW index k.
+
+// CHECK-LABEL: func.func @conv2d_1x1_on_host(
+func.func @conv2d_1x1_on_host(%arg0: tensor<1x8x8x2xbf16>) -> tensor<1x8x8x4xbf16> {
+    // CHECK-NOT: "ttnn.prepare_conv2d_weights"
+    // CHECK: = "ttnn.conv2d"
+    // CHECK-SAME: shard_layout = height_sharded
+    %weight = "ttir.constant"() <{value = dense<[[[[-1.0]], [[-0.875]]], [[[-0.75]], [[-0.625]]], [[[-0.5]], [[-0.375]]], [[[-0.25]], [[-0.125]]]]> : tensor<4x2x1x1xbf16>}> : () -> tensor<4x2x1x1xbf16>
+    %0 = ttir.empty() : tensor<1x8x8x4xbf16>
+    %1 = "ttir.conv2d"(%arg0, %weight, %0)
+            <{
+                stride = 1: i32,
+                padding = 0: i32,
+                dilation = 1: i32,
+                groups = 1: i32
+            }> : (tensor<1x8x8x2xbf16>, tensor<4x2x1x1xbf16>, tensor<1x8x8x4xbf16>) -> tensor<1x8x8x4xbf16> loc("conv2d_1x1_host")
+    return %1 : tensor<1x8x8x4xbf16>
+}
+
+// CHECK-LABEL: func.func @conv2d_1x1_on_device(
+func.func @conv2d_1x1_on_device(%arg0: tensor<1x8x8x2xbf16>, %weight: tensor<4x2x1x1xbf16>) -> tensor<1x8x8x4xbf16> {
+    // CHECK: "ttnn.prepare_conv2d_weights"
+    // CHECK: = "ttnn.conv2d"
+    // CHECK-SAME: shard_layout = height_sharded
+    %0 = ttir.empty() : tensor<1x8x8x4xbf16>
+    %1 = "ttir.conv2d"(%arg0, %weight, %0)
+            <{
+                stride = 1: i32,
+                padding = 0: i32,
+                dilation = 1: i32,
+                groups = 1: i32
+            }> : (tensor<1x8x8x2xbf16>, tensor<4x2x1x1xbf16>, tensor<1x8x8x4xbf16>) -> tensor<1x8x8x4xbf16> loc("conv2d_1x1_device")
+    return %1 : tensor<1x8x8x4xbf16>
+}
+
+// CHECK-LABEL: func.func @conv2d_3x3_on_host(
+func.func @conv2d_3x3_on_host(%arg0: tensor<1x8x8x2xbf16>) -> tensor<1x8x8x4xbf16> {
+    // CHECK-NOT: "ttnn.prepare_conv2d_weights"
+    // CHECK: = "ttnn.conv2d"
+    // CHECK-SAME: shard_layout = height_sharded
+    %weight = "ttir.constant"() <{value = dense<[[[[-1.0, -0.875, -0.75], [-0.625, -0.5, -0.375], [-0.25, -0.125, 0.0]], [[0.125, 0.25, 0.375], [0.5, 0.625, 0.75], [0.875, -1.0, -0.875]]], [[[-0.75, -0.625, -0.5], [-0.375, -0.25, -0.125], [0.0, 0.125, 0.25]], [[0.375, 0.5, 0.625], [0.75, 0.875, -1.0], [-0.875, -0.75, -0.625]]], [[[-0.5, -0.375, -0.25], [-0.125, 0.0, 0.125], [0.25, 0.375, 0.5]], [[0.625, 0.75, 0.875], [-1.0, -0.875, -0.75], [-0.625, -0.5, -0.375]]], [[[-0.25, -0.125, 0.0], [0.125, 0.25, 0.375], [0.5, 0.625, 0.75]], [[0.875, -1.0, -0.875], [-0.75, -0.625, -0.5], [-0.375, -0.25, -0.125]]]]> : tensor<4x2x3x3xbf16>}> : () -> tensor<4x2x3x3xbf16>
+    %0 = ttir.empty() : tensor<1x8x8x4xbf16>
+    %1 = "ttir.conv2d"(%arg0, %weight, %0)
+            <{
+                stride = 1: i32,
+                padding = 1: i32,
+                dilation = 1: i32,
+                groups = 1: i32
+            }> : (tensor<1x8x8x2xbf16>, tensor<4x2x3x3xbf16>, tensor<1x8x8x4xbf16>) -> tensor<1x8x8x4xbf16> loc("conv2d_3x3_host")
+    return %1 : tensor<1x8x8x4xbf16>
+}
+
+// CHECK-LABEL: func.func @conv2d_3x3_on_device(
+func.func @conv2d_3x3_on_device(%arg0: tensor<1x8x8x2xbf16>, %weight: tensor<4x2x3x3xbf16>) -> tensor<1x8x8x4xbf16> {
+    // CHECK: "ttnn.prepare_conv2d_weights"
+    // CHECK: = "ttnn.conv2d"
+    // CHECK-SAME: shard_layout = height_sharded
+    %0 = ttir.empty() : tensor<1x8x8x4xbf16>
+    %1 = "ttir.conv2d"(%arg0, %weight, %0)
+            <{
+                stride = 1: i32,
+                padding = 1: i32,
+                dilation = 1: i32,
+                groups = 1: i32
+            }> : (tensor<1x8x8x2xbf16>, tensor<4x2x3x3xbf16>, tensor<1x8x8x4xbf16>) -> tensor<1x8x8x4xbf16> loc("conv2d_3x3_device")
+    return %1 : tensor<1x8x8x4xbf16>
+}
+
+// Grouped convolutions interleave the weight matrix, their weights are
+// prepared on the device even with height sharding.
+// CHECK-LABEL: func.func @conv2d_grouped(
+func.func @conv2d_grouped(%arg0: tensor<1x8x8x2xbf16>) -> tensor<1x8x8x4xbf16> {
+    // CHECK: "ttnn.prepare_conv2d_weights"
+    // CHECK: = "ttnn.conv2d"
+    %weight = "ttir.constant"() <{value = dense<[[[[-1.0, -0.875, -0.75], [-0.625, -0.5, -0.375], [-0.25, -0.125, 0.0]]], [[[0.125, 0.25, 0.375], [0.5, 0.625, 0.75], [0.875, -1.0, -0.875]]], [[[-0.75, -0.625, -0.5], [-0.375, -0.25, -0.125], [0.0, 0.125, 0.25]]], [[[0.375, 0.5, 0.625], [0.75, 0.875, -1.0], [-0.875, -0.75, -0.625]]]]> : tensor<4x1x3x3xbf16>}> : () -> tensor<4x1x3x3xbf16>
+    %0 = ttir.empty() : tensor<1x8x8x4xbf16>
+    %1 = "ttir.conv2d"(%arg0, %weight, %0)
+            <{
+                stride = 1: i32,
+                padding = 1: i32,
+                dilation = 1: i32,
+                groups = 2: i32
+            }> : (tensor<1x8x8x2xbf16>, tensor<4x1x3x3xbf16>, tensor<1x8x8x4xbf16>) -> tensor<1x8x8x4xbf16> loc("conv2d_grouped")
+    return %1 : tensor<1x8x8x4xbf16>
+}
+
+// Without an explicit shard layout ttnn picks one at runtime, so the weights
+// are prepared on the device.
+// CHECK-LABEL: func.func @prepare_conv2d_weights_on_device(
+func.func @prepare_conv2d_weights_on_device(%arg0: tensor<1x8x8x2xbf16>) -> tensor<1x8x8x4xbf16> {
+    // CHECK: "ttnn.prepare_conv2d_weights"
+    // CHECK: = "ttnn.conv2d"
+    %weight = "ttir.constant"() <{value = dense<[[[[-1.0]], [[-0.875]]], [[[-0.75]], [[-0.625]]], [[[-0.5]], [[-0.375]]], [[[-0.25]], [[-0.125]]]]> : tensor<4x2x1x1xbf16>}> : () -> tensor<4x2x1x1xbf16>
+    %0 = ttir.empty() : tensor<1x8x8x4xbf16>
+    %1 = "ttir.conv2d"(%arg0, %weight, %0)
+            <{
+                stride = 1: i32,
+                padding = 0: i32,
+                dilation = 1: i32,
+                groups = 1: i32
+            }> : (tensor<1x8x8x2xbf16>, tensor<4x2x1x1xbf16>, tensor<1x8x8x4xbf16>) -> tensor<1x8x8x4xbf16>
+    return %1 : tensor<1x8x8x4xbf16>
+}
@@ -0,0 +1,36 @@
+// RUN: ttmlir-opt --ttir-to-ttnn-backend-pipeline="system-desc-path=%system_desc_path%" %s > %t.mlir
+// RUN: FileCheck %s --input-file=%t.mlir
+// RUN: ttmlir-translate --ttnn-to-flatbuffer %t.mlir > %t.serial.ttnn
+// RUN: ttmlir-translate --ttnn-to-flatbuffer --ttnn-parallel-serialization %t.mlir > %t.ttnn
+// RUN: ttmlir-translate --ttnn-to-flatbuffer --ttnn-parallel-serialization --ttnn-debug-info=false %t.mlir > %t.nodebug.ttnn
+
+// Programs serialized by different workers share a constant. The parallel
+// binaries are compared with the serial one and executed by
+// runtime/test/python/ttnn/device_agnostic/test_parallel_serialization.py.
+module @parallel_serialization attributes {} {
+  func.func @add(%arg0: tensor<64x128xf32>, %arg1: tensor<64x128xf32>) -> tensor<64x128xf32> {
+    // CHECK-LABEL: func.func @add
+    // CHECK: "ttnn.add"
+    %0 = ttir.empty() : tensor<64x128xf32>
+    %1 = "ttir.add"(%arg0, %arg1, %0) : (tensor<64x128xf32>, tensor<64x128xf32>, tensor<64x128xf32>) -> tensor<64x128xf32>
+    return %1 : tensor<64x128xf32>
+  }
+
+  func.func @multiply_constant(%arg0: tensor<4x2xf32>) -> tensor<4x2xf32> {
+    // CHECK-LABEL: func.func @multiply_constant
+    // CHECK: "ttnn.constant"
+    %0 = "ttir.constant"() <{value = dense<[[0.5, -1.5], [2.5, -3.5], [4.5, -5.5], [6.5, -7.5]]> : tensor<4x2xf32>}> : () -> tensor<4x2xf32>
+    %1 = ttir.empty() : tensor<4x2xf32>
+    %2 = "ttir.multiply"(%arg0, %0, %1) : (tensor<4x2xf32>, tensor<4x2xf32>, tensor<4x2xf32>) -> tensor<4x2xf32>
+    return %2 : tensor<4x2xf32>
+  }
+
+  func.func @subtract_constant(%arg0: tensor<4x2xf32>) -> tensor<4x2xf32> {
+    // CHECK-LABEL: func.func @subtract_constant
+    // CHECK: "ttnn.constant"
+    %0 = "ttir.constant"() <{value = dense<[[0.5, -1.5], [2.5, -3.5], [4.5, -5.5], [6.5, -7.5]]> : tensor<4x2xf32>}> : () -> tensor<4x2xf32>
+    %1 = ttir.empty() : tensor<4x2xf32>
+    %2 = "ttir.subtract"(%arg0, %0, %1) : (tensor<4x2xf32>, tensor<4x2xf32>, tensor<4x2xf32>) -> tensor<4x2xf32>
+    return %2 : tensor<4x2xf32>
+  }
+}
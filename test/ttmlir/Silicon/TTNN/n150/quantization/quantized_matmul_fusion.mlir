@@ -0,0 +1,27 @@
+// RUN: ttmlir-opt --ttir-to-ttnn-backend-pipeline="system-desc-path=%system_desc_path% enable-quantized-domain-fusion=true" %s > %t.mlir
+// RUN: FileCheck %s --input-file=%t.mlir
+// RUN: ttmlir-translate --ttnn-to-flatbuffer %t.mlir > %t.ttnn
+
+// Runs the integer matmul and requantize epilogue produced by the quantized
+// domain fusion on device.
+module {
+  func.func @matmul_qdq(%arg0: tensor<64x128x!quant.uniform<i8:f32, 5.000000e-01>>, %arg1: tensor<128x64x!quant.uniform<i8:f32, 2.500000e-01>>) -> tensor<64x64x!quant.uniform<i8:f32, 1.000000e+00>> {
+    // CHECK-LABEL: func.func @matmul_qdq(
+    // CHECK-NOT: "ttnn.dequantize"
+    // CHECK: %[[MATMUL:[0-9]+]] = "ttnn.matmul"(%arg0, %arg1)
+    // CHECK-SAME: -> tensor<64x64x!quant.uniform<i32:f32, 1.250000e-01>
+    // CHECK: "ttnn.requantize"(%[[MATMUL]])
+    // CHECK-SAME: out_scale = 1.000000e+00 : f32
+    // CHECK-SAME: -> tensor<64x64x!quant.uniform<i32:f32, 1.000000e+00>
+    // CHECK-NOT: "ttnn.quantize"
+    %0 = ttir.empty() : tensor<64x128xf32>
+    %1 = "ttir.dequantize"(%arg0, %0) : (tensor<64x128x!quant.uniform<i8:f32, 5.000000e-01>>, tensor<64x128xf32>) -> tensor<64x128xf32>
+    %2 = ttir.empty() : tensor<128x64xf32>
+    %3 = "ttir.dequantize"(%arg1, %2) : (tensor<128x64x!quant.uniform<i8:f32, 2.500000e-01>>, tensor<128x64xf32>) -> tensor<128x64xf32>
+    %4 = ttir.empty() : tensor<64x64xf32>
+    %5 = "ttir.matmul"(%1, %3, %4) : (tensor<64x128xf32>, tensor<128x64xf32>, tensor<64x64xf32>) -> tensor<64x64xf32>
+    %6 = ttir.empty() : tensor<64x64x!quant.uniform<i8:f32, 1.000000e+00>>
+    %7 = "ttir.quantize"(%5, %6) : (tensor<64x64xf32>, tensor<64x64x!quant.uniform<i8:f32, 1.000000e+00>>) -> tensor<64x64x!quant.uniform<i8:f32, 1.000000e+00>>
+    return %7 : tensor<64x64x!quant.uniform<i8:f32, 1.000000e+00>>
+  }
+}
@@ -0,0 +1,20 @@
+// RUN: ttmlir-opt --ttir-to-ttnn-backend-pipeline="system-desc-path=%system_desc_path%" %s > %t.mlir
+// RUN: FileCheck %s --input-file=%t.mlir
+// RUN: ttmlir-translate --ttnn-to-flatbuffer --ttnn-split-debug-info=%t.ttnndbg %t.mlir > %t.ttnn
+// RUN: test -s %t.ttnndbg
+// RUN: sed -e 's/@split_debug_info/@split_debug_info_other/' %t.mlir > %t.other.mlir
+// RUN: ttmlir-translate --ttnn-to-flatbuffer --ttnn-split-debug-info=%t.other.ttnndbg %t.other.mlir > %t.other.ttnn
+
+// The binary refers to its debug info, which is written to its own file. The
+// debug info of the renamed module hashes differently and must not be used
+// for this binary. Both are loaded by
+// runtime/test/python/ttnn/device_agnostic/test_split_debug_info.py.
+module @split_debug_info attributes {} {
+  func.func @add(%arg0: tensor<64x128xf32>, %arg1: tensor<64x128xf32>) -> tensor<64x128xf32> {
+    // CHECK-LABEL: func.func @add
+    // CHECK: "ttnn.add"
+    %0 = ttir.empty() : tensor<64x128xf32>
+    %1 = "ttir.add"(%arg0, %arg1, %0) : (tensor<64x128xf32>, tensor<64x128xf32>, tensor<64x128xf32>) -> tensor<64x128xf32>
+    return %1 : tensor<64x128xf32>
+  }
+}
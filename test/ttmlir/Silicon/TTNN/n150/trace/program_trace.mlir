@@ -0,0 +1,39 @@
+// RUN: ttmlir-opt --ttir-to-ttnn-backend-pipeline="system-desc-path=%system_desc_path%" %s > %t.mlir
+// RUN: FileCheck %s --input-file=%t.mlir
+// RUN: ttmlir-translate --ttnn-to-flatbuffer %t.mlir > %t.ttnn
+
+// Executed with program trace enabled by
+// runtime/test/python/ttnn/device_agnostic/test_program_trace.py. Both
+// programs run only device ops and are traced. The inputs are deallocated after
+// their last use, which leaves the retained inputs of a trace alone, and
+// @add_multiply also deallocates an intermediate, whose buffer the trace keeps.
+module {
+  // CHECK-LABEL: func.func @add(
+  func.func @add(%arg0: tensor<64x128xbf16>, %arg1: tensor<64x128xbf16>) -> tensor<64x128xbf16> {
+    // CHECK-NOT: "ttnn.from_device"
+    // CHECK: %[[ADD:[0-9]+]] = "ttnn.add"(%arg0, %arg1)
+    // CHECK-DAG: "ttnn.deallocate"(%arg0) <{force = false}>
+    // CHECK-DAG: "ttnn.deallocate"(%arg1) <{force = false}>
+    // CHECK-NOT: "ttnn.from_device"
+    // CHECK: return %[[ADD]]
+    %0 = ttir.empty() : tensor<64x128xbf16>
+    %1 = "ttir.add"(%arg0, %arg1, %0) : (tensor<64x128xbf16>, tensor<64x128xbf16>, tensor<64x128xbf16>) -> tensor<64x128xbf16>
+    return %1 : tensor<64x128xbf16>
+  }
+
+  // CHECK-LABEL: func.func @add_multiply(
+  func.func @add_multiply(%arg0: tensor<64x128xbf16>, %arg1: tensor<64x128xbf16>) -> tensor<64x128xbf16> {
+    // CHECK-NOT: "ttnn.from_device"
+    // CHECK: %[[ADD:[0-9]+]] = "ttnn.add"
+    // CHECK: "ttnn.multiply"(%[[ADD]], %arg1)
+    // CHECK-DAG: "ttnn.deallocate"(%[[ADD]]) <{force = false}>
+    // CHECK-DAG: "ttnn.deallocate"(%arg1) <{force = false}>
+    // CHECK-NOT: "ttnn.from_device"
+    // CHECK: return
+    %0 = ttir.empty() : tensor<64x128xbf16>
+    %1 = "ttir.add"(%arg0, %arg1, %0) : (tensor<64x128xbf16>, tensor<64x128xbf16>, tensor<64x128xbf16>) -> tensor<64x128xbf16>
+    %2 = ttir.empty() : tensor<64x128xbf16>
+    %3 = "ttir.multiply"(%1, %arg1, %2) : (tensor<64x128xbf16>, tensor<64x128xbf16>, tensor<64x128xbf16>) -> tensor<64x128xbf16>
+    return %3 : tensor<64x128xbf16>
+  }
+}
@@ -0,0 +1,107 @@
+// SPDX-FileCopyrightText: (c) 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "ttmlir/Dialect/TTNN/Utils/Conv2dWeights.h"
+
+#include "llvm/ADT/APFloat.h"
+#include "llvm/ADT/STLExtras.h"
+#include "gtest/gtest.h"
+
+#include <numeric>
+
+namespace mlir::tt::ttnn::utils {
+
+// 2x3x2x2 OIHW weights holding 1..24, laid out for a tiled, height sharded
+// input the way the pass calls the helper: in channels padded to the tile
+// width, rows padded to a multiple of the tile height and out channels padded
+// to the tile width, which gives a [128, 32] weight matrix. Rows are
+// (kh, kw, in channel), columns are out channels. These tests pin the helper's
+// indexing, the match with ttnn::prepare_conv_weights is checked on device by
+// the ttrt test test_conv2d_weights_on_host.py.
+static const int64_t kWeightShape[] = {2, 3, 2, 2};
+static constexpr int64_t kPaddedInChannels = 32;
+static constexpr int64_t kRows = 128;
+static constexpr int64_t kCols = 32;
+
+struct MatrixEntry {
+  int64_t row;
+  int64_t col;
+  // 1-based index of the source weight.
+  size_t source;
+};
+
+// Non zero entries of the weight matrix, every other entry is padding.
+static const MatrixEntry kPreparedWeights[] = {
+    {0, 0, 1},   {0, 1, 13},  {1, 0, 5},   {1, 1, 17},  {2, 0, 9},
+    {2, 1, 21},  {32, 0, 2},  {32, 1, 14}, {33, 0, 6},  {33, 1, 18},
+    {34, 0, 10}, {34, 1, 22}, {64, 0, 3},  {64, 1, 15}, {65, 0, 7},
+    {65, 1, 19}, {66, 0, 11}, {66, 1, 23}, {96, 0, 4},  {96, 1, 16},
+    {97, 0, 8},  {97, 1, 20}, {98, 0, 12}, {98, 1, 24},
+};
+
+// Returns the 1-based source weight index of every matrix entry, 0 for
+// padding.
+static llvm::SmallVector<size_t> getExpectedSources(int64_t rows) {
+  llvm::SmallVector<size_t> sources(rows * kCols, 0);
+  for (const MatrixEntry &entry : kPreparedWeights) {
+    sources[entry.row * kCols + entry.col] = entry.source;
+  }
+  return sources;
+}
+
+TEST(Conv2dWeightsTest, MatchesDeviceLayout) {
+  llvm::SmallVector<float> weights(24);
+  std::iota(weights.begin(), weights.end(), 1.0f);
+
+  llvm::SmallVector<float> matrix = reorderConv2dWeightsToMatrix<float>(
+      weights, kWeightShape, kPaddedInChannels, kRows, kCols, /*zero=*/0.0f);
+
+  llvm::SmallVector<size_t> expected = getExpectedSources(kRows);
+  ASSERT_EQ(matrix.size(), expected.size());
+  for (size_t i = 0; i < matrix.size(); ++i) {
+    EXPECT_EQ(matrix[i], static_cast<float>(expected[i])) << "at index " << i;
+  }
+}
+
+TEST(Conv2dWeightsTest, PadsRows) {
+  llvm::SmallVector<float> weights(24);
+  std::iota(weights.begin(), weights.end(), 1.0f);
+
+  // Rows past KH * KW * paddedInChannels are zero.
+  constexpr int64_t rows = kRows + 32;
+  llvm::SmallVector<float> matrix = reorderConv2dWeightsToMatrix<float>(
+      weights, kWeightShape, kPaddedInChannels, rows, kCols, /*zero=*/0.0f);
+
+  llvm::SmallVector<size_t> expected = getExpectedSources(rows);
+  ASSERT_EQ(matrix.size(), expected.size());
+  for (size_t i = 0; i < matrix.size(); ++i) {
+    EXPECT_EQ(matrix[i], static_cast<float>(expected[i])) << "at index " << i;
+  }
+}
+
+// The pass reorders APFloat values, make sure the bits are carried over as is.
+TEST(Conv2dWeightsTest, BitExactBFloat16) {
+  const llvm::fltSemantics &semantics = llvm::APFloat::BFloat();
+  llvm::SmallVector<llvm::APFloat> weights;
+  for (uint16_t bits = 0x3f81; weights.size() < 24; bits += 7) {
+    weights.emplace_back(semantics, llvm::APInt(16, bits));
+  }
+
+  llvm::SmallVector<llvm::APFloat> matrix =
+      reorderConv2dWeightsToMatrix<llvm::APFloat>(
+          weights, kWeightShape, kPaddedInChannels, kRows, kCols,
+          llvm::APFloat::getZero(semantics));
+
+  llvm::SmallVector<size_t> expected = getExpectedSources(kRows);
+  ASSERT_EQ(matrix.size(), expected.size());
+  for (size_t i = 0; i < matrix.size(); ++i) {
+    const size_t source = expected[i];
+    const uint64_t expectedBits =
+        source ? weights[source - 1].bitcastToAPInt().getZExtValue() : 0;
+    EXPECT_EQ(matrix[i].bitcastToAPInt().getZExtValue(), expectedBits)
+        << "at index " << i;
+  }
+}
+
+} // namespace mlir::tt::ttnn::utils
@@ -776,6 +776,14 @@ class TTIRBuilder:
             torch.nn.functional.gelu, ttir.GeluOp, [in0], unit_attrs
         )
 
+    def silu(self, in0: Operand, unit_attrs: List[str] = None) -> OpView:
+        return self.eltwise_proxy(
+            torch.nn.functional.silu, ttir.SiluOp, [in0], unit_attrs
+        )
+
+    def erf(self, in0: Operand, unit_attrs: List[str] = None) -> OpView:
+        return self.eltwise_proxy(torch.erf, ttir.ErfOp, [in0], unit_attrs)
+
     def is_finite(self, in0: Operand, unit_attrs: List[str] = None) -> OpView:
         return self.eltwise_proxy(torch.isfinite, ttir.IsFiniteOp, [in0], unit_attrs)
 
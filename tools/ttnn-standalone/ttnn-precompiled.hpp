@@ -29,6 +29,8 @@
 #include "operations/embedding_backward/embedding_backward.hpp"
 #include "operations/matmul/matmul.hpp"
 #include "operations/moreh/moreh_cumsum/moreh_cumsum.hpp"
+#include "operations/normalization/layernorm/layernorm.hpp"
+#include "operations/normalization/rmsnorm/rmsnorm.hpp"
 #include "operations/normalization/softmax/softmax.hpp"
 #include "operations/pool/generic/generic_pools.hpp"
 #include "operations/pool/upsample/upsample.hpp"
@@ -47,6 +49,7 @@
 
 #include <cassert>
 #include <cstddef>
+#include <functional>
 #include <iostream>
 #include <vector>
 
@@ -86,6 +89,99 @@ void constEvalFuncWrapper(
   }
 }
 
+// ConstEvalCache class
+//
+// Results of a const-eval function, together with the inputs they were
+// computed from. The results are recomputed if any of the inputs is a
+// different tensor than before, e.g. when the weights of the model are
+// replaced.
+//
+class ConstEvalCache {
+public:
+  void update(const std::function<std::vector<ttnn::Tensor>(
+                  std::vector<ttnn::Tensor>)> &constEvalFunc,
+              const std::vector<ttnn::Tensor> &inputs) {
+    if (!outputs.empty() && isComputedFrom(inputs)) {
+      return;
+    }
+    outputs = constEvalFunc(inputs);
+    this->inputs = inputs;
+  }
+
+  const ttnn::Tensor &getOutput(std::size_t index) const {
+    assert(index < outputs.size() && "Const-eval output index out of range");
+    return outputs[index];
+  }
+
+private:
+  // Copies of the inputs share their attributes with the tensors they were
+  // copied from, which also keeps the attributes from being reused by new
+  // tensors while cached.
+  bool isComputedFrom(const std::vector<ttnn::Tensor> &newInputs) const {
+    if (newInputs.size() != inputs.size()) {
+      return false;
+    }
+    for (std::size_t i = 0; i < inputs.size(); ++i) {
+      if (newInputs[i].tensor_attributes != inputs[i].tensor_attributes) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  std::vector<ttnn::Tensor> inputs;
+  std::vector<ttnn::Tensor> outputs;
+};
+
+// ModelState class
+//
+// State that a model emitted in optimized mode keeps between calls: the
+// device it last ran on and a cache for each of its const-eval functions.
+// Cached results live on the device, so all caches are dropped when the model
+// runs on another device.
+//
+class ModelState {
+public:
+  ConstEvalCache &getConstEvalCache(std::size_t slot) {
+    if (slot >= constEvalCaches.size()) {
+      constEvalCaches.resize(slot + 1);
+    }
+    return constEvalCaches[slot];
+  }
+
+  // Functions that don't take a device pass nullptr, which keeps the current
+  // device.
+  void setDevice(ttnn::MeshDevice *newDevice) {
+    if (newDevice && newDevice != device) {
+      constEvalCaches.clear();
+      device = newDevice;
+    }
+  }
+
+private:
+  ttnn::MeshDevice *device = nullptr;
+  std::vector<ConstEvalCache> constEvalCaches;
+};
+
+// Const-eval wrapper used by optimized EmitC output. Results of the function
+// are cached in `slot` of `state`, and recomputed only if the inputs or the
+// device change.
+void constEvalFuncWrapper(
+    const std::function<std::vector<ttnn::Tensor>(std::vector<ttnn::Tensor>)>
+        &constEvalFunc,
+    const std::vector<ttnn::Tensor> &inputs, ModelState *state,
+    std::size_t slot, ttnn::MeshDevice *device) {
+  state->setDevice(device);
+  state->getConstEvalCache(slot).update(constEvalFunc, inputs);
+}
+
+// Returns output `index` of the const-eval function cached in `slot` of
+// `state`, without copying the rest of the outputs.
+ttnn::Tensor getConstEvalResult(ModelState *state, std::size_t slot,
+                                std::size_t index) {
+  return state->getConstEvalCache(slot).getOutput(index);
+}
+
 } // namespace ttnn
 
 #endif // TOOLS_TTNN_STANDALONE_TTNN_PRECOMPILED_HPP